@@ -0,0 +1,167 @@
+/**
+ * @file Arduino.cpp
+ * @brief ホストテスト用のArduino APIの実装
+ */
+
+#include "Arduino.h"
+#include <cctype>
+#include <chrono>
+
+// ========================================
+// String
+// ========================================
+
+std::string String::formatSigned(long long number, unsigned char base) {
+    if (base == DEC) {
+        return std::to_string(number);
+    }
+    // ESP32コアと同様に10進以外は符号なしとして変換する
+    return formatUnsigned((unsigned long long)number, base);
+}
+
+std::string String::formatUnsigned(unsigned long long number, unsigned char base) {
+    if (base < 2 || base > 36) {
+        base = DEC;
+    }
+    std::string digits;
+    do {
+        int digit = (int)(number % base);
+        digits.insert(digits.begin(), (char)(digit < 10 ? '0' + digit : 'a' + digit - 10));
+        number /= base;
+    } while (number != 0);
+    return digits;
+}
+
+std::string String::formatFloat(double number, unsigned int decimalPlaces) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimalPlaces, number);
+    return buffer;
+}
+
+void String::trim() {
+    size_t begin = 0;
+    while (begin < value.size() && isspace((unsigned char)value[begin])) {
+        begin++;
+    }
+    size_t end = value.size();
+    while (end > begin && isspace((unsigned char)value[end - 1])) {
+        end--;
+    }
+    value = value.substr(begin, end - begin);
+}
+
+void String::toLowerCase() {
+    for (char &c : value) {
+        c = (char)tolower((unsigned char)c);
+    }
+}
+
+void String::toUpperCase() {
+    for (char &c : value) {
+        c = (char)toupper((unsigned char)c);
+    }
+}
+
+void String::replace(const String &from, const String &to) {
+    if (from.value.empty()) {
+        return;
+    }
+    size_t position = 0;
+    while ((position = value.find(from.value, position)) != std::string::npos) {
+        value.replace(position, from.value.size(), to.value);
+        position += to.value.size();
+    }
+}
+
+// ========================================
+// 時刻
+// ========================================
+
+static uint64_t hostMicros = 0;
+
+unsigned long millis() {
+    return (unsigned long)(uint32_t)(hostMicros / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)(uint32_t)hostMicros;
+}
+
+void delay(unsigned long ms) {
+    hostMicros += (uint64_t)ms * 1000;
+}
+
+void hostSetMicros(uint64_t us) {
+    hostMicros = us;
+}
+
+void hostAdvanceMillis(unsigned long ms) {
+    hostMicros += (uint64_t)ms * 1000;
+}
+
+// ========================================
+// ESP
+// ========================================
+
+EspClass ESP;
+
+uint32_t EspClass::getFreeHeap() {
+    return 200000;  // 起動直後の実機と同程度（低メモリ時の縮退処理は発生させない）
+}
+
+uint32_t EspClass::getCycleCount() {
+    // ホストのCPUサイクルではなく、実時間を240MHz換算したサイクル数を返す
+    using namespace std::chrono;
+    uint64_t ns = (uint64_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    return (uint32_t)(ns * 240 / 1000);
+}
+
+bool psramFound() {
+    return false;  // M5Stack Core（PSRAMなし）
+}
+
+// ========================================
+// FreeRTOS
+// ========================================
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)millis();
+}
+
+void vTaskDelay(TickType_t ticks) {
+    (void)ticks;
+}
+
+void vTaskDelayUntil(TickType_t *previousWakeTime, TickType_t increment) {
+    *previousWakeTime += increment;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameter,
+                                   unsigned int priority, TaskHandle_t *handle, BaseType_t core) {
+    (void)task;
+    (void)name;
+    (void)stackDepth;
+    (void)parameter;
+    (void)priority;
+    (void)core;
+    if (handle != nullptr) {
+        *handle = nullptr;
+    }
+    return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    static int mutex;
+    return &mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    (void)semaphore;
+    (void)ticks;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    (void)semaphore;
+    return pdTRUE;
+}
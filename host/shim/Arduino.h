@@ -0,0 +1,216 @@
+/**
+ * @file Arduino.h
+ * @brief ホストテスト用のArduino API（ESP32コアのうちsrc/で使う部分のみ）
+ * @details String・時刻・ESPクラス・FreeRTOSの最小限の実装。millis()/micros()はテストが進める仮想時刻を返し、
+ *          タスクの生成は成功を返すのみで実行しない（テストが処理を直接呼び出す）
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/time.h>
+#include <time.h>
+#include <type_traits>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+#define PI 3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+// ========================================
+// String
+// ========================================
+
+class String {
+public:
+    String() {}
+    String(const char *text) : value(text != nullptr ? text : "") {}
+    String(const std::string &text) : value(text) {}
+    explicit String(char c) : value(1, c) {}
+    String(int number, unsigned char base = DEC) : value(formatSigned(number, base)) {}
+    String(long number, unsigned char base = DEC) : value(formatSigned(number, base)) {}
+    String(long long number, unsigned char base = DEC) : value(formatSigned(number, base)) {}
+    String(unsigned int number, unsigned char base = DEC) : value(formatUnsigned(number, base)) {}
+    String(unsigned long number, unsigned char base = DEC) : value(formatUnsigned(number, base)) {}
+    String(unsigned long long number, unsigned char base = DEC) : value(formatUnsigned(number, base)) {}
+    String(unsigned char number, unsigned char base = DEC) : value(formatUnsigned(number, base)) {}
+    String(float number, unsigned int decimalPlaces = 2) : value(formatFloat(number, decimalPlaces)) {}
+    String(double number, unsigned int decimalPlaces = 2) : value(formatFloat(number, decimalPlaces)) {}
+
+    const char *c_str() const { return value.c_str(); }
+    unsigned int length() const { return (unsigned int)value.size(); }
+    bool isEmpty() const { return value.empty(); }
+    void reserve(unsigned int size) { value.reserve(size); }
+
+    char charAt(unsigned int index) const { return index < value.size() ? value[index] : '\0'; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char &operator[](unsigned int index) { return value[index]; }
+    void setCharAt(unsigned int index, char c) {
+        if (index < value.size()) {
+            value[index] = c;
+        }
+    }
+
+    int indexOf(char c, unsigned int from = 0) const { return find(value.find(c, from)); }
+    int indexOf(const String &text, unsigned int from = 0) const { return find(value.find(text.value, from)); }
+    int lastIndexOf(char c) const { return find(value.rfind(c)); }
+    int lastIndexOf(const String &text) const { return find(value.rfind(text.value)); }
+    String substring(unsigned int from) const { return from < value.size() ? String(value.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) {
+            std::swap(from, to);
+        }
+        if (from >= value.size()) {
+            return String();
+        }
+        return String(value.substr(from, std::min<size_t>(to, value.size()) - from));
+    }
+    bool startsWith(const String &prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+    bool endsWith(const String &suffix) const {
+        return value.size() >= suffix.value.size() &&
+               value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+    }
+    bool equals(const String &other) const { return value == other.value; }
+    bool equalsIgnoreCase(const String &other) const {
+        return value.size() == other.value.size() &&
+               std::equal(value.begin(), value.end(), other.value.begin(),
+                          [](char a, char b) { return tolower((unsigned char)a) == tolower((unsigned char)b); });
+    }
+
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    void replace(const String &from, const String &to);
+    void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+        if (index < value.size()) {
+            value.erase(index, count);
+        }
+    }
+    long toInt() const { return strtol(value.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(value.c_str(), nullptr); }
+    double toDouble() const { return strtod(value.c_str(), nullptr); }
+
+    bool concat(const String &text) {
+        value += text.value;
+        return true;
+    }
+    String &operator+=(const String &text) {
+        value += text.value;
+        return *this;
+    }
+    String &operator+=(const char *text) {
+        value += text;
+        return *this;
+    }
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    String &operator+=(T number) {
+        value += String(number).value;
+        return *this;
+    }
+
+    bool operator==(const String &other) const { return value == other.value; }
+    bool operator==(const char *other) const { return value == other; }
+    bool operator!=(const String &other) const { return value != other.value; }
+    bool operator!=(const char *other) const { return value != other; }
+    bool operator<(const String &other) const { return value < other.value; }
+
+    friend String operator+(const String &a, const String &b) { return String(a.value + b.value); }
+    friend String operator+(const String &a, const char *b) { return String(a.value + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.value); }
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    friend String operator+(const String &a, T b) {
+        return String(a.value + String(b).value);
+    }
+
+private:
+    static int find(size_t position) { return position == std::string::npos ? -1 : (int)position; }
+    static std::string formatSigned(long long number, unsigned char base);
+    static std::string formatUnsigned(unsigned long long number, unsigned char base);
+    static std::string formatFloat(double number, unsigned int decimalPlaces);
+
+    std::string value;
+};
+
+// ========================================
+// 時刻（テストが進める仮想時刻）
+// ========================================
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+/**
+ * @brief 仮想時刻を設定（マイクロ秒）
+ */
+void hostSetMicros(uint64_t us);
+
+/**
+ * @brief 仮想時刻を進める（ミリ秒）
+ */
+void hostAdvanceMillis(unsigned long ms);
+
+// ========================================
+// ESP
+// ========================================
+
+class EspClass {
+public:
+    uint32_t getFreeHeap();
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 240; }
+};
+extern EspClass ESP;
+
+bool psramFound();
+
+// ========================================
+// FreeRTOS（タスクは実行しない）
+// ========================================
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+struct portMUX_TYPE {
+    int owner;
+};
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+
+#define pdPASS 1
+#define pdFAIL 0
+#define pdTRUE 1
+#define pdFALSE 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t *previousWakeTime, TickType_t increment);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameter,
+                                   unsigned int priority, TaskHandle_t *handle, BaseType_t core);
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,245 @@
+/**
+ * @file M5Unified.cpp
+ * @brief ホストテスト用のM5Unified/LovyanGFXの実装
+ */
+
+#include "M5Unified.h"
+
+m5::M5Unified M5;
+
+std::vector<std::string> &hostDrawnText() {
+    static std::vector<std::string> text;
+    return text;
+}
+
+namespace lgfx {
+inline namespace v1 {
+
+// 文字の大きさ（高さ, 半角幅, 全角幅）。LovyanGFXのフォントの行の高さと平均的な送り幅に合わせる
+namespace fonts {
+const IFont Font0 = {8, 6, 6};
+const IFont Font2 = {16, 8, 8};
+const IFont Font4 = {26, 14, 14};
+const IFont lgfxJapanGothic_8 = {8, 4, 8};
+const IFont lgfxJapanGothic_12 = {12, 6, 12};
+const IFont lgfxJapanGothic_16 = {16, 8, 16};
+const IFont lgfxJapanGothic_20 = {20, 10, 20};
+const IFont lgfxJapanGothic_24 = {24, 12, 24};
+} // namespace fonts
+
+static uint8_t rgb565To332(uint16_t c) {
+    return (uint8_t)(((c >> 13) & 0x07) << 5 | ((c >> 8) & 0x07) << 2 | ((c >> 3) & 0x03));
+}
+
+void LovyanGFX::allocate(int32_t w, int32_t h, uint8_t depth) {
+    _width = w;
+    _height = h;
+    _depth = depth;
+    _palette = (depth == 1);
+    size_t stride = (depth == 1) ? (size_t)(w + 7) / 8 : (size_t)w * (depth / 8);
+    _buffer.assign(stride * h, 0);
+}
+
+void LovyanGFX::release() {
+    _buffer.clear();
+    _buffer.shrink_to_fit();
+    _width = 0;
+    _height = 0;
+}
+
+void LovyanGFX::writeRaw(int32_t x, int32_t y, uint32_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return;
+    }
+    switch (_depth) {
+    case 16: {
+        uint8_t *p = &_buffer[((size_t)y * _width + x) * 2];
+        p[0] = (uint8_t)(color >> 8);
+        p[1] = (uint8_t)color;
+        break;
+    }
+    case 8:
+        _buffer[(size_t)y * _width + x] = rgb565To332((uint16_t)color);
+        break;
+    default: {
+        uint8_t &byte = _buffer[(size_t)y * ((_width + 7) / 8) + x / 8];
+        uint8_t mask = (uint8_t)(0x80 >> (x & 7));
+        byte = (color & 1) ? (byte | mask) : (byte & ~mask);
+        break;
+    }
+    }
+}
+
+uint16_t LovyanGFX::readPixel(int32_t x, int32_t y) const {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return 0;
+    }
+    switch (_depth) {
+    case 16: {
+        const uint8_t *p = &_buffer[((size_t)y * _width + x) * 2];
+        return (uint16_t)(p[0] << 8 | p[1]);
+    }
+    case 8:
+        return toRgb565(_buffer[(size_t)y * _width + x]);
+    default: {
+        uint8_t byte = _buffer[(size_t)y * ((_width + 7) / 8) + x / 8];
+        return _paletteColors[(byte >> (7 - (x & 7))) & 1];
+    }
+    }
+}
+
+void LovyanGFX::fillRectRaw(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    int32_t x0 = std::max<int32_t>(x, 0), y0 = std::max<int32_t>(y, 0);
+    int32_t x1 = std::min<int32_t>(x + w, _width), y1 = std::min<int32_t>(y + h, _height);
+    for (int32_t py = y0; py < y1; py++) {
+        for (int32_t px = x0; px < x1; px++) {
+            writeRaw(px, py, color);
+        }
+    }
+}
+
+void LovyanGFX::drawRectRaw(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    fillRectRaw(x, y, w, 1, color);
+    fillRectRaw(x, y + h - 1, w, 1, color);
+    fillRectRaw(x, y, 1, h, color);
+    fillRectRaw(x + w - 1, y, 1, h, color);
+}
+
+void LovyanGFX::fillRoundRectRaw(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    r = std::max<int32_t>(0, std::min(r, std::min(w, h) / 2));
+    for (int32_t row = 0; row < h; row++) {
+        // 角の行は円弧の内側のみ（中心から行の中央までの距離で幅を決める）
+        int32_t fromEdge = std::min(row, h - 1 - row);
+        int32_t inset = 0;
+        if (fromEdge < r) {
+            float dy = (float)r - fromEdge - 0.5f;
+            inset = r - (int32_t)floorf(sqrtf((float)(r * r) - dy * dy) + 0.5f);
+        }
+        fillRectRaw(x + inset, y + row, w - inset * 2, 1, color);
+    }
+}
+
+void LovyanGFX::drawLineRaw(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+    int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int32_t error = dx + dy;
+    while (true) {
+        writeRaw(x0, y0, color);
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+        int32_t e2 = error * 2;
+        if (e2 >= dy) {
+            error += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            error += dx;
+            y0 += sy;
+        }
+    }
+}
+
+/**
+ * @brief 1文字の送り幅
+ * @param p 文字の先頭バイト（UTF-8）
+ * @param bytes 文字のバイト数を返す
+ */
+static int32_t glyphAdvance(const char *p, const IFont *font, float size, int &bytes) {
+    uint8_t lead = (uint8_t)*p;
+    bytes = (lead < 0x80) ? 1 : (lead >= 0xF0) ? 4 : (lead >= 0xE0) ? 3 : 2;
+    return (int32_t)(((lead < 0x80) ? font->halfWidth : font->fullWidth) * size);
+}
+
+int32_t LovyanGFX::textWidth(const char *text, const IFont *font) const {
+    int32_t width = 0;
+    for (const char *p = text; *p != '\0';) {
+        int bytes;
+        width += glyphAdvance(p, font, _textSize, bytes);
+        for (int i = 0; i < bytes && *p != '\0'; i++) {
+            p++;
+        }
+    }
+    return width;
+}
+
+size_t LovyanGFX::drawString(const char *text, int32_t x, int32_t y) {
+    hostDrawnText().push_back(text);
+    int32_t width = textWidth(text);
+    int32_t height = fontHeight();
+    // 基準位置（下位2ビットが横、次の2ビットが縦）
+    if ((_datum & 3) == 1) {
+        x -= width / 2;
+    } else if ((_datum & 3) == 2) {
+        x -= width;
+    }
+    if ((_datum & 12) == 4) {
+        y -= height / 2;
+    } else if ((_datum & 12) == 8) {
+        y -= height;
+    }
+    if (_textBackground >= 0) {
+        fillRectRaw(x, y, width, height, (uint32_t)_textBackground);
+    }
+    // 字形の代わりに文字ごとの矩形（右と上下に1ピクセルの隙間）
+    for (const char *p = text; *p != '\0';) {
+        int bytes;
+        int32_t advance = glyphAdvance(p, _font, _textSize, bytes);
+        if (*p != ' ') {
+            fillRectRaw(x, y + 1, std::max<int32_t>(advance - 1, 1), std::max<int32_t>(height - 2, 1), _textColor);
+        }
+        x += advance;
+        for (int i = 0; i < bytes && *p != '\0'; i++) {
+            p++;
+        }
+    }
+    return (size_t)width;
+}
+
+size_t LovyanGFX::drawString(const char *text, int32_t x, int32_t y, uint8_t font) {
+    // LovyanGFXと同様に番号のフォントを以降の描画にも使う
+    setFont(font == 2 ? &fonts::Font2 : font == 4 ? &fonts::Font4 : &fonts::Font0);
+    return drawString(text, x, y);
+}
+
+void *LGFX_Sprite::createSprite(int32_t w, int32_t h) {
+    allocate(w, h, _requestedDepth);
+    return _buffer.data();
+}
+
+void LGFX_Sprite::pushSprite(LovyanGFX *destination, int32_t x, int32_t y) const {
+    if (destination == nullptr) {
+        return;
+    }
+    for (int32_t py = 0; py < _height; py++) {
+        for (int32_t px = 0; px < _width; px++) {
+            destination->drawPixel(x + px, y + py, readPixel(px, py));
+        }
+    }
+}
+
+} // namespace v1
+} // namespace lgfx
+
+namespace m5 {
+
+M5GFX::M5GFX() {
+    allocate(320, 240, 16);
+}
+
+void M5GFX::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const lgfx::v1::swap565_t *data) {
+    for (int32_t py = 0; py < h; py++) {
+        for (int32_t px = 0; px < w; px++) {
+            const lgfx::v1::swap565_t &pixel = data[py * w + px];
+            drawPixel(x + px, y + py, (uint16_t)(pixel.high << 8 | pixel.low));
+        }
+    }
+}
+
+} // namespace m5
@@ -0,0 +1,300 @@
+/**
+ * @file M5Unified.h
+ * @brief ホストテスト用のM5Unified/LovyanGFX（src/で使う部分のみ）
+ * @details 描画はメモリ上の画素に対して行う（画面・スプライトとも）。図形はLovyanGFXと同じ画素を塗り、
+ *          文字は字形の代わりに1文字ごとの矩形を描く（配置・幅・色の確認用。字形そのものは比較しない）。
+ *          色の引数はLovyanGFXと同様に型で解釈する（uint8_tはRGB332、uint16_t・intはRGB565、uint32_tはRGB888）。
+ *          スピーカー・IMU・タッチはテストから状態を設定し、呼び出しを記録する
+ */
+
+#ifndef HOST_M5UNIFIED_H
+#define HOST_M5UNIFIED_H
+
+#include <Arduino.h>
+#include <lgfx/v1/lgfx_fonts.hpp>
+#include <string>
+#include <vector>
+
+// 色（TFT_eSPI互換、RGB565）
+static constexpr int TFT_BLACK = 0x0000;
+static constexpr int TFT_NAVY = 0x000F;
+static constexpr int TFT_DARKGREEN = 0x03E0;
+static constexpr int TFT_MAROON = 0x7800;
+static constexpr int TFT_LIGHTGREY = 0xD69A;
+static constexpr int TFT_DARKGREY = 0x7BEF;
+static constexpr int TFT_BLUE = 0x001F;
+static constexpr int TFT_GREEN = 0x07E0;
+static constexpr int TFT_CYAN = 0x07FF;
+static constexpr int TFT_RED = 0xF800;
+static constexpr int TFT_MAGENTA = 0xF81F;
+static constexpr int TFT_YELLOW = 0xFFE0;
+static constexpr int TFT_WHITE = 0xFFFF;
+static constexpr int TFT_ORANGE = 0xFDA0;
+
+// 文字の基準位置
+enum : uint8_t {
+    TL_DATUM = 0,
+    TC_DATUM = 1,
+    TR_DATUM = 2,
+    ML_DATUM = 4,
+    MC_DATUM = 5,
+    MR_DATUM = 6,
+    BL_DATUM = 8,
+    BC_DATUM = 9,
+    BR_DATUM = 10,
+};
+
+namespace lgfx {
+inline namespace v1 {
+
+struct swap565_t {
+    uint8_t high;  // 上位バイトが先（パネルの転送順）
+    uint8_t low;
+};
+
+// 色の引数を型に応じてRGB565に変換（LovyanGFXのcolor_conv_tと同じ解釈）
+inline uint16_t toRgb565(uint8_t c) {
+    uint16_t r = (c >> 5) & 0x07, g = (c >> 2) & 0x07, b = c & 0x03;
+    return (uint16_t)(((r << 2 | r >> 1) << 11) | ((g << 3 | g) << 5) | (b << 3 | b << 1 | b >> 1));
+}
+inline uint16_t toRgb565(int8_t c) { return toRgb565((uint8_t)c); }
+inline uint16_t toRgb565(uint16_t c) { return c; }
+inline uint16_t toRgb565(int16_t c) { return (uint16_t)c; }
+inline uint16_t toRgb565(int32_t c) { return (uint16_t)c; }
+inline uint16_t toRgb565(int64_t c) { return (uint16_t)c; }
+inline uint16_t toRgb565(uint32_t c) {
+    return (uint16_t)(((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F));
+}
+inline uint16_t toRgb565(uint64_t c) { return toRgb565((uint32_t)c); }
+
+/**
+ * @brief 描画先（画面・スプライト共通）
+ * @details 画素は色深度に応じてバッファに格納する（16ビットは上位バイトが先のRGB565、8ビットはRGB332、
+ *          1ビットはパレット番号でMSBが左）
+ */
+class LovyanGFX {
+public:
+    virtual ~LovyanGFX() = default;
+
+    int32_t width() const { return _width; }
+    int32_t height() const { return _height; }
+    uint8_t getColorDepth() const { return _depth; }
+
+    template <typename T> void fillScreen(T color) { fillRectRaw(0, 0, _width, _height, native(color)); }
+    template <typename T> void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, T color) {
+        fillRectRaw(x, y, w, h, native(color));
+    }
+    template <typename T> void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, T color) {
+        drawRectRaw(x, y, w, h, native(color));
+    }
+    template <typename T> void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, T color) {
+        fillRoundRectRaw(x, y, w, h, r, native(color));
+    }
+    template <typename T> void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, T color) {
+        drawLineRaw(x0, y0, x1, y1, native(color));
+    }
+    template <typename T> void drawPixel(int32_t x, int32_t y, T color) { writeRaw(x, y, native(color)); }
+
+    /**
+     * @brief 画素の色を取得
+     * @return RGB565（パレットのスプライトはパレットの色）
+     */
+    uint16_t readPixel(int32_t x, int32_t y) const;
+
+    void setFont(const IFont *font) { _font = (font != nullptr) ? font : &fonts::Font0; }
+    template <typename T> void setTextColor(T color) {
+        _textColor = native(color);
+        _textBackground = -1;
+    }
+    template <typename T, typename U> void setTextColor(T color, U background) {
+        _textColor = native(color);
+        _textBackground = (int32_t)native(background);
+    }
+    void setTextDatum(uint8_t datum) { _datum = datum; }
+    void setTextSize(float size) { _textSize = size; }
+
+    int32_t textWidth(const char *text) const { return textWidth(text, _font); }
+    int32_t textWidth(const char *text, const IFont *font) const;
+    int32_t textWidth(const String &text) const { return textWidth(text.c_str(), _font); }
+    int32_t textWidth(const String &text, const IFont *font) const { return textWidth(text.c_str(), font); }
+    int32_t fontHeight() const { return fontHeight(_font); }
+    int32_t fontHeight(const IFont *font) const { return (int32_t)(font->height * _textSize); }
+
+    size_t drawString(const char *text, int32_t x, int32_t y);
+    size_t drawString(const char *text, int32_t x, int32_t y, uint8_t font);
+    size_t drawString(const String &text, int32_t x, int32_t y) { return drawString(text.c_str(), x, y); }
+    size_t drawString(const String &text, int32_t x, int32_t y, uint8_t font) { return drawString(text.c_str(), x, y, font); }
+
+protected:
+    void allocate(int32_t w, int32_t h, uint8_t depth);
+    void release();
+
+    template <typename T> uint32_t native(T color) const { return _palette ? (uint32_t)color : toRgb565(color); }
+    void writeRaw(int32_t x, int32_t y, uint32_t color);
+    void fillRectRaw(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRectRaw(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void fillRoundRectRaw(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void drawLineRaw(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+
+    std::vector<uint8_t> _buffer;
+    int32_t _width = 0;
+    int32_t _height = 0;
+    uint8_t _depth = 16;
+    bool _palette = false;         // 1ビットのスプライトはパレット番号で描画する
+    uint16_t _paletteColors[2] = {TFT_BLACK, TFT_WHITE};
+
+    const IFont *_font = &fonts::Font0;
+    uint32_t _textColor = TFT_WHITE;
+    int32_t _textBackground = -1;  // -1は背景なし
+    uint8_t _datum = TL_DATUM;
+    float _textSize = 1.0f;
+};
+
+/**
+ * @brief メモリ上のスプライト
+ */
+class LGFX_Sprite : public LovyanGFX {
+public:
+    LGFX_Sprite() {}
+    explicit LGFX_Sprite(LovyanGFX *parent) : _parent(parent) {}
+
+    void setColorDepth(int depth) { _requestedDepth = (uint8_t)depth; }
+    void setPsram(bool enabled) { (void)enabled; }
+    void *createSprite(int32_t w, int32_t h);
+    void deleteSprite() { release(); }
+    void *getBuffer() { return _buffer.empty() ? nullptr : _buffer.data(); }
+    uint32_t bufferLength() const { return (uint32_t)_buffer.size(); }
+    template <typename T> void setPaletteColor(size_t index, T color) {
+        if (index < 2) {
+            _paletteColors[index] = toRgb565(color);
+        }
+    }
+    void pushSprite(LovyanGFX *destination, int32_t x, int32_t y) const;
+    void pushSprite(int32_t x, int32_t y) const { pushSprite(_parent, x, y); }
+
+private:
+    LovyanGFX *_parent = nullptr;
+    uint8_t _requestedDepth = 16;
+};
+
+} // namespace v1
+} // namespace lgfx
+
+using LGFX_Sprite = lgfx::v1::LGFX_Sprite;
+using M5Canvas = lgfx::v1::LGFX_Sprite;
+
+namespace m5 {
+
+/**
+ * @brief 画面（320×240、RGB565）
+ */
+class M5GFX : public lgfx::v1::LovyanGFX {
+public:
+    M5GFX();
+
+    void setBrightness(uint8_t brightness) { _brightness = brightness; }
+    uint8_t getBrightness() const { return _brightness; }
+    void invertDisplay(bool invert) { _inverted = invert; }
+    bool getInvert() const { return _inverted; }
+    void startWrite() {}
+    void endWrite() {}
+    void waitDMA() {}
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const lgfx::v1::swap565_t *data);
+
+private:
+    uint8_t _brightness = 128;
+    bool _inverted = false;
+};
+
+/**
+ * @brief スピーカー（鳴らした音を記録）
+ */
+class Speaker_Class {
+public:
+    struct Tone {
+        unsigned long millis;
+        float frequency;
+        uint32_t duration;
+    };
+
+    bool begin() { return true; }
+    void setVolume(uint8_t volume) { (void)volume; }
+    bool tone(float frequency, uint32_t duration) {
+        tones.push_back({millis(), frequency, duration});
+        return true;
+    }
+
+    std::vector<Tone> tones;  // テストで参照
+};
+
+/**
+ * @brief IMU（テストが設定した加速度を返す）
+ */
+class IMU_Class {
+public:
+    bool isEnabled() const { return enabled; }
+    bool getAccel(float *ax, float *ay, float *az) const {
+        *ax = accel[0];
+        *ay = accel[1];
+        *az = accel[2];
+        return enabled;
+    }
+
+    bool enabled = true;
+    float accel[3] = {0.0f, 0.0f, 1.0f};  // 重力加速度単位
+};
+
+struct touch_detail_t {
+    int16_t x = -1;
+    int16_t y = -1;
+    bool pressed = false;
+    bool released = false;
+
+    bool isPressed() const { return pressed; }
+    bool isHolding() const { return false; }
+    bool wasPressed() const { return false; }
+    bool wasReleased() const { return released; }
+};
+
+/**
+ * @brief タッチ（テストが設定した状態を返す）
+ */
+class Touch_Class {
+public:
+    touch_detail_t getDetail() const { return detail; }
+
+    /**
+     * @brief 次のフレームのタッチ状態を設定
+     * @param pressed 押しているか（押していた状態からfalseにするとwasReleased()がtrue）
+     */
+    void set(bool pressed, int16_t x, int16_t y) {
+        detail.released = detail.pressed && !pressed;
+        detail.pressed = pressed;
+        detail.x = x;
+        detail.y = y;
+    }
+
+private:
+    touch_detail_t detail;
+};
+
+class M5Unified {
+public:
+    M5GFX Display;
+    Speaker_Class Speaker;
+    IMU_Class Imu;
+    Touch_Class Touch;
+
+    void update() {}
+};
+
+} // namespace m5
+
+extern m5::M5Unified M5;
+
+/**
+ * @brief 描画した文字列の記録（テストで参照、drawString()ごとに追加）
+ */
+std::vector<std::string> &hostDrawnText();
+
+#endif // HOST_M5UNIFIED_H
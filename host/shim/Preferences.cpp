@@ -0,0 +1,47 @@
+/**
+ * @file Preferences.cpp
+ * @brief ホストテスト用のNVSの実装
+ */
+
+#include "Preferences.h"
+#include <map>
+#include <vector>
+
+static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> storage;
+
+bool Preferences::begin(const char *name, bool readOnly) {
+    (void)readOnly;
+    space = name;
+    return true;
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+    auto &entries = storage[space];
+    auto found = entries.find(key);
+    return found != entries.end() ? found->second.size() : 0;
+}
+
+size_t Preferences::getBytes(const char *key, void *buffer, size_t length) {
+    auto &entries = storage[space];
+    auto found = entries.find(key);
+    if (found == entries.end() || found->second.size() > length) {
+        return 0;
+    }
+    memcpy(buffer, found->second.data(), found->second.size());
+    return found->second.size();
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)value;
+    storage[space][key].assign(bytes, bytes + length);
+    return length;
+}
+
+bool Preferences::remove(const char *key) {
+    return storage[space].erase(key) > 0;
+}
+
+bool Preferences::clear() {
+    storage[space].clear();
+    return true;
+}
@@ -0,0 +1,25 @@
+/**
+ * @file Preferences.h
+ * @brief ホストテスト用のNVS（プロセス内のメモリに保持）
+ */
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+    bool begin(const char *name, bool readOnly = false);
+    void end() { space.clear(); }
+    size_t getBytesLength(const char *key);
+    size_t getBytes(const char *key, void *buffer, size_t length);
+    size_t putBytes(const char *key, const void *value, size_t length);
+    bool remove(const char *key);
+    bool clear();
+
+private:
+    std::string space;
+};
+
+#endif // HOST_PREFERENCES_H
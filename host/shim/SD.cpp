@@ -0,0 +1,89 @@
+/**
+ * @file SD.cpp
+ * @brief ホストテスト用のSDカードの実装
+ */
+
+#include "SD.h"
+#include <sys/stat.h>
+
+SPIClass SPI;
+SDFS SD;
+
+static std::string sdRoot = "sd";
+static HostSdStats sdStats;
+
+void hostSetSdRoot(const std::string &directory) {
+    sdRoot = directory;
+    ::mkdir(sdRoot.c_str(), 0755);
+}
+
+HostSdStats &hostSdStats() {
+    return sdStats;
+}
+
+static std::string hostPath(const char *path) {
+    return sdRoot + (path[0] == '/' ? "" : "/") + path;
+}
+
+size_t File::size() const {
+    if (!handle) {
+        return 0;
+    }
+    struct stat info;
+    fflush(handle.get());
+    return fstat(fileno(handle.get()), &info) == 0 ? (size_t)info.st_size : 0;
+}
+
+bool File::seek(uint32_t position) {
+    sdStats.seeks++;
+    return handle && fseek(handle.get(), position, SEEK_SET) == 0;
+}
+
+int File::read() {
+    uint8_t value;
+    return read(&value, 1) == 1 ? value : -1;
+}
+
+size_t File::read(uint8_t *buffer, size_t length) {
+    if (!handle) {
+        return 0;
+    }
+    size_t count = fread(buffer, 1, length, handle.get());
+    sdStats.reads++;
+    sdStats.bytesRead += count;
+    return count;
+}
+
+size_t File::write(const uint8_t *buffer, size_t length) {
+    if (!handle) {
+        return 0;
+    }
+    size_t count = fwrite(buffer, 1, length, handle.get());
+    sdStats.writes++;
+    sdStats.bytesWritten += count;
+    return count;
+}
+
+File SDFS::open(const char *path, const char *mode, bool create) {
+    (void)create;
+    // ESP32のSDライブラリと同じモード（"r"・"w"・"a"・"r+"）をバイナリで開く
+    std::string hostMode = std::string(mode) + "b";
+    FILE *handle = fopen(hostPath(path).c_str(), hostMode.c_str());
+    if (handle != nullptr) {
+        sdStats.opens++;
+    }
+    return File(handle);
+}
+
+bool SDFS::exists(const char *path) {
+    struct stat info;
+    return stat(hostPath(path).c_str(), &info) == 0;
+}
+
+bool SDFS::mkdir(const char *path) {
+    return ::mkdir(hostPath(path).c_str(), 0755) == 0;
+}
+
+bool SDFS::remove(const char *path) {
+    return ::remove(hostPath(path).c_str()) == 0;
+}
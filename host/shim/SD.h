@@ -0,0 +1,93 @@
+/**
+ * @file SD.h
+ * @brief ホストテスト用のSDカード（ホストのディレクトリに読み書き）
+ * @details パスはhostSetSdRoot()で指定したディレクトリからの相対パスとして扱う。
+ *          読み書きの回数・バイト数を集計し、テストでSDカードへのアクセス量を確認できる
+ */
+
+#ifndef HOST_SD_H
+#define HOST_SD_H
+
+#include <Arduino.h>
+#include <memory>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+class File {
+public:
+    File() {}
+    explicit File(FILE *file) {
+        if (file != nullptr) {
+            handle.reset(file, fclose);
+        }
+    }
+
+    explicit operator bool() const { return handle != nullptr; }
+    void close() { handle.reset(); }
+    size_t size() const;
+    size_t position() const { return handle ? (size_t)ftell(handle.get()) : 0; }
+    bool seek(uint32_t position);
+    int available() const { return (int)(size() - position()); }
+    int read();
+    size_t read(uint8_t *buffer, size_t length);
+    size_t write(uint8_t value) { return write(&value, 1); }
+    size_t write(const uint8_t *buffer, size_t length);
+    void flush() {
+        if (handle) {
+            fflush(handle.get());
+        }
+    }
+    time_t getLastWrite() const { return 0; }
+
+private:
+    std::shared_ptr<FILE> handle;
+};
+
+class SPIClass {};
+extern SPIClass SPI;
+
+class SDFS {
+public:
+    bool begin(uint8_t csPin = 0, SPIClass &spi = SPI, uint32_t frequency = 0) {
+        (void)csPin;
+        (void)spi;
+        (void)frequency;
+        return true;
+    }
+    void end() {}
+    File open(const char *path, const char *mode = FILE_READ, bool create = false);
+    File open(const String &path, const char *mode = FILE_READ, bool create = false) {
+        return open(path.c_str(), mode, create);
+    }
+    bool exists(const char *path);
+    bool exists(const String &path) { return exists(path.c_str()); }
+    bool mkdir(const char *path);
+    bool remove(const char *path);
+};
+extern SDFS SD;
+
+/**
+ * @brief SDカードへのアクセスの集計値
+ */
+struct HostSdStats {
+    uint32_t opens = 0;
+    uint32_t seeks = 0;
+    uint32_t reads = 0;
+    uint64_t bytesRead = 0;
+    uint32_t writes = 0;
+    uint64_t bytesWritten = 0;
+};
+
+/**
+ * @brief SDカードのルートにするディレクトリを設定（存在しなければ作成）
+ */
+void hostSetSdRoot(const std::string &directory);
+
+/**
+ * @brief アクセスの集計値（テストがリセットしてよい）
+ */
+HostSdStats &hostSdStats();
+
+#endif // HOST_SD_H
@@ -0,0 +1,37 @@
+/**
+ * @file lgfx_fonts.hpp
+ * @brief ホストテスト用のフォント定義（LovyanGFXのうちsrc/で使うフォントのみ）
+ * @details 字形は持たず、文字の大きさのみを定義する。ASCIIは半角幅、それ以外（UTF-8の複数バイト文字）は全角幅で数える
+ */
+
+#ifndef HOST_LGFX_FONTS_HPP
+#define HOST_LGFX_FONTS_HPP
+
+#include <cstdint>
+
+namespace lgfx {
+inline namespace v1 {
+
+struct IFont {
+    uint8_t height;      // 文字の高さ（ピクセル）
+    uint8_t halfWidth;   // ASCIIの送り幅
+    uint8_t fullWidth;   // 全角文字の送り幅
+};
+
+namespace fonts {
+extern const IFont Font0;
+extern const IFont Font2;
+extern const IFont Font4;
+extern const IFont lgfxJapanGothic_8;
+extern const IFont lgfxJapanGothic_12;
+extern const IFont lgfxJapanGothic_16;
+extern const IFont lgfxJapanGothic_20;
+extern const IFont lgfxJapanGothic_24;
+} // namespace fonts
+
+} // namespace v1
+} // namespace lgfx
+
+namespace fonts = lgfx::v1::fonts;
+
+#endif // HOST_LGFX_FONTS_HPP
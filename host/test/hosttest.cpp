@@ -0,0 +1,78 @@
+/**
+ * @file hosttest.cpp
+ * @brief ホストテストの共通処理の実装
+ */
+
+#include "hosttest.h"
+#include <chrono>
+#include <filesystem>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+static int checks = 0;
+static int failures = 0;
+
+bool hostCheck(bool ok, const char *expression, const char *file, int line) {
+    checks++;
+    if (!ok) {
+        failures++;
+        fprintf(stderr, "FAILED: %s (%s:%d)\n", expression, file, line);
+    }
+    return ok;
+}
+
+int hostTestResult() {
+    printf("%d checks, %d failures\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
+
+std::vector<std::string> &hostLog() {
+    static std::vector<std::string> lines;
+    return lines;
+}
+
+bool hostLogContains(const std::string &text) {
+    for (const std::string &line : hostLog()) {
+        if (line.find(text) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void consoleLog(String message) {
+    static const bool verbose = getenv("HOST_VERBOSE") != nullptr && strcmp(getenv("HOST_VERBOSE"), "1") == 0;
+    if (verbose) {
+        fprintf(stderr, "%s\n", message.c_str());
+    }
+    hostLog().push_back(message.c_str());
+}
+
+std::string hostSourcePath(const std::string &relative) {
+    return std::string(HOST_SOURCE_DIR) + "/" + relative;
+}
+
+bool hostUpdateGolden() {
+    const char *value = getenv("UPDATE_GOLDEN");
+    return value != nullptr && strcmp(value, "1") == 0;
+}
+
+std::string hostScratchDirectory(const std::string &name) {
+    std::filesystem::remove_all(name);
+    std::filesystem::create_directories(name);
+    return name;
+}
+
+double hostWallMicros() {
+    using namespace std::chrono;
+    return duration_cast<duration<double, std::micro>>(steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t hostCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
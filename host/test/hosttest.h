@@ -0,0 +1,66 @@
+/**
+ * @file hosttest.h
+ * @brief ホストテストの共通処理（判定・ログ・ゴールデンファイル・時間計測）
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 条件を判定（失敗時は位置を出力し、終了コードを失敗にする）
+ */
+#define CHECK(condition) hostCheck((condition), #condition, __FILE__, __LINE__)
+
+bool hostCheck(bool ok, const char *expression, const char *file, int line);
+
+/**
+ * @brief 判定の結果を出力して終了コードを返す（main()の戻り値にする）
+ */
+int hostTestResult();
+
+/**
+ * @brief consoleLog()の出力（HOST_VERBOSE=1のときは標準エラーにも出力）
+ */
+std::vector<std::string> &hostLog();
+
+/**
+ * @brief ログを記録（src/のモジュールがextern宣言して呼び出す、実機ではmain.cppで定義）
+ */
+void consoleLog(String message);
+
+/**
+ * @brief ログに文字列を含む行があるか
+ */
+bool hostLogContains(const std::string &text);
+
+/**
+ * @brief host/からの相対パスをソースツリー上のパスに変換（ゴールデンファイル・記録波形用）
+ */
+std::string hostSourcePath(const std::string &relative);
+
+/**
+ * @brief ゴールデンファイルを更新するか（環境変数UPDATE_GOLDEN=1）
+ */
+bool hostUpdateGolden();
+
+/**
+ * @brief テスト用の空のディレクトリを作成（既存の内容は削除）
+ */
+std::string hostScratchDirectory(const std::string &name);
+
+/**
+ * @brief 実時間（マイクロ秒、ベンチマーク用。millis()/micros()は仮想時刻）
+ */
+double hostWallMicros();
+
+/**
+ * @brief ホストのサイクルカウンター（x86のTSC、それ以外は0）
+ * @details 実機（Xtensa 240MHz）のサイクル数ではない。同じホストでの処理量の比較に使う
+ */
+uint64_t hostCycles();
+
+#endif // HOST_TEST_H
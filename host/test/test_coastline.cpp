@@ -0,0 +1,110 @@
+/**
+ * @file test_coastline.cpp
+ * @brief 海岸線と経緯線の1ビットのビットマップ（rasterizeCoastline()）をゴールデン画像と比較
+ * @details 1ビットスプライトと同じ画素配置（1行40バイト、MSBが左端）のビットマップを、
+ *          host/golden/coastline.pbm（P4、1が線）とバイト単位で比較する。
+ *          不一致の場合は実際の画像をcoastline.actual.pbmに書き出す。あわせてホストでの描画時間を出力する
+ */
+
+#include "epicentermap.h"
+#include "hosttest.h"
+#include <vector>
+
+// ========================================
+// 他のモジュールの代用
+// ========================================
+
+bool getSiteLocation(float &latitude, float &longitude) {
+    (void)latitude;
+    (void)longitude;
+    return false;
+}
+
+// ========================================
+// ビットマップとPBM
+// ========================================
+
+#define MAP_STRIDE ((EPICENTER_MAP_WIDTH + 7) / 8)
+#define MAP_BYTES (MAP_STRIDE * EPICENTER_MAP_HEIGHT)
+#define BENCHMARK_RASTERS 200  // 描画時間を計測する回数
+
+static bool writePbm(const std::string &path, const std::vector<uint8_t> &bitmap) {
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    fprintf(file, "P4\n%d %d\n", EPICENTER_MAP_WIDTH, EPICENTER_MAP_HEIGHT);
+    bool ok = fwrite(bitmap.data(), 1, bitmap.size(), file) == bitmap.size();
+    fclose(file);
+    return ok;
+}
+
+/**
+ * @brief PBM（P4）を読み込み（コメントなし、大きさが地図と一致するもののみ）
+ */
+static bool readPbm(const std::string &path, std::vector<uint8_t> &bitmap) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    int width = 0;
+    int height = 0;
+    bool ok = fscanf(file, "P4 %d %d", &width, &height) == 2 && fgetc(file) == '\n' &&
+              width == EPICENTER_MAP_WIDTH && height == EPICENTER_MAP_HEIGHT;
+    bitmap.assign(MAP_BYTES, 0);
+    ok = ok && fread(bitmap.data(), 1, bitmap.size(), file) == bitmap.size();
+    fclose(file);
+    return ok;
+}
+
+/**
+ * @brief 異なる画素の数
+ */
+static int countDifferentPixels(const std::vector<uint8_t> &a, const std::vector<uint8_t> &b) {
+    int count = 0;
+    for (size_t i = 0; i < a.size() && i < b.size(); i++) {
+        count += __builtin_popcount(a[i] ^ b[i]);
+    }
+    return count;
+}
+
+int main() {
+    std::vector<uint8_t> bitmap(MAP_BYTES, 0);
+    uint32_t segments = rasterizeCoastline(bitmap.data());
+    CHECK(segments > 0);
+
+    std::string golden = hostSourcePath("golden/coastline.pbm");
+    if (hostUpdateGolden()) {
+        CHECK(writePbm(golden, bitmap));
+    } else {
+        std::vector<uint8_t> expected;
+        bool loaded = readPbm(golden, expected);
+        CHECK(loaded);
+        int different = loaded ? countDifferentPixels(bitmap, expected) : -1;
+        printf("coastline: %u線分, %s (%d画素)\n", segments, different == 0 ? "一致" : "不一致", different);
+        if (different != 0) {
+            writePbm("coastline.actual.pbm", bitmap);
+        }
+        CHECK(different == 0);
+    }
+
+    // 投影: 範囲内（東京・那覇）と範囲外（震源不明の0度、南鳥島）
+    int x;
+    int y;
+    CHECK(projectToEpicenterMap(35.68f, 139.77f, x, y) && x > EPICENTER_MAP_WIDTH / 2 && y > 0 &&
+          y < EPICENTER_MAP_HEIGHT);
+    CHECK(projectToEpicenterMap(26.21f, 127.68f, x, y) && x < EPICENTER_MAP_WIDTH / 2 && y > EPICENTER_MAP_HEIGHT / 2);
+    CHECK(!projectToEpicenterMap(0.0f, 0.0f, x, y));
+    CHECK(!projectToEpicenterMap(24.28f, 153.98f, x, y));
+
+    // 描画時間（ホスト、スプライト作成時の1回分）
+    double elapsed = 0;
+    for (int i = 0; i < BENCHMARK_RASTERS; i++) {
+        std::fill(bitmap.begin(), bitmap.end(), 0);
+        double start = hostWallMicros();
+        rasterizeCoastline(bitmap.data());
+        elapsed += hostWallMicros() - start;
+    }
+    printf("rasterizeCoastline(): %.1fus/回 (ホスト)\n", elapsed / BENCHMARK_RASTERS);
+    return hostTestResult();
+}
@@ -0,0 +1,315 @@
+/**
+ * @file test_history.cpp
+ * @brief SDカード上の地震履歴ストアのテスト（追記・挿入・続報の書き換え・インデックスの再構築）と10万件のベンチマーク
+ * @details history.cppをファイルに読み書きするSDカード（shim/SD.h）で動かし、appendHistory()の経路で
+ *          shiftRecords()・updateTimeIndexFrom()・rewriteRecord()を通す。インデックスファイルの内容は
+ *          レコード本体と直接照合する。ベンチマークは10万件の履歴の先頭・途中・末尾でスクロールのフレームを再現し、
+ *          1フレームのSDカードへのアクセス量が位置に依存しないことを確認して、ホストでの時間を出力する
+ */
+
+#include "history.h"
+#include "hosttest.h"
+#include "snapshot.h"
+#include <SD.h>
+
+// ========================================
+// 他のモジュールの代用
+// ========================================
+
+bool isSDCardMounted() {
+    return true;
+}
+
+// earthquake.cppのisSameEvent()と同じ判定（震央間の距離は球面上の近似）
+bool isSameEvent(const EarthquakeData &a, const EarthquakeData &b) {
+    if (a.originTime == 0 || b.originTime == 0) {
+        return false;
+    }
+    time_t diff = (a.originTime > b.originTime) ? a.originTime - b.originTime : b.originTime - a.originTime;
+    if (diff > EVENT_SAME_TIME_S) {
+        return false;
+    }
+    float dLat = (a.latitude - b.latitude) * 111.2f;
+    float dLon = (a.longitude - b.longitude) * 111.2f * cosf((a.latitude + b.latitude) * 0.5f * (float)M_PI / 180.0f);
+    return sqrtf(dLat * dLat + dLon * dLon) <= EVENT_SAME_DISTANCE_KM;
+}
+
+// ========================================
+// シナリオ
+// ========================================
+
+#define EVENT_INTERVAL_S 600        // 地震の発生間隔（秒、isSameEvent()で別の地震と判定される間隔）
+#define BENCHMARK_RECORDS 100000    // ベンチマークの件数
+#define FRAME_ROWS 6                // 1フレームに表示する行数（display.cppのLIST_VISIBLE_CARDS_MAXと同じ）
+#define FRAMES_PER_POSITION 64      // 各位置でスクロールするフレーム数（1フレーム1行ずつ古い方へ）
+
+// ジャンプで読み込むページ数の上限（区間内の二分探索で log2(区間のページ数) + 1、フレームの行で1ページ）
+#define JUMP_PAGES_MAX 6
+
+static const time_t BASE_TIME = 1704085200;  // 2024-01-01 05:00 UTC
+
+/**
+ * @brief n番目の地震（発生時刻はEVENT_INTERVAL_Sごと、震央は同じ）
+ */
+static EarthquakeData makeEvent(uint32_t n) {
+    EarthquakeData data;
+    data.originTime = BASE_TIME + (time_t)n * EVENT_INTERVAL_S;
+    data.utcOffsetMinutes = 540;
+    data.hypocenterName = String("地震") + n;
+    data.latitude = 36.0f;
+    data.longitude = 140.0f;
+    data.depth = 10;
+    data.magnitude = 4.0f;
+    data.maxIntensity = Intensity::Int3;
+    data.tsunami = "None";
+    return data;
+}
+
+/**
+ * @brief 全レコードが発生時刻の昇順で、地震（震源地名の番号）がexpectedと一致するか
+ * @param expected 先頭から順の地震の番号
+ */
+static bool checkRecords(const std::vector<uint32_t> &expected) {
+    if (getHistoryCount() != expected.size()) {
+        printf("件数: %u (期待値 %zu)\n", getHistoryCount(), expected.size());
+        return false;
+    }
+    EarthquakeData data;
+    for (uint32_t i = 0; i < expected.size(); i++) {
+        uint32_t previous = (uint32_t)data.originTime;
+        if (!readHistory(i, data) || data.hypocenterName != makeEvent(expected[i]).hypocenterName ||
+            (i > 0 && (uint32_t)data.originTime < previous)) {
+            printf("%u件目: %s %ld (期待値 %s)\n", i, data.hypocenterName.c_str(), (long)data.originTime,
+                   makeEvent(expected[i]).hypocenterName.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief インデックスファイルがHISTORY_INDEX_STRIDE件ごとのレコードの発生時刻と一致するか
+ */
+static bool checkIndexFile() {
+    File file = SD.open(HISTORY_INDEX_PATH, FILE_READ);
+    if (!file) {
+        return false;
+    }
+    uint32_t count = getHistoryCount();
+    uint32_t expected = (count + HISTORY_INDEX_STRIDE - 1) / HISTORY_INDEX_STRIDE;
+    if (file.size() != expected * sizeof(uint32_t)) {
+        printf("インデックス: %zuバイト (期待値 %zu)\n", file.size(), expected * sizeof(uint32_t));
+        return false;
+    }
+    EarthquakeData data;
+    for (uint32_t k = 0; k < expected; k++) {
+        uint32_t originTime;
+        if (file.read((uint8_t *)&originTime, sizeof(originTime)) != sizeof(originTime) ||
+            !readHistory(k * HISTORY_INDEX_STRIDE, data) || originTime != (uint32_t)data.originTime) {
+            printf("インデックス%u: %u (レコード %ld)\n", k, originTime, (long)data.originTime);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief findHistoryBefore()が全レコードの直前・直後の時刻で正しい位置を返すか（メモリ上のインデックスの確認）
+ */
+static bool checkFindBefore() {
+    EarthquakeData data;
+    for (uint32_t i = 0; i < getHistoryCount(); i++) {
+        if (!readHistory(i, data) || findHistoryBefore(data.originTime + 1) != (int32_t)i ||
+            findHistoryBefore(data.originTime) != (int32_t)i - 1) {
+            printf("findHistoryBefore: %u件目 (発生時刻 %ld)\n", i, (long)data.originTime);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 追記・挿入・続報の書き換え・再起動後の読み込みとインデックスの再構築
+ */
+static void testAppendInsertRewrite() {
+    hostSetSdRoot(hostScratchDirectory("test_history_sd"));
+    CHECK(initHistory());
+    CHECK(getHistoryCount() == 0);
+
+    // 600件のうち、インデックスの区切り（512件目）をまたぐ位置の数件を後から届く地震として抜いておく
+    const uint32_t late[] = {500, 530, 590};
+    std::vector<uint32_t> expected;
+    for (uint32_t n = 0; n < 600; n++) {
+        if (std::find(std::begin(late), std::end(late), n) == std::end(late)) {
+            CHECK(appendHistory(makeEvent(n)));
+            expected.push_back(n);
+        }
+    }
+    CHECK(checkRecords(expected));
+    CHECK(checkIndexFile());
+
+    // 最新より古い地震: shiftRecords()で後ろをずらして挿入し、updateTimeIndexFrom()でずれた区間のインデックスを更新
+    for (uint32_t n : late) {
+        hostLog().clear();
+        CHECK(appendHistory(makeEvent(n)));
+        CHECK(hostLogContains("[History] 発生時刻の順に挿入: 地震" + std::to_string(n)));
+        expected.insert(std::lower_bound(expected.begin(), expected.end(), n), n);
+    }
+    CHECK(checkRecords(expected));
+    CHECK(checkIndexFile());
+    CHECK(checkFindBefore());
+
+    // HISTORY_INSERT_MAX_SHIFTより前への挿入は記録しない
+    hostLog().clear();
+    EarthquakeData old = makeEvent(0);
+    old.originTime -= EVENT_INTERVAL_S * 10;  // 全レコードより前
+    CHECK(!appendHistory(old));
+    CHECK(hostLogContains("[History] 古すぎるため記録せず"));
+    CHECK(checkRecords(expected));
+
+    // 記録済みの同じ地震（REST APIでの再取得）は何もしない
+    hostLog().clear();
+    CHECK(!appendHistory(makeEvent(300)));
+    CHECK(getHistoryCount() == expected.size());
+
+    // 続報: rewriteRecord()で同じ位置を書き換える（震度の更新）
+    EarthquakeData revised = makeEvent(300);
+    revised.maxIntensity = Intensity::Int5Lower;
+    revised.magnitude = 5.1f;
+    CHECK(appendHistory(revised));
+    CHECK(hostLogContains("[History] 続報で書き換え: 地震300 (300件目)"));
+    EarthquakeData data;
+    CHECK(readHistory(300, data) && data.maxIntensity == Intensity::Int5Lower && data.magnitude == 5.1f);
+    CHECK(getHistoryCount() == expected.size());
+
+    // 続報で発生時刻が変わったインデックスの区切りのレコード（256件目）は、インデックスも書き換える
+    EarthquakeData shifted = makeEvent(256);
+    shifted.originTime += 30;
+    CHECK(appendHistory(shifted));
+    CHECK(readHistory(256, data) && data.originTime == shifted.originTime);
+    CHECK(findHistoryBefore(shifted.originTime) == 255);
+    CHECK(checkIndexFile());
+
+    // 区切り以外のレコードは発生時刻と震源の更新を同じ位置に書き換える
+    EarthquakeData moved = makeEvent(400);
+    moved.originTime += EVENT_SAME_TIME_S;
+    moved.latitude += 0.1f;
+    CHECK(appendHistory(moved));
+    CHECK(readHistory(400, data) && data.originTime == moved.originTime && data.latitude == moved.latitude);
+
+    // 末尾への続報（最新の発生時刻も書き換わり、次の地震は末尾に追記される）
+    EarthquakeData newest = makeEvent(599);
+    newest.depth = 20;
+    CHECK(appendHistory(newest));
+    CHECK(appendHistory(makeEvent(600)));
+    expected.push_back(600);
+    CHECK(checkRecords(expected));
+    CHECK(checkIndexFile());
+    CHECK(checkFindBefore());
+    logHistoryStats();
+    CHECK(hostLogContains("(うち挿入3件, 記録せず1件)"));
+
+    // 再起動: インデックスファイルをそのまま読み込む
+    hostLog().clear();
+    CHECK(initHistory());
+    CHECK(!hostLogContains("[History] インデックス再構築"));
+    CHECK(getHistoryCount() == expected.size());
+    CHECK(checkFindBefore());
+
+    // インデックスファイルが件数と合わない場合は再構築する
+    SD.remove(HISTORY_INDEX_PATH);
+    File stale = SD.open(HISTORY_INDEX_PATH, FILE_WRITE);
+    uint32_t zero = 0;
+    stale.write((const uint8_t *)&zero, sizeof(zero));
+    stale.close();
+    hostLog().clear();
+    CHECK(initHistory());
+    CHECK(hostLogContains("[History] インデックス再構築: 3件"));
+    CHECK(checkIndexFile());
+    CHECK(checkFindBefore());
+
+    // 電源断で書きかけのレコードは件数に含めず、次の追記で上書きする
+    File partial = SD.open(HISTORY_FILE_PATH, FILE_APPEND);
+    uint8_t torn[20] = {};
+    partial.write(torn, sizeof(torn));
+    partial.close();
+    hostLog().clear();
+    CHECK(initHistory());
+    CHECK(hostLogContains("[History] 末尾の不完全なレコードを破棄"));
+    CHECK(getHistoryCount() == expected.size());
+    CHECK(appendHistory(makeEvent(601)));
+    expected.push_back(601);
+    CHECK(checkRecords(expected));
+    File file = SD.open(HISTORY_FILE_PATH, FILE_READ);
+    CHECK(file.size() == 8 + expected.size() * sizeof(EventRecord));
+    file.close();
+}
+
+/**
+ * @brief スクロール1フレームの読み出し（index行目から古い方へFRAME_ROWS行）
+ */
+static void readFrame(uint32_t index) {
+    EarthquakeData data;
+    for (uint32_t row = 0; row < FRAME_ROWS && row <= index; row++) {
+        readHistory(index - row, data);
+    }
+}
+
+/**
+ * @brief 10万件の履歴の各位置へジャンプ（findHistoryBefore()）してスクロールし、1フレームの時間とSDカードへのアクセス量を出力
+ */
+static void benchmarkScroll() {
+    hostSetSdRoot(hostScratchDirectory("test_history_bench_sd"));
+    CHECK(initHistory());
+    double start = hostWallMicros();
+    for (uint32_t n = 0; n < BENCHMARK_RECORDS; n++) {
+        appendHistory(makeEvent(n));
+    }
+    printf("追記: %u件 %.1fus/件 (ホスト)\n", getHistoryCount(), (hostWallMicros() - start) / BENCHMARK_RECORDS);
+    CHECK(getHistoryCount() == BENCHMARK_RECORDS);
+
+    // 再起動時のインデックス再構築（HISTORY_INDEX_STRIDE件ごとに1レコード）
+    SD.remove(HISTORY_INDEX_PATH);
+    start = hostWallMicros();
+    CHECK(initHistory());
+    printf("インデックス再構築: %.0fus (ホスト)\n", hostWallMicros() - start);
+    CHECK(checkIndexFile());
+
+    // 各位置で、リスト末尾に続く位置の検索と最初のフレーム（ページはキャッシュにない）、続くスクロールのフレーム
+    const uint32_t positions[] = {FRAME_ROWS, BENCHMARK_RECORDS / 4, BENCHMARK_RECORDS / 2, BENCHMARK_RECORDS * 3 / 4,
+                                  BENCHMARK_RECORDS - 1};
+    for (uint32_t position : positions) {
+        initHistory();  // キャッシュを空にする
+        EarthquakeData target = makeEvent(position + 1);
+
+        hostSdStats() = HostSdStats();
+        double jumpStart = hostWallMicros();
+        int32_t found = findHistoryBefore(target.originTime);
+        readFrame((uint32_t)found);
+        double jumpTime = hostWallMicros() - jumpStart;
+        HostSdStats jump = hostSdStats();
+        CHECK(found == (int32_t)position);
+
+        hostSdStats() = HostSdStats();
+        double scrollStart = hostWallMicros();
+        for (uint32_t frame = 1; frame <= FRAMES_PER_POSITION; frame++) {
+            readFrame(position - frame);
+        }
+        double scrollTime = (hostWallMicros() - scrollStart) / FRAMES_PER_POSITION;
+        HostSdStats scroll = hostSdStats();
+
+        printf("%6u件目: ジャンプ %.1fus (SD読み出し%u回 %lluバイト), スクロール %.2fus/フレーム (%uフレームでSD読み出し%u回) (ホスト)\n",
+               position, jumpTime, jump.reads, (unsigned long long)jump.bytesRead, scrollTime, FRAMES_PER_POSITION,
+               scroll.reads);
+
+        // SDカードの読み出しは位置・件数によらず、区間内の二分探索とフレームの行が触れるページ数で抑えられる
+        CHECK(jump.reads <= JUMP_PAGES_MAX);
+        CHECK(scroll.reads <= FRAMES_PER_POSITION / HISTORY_PAGE_RECORDS + 1);
+    }
+}
+
+int main() {
+    testAppendInsertRewrite();
+    benchmarkScroll();
+    return hostTestResult();
+}
@@ -0,0 +1,196 @@
+/**
+ * @file test_intensity.cpp
+ * @brief 計測震度の算出（intensityfilter.cpp）を基準波形で確認し、1窓の処理時間とサイクル数を出力
+ * @details 単精度FFTの結果を、同じ手順を倍精度の素朴なDFTで計算した参照値と比較する（丸め前の差0.001以内）。
+ *          入力は正弦波（0.5〜10Hz）、3成分の乱数波形、host/traces/strong.binのS波部分。
+ *          1Hz・振幅100galの正弦波は解析的な期待値（4.9）、丸めは気象庁の例（4.4951 → 4.5）とも比較する
+ */
+
+#include "intensityfilter.h"
+#include "hosttest.h"
+#include <complex>
+#include <vector>
+
+#define WINDOW INSTRUMENTAL_WINDOW_SAMPLES
+#define TOLERANCE 0.001          // 参照値との差の上限（丸め前の計測震度、単精度の誤差は1e-4未満）
+#define BENCHMARK_WINDOWS 200    // 処理時間を計測する窓数
+
+static const double GAL_PER_MG = 0.980665;
+
+/**
+ * @brief 参照値: 倍精度の素朴なDFTで同じ手順（平均除去・テーパー・3フィルタ・0.3秒ルール）を計算
+ */
+static double referenceInstrumental(const std::vector<SeismicSample> &samples) {
+    const int taperSamples = WINDOW / 20;
+    const int exceed = SEISMIC_SAMPLE_RATE_HZ * 3 / 10;
+    std::vector<double> magnitudeSquared(WINDOW, 0.0);
+
+    for (int axis = 0; axis < 3; axis++) {
+        std::vector<double> signal(WINDOW);
+        double mean = 0;
+        for (int i = 0; i < WINDOW; i++) {
+            const SeismicSample &s = samples[i];
+            signal[i] = (axis == 0) ? s.x : (axis == 1) ? s.y : s.z;
+            mean += signal[i];
+        }
+        mean /= WINDOW;
+        for (int i = 0; i < WINDOW; i++) {
+            double w = GAL_PER_MG;
+            int edge = std::min(i, WINDOW - 1 - i);
+            if (edge < taperSamples) {
+                w *= 0.5 * (1.0 - cos(M_PI * (edge + 0.5) / taperSamples));
+            }
+            signal[i] = (signal[i] - mean) * w;
+        }
+
+        std::vector<std::complex<double>> spectrum(WINDOW);
+        for (int k = 0; k < WINDOW; k++) {
+            std::complex<double> acc = 0;
+            for (int i = 0; i < WINDOW; i++) {
+                acc += signal[i] * std::polar(1.0, -2.0 * M_PI * (double)k * i / WINDOW);
+            }
+            int bin = (k <= WINDOW / 2) ? k : WINDOW - k;
+            double gain = 0;
+            if (bin > 0) {
+                double f = (double)bin * SEISMIC_SAMPLE_RATE_HZ / WINDOW;
+                double x = f / 10.0;
+                double poly = 1 + 0.694 * pow(x, 2) + 0.241 * pow(x, 4) + 0.0557 * pow(x, 6) + 0.009664 * pow(x, 8) +
+                              0.00134 * pow(x, 10) + 0.000155 * pow(x, 12);
+                gain = sqrt(1.0 / f) / sqrt(poly) * sqrt(1.0 - exp(-pow(f / 0.5, 3)));
+            }
+            spectrum[k] = acc * gain;
+        }
+        for (int i = 0; i < WINDOW; i++) {
+            std::complex<double> acc = 0;
+            for (int k = 0; k < WINDOW; k++) {
+                acc += spectrum[k] * std::polar(1.0, 2.0 * M_PI * (double)k * i / WINDOW);
+            }
+            double value = acc.real() / WINDOW;
+            magnitudeSquared[i] += value * value;
+        }
+    }
+
+    std::sort(magnitudeSquared.begin(), magnitudeSquared.end());
+    return log10(magnitudeSquared[WINDOW - exceed]) + 0.94;
+}
+
+/**
+ * @brief 単精度の計算結果（丸め前）
+ */
+static float kernelInstrumental(const std::vector<SeismicSample> &samples) {
+    static IntensityWindow window;
+    std::copy(samples.begin(), samples.end(), window.samples);
+    return computeInstrumentalRaw(window);
+}
+
+/**
+ * @brief 参照値と比較し、結果を出力
+ */
+static void checkAgainstReference(const char *name, const std::vector<SeismicSample> &samples) {
+    float value = kernelInstrumental(samples);
+    double reference = referenceInstrumental(samples);
+    printf("%s: 計測震度%.3f (参照値%.3f, 差%+.4f) → %.1f\n", name, value, reference, value - reference,
+           roundInstrumental(value));
+    CHECK(fabs(value - reference) <= TOLERANCE);
+}
+
+/**
+ * @brief 正弦波（mg、重力1000mgをZに加える）
+ */
+static std::vector<SeismicSample> sineWindow(double frequency, double amplitudeGal, int axis) {
+    std::vector<SeismicSample> samples(WINDOW);
+    for (int i = 0; i < WINDOW; i++) {
+        double value = amplitudeGal / GAL_PER_MG * sin(2.0 * M_PI * frequency * i / SEISMIC_SAMPLE_RATE_HZ);
+        int16_t mg = (int16_t)lround(value);
+        samples[i] = {0, 0, 1000};
+        (axis == 0 ? samples[i].x : axis == 1 ? samples[i].y : samples[i].z) += mg;
+    }
+    return samples;
+}
+
+/**
+ * @brief 3成分の乱数波形（一様乱数、決定的な線形合同法）
+ */
+static std::vector<SeismicSample> noiseWindow(int amplitudeMilliG) {
+    std::vector<SeismicSample> samples(WINDOW);
+    uint32_t state = 12345;
+    auto next = [&state, amplitudeMilliG]() {
+        state = state * 1103515245u + 12345u;
+        return (int16_t)((int32_t)((state >> 16) % (2 * amplitudeMilliG + 1)) - amplitudeMilliG);
+    };
+    for (SeismicSample &s : samples) {
+        s.x = next();
+        s.y = next();
+        s.z = (int16_t)(1000 + next());
+    }
+    return samples;
+}
+
+/**
+ * @brief 波形ファイルのトリガーサンプル以降のoffsetサンプル目から1窓分
+ */
+static bool traceWindow(const char *name, uint32_t offset, std::vector<SeismicSample> &samples) {
+    FILE *file = fopen(hostSourcePath(std::string("traces/") + name + ".bin").c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t header[32];
+    uint32_t preSamples = 0;
+    bool ok = fread(header, 1, sizeof(header), file) == sizeof(header);
+    memcpy(&preSamples, header + 16, 4);
+    samples.resize(WINDOW);
+    ok = ok && fseek(file, (long)(sizeof(header) + (preSamples + offset) * sizeof(SeismicSample)), SEEK_SET) == 0 &&
+         fread(samples.data(), sizeof(SeismicSample), WINDOW, file) == WINDOW;
+    fclose(file);
+    return ok;
+}
+
+int main() {
+    initIntensityFilter();
+
+    // 気象庁の丸め: 小数第3位を四捨五入し、第2位以下を切り捨てる
+    CHECK(fabsf(roundInstrumental(4.4951f) - 4.5f) < 1e-4f);
+    CHECK(fabsf(roundInstrumental(4.4949f) - 4.4f) < 1e-4f);
+    CHECK(fabsf(roundInstrumental(4.96f) - 4.9f) < 1e-4f);
+    CHECK(fabsf(roundInstrumental(5.995f) - 6.0f) < 1e-4f);
+
+    // 1Hz・振幅100galの正弦波（フィルタ後約99.6gal、0.3秒ルールで約99.2gal、I = 4.93）
+    std::vector<SeismicSample> reference1Hz = sineWindow(1.0, 100.0, 0);
+    float value = kernelInstrumental(reference1Hz);
+    CHECK(fabsf(value - 4.933f) < 0.02f);
+    CHECK(fabsf(roundInstrumental(value) - 4.9f) < 1e-4f);
+
+    // 周波数・成分を変えた正弦波、3成分の乱数、記録波形を参照値と比較
+    checkAgainstReference("1Hz 100gal X", reference1Hz);
+    checkAgainstReference("0.5Hz 100gal Y", sineWindow(0.5, 100.0, 1));
+    checkAgainstReference("2Hz 300gal X", sineWindow(2.0, 300.0, 0));
+    checkAgainstReference("5Hz 50gal Z", sineWindow(5.0, 50.0, 2));
+    checkAgainstReference("10Hz 20gal Y", sineWindow(10.0, 20.0, 1));
+    checkAgainstReference("乱数 ±5mg", noiseWindow(5));
+    checkAgainstReference("乱数 ±200mg", noiseWindow(200));
+    std::vector<SeismicSample> strong;
+    CHECK(traceWindow("strong", 200, strong));
+    if (!strong.empty()) {
+        checkAgainstReference("strong.bin S波", strong);
+    }
+
+    // 揺れがない（一定値のみ）場合は負の値
+    std::vector<SeismicSample> still(WINDOW, SeismicSample{0, 0, 1000});
+    CHECK(kernelInstrumental(still) < 0.0f);
+
+    // 1窓の処理時間（ホスト）
+    static IntensityWindow window;
+    double elapsed = 0;
+    uint64_t cycles = 0;
+    for (int i = 0; i < BENCHMARK_WINDOWS; i++) {
+        std::copy(reference1Hz.begin(), reference1Hz.end(), window.samples);
+        double start = hostWallMicros();
+        uint64_t startCycles = hostCycles();
+        computeInstrumentalRaw(window);
+        cycles += hostCycles() - startCycles;
+        elapsed += hostWallMicros() - start;
+    }
+    printf("computeInstrumentalRaw(): %.1fus, %lluサイクル/窓 (ホスト)\n", elapsed / BENCHMARK_WINDOWS,
+           (unsigned long long)(cycles / BENCHMARK_WINDOWS));
+    return hostTestResult();
+}
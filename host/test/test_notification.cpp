@@ -0,0 +1,304 @@
+/**
+ * @file test_notification.cpp
+ * @brief 地震情報が毎分50件届く場合の通知キュー（集約・重要度・バナー表示）の確認と処理時間の出力
+ * @details 模擬ノード（MockNode）が受信・解析済みの地震情報を1.2秒ごとに生成し、websocket.cppと同じく
+ *          notifyEarthquake()に渡す。仮想時刻を10msずつ進めてschedulerRun()・updateNotification()を呼び出す（loop()と同じ）。
+ *          通知の開始はログ（集約通知開始・通知処理開始）から検出し、次を確認する:
+ *          - 全件がリストに追加され、全件がいずれかの通知（代表または集約件数）に含まれる（押し出しを含めて取りこぼしがない）
+ *          - 重要度の高い地震（震度5弱・大津波警報）は集約期間を待たず、通知中の点滅の終了後すぐに代表として通知される
+ *          - 2件以上の集約通知はヘッダーに「N件: 最大震度X」を表示し、到達カウントダウンの表示中は表示しない
+ */
+
+#include "notification.h"
+#include "config.h"
+#include "scheduler.h"
+#include "hosttest.h"
+#include <M5Unified.h>
+
+// ========================================
+// 他のモジュールの代用
+// ========================================
+
+static bool arrivalActive = false;   // 到達カウントダウンの表示中
+static uint32_t listAdded = 0;       // リストに追加した件数
+static uint32_t headerRedraws = 0;   // ヘッダーの再描画回数
+
+const AppConfig &getAppConfig() {
+    static AppConfig config = {};
+    return config;
+}
+
+bool hasSiteLocation() {
+    return false;  // 設置場所なし（全ての地震を最大震度で通知）
+}
+
+bool getSiteLocation(float &latitude, float &longitude) {
+    (void)latitude;
+    (void)longitude;
+    return false;
+}
+
+uint32_t greatCircleDistanceKm10(float lat1, float lon1, float lat2, float lon2) {
+    (void)lat1;
+    (void)lon1;
+    (void)lat2;
+    (void)lon2;
+    return 0;
+}
+
+void startArrivalCountdown(const EarthquakeData &data) {
+    (void)data;
+}
+
+bool isArrivalCountdownActive() {
+    return arrivalActive;
+}
+
+void captureNetworkWaveform(const EarthquakeData &data) {
+    (void)data;
+}
+
+void addEarthquakeToDisplay(const EarthquakeData &data) {
+    (void)data;
+    listAdded++;
+}
+
+void renderList() {}
+
+void drawMainHeader() {
+    headerRedraws++;
+}
+
+void drawWebSocketIndicator(bool connected) {
+    (void)connected;
+}
+
+bool getWebSocketConnected() {
+    return true;
+}
+
+// earthquake.cppのisSameEvent()と同じ判定（震央間の距離は球面上の近似）
+bool isSameEvent(const EarthquakeData &a, const EarthquakeData &b) {
+    if (a.originTime == 0 || b.originTime == 0) {
+        return false;
+    }
+    time_t diff = (a.originTime > b.originTime) ? a.originTime - b.originTime : b.originTime - a.originTime;
+    if (diff > EVENT_SAME_TIME_S) {
+        return false;
+    }
+    float dLat = (a.latitude - b.latitude) * 111.2f;
+    float dLon = (a.longitude - b.longitude) * 111.2f * cosf((a.latitude + b.latitude) * 0.5f * (float)M_PI / 180.0f);
+    return sqrtf(dLat * dLat + dLon * dLon) <= EVENT_SAME_DISTANCE_KM;
+}
+
+// ========================================
+// 模擬ノード
+// ========================================
+
+#define EVENTS_PER_MINUTE 50
+#define EVENT_INTERVAL_MS (60000 / EVENTS_PER_MINUTE)
+#define EVENT_COUNT 500            // 送信する地震情報の件数（10分間）
+#define STRONG_EVERY 25            // 震度5弱を送る間隔（件）
+#define TSUNAMI_EVENT 213          // 大津波警報を送る番号（直前の震度5弱と同じ通知にまとまり、代表になる）
+#define ARRIVAL_FIRST 300          // 到達カウントダウンを表示中とする範囲（番号）
+#define ARRIVAL_LAST 340
+#define STEP_MS 10                 // loop()の周期
+#define DRAIN_MS 30000             // 送信後に通知キューが空になるまで進める時間
+#define STRONG_LATENCY_MAX_MS 2500 // 重要な地震の受信から通知開始までの上限（点滅1.5秒 + ビープ音3回 + 余裕）
+#define LATENCY_MAX_MS 12500       // 全ての地震の上限（集約期間10秒 + 通知1回分）
+
+static const time_t BASE_TIME = 1767225600;  // 2026-01-01 00:00:00 UTC
+
+/**
+ * @brief 受信・解析済みの地震情報を一定間隔で生成する模擬ノード
+ * @details 発生時刻を2分ずつずらし、続報として統合されない別々の地震にする
+ */
+struct MockNode {
+    int sent = 0;
+    unsigned long nextMillis = 0;
+
+    bool poll(unsigned long now, EarthquakeData &data) {
+        if (sent >= EVENT_COUNT || (long)(now - nextMillis) < 0) {
+            return false;
+        }
+        data = EarthquakeData();
+        data.originTime = BASE_TIME + (time_t)sent * 120;
+        data.utcOffsetMinutes = 540;
+        data.latitude = 30.0f + (sent % 40) * 0.3f;
+        data.longitude = 130.0f + (sent % 30) * 0.3f;
+        data.depth = 10 + sent % 50;
+        data.magnitude = 3.0f + (sent % 20) * 0.1f;
+        data.tsunami = "None";
+        if (sent == TSUNAMI_EVENT) {
+            data.hypocenterName = "津波" + String(sent);
+            data.maxIntensity = Intensity::Int3;
+            data.tsunami = "MajorWarning";
+        } else if (sent % STRONG_EVERY == STRONG_EVERY / 2) {
+            data.hypocenterName = "強い地震" + String(sent);
+            data.maxIntensity = Intensity::Int5Lower;
+        } else {
+            data.hypocenterName = "地震" + String(sent);
+            data.maxIntensity = (Intensity)((int)Intensity::Int1 + sent % 3);
+        }
+        sent++;
+        nextMillis += EVENT_INTERVAL_MS;
+        return true;
+    }
+};
+
+// ========================================
+// 通知の検出と判定
+// ========================================
+
+/**
+ * @brief 通知に含まれていない受信済みの地震
+ */
+struct Received {
+    std::string name;
+    unsigned long millis;
+    int urgency;  // 重要度の高い地震（1: 震度5弱、2: 大津波警報、0はそれ以外）
+};
+
+static std::vector<Received> uncovered;
+static uint32_t alerts = 0;
+static uint32_t coveredEvents = 0;
+static uint32_t bannersExpected = 0;
+static uint32_t bannersDrawn = 0;
+static uint32_t bannersSuppressed = 0;  // 到達カウントダウンの表示中の集約通知
+static unsigned long latencyMax = 0;
+static unsigned long urgentLatencyMax = 0;
+
+/**
+ * @brief 通知の開始のログを処理（通知した件数・代表・バナーを判定）
+ * @param line ログの行
+ * @param drawn このステップで描画した文字列
+ */
+static void onAlertLog(const std::string &line, const std::vector<std::string> &drawn) {
+    static const std::string COALESCED = "[Notification] 集約通知開始: ";
+    static const std::string SINGLE = "[Notification] 通知処理開始: ";
+    int total;
+    std::string representative;
+    if (line.compare(0, COALESCED.size(), COALESCED) == 0) {
+        std::string rest = line.substr(COALESCED.size());
+        total = atoi(rest.c_str());
+        size_t open = rest.find(" (");
+        size_t comma = rest.find(',', open);
+        representative = rest.substr(open + 2, comma - open - 2);
+
+        std::string banner = rest.substr(0, open);
+        bool shown = std::find(drawn.begin(), drawn.end(), banner) != drawn.end();
+        if (arrivalActive) {
+            bannersSuppressed++;
+            CHECK(!shown);
+            CHECK(!isNotificationBannerShown());
+        } else {
+            bannersExpected++;
+            bannersDrawn += shown ? 1 : 0;
+            CHECK(shown && isNotificationBannerShown());
+        }
+    } else if (line.compare(0, SINGLE.size(), SINGLE) == 0) {
+        total = 1;
+        std::string rest = line.substr(SINGLE.size());
+        representative = rest.substr(0, rest.find(' '));
+    } else {
+        return;
+    }
+
+    // キューは通知のたびに全件まとめて空になる: それまでに受信した全件がこの通知に含まれる
+    alerts++;
+    coveredEvents += total;
+    CHECK(total == (int)uncovered.size());
+    unsigned long now = millis();
+    const Received *mostUrgent = nullptr;
+    for (const Received &event : uncovered) {
+        unsigned long latency = now - event.millis;
+        latencyMax = std::max(latencyMax, latency);
+        CHECK(latency <= LATENCY_MAX_MS);
+        if (event.urgency > 0) {
+            urgentLatencyMax = std::max(urgentLatencyMax, latency);
+            CHECK(latency <= STRONG_LATENCY_MAX_MS);
+            if (mostUrgent == nullptr || event.urgency > mostUrgent->urgency) {
+                mostUrgent = &event;
+            }
+        }
+    }
+    if (mostUrgent != nullptr) {
+        CHECK(representative == mostUrgent->name);
+    }
+    uncovered.clear();
+}
+
+/**
+ * @brief 前回以降のログと描画した文字列を処理
+ */
+static void scanLog() {
+    static size_t logSeen = 0;
+    static size_t drawnSeen = 0;
+    std::vector<std::string> drawn(hostDrawnText().begin() + drawnSeen, hostDrawnText().end());
+    drawnSeen = hostDrawnText().size();
+    for (; logSeen < hostLog().size(); logSeen++) {
+        onAlertLog(hostLog()[logSeen], drawn);
+    }
+}
+
+int main() {
+    initNotification();
+    scanLog();
+
+    MockNode node;
+    unsigned long startMillis = millis();
+    node.nextMillis = startMillis + EVENT_INTERVAL_MS;
+    double notifyMicros = 0;
+    double notifyMicrosMax = 0;
+    double loopMicros = 0;
+    unsigned long endMillis = 0;
+    uint32_t steps = 0;
+
+    while (node.sent < EVENT_COUNT || (long)(millis() - endMillis) < DRAIN_MS) {
+        hostAdvanceMillis(STEP_MS);
+        double start = hostWallMicros();
+        schedulerRun();
+        updateNotification();
+        loopMicros += hostWallMicros() - start;
+        steps++;
+        scanLog();
+
+        EarthquakeData data;
+        if (node.poll(millis(), data)) {
+            int number = node.sent - 1;
+            arrivalActive = (number >= ARRIVAL_FIRST && number <= ARRIVAL_LAST);
+            int urgency = (data.tsunami == "MajorWarning") ? 2 : (data.maxIntensity == Intensity::Int5Lower) ? 1 : 0;
+            uncovered.push_back({data.hypocenterName.c_str(), millis(), urgency});
+            start = hostWallMicros();
+            notifyEarthquake(data);
+            double elapsed = hostWallMicros() - start;
+            notifyMicros += elapsed;
+            notifyMicrosMax = std::max(notifyMicrosMax, elapsed);
+            if (node.sent == EVENT_COUNT) {
+                endMillis = millis();
+                arrivalActive = false;
+            }
+            scanLog();
+        }
+    }
+
+    // 取りこぼしがない: 全件がリストに追加され、全件がいずれかの通知に含まれる
+    CHECK(listAdded == EVENT_COUNT);
+    CHECK(coveredEvents == EVENT_COUNT);
+    CHECK(uncovered.empty());
+    CHECK(hostLogContains("キュー満杯"));
+    CHECK(!M5.Speaker.tones.empty());
+
+    // バナー: 集約通知ごとに表示し、BANNER_HOLD_MS後にヘッダーを元に戻す
+    CHECK(bannersExpected > 0 && bannersDrawn == bannersExpected);
+    CHECK(bannersSuppressed > 0);
+    CHECK(!isNotificationBannerShown());
+    CHECK(headerRedraws > 0);
+
+    double minutes = (millis() - startMillis) / 60000.0;
+    printf("毎分%d件 × %d件 (%.1f分): 通知%u回, 集約バナー%u回, 最大遅延%lums (重要な地震%lums)\n", EVENTS_PER_MINUTE,
+           EVENT_COUNT, minutes, alerts, bannersDrawn, latencyMax, urgentLatencyMax);
+    printf("notifyEarthquake(): 平均%.2fus, 最大%.1fus / loop()の通知処理: 平均%.3fus (ホスト)\n",
+           notifyMicros / EVENT_COUNT, notifyMicrosMax, loopMicros / steps);
+    return hostTestResult();
+}
@@ -0,0 +1,196 @@
+/**
+ * @file test_render.cpp
+ * @brief 描画のゴールデン画像テスト（リストの先頭・スクロール後・余震クラスタの展開・詳細画面）
+ * @details display.cppを実際のタッチ操作の経路（updateDisplay()）で動かし、ヘッドレス描画のフレームバッファを
+ *          host/golden/のPPMと画素単位で比較する。不一致の場合は実際の画像を<名前>.<band|direct>.actual.ppmに書き出す。
+ *          文字は字形の代わりに1文字ごとの矩形で描かれる（shim/M5Unified.h）。
+ *          バンド描画（test_render）と直接描画（test_render_direct、LIST_RENDER_DIRECT）は同じゴールデン画像と比較し、
+ *          renderList()のホストでの描画時間と1回あたりの集計値を出力する
+ */
+
+#include "display.h"
+#include "history.h"
+#include "hosttest.h"
+#include "rendertarget.h"
+#include <SD.h>
+
+// ========================================
+// 他のモジュールの代用（描画に関係しない部分）
+// ========================================
+
+bool isTimeSynced = false;  // 時刻未取得（カードは絶対時刻で表示し、実行時刻に依存しない）
+
+bool isSDCardMounted() {
+    return true;
+}
+
+bool findLocalInstrumental(time_t originTime, float &instrumental) {
+    (void)originTime;
+    (void)instrumental;
+    return false;
+}
+
+bool isNotificationActive() {
+    return false;
+}
+
+bool getSiteLocation(float &latitude, float &longitude) {
+    latitude = 35.68f;  // 東京
+    longitude = 139.77f;
+    return true;
+}
+
+// earthquake.cppのisSameEvent()と同じ判定（震央間の距離は球面上の近似）
+bool isSameEvent(const EarthquakeData &a, const EarthquakeData &b) {
+    if (a.originTime == 0 || b.originTime == 0) {
+        return false;
+    }
+    time_t diff = (a.originTime > b.originTime) ? a.originTime - b.originTime : b.originTime - a.originTime;
+    if (diff > EVENT_SAME_TIME_S) {
+        return false;
+    }
+    float dLat = (a.latitude - b.latitude) * 111.2f;
+    float dLon = (a.longitude - b.longitude) * 111.2f * cosf((a.latitude + b.latitude) * 0.5f * (float)M_PI / 180.0f);
+    return sqrtf(dLat * dLat + dLon * dLon) <= EVENT_SAME_DISTANCE_KM;
+}
+
+// ========================================
+// シナリオ
+// ========================================
+
+static EarthquakeData makeEvent(time_t originTime, const char *name, float latitude, float longitude, int depth,
+                                float magnitude, Intensity intensity, const char *tsunami) {
+    EarthquakeData data;
+    data.originTime = originTime;
+    data.utcOffsetMinutes = 540;
+    data.hypocenterName = name;
+    data.latitude = latitude;
+    data.longitude = longitude;
+    data.depth = depth;
+    data.magnitude = magnitude;
+    data.maxIntensity = intensity;
+    data.tsunami = tsunami;
+    return data;
+}
+
+/**
+ * @brief 1フレーム分のタッチ状態を設定して表示を更新
+ */
+static void touchFrame(bool pressed, int16_t y) {
+    M5.Touch.set(pressed, 160, y);
+    updateDisplay();
+}
+
+/**
+ * @brief 慣性スクロールが止まるまで表示を更新
+ */
+static void settle() {
+    for (int i = 0; i < 200; i++) {
+        touchFrame(false, -1);
+    }
+}
+
+#ifdef LIST_RENDER_DIRECT
+#define LIST_RENDER_MODE "直接"
+#define LIST_RENDER_TAG "direct"  // 書き出すファイル名（2つのテストを並列に実行できるよう分ける）
+#else
+#define LIST_RENDER_MODE "バンド"
+#define LIST_RENDER_TAG "band"
+#endif
+#define BENCHMARK_RENDERS 200  // 描画時間を計測する描画回数
+
+/**
+ * @brief renderList()の描画時間（ホストの実時間）と1回あたりの集計値を出力
+ * @param scene 画面の名前
+ */
+static void benchmarkRenderList(const char *scene) {
+    renderList();  // バンドの確保など初回のみの処理を除く
+    Screen.resetCounters();
+    double start = hostWallMicros();
+    for (int i = 0; i < BENCHMARK_RENDERS; i++) {
+        renderList();
+    }
+    double average = (hostWallMicros() - start) / BENCHMARK_RENDERS;
+    const RenderCounters &stats = Screen.counters();
+    printf("renderList(%s) %s: %.1fus/回 (ホスト), 描画%u回, %u画素, SPI%uバイト\n", LIST_RENDER_MODE, scene, average,
+           stats.drawCalls / BENCHMARK_RENDERS, stats.pixels / BENCHMARK_RENDERS, stats.spiBytes / BENCHMARK_RENDERS);
+}
+
+/**
+ * @brief フレームバッファをゴールデン画像と比較（UPDATE_GOLDEN=1では書き出し）
+ */
+static void checkGolden(const char *name) {
+    std::string golden = hostSourcePath(std::string("golden/") + name + ".ppm");
+    if (hostUpdateGolden()) {
+        CHECK(dumpRenderTarget(golden.c_str()));
+        return;
+    }
+    bool matched = checkRenderGolden(name, golden.c_str());
+    if (!matched) {
+        printf("%s\n", hostLog().back().c_str());
+        dumpRenderTarget((std::string(name) + "." LIST_RENDER_TAG ".actual.ppm").c_str());
+    }
+    CHECK(matched);
+}
+
+int main() {
+    hostSetSdRoot(hostScratchDirectory("test_render_" LIST_RENDER_TAG "_sd"));
+    CHECK(Screen.begin());
+    CHECK(initHistory());
+
+    // 新しい順。茨城県沖の3件は余震クラスタ（1枚のカードに折りたたまれる）
+    const time_t base = 1704085200;  // 2024-01-01 05:00 UTC（14:00 JST）
+    EarthquakeData fresh[] = {
+        makeEvent(base + 7200, "能登半島沖", 37.5f, 137.3f, 10, 7.6f, Intensity::Int7, "MajorWarning"),
+        makeEvent(base + 5400, "茨城県沖", 36.40f, 141.00f, 40, 4.1f, Intensity::Int3, "None"),
+        makeEvent(base + 3600, "茨城県沖", 36.45f, 141.05f, 50, 5.3f, Intensity::Int5Lower, "NonEffective"),
+        makeEvent(base + 1800, "茨城県沖", 36.42f, 141.10f, 30, 3.2f, Intensity::Int1, "None"),
+        makeEvent(base - 86400, "日向灘", 31.8f, 131.9f, 30, 6.9f, Intensity::Int6Lower, "Watch"),
+        makeEvent(base - 172800, "千葉県北西部", 35.6f, 140.1f, 75, 5.9f, Intensity::Int5Upper, "None"),
+        makeEvent(base - 259200, "石狩地方南部", 42.7f, 141.9f, 35, 6.7f, Intensity::Int6Upper, "Warning"),
+        makeEvent(base - 345600, "熊本県熊本地方", 32.8f, 130.8f, 10, 4.6f, Intensity::Int4, "None"),
+        makeEvent(base - 432000, "震源不明", 0.0f, 0.0f, 0, 0.0f, Intensity::Unknown, ""),
+    };
+    const int freshCount = sizeof(fresh) / sizeof(fresh[0]);
+    mergeFetchedEarthquakes(fresh, freshCount);
+    Screen.resetCounters();
+    renderList();
+    checkGolden("list_top");
+    benchmarkRenderList("先頭");
+
+    // 下にドラッグして離す（慣性で止まるまで）
+    touchFrame(true, 200);
+    touchFrame(true, 140);
+    touchFrame(true, 80);
+    touchFrame(false, 80);
+    settle();
+    Screen.resetCounters();
+    renderList();
+    checkGolden("list_scrolled");
+    benchmarkRenderList("スクロール後");
+
+    // 上に大きくドラッグして先頭に戻し、クラスタのカード（2枚目）をタップして展開
+    for (int i = 0; i < 3; i++) {
+        touchFrame(true, 40);
+        touchFrame(true, 230);
+        touchFrame(false, 230);
+        settle();
+    }
+    touchFrame(true, 150);
+    touchFrame(false, 150);
+    CHECK(hostLogContains("[Cluster] #"));
+    Screen.resetCounters();
+    renderList();
+    checkGolden("list_cluster_expanded");
+
+    // 先頭のカードをタップして詳細画面（震央地図）を開き、タッチで戻る
+    touchFrame(true, 60);
+    touchFrame(false, 60);
+    CHECK(hostLogContains("[Display] 詳細画面を表示: 能登半島沖"));
+    checkGolden("detail");
+    touchFrame(true, 60);
+    touchFrame(false, 60);
+    checkGolden("list_cluster_expanded");
+
+    return hostTestResult();
+}
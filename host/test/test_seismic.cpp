@@ -0,0 +1,226 @@
+/**
+ * @file test_seismic.cpp
+ * @brief 揺れ検知（STA/LTAトリガー）に加速度波形を入力し、トリガーの遅れと1サンプルの処理時間を出力
+ * @details host/traces/の波形（本機の波形記録と同じ"EQWF"形式）をfeedSeismicSample()で1サンプルずつ入力し、
+ *          サンプリング周期ごとに仮想時刻を進めてupdateSeismic()を呼び出す（loop()と同じ）。
+ *          トリガーの遅れは波形のトリガーサンプル（ヘッダーのpreSamples）から揺れ検知の通知までの時間。
+ *          LTAが安定するまでトリガー前の部分を繰り返し入力してから波形全体を入力する。
+ *          既知の波形（tools/gen_traces.pyの合成波形）は通知の有無・推定震度・遅れの上限を判定し、
+ *          それ以外のファイル（本機で記録した波形）は結果の出力のみ行う
+ */
+
+#include "seismic.h"
+#include "earthquake.h"
+#include "hosttest.h"
+#include <M5Unified.h>
+#include <dirent.h>
+#include <map>
+
+// ========================================
+// 他のモジュールの代用（揺れ検知の通知を記録）
+// ========================================
+
+/**
+ * @brief 揺れ検知の通知（notifyLocalShake()の呼び出し）
+ */
+struct ShakeNotice {
+    unsigned long millis;
+    Intensity intensity;
+};
+static std::vector<ShakeNotice> notices;
+
+void notifyLocalShake(const EarthquakeData &data) {
+    notices.push_back({millis(), data.maxIntensity});
+}
+
+bool getInstrumentalSince(uint32_t sinceMillis, float &instrumental) {
+    (void)sinceMillis;
+    (void)instrumental;
+    return false;  // 計測震度は使わず、最大加速度からの推定震度で判定する
+}
+
+void captureLocalWaveform(uint32_t onsetSample) {
+    (void)onsetSample;
+}
+
+void captureWaveformSample(uint32_t sequence, const SeismicSample &sample) {
+    (void)sequence;
+    (void)sample;
+}
+
+// ========================================
+// 波形の読み込み
+// ========================================
+
+#define SAMPLE_PERIOD_MS (1000 / SEISMIC_SAMPLE_RATE_HZ)
+#define PRIME_SAMPLES 3000  // 波形の前に入力する静穏部分のサンプル数（LTAの時定数の約3倍）
+#define SETTLE_SAMPLES 2000 // 波形の後に入力する静穏部分のサンプル数（トリガー終了と再通知の間隔を空ける）
+
+/**
+ * @brief 波形ファイル（waveform.cppのWaveformHeaderとサンプル）
+ */
+struct Trace {
+    uint32_t preSamples = 0;  // トリガーサンプルの位置
+    std::vector<SeismicSample> samples;
+};
+
+static bool loadTrace(const std::string &path, Trace &trace) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t header[32];
+    bool ok = fread(header, 1, sizeof(header), file) == sizeof(header);
+    uint32_t magic;
+    uint16_t sampleRate;
+    uint32_t total;
+    memcpy(&magic, header, 4);
+    memcpy(&sampleRate, header + 6, 2);
+    memcpy(&trace.preSamples, header + 16, 4);
+    memcpy(&total, header + 20, 4);
+    ok = ok && magic == 0x46575145 && header[4] == 1 && header[14] == 3 && sampleRate == SEISMIC_SAMPLE_RATE_HZ;
+    if (ok) {
+        trace.samples.resize(total);
+        ok = fread(trace.samples.data(), sizeof(SeismicSample), total, file) == total && trace.preSamples > 0 &&
+             trace.preSamples < total;
+    }
+    fclose(file);
+    return ok;
+}
+
+// ========================================
+// 入力と判定
+// ========================================
+
+/**
+ * @brief 既知の波形の期待値
+ */
+struct TraceExpectation {
+    bool notified;          // 揺れ検知を通知するか
+    Intensity minIntensity; // 通知した推定震度の最大値の範囲
+    Intensity maxIntensity;
+    uint32_t maxLatencyMs;  // トリガーサンプルから最初の通知までの遅れの上限
+};
+
+// moderateのP波（6mg）はSTA/LTA比が3に届かず、4秒後のS波（30mg）で検知する
+static const std::map<std::string, TraceExpectation> EXPECTATIONS = {
+    {"quiet", {false, Intensity::Unknown, Intensity::Unknown, 0}},
+    {"moderate", {true, Intensity::Int3, Intensity::Int4, 4500}},
+    {"strong", {true, Intensity::Int6Lower, Intensity::Int7, 300}},
+};
+
+/**
+ * @brief 1サンプルを入力し、サンプリング周期分の時刻を進めてloop()側の処理を呼び出す
+ */
+static void feed(const SeismicSample &sample) {
+    int32_t mg[3] = {sample.x, sample.y, sample.z};
+    hostAdvanceMillis(SAMPLE_PERIOD_MS);
+    feedSeismicSample(mg);
+    updateSeismic();
+}
+
+/**
+ * @brief トリガー前の部分を繰り返して入力（静穏時の状態にする）
+ */
+static void feedQuiet(const Trace &trace, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        feed(trace.samples[i % trace.preSamples]);
+    }
+}
+
+static void runTrace(const std::string &name, const Trace &trace) {
+    feedQuiet(trace, PRIME_SAMPLES);
+    bool primedQuiet = notices.empty();
+    notices.clear();
+
+    unsigned long onsetMillis = 0;
+    for (uint32_t i = 0; i < trace.samples.size(); i++) {
+        feed(trace.samples[i]);
+        if (i == trace.preSamples) {
+            onsetMillis = millis();
+        }
+    }
+
+    Intensity peak = Intensity::Unknown;
+    for (const ShakeNotice &notice : notices) {
+        if (intensityRank(notice.intensity) > intensityRank(peak)) {
+            peak = notice.intensity;
+        }
+    }
+    long latency = notices.empty() ? -1 : (long)(notices.front().millis - onsetMillis);
+    printf("%s: 通知%zu回, 推定震度%s, トリガーの遅れ%ldms\n", name.c_str(), notices.size(),
+           notices.empty() ? "-" : intensityLabel(peak), latency);
+
+    auto expected = EXPECTATIONS.find(name);
+    if (expected != EXPECTATIONS.end()) {
+        const TraceExpectation &e = expected->second;
+        CHECK(primedQuiet);
+        CHECK(notices.empty() != e.notified);
+        if (e.notified && !notices.empty()) {
+            CHECK(latency >= 0 && latency <= (long)e.maxLatencyMs);
+            CHECK(intensityRank(peak) >= intensityRank(e.minIntensity));
+            CHECK(intensityRank(peak) <= intensityRank(e.maxIntensity));
+        }
+    }
+
+    feedQuiet(trace, SETTLE_SAMPLES);
+    notices.clear();
+}
+
+#define BENCHMARK_PASSES 20  // 処理時間の計測で波形を入力する回数
+
+/**
+ * @brief feedSeismicSample()のみを連続して呼び出し、1サンプルの処理時間とサイクル数（ホスト）を出力
+ */
+static void benchmarkFeed(const std::string &name, const Trace &trace) {
+    uint32_t count = 0;
+    double start = hostWallMicros();
+    uint64_t startCycles = hostCycles();
+    for (int pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        for (const SeismicSample &sample : trace.samples) {
+            int32_t mg[3] = {sample.x, sample.y, sample.z};
+            feedSeismicSample(mg);
+            count++;
+        }
+    }
+    uint64_t cycles = hostCycles() - startCycles;
+    double micros = hostWallMicros() - start;
+    printf("feedSeismicSample() (%s): %.1fns, %lluサイクル/サンプル (ホスト), %uサンプル\n", name.c_str(),
+           micros * 1000.0 / count, (unsigned long long)(cycles / count), count);
+}
+
+int main() {
+    M5.Imu.enabled = true;
+    CHECK(initSeismic());
+
+    std::string directory = hostSourcePath("traces");
+    std::vector<std::string> names;
+    if (DIR *dir = opendir(directory.c_str())) {
+        while (dirent *entry = readdir(dir)) {
+            std::string file = entry->d_name;
+            if (file.size() > 4 && file.compare(file.size() - 4, 4, ".bin") == 0) {
+                names.push_back(file.substr(0, file.size() - 4));
+            }
+        }
+        closedir(dir);
+    }
+    std::sort(names.begin(), names.end());
+    for (const auto &expected : EXPECTATIONS) {
+        CHECK(std::find(names.begin(), names.end(), expected.first) != names.end());
+    }
+
+    for (const std::string &name : names) {
+        Trace trace;
+        bool loaded = loadTrace(directory + "/" + name + ".bin", trace);
+        CHECK(loaded);
+        if (loaded) {
+            runTrace(name, trace);
+        }
+    }
+
+    Trace strong;
+    if (loadTrace(directory + "/strong.bin", strong)) {
+        benchmarkFeed("strong", strong);
+    }
+    return hostTestResult();
+}
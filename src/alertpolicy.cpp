@@ -0,0 +1,157 @@
+/**
+ * @file alertpolicy.cpp
+ * @brief 設置場所の推定震度による通知の段階付けの実装
+ * @details 推定の流れ（気象庁マグニチュードMj、震源深さD km、震源距離R km）:
+ *          1. Mw = Mj - 0.171（上限8.3）、断層長 L = 10^(0.5Mw - 1.85) km、断層最短距離 X = max(R - L/2, 3)
+ *          2. log10 PGV600 = 0.58Mw + 0.0038D - 1.29 - log10(X + 0.0028×10^(0.5Mw)) - 0.002X（工学的基盤の最大速度 cm/s）
+ *          3. 地表の最大速度 PGV = PGV600 × ALERT_SITE_AMPLIFICATION
+ *          4. 計測震度 I = 2.002 + 2.603 log10 PGV - 0.213 (log10 PGV)²
+ *          受信1件あたり1回の計算のため単精度浮動小数点で行う
+ */
+
+#include "alertpolicy.h"
+#include "arrival.h"
+#include "config.h"
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+static const float MW_FROM_MJ_OFFSET = 0.171f;  // Mw = Mj - 0.171
+static const float MW_SATURATION = 8.3f;        // 距離減衰式の適用上限
+static const float DEPTH_LIMIT_KM = 200.0f;     // 距離減衰式の深さ項の適用上限
+static const float MIN_FAULT_DISTANCE_KM = 3.0f;
+
+/**
+ * @brief 震度のしきい値の表記（config.iniの値）
+ */
+struct IntensityAlias {
+    const char *text;
+    Intensity intensity;
+};
+static const IntensityAlias INTENSITY_ALIASES[] = {
+    {"5-", Intensity::Int5Lower},
+    {"5+", Intensity::Int5Upper},
+    {"6-", Intensity::Int6Lower},
+    {"6+", Intensity::Int6Upper},
+    {"off", Intensity::Count},  // 通知しない
+};
+
+// しきい値（Intensity::Countは無効）
+static Intensity beepThreshold = ALERT_BEEP_DEFAULT;
+static Intensity flashThreshold = ALERT_FLASH_DEFAULT;
+
+/**
+ * @brief しきい値の設定値を解析
+ * @param text 設定値（"1"〜"7"、"5弱"、"5-"、"off"など、空なら既定値）
+ * @param fallback 既定値
+ * @param key キー名（ログ用）
+ * @return しきい値
+ */
+static Intensity parseThreshold(const char *text, Intensity fallback, const char *key) {
+    if (text[0] == '\0') {
+        return fallback;
+    }
+    for (uint8_t i = 1; i < (uint8_t)Intensity::Count; i++) {
+        if (strcmp(text, INTENSITY_TABLE[i].label) == 0) {
+            return (Intensity)i;
+        }
+    }
+    for (const IntensityAlias &alias : INTENSITY_ALIASES) {
+        if (strcmp(text, alias.text) == 0) {
+            return alias.intensity;
+        }
+    }
+    consoleLog("[Alert] " + String(key) + "の値が不正: " + String(text) + "、既定値の震度" + intensityLabel(fallback) + "を使用");
+    return fallback;
+}
+
+/**
+ * @brief しきい値の表示文字列（ログ用）
+ */
+static String thresholdLabel(Intensity threshold) {
+    return (threshold == Intensity::Count) ? String("なし") : "震度" + String(intensityLabel(threshold)) + "以上";
+}
+
+void initAlertPolicy() {
+    const AppConfig &appConfig = getAppConfig();
+    beepThreshold = parseThreshold(appConfig.alertBeep, ALERT_BEEP_DEFAULT, "alertBeep");
+    flashThreshold = parseThreshold(appConfig.alertFlash, ALERT_FLASH_DEFAULT, "alertFlash");
+    if (!hasSiteLocation()) {
+        consoleLog("[Alert] 設置場所が未設定のため、全ての地震を最大震度で通知");
+        return;
+    }
+    consoleLog("[Alert] 推定震度による通知: ビープ音=" + thresholdLabel(beepThreshold) + ", 点滅=" +
+               thresholdLabel(flashThreshold));
+}
+
+void estimateSiteIntensity(EarthquakeData &data) {
+    data.hasSiteEstimate = false;
+    data.siteIntensity = Intensity::Unknown;
+
+    float siteLatitude;
+    float siteLongitude;
+    if (!getSiteLocation(siteLatitude, siteLongitude) || data.magnitude <= 0 || data.depth < 0 ||
+        (data.latitude == 0 && data.longitude == 0)) {
+        return;
+    }
+
+    float epicentral = greatCircleDistanceKm10(siteLatitude, siteLongitude, data.latitude, data.longitude) / 10.0f;
+    float depth = (float)data.depth;
+    float hypocentral = sqrtf(epicentral * epicentral + depth * depth);
+
+    float mw = data.magnitude - MW_FROM_MJ_OFFSET;
+    if (mw > MW_SATURATION) {
+        mw = MW_SATURATION;
+    }
+    float faultLength = powf(10.0f, 0.5f * mw - 1.85f);
+    float faultDistance = hypocentral - faultLength / 2;
+    if (faultDistance < MIN_FAULT_DISTANCE_KM) {
+        faultDistance = MIN_FAULT_DISTANCE_KM;
+    }
+    float depthTerm = (depth < DEPTH_LIMIT_KM) ? depth : DEPTH_LIMIT_KM;
+
+    float logPgv600 = 0.58f * mw + 0.0038f * depthTerm - 1.29f -
+                      log10f(faultDistance + 0.0028f * powf(10.0f, 0.5f * mw)) - 0.002f * faultDistance;
+    float logPgv = logPgv600 + log10f(ALERT_SITE_AMPLIFICATION);
+    float instrumental = 2.002f + 2.603f * logPgv - 0.213f * logPgv * logPgv;
+
+    data.hasSiteEstimate = true;
+    data.siteIntensity = intensityFromInstrumental(instrumental);
+}
+
+Intensity alertIntensity(const EarthquakeData &data) {
+    return data.hasSiteEstimate ? data.siteIntensity : data.maxIntensity;
+}
+
+AlertLevel decideAlertLevel(const EarthquakeData &data) {
+    // 津波は設置場所の揺れと無関係に通知（沿岸からの距離は考慮しない）
+    if (data.tsunami == "Warning" || data.tsunami == "MajorWarning") {
+        return AlertLevel::Beep;
+    }
+    if (!data.hasSiteEstimate) {
+        return AlertLevel::Beep;
+    }
+
+    AlertLevel level = AlertLevel::ListOnly;
+    int rank = intensityRank(data.siteIntensity);
+    if (beepThreshold != Intensity::Count && rank >= intensityRank(beepThreshold)) {
+        level = AlertLevel::Beep;
+    } else if (flashThreshold != Intensity::Count && rank >= intensityRank(flashThreshold)) {
+        level = AlertLevel::Flash;
+    }
+    if (data.tsunami == "Watch" && level < AlertLevel::Flash) {
+        level = AlertLevel::Flash;
+    }
+    return level;
+}
+
+const char *alertLevelName(AlertLevel level) {
+    switch (level) {
+    case AlertLevel::Beep:
+        return "ビープ音+点滅";
+    case AlertLevel::Flash:
+        return "点滅のみ";
+    default:
+        return "リストのみ";
+    }
+}
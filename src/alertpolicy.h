@@ -0,0 +1,63 @@
+/**
+ * @file alertpolicy.h
+ * @brief 設置場所の推定震度による通知の段階付け
+ * @details 受信時（parseEarthquakeJson）に距離減衰式で設置場所の震度を推定し、
+ *          config.iniのしきい値でビープ音+点滅 / 点滅のみ / リスト表示のみを決める。
+ *          設置場所が未設定、または震源が不明な地震は従来どおり最大震度で通知する
+ */
+
+#ifndef ALERTPOLICY_H
+#define ALERTPOLICY_H
+
+#include <Arduino.h>
+#include "earthquake.h"
+
+// しきい値の既定値（config.iniのalertBeep/alertFlashで変更）
+#define ALERT_BEEP_DEFAULT Intensity::Int3    // ビープ音を鳴らす推定震度の下限
+#define ALERT_FLASH_DEFAULT Intensity::Int1   // 点滅する推定震度の下限
+
+// 距離減衰式の設定
+#define ALERT_SITE_AMPLIFICATION 2.0f  // 工学的基盤から地表への最大速度の増幅率（平均的な地盤）
+
+/**
+ * @brief 通知の段階（値は序列、大きいほど目立つ）
+ */
+enum class AlertLevel : uint8_t {
+    ListOnly = 0,  // リストに表示するのみ
+    Flash,         // 画面点滅のみ
+    Beep,          // ビープ音+画面点滅
+};
+
+/**
+ * @brief しきい値を読み込み（loadAppConfig()の後に1回呼び出し）
+ */
+void initAlertPolicy();
+
+/**
+ * @brief 設置場所の震度を推定し、地震情報に設定（受信時に1回呼び出し）
+ * @param data 地震情報（hasSiteEstimate、siteIntensityを設定）
+ * @details 司・翠川（1999）の最大速度の距離減衰式と、藤本・翠川（2005）の最大速度−計測震度の関係式を使用。
+ *          断層面までの距離は震源距離から断層長の半分を引いて近似する
+ */
+void estimateSiteIntensity(EarthquakeData &data);
+
+/**
+ * @brief 地震情報の通知の段階を決定
+ * @param data 地震情報
+ * @return 通知の段階（津波警報・大津波警報は常にBeep、津波注意報は最低でもFlash）
+ */
+AlertLevel decideAlertLevel(const EarthquakeData &data);
+
+/**
+ * @brief 通知の重要度付けに使う震度を取得
+ * @param data 地震情報
+ * @return 設置場所の推定震度（推定していない場合は最大震度）
+ */
+Intensity alertIntensity(const EarthquakeData &data);
+
+/**
+ * @brief 通知の段階の名前を取得（ログ用）
+ */
+const char *alertLevelName(AlertLevel level);
+
+#endif // ALERTPOLICY_H
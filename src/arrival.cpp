@@ -0,0 +1,362 @@
+/**
+ * @file arrival.cpp
+ * @brief P波・S波の到達予測とカウントダウン表示の実装
+ * @details 角度は1周を2^32とする32ビット整数で表し、正弦は1/4周期の表（Q30、256区間）の線形補間で求める。
+ *          大円距離は半正矢関数の公式 hav(θ) = hav(Δφ) + cosφ1・cosφ2・hav(Δλ) をQ30で計算し、
+ *          θ = 2・asin(√hav(θ)) の逆正弦は3次までの級数で近似する。浮動小数点演算は座標の変換のみ
+ */
+
+#include "arrival.h"
+#include "config.h"
+#include "scheduler.h"
+#include "timesync.h"
+#include "websocket.h"
+#include "traveltime_table.h"
+#include "rendertarget.h"
+#include <M5Unified.h>
+#include <sys/time.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+extern void drawMainHeader();
+extern void drawWebSocketIndicator(bool connected);
+
+static const int SINE_TABLE_BITS = 8;                       // 1/4周期の区間数のビット数（256区間）
+static const int SINE_TABLE_SIZE = 1 << SINE_TABLE_BITS;
+static const int Q30_SHIFT = 30;
+static const int64_t Q30_ONE = (int64_t)1 << Q30_SHIFT;
+static const float DEGREES_TO_ANGLE = 4294967296.0f / 360.0f;  // 度 → 32ビット角度
+static const int64_t EARTH_RADIUS_KM10 = 63710;                 // 地球半径（0.1km単位）
+static const uint32_t TABLE_MAX_DISTANCE_KM10 = (uint32_t)TRAVELTIME_DISTANCE_STEP_KM * (TRAVELTIME_DISTANCE_COUNT - 1) * 10;
+static const int TABLE_MAX_DEPTH_KM = TRAVELTIME_DEPTH_STEP_KM * (TRAVELTIME_DEPTH_COUNT - 1);
+
+// 画面レイアウト定数（main.cppと同じ値）
+static const int HEADER_HEIGHT = 30;
+static const int BANNER_WIDTH = 235;       // WebSocketインジケーターの手前まで
+static const uint16_t COLOR_BANNER = TFT_RED;
+static const uint16_t COLOR_BANNER_TEXT = TFT_WHITE;
+
+// 正弦表（sin(0)〜sin(π/2)、Q30、initArrival()で作成）
+static int32_t sineTable[SINE_TABLE_SIZE + 1];
+
+// 設置場所
+static bool siteConfigured = false;
+static float siteLatitude = 0;
+static float siteLongitude = 0;
+
+// カウントダウンの状態
+static int countdownTimerId = SCHEDULER_INVALID_TIMER;
+static bool countdownActive = false;
+static int64_t pArrivalMs = 0;      // P波の到達予測時刻（UTC、Unix時刻・ミリ秒）
+static int64_t sArrivalMs = 0;      // S波の到達予測時刻（UTC、Unix時刻・ミリ秒）
+static char lastBannerText[48] = "";
+
+// 到達予測の計測
+static uint32_t estimateCount = 0;
+static uint32_t estimateCyclesTotal = 0;
+static uint32_t estimateCyclesMax = 0;
+
+// 前方宣言
+static void onCountdownTimer(void *arg);
+
+/**
+ * @brief 設定値の座標を解析
+ * @param text 設定値
+ * @param limit 絶対値の上限（度）
+ * @param value 出力先
+ * @return 数値として解析でき、範囲内の場合true
+ */
+static bool parseCoordinate(const char *text, float limit, float &value) {
+    if (text[0] == '\0') {
+        return false;
+    }
+    char *end = nullptr;
+    value = strtof(text, &end);
+    return end != text && *end == '\0' && value >= -limit && value <= limit;
+}
+
+bool initArrival() {
+    for (int i = 0; i <= SINE_TABLE_SIZE; i++) {
+        sineTable[i] = (int32_t)lroundf(sinf((float)M_PI_2 * i / SINE_TABLE_SIZE) * (float)Q30_ONE);
+    }
+    if (countdownTimerId == SCHEDULER_INVALID_TIMER) {
+        countdownTimerId = schedulerCreateTimer("arrival", onCountdownTimer);
+    }
+
+    const AppConfig &appConfig = getAppConfig();
+    if (appConfig.latitude[0] == '\0' && appConfig.longitude[0] == '\0') {
+        consoleLog("[Arrival] 設置場所が未設定（config.iniのlatitude/longitude）、到達予測は無効");
+        return false;
+    }
+    if (!parseCoordinate(appConfig.latitude, 90.0f, siteLatitude) ||
+        !parseCoordinate(appConfig.longitude, 180.0f, siteLongitude)) {
+        consoleLog("[Arrival] 設置場所の値が不正: latitude=" + String(appConfig.latitude) + ", longitude=" +
+                   String(appConfig.longitude));
+        return false;
+    }
+    siteConfigured = true;
+    consoleLog("[Arrival] 設置場所: " + String(siteLatitude, 3) + ", " + String(siteLongitude, 3));
+    return true;
+}
+
+bool hasSiteLocation() {
+    return siteConfigured;
+}
+
+bool getSiteLocation(float &latitude, float &longitude) {
+    latitude = siteLatitude;
+    longitude = siteLongitude;
+    return siteConfigured;
+}
+
+/**
+ * @brief 度を32ビット角度に変換（1周 = 2^32）
+ */
+static uint32_t toAngle(float degrees) {
+    return (uint32_t)(int64_t)(degrees * DEGREES_TO_ANGLE);
+}
+
+/**
+ * @brief 32ビット角度の正弦（Q30）
+ */
+static int32_t sineQ30(uint32_t angle) {
+    uint32_t quadrant = angle >> 30;
+    uint32_t offset = angle & 0x3FFFFFFF;
+    if (quadrant & 1) {
+        offset = 0x40000000 - offset;  // 第2・第4象限は鏡像
+    }
+    uint32_t index = offset >> (30 - SINE_TABLE_BITS);
+    uint32_t fraction = (offset >> (14 - SINE_TABLE_BITS)) & 0xFFFF;  // 区間内の位置（Q16）
+    int32_t value = sineTable[index];
+    if (index < SINE_TABLE_SIZE) {
+        value += (int32_t)(((int64_t)(sineTable[index + 1] - value) * fraction) >> 16);
+    }
+    return (quadrant & 2) ? -value : value;
+}
+
+/**
+ * @brief 64ビット整数の平方根
+ */
+static uint32_t isqrt64(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+uint32_t greatCircleDistanceKm10(float lat1, float lon1, float lat2, float lon2) {
+    uint32_t phi1 = toAngle(lat1);
+    uint32_t phi2 = toAngle(lat2);
+    // 差の半分（符号付きで半分にし、経度の±180度をまたぐ差も正しく扱う）
+    uint32_t halfDeltaPhi = (uint32_t)((int32_t)(phi2 - phi1) >> 1);
+    uint32_t halfDeltaLambda = (uint32_t)((int32_t)(toAngle(lon2) - toAngle(lon1)) >> 1);
+
+    int64_t sinHalfPhi = sineQ30(halfDeltaPhi);
+    int64_t sinHalfLambda = sineQ30(halfDeltaLambda);
+    int64_t cosPhi1 = sineQ30(phi1 + 0x40000000);
+    int64_t cosPhi2 = sineQ30(phi2 + 0x40000000);
+
+    // hav(θ)（Q30、0〜1）
+    int64_t haversine = ((sinHalfPhi * sinHalfPhi) >> Q30_SHIFT) +
+                        ((((cosPhi1 * cosPhi2) >> Q30_SHIFT) * ((sinHalfLambda * sinHalfLambda) >> Q30_SHIFT)) >> Q30_SHIFT);
+    if (haversine > Q30_ONE) {
+        haversine = Q30_ONE;
+    }
+
+    // θ/2 = asin(x) ≈ x + x³/6（x = √hav(θ)、Q30）
+    int64_t x = isqrt64((uint64_t)haversine << Q30_SHIFT);
+    int64_t x3 = (((x * x) >> Q30_SHIFT) * x) >> Q30_SHIFT;
+    int64_t halfTheta = x + x3 / 6;
+    return (uint32_t)((2 * halfTheta * EARTH_RADIUS_KM10) >> Q30_SHIFT);
+}
+
+/**
+ * @brief 走時表を双線形補間
+ * @param table 走時表（[深さ][距離]、0.1秒単位）
+ * @param distanceKm10 震央距離（0.1km単位、表の範囲内）
+ * @param depthKm 震源深さ（km、表の範囲内）
+ * @return 走時（0.1秒単位）
+ */
+static uint16_t interpolateTravelTime(const uint16_t table[TRAVELTIME_DEPTH_COUNT][TRAVELTIME_DISTANCE_COUNT],
+                                      uint32_t distanceKm10, int depthKm) {
+    const uint32_t distanceStep = TRAVELTIME_DISTANCE_STEP_KM * 10;
+    uint32_t di = distanceKm10 / distanceStep;
+    uint32_t df = distanceKm10 % distanceStep;
+    uint32_t hi = (uint32_t)depthKm / TRAVELTIME_DEPTH_STEP_KM;
+    uint32_t hf = (uint32_t)depthKm % TRAVELTIME_DEPTH_STEP_KM;
+    uint32_t di1 = (di + 1 < TRAVELTIME_DISTANCE_COUNT) ? di + 1 : di;
+    uint32_t hi1 = (hi + 1 < TRAVELTIME_DEPTH_COUNT) ? hi + 1 : hi;
+
+    uint32_t upper = table[hi][di] * (distanceStep - df) + table[hi][di1] * df;
+    uint32_t lower = table[hi1][di] * (distanceStep - df) + table[hi1][di1] * df;
+    uint32_t total = upper * (TRAVELTIME_DEPTH_STEP_KM - hf) + lower * hf;
+    const uint32_t scale = distanceStep * TRAVELTIME_DEPTH_STEP_KM;
+    return (uint16_t)((total + scale / 2) / scale);
+}
+
+bool estimateArrival(const EarthquakeData &data, ArrivalEstimate &estimate) {
+    if (!siteConfigured) {
+        return false;
+    }
+    // 震源不明（緯度・経度が0または範囲外、深さが負）は推定しない
+    if ((data.latitude == 0 && data.longitude == 0) || data.latitude < -90 || data.latitude > 90 ||
+        data.longitude < -180 || data.longitude > 180 || data.depth < 0) {
+        return false;
+    }
+
+    uint32_t startCycles = ESP.getCycleCount();
+    uint32_t distanceKm10 = greatCircleDistanceKm10(siteLatitude, siteLongitude, data.latitude, data.longitude);
+    if (distanceKm10 > TABLE_MAX_DISTANCE_KM10) {
+        return false;
+    }
+    int depthKm = (data.depth > TABLE_MAX_DEPTH_KM) ? TABLE_MAX_DEPTH_KM : data.depth;
+    estimate.distanceKm10 = distanceKm10;
+    estimate.pTravel10 = interpolateTravelTime(TRAVELTIME_P, distanceKm10, depthKm);
+    estimate.sTravel10 = interpolateTravelTime(TRAVELTIME_S, distanceKm10, depthKm);
+    uint32_t cycles = ESP.getCycleCount() - startCycles;
+
+    estimateCount++;
+    estimateCyclesTotal += cycles;
+    if (cycles > estimateCyclesMax) {
+        estimateCyclesMax = cycles;
+    }
+    return true;
+}
+
+/**
+ * @brief 現在時刻（UTC、Unix時刻・ミリ秒）
+ */
+static int64_t currentTimeMs() {
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    return (int64_t)now.tv_sec * 1000 + now.tv_usec / 1000;
+}
+
+/**
+ * @brief 表示中の秒数（切り上げ）が次に変わるまでのミリ秒
+ */
+static unsigned long msUntilNextSecond(int64_t remainingMs) {
+    return (unsigned long)((remainingMs - 1) % 1000) + 1;
+}
+
+/**
+ * @brief カウントダウンをヘッダーに描画（文字列が変わった場合のみ）
+ * @param text 表示文字列
+ */
+static void drawBanner(const char *text) {
+    if (strcmp(text, lastBannerText) == 0) {
+        return;
+    }
+    strncpy(lastBannerText, text, sizeof(lastBannerText) - 1);
+    lastBannerText[sizeof(lastBannerText) - 1] = '\0';
+
+    Screen.fillRect(0, 0, BANNER_WIDTH, HEADER_HEIGHT, COLOR_BANNER);
+    Screen.setFont(&fonts::lgfxJapanGothic_16);
+    Screen.setTextColor(COLOR_BANNER_TEXT);
+    Screen.setTextDatum(MC_DATUM);
+    Screen.drawString(text, BANNER_WIDTH / 2, HEADER_HEIGHT / 2);
+    Screen.setFont(nullptr);
+}
+
+/**
+ * @brief カウントダウンを終了し、ヘッダーを元に戻す
+ */
+static void finishCountdown() {
+    schedulerStop(countdownTimerId);
+    countdownActive = false;
+    lastBannerText[0] = '\0';
+    drawMainHeader();
+    drawWebSocketIndicator(getWebSocketConnected());
+}
+
+/**
+ * @brief カウントダウンタイマーのコールバック（表示の秒数が変わる時刻に実行）
+ * @param arg 未使用
+ */
+static void onCountdownTimer(void *arg) {
+    (void)arg;
+
+    int64_t now = currentTimeMs();
+    int64_t sRemaining = sArrivalMs - now;
+    int64_t pRemaining = pArrivalMs - now;
+    if (sRemaining <= -(int64_t)ARRIVAL_ARRIVED_HOLD_MS) {
+        finishCountdown();
+        return;
+    }
+
+    char text[sizeof(lastBannerText)];
+    unsigned long nextMs;
+    if (sRemaining > 0) {
+        unsigned long sSeconds = (unsigned long)((sRemaining + 999) / 1000);
+        nextMs = msUntilNextSecond(sRemaining);
+        if (pRemaining > 0) {
+            snprintf(text, sizeof(text), "P波 %lu秒・S波 %lu秒", (unsigned long)((pRemaining + 999) / 1000), sSeconds);
+            unsigned long pNextMs = msUntilNextSecond(pRemaining);
+            if (pNextMs < nextMs) {
+                nextMs = pNextMs;
+            }
+        } else {
+            snprintf(text, sizeof(text), "P波 到達・S波 %lu秒", sSeconds);
+        }
+    } else {
+        snprintf(text, sizeof(text), "S波 到達");
+        nextMs = (unsigned long)(sRemaining + ARRIVAL_ARRIVED_HOLD_MS);
+    }
+    drawBanner(text);
+    schedulerStart(countdownTimerId, nextMs);
+}
+
+void startArrivalCountdown(const EarthquakeData &data) {
+    ArrivalEstimate estimate;
+    if (data.originTime == 0 || !isClockValid() || !estimateArrival(data, estimate)) {
+        return;
+    }
+
+    int64_t originMs = (int64_t)data.originTime * 1000;
+    int64_t pArrival = originMs + (int64_t)estimate.pTravel10 * 100;
+    int64_t sArrival = originMs + (int64_t)estimate.sTravel10 * 100;
+    int64_t sRemaining = sArrival - currentTimeMs();
+    consoleLog("[Arrival] " + data.hypocenterName + ": 震央距離" + String(estimate.distanceKm10 / 10.0f, 1) +
+               "km, P波" + String(estimate.pTravel10 / 10.0f, 1) + "秒, S波" + String(estimate.sTravel10 / 10.0f, 1) +
+               "秒 (S波到達まで" + String((long)(sRemaining / 100) / 10.0f, 1) + "秒)");
+    if (sRemaining <= 0) {
+        return;
+    }
+    // 表示中の地震の方がS波の到達が早い場合はそのまま
+    if (countdownActive && sArrivalMs - currentTimeMs() > 0 && sArrivalMs <= sArrival) {
+        return;
+    }
+
+    pArrivalMs = pArrival;
+    sArrivalMs = sArrival;
+    countdownActive = true;
+    lastBannerText[0] = '\0';
+    onCountdownTimer(nullptr);
+}
+
+bool isArrivalCountdownActive() {
+    return countdownActive;
+}
+
+void logArrivalStats() {
+    if (estimateCount == 0) {
+        return;
+    }
+    consoleLog("[Arrival] 到達予測" + String(estimateCount) + "回, 平均" + String(estimateCyclesTotal / estimateCount) +
+               "サイクル, 最大" + String(estimateCyclesMax) + "サイクル (" +
+               String(estimateCyclesMax / (float)ESP.getCpuFreqMHz(), 1) + "us)");
+    estimateCount = 0;
+    estimateCyclesTotal = 0;
+    estimateCyclesMax = 0;
+}
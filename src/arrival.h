@@ -0,0 +1,85 @@
+/**
+ * @file arrival.h
+ * @brief 設置場所へのP波・S波の到達予測とカウントダウン表示
+ * @details config.iniのlatitude/longitudeを設置場所とし、震源との震央距離を固定小数点の大円距離で求め、
+ *          ビルド時に生成した走時表（traveltime_table.h、震央距離×震源深さ）の双線形補間で走時を得る。
+ *          地震情報の受信時にS波の到達前であれば、ヘッダーに到達までの秒数を表示する
+ */
+
+#ifndef ARRIVAL_H
+#define ARRIVAL_H
+
+#include <Arduino.h>
+#include "earthquake.h"
+
+// カウントダウン表示設定
+#define ARRIVAL_ARRIVED_HOLD_MS 5000  // S波到達後に「S波到達」を表示し続ける時間（ミリ秒）
+
+/**
+ * @brief 設置場所への到達予測
+ */
+struct ArrivalEstimate {
+    uint32_t distanceKm10;  // 震央距離（0.1km単位）
+    uint16_t pTravel10;     // P波の走時（0.1秒単位）
+    uint16_t sTravel10;     // S波の走時（0.1秒単位）
+};
+
+/**
+ * @brief 設置場所を読み込み、三角関数表を作成（loadAppConfig()の後に1回呼び出し）
+ * @return 設置場所が設定されている場合true
+ */
+bool initArrival();
+
+/**
+ * @brief 設置場所が設定されているかを取得
+ * @return 設定済みならtrue
+ */
+bool hasSiteLocation();
+
+/**
+ * @brief 設置場所の緯度・経度を取得
+ * @param latitude 緯度（出力先、度）
+ * @param longitude 経度（出力先、度）
+ * @return 設定済みならtrue
+ */
+bool getSiteLocation(float &latitude, float &longitude);
+
+/**
+ * @brief 2点間の大円距離を計算（固定小数点）
+ * @param lat1 地点1の緯度（度）
+ * @param lon1 地点1の経度（度）
+ * @param lat2 地点2の緯度（度）
+ * @param lon2 地点2の経度（度）
+ * @return 距離（0.1km単位）
+ * @details 半正矢関数の公式を32ビット角度と三角関数表で計算し、逆正弦は級数で近似する
+ *          （数千km以内で誤差0.1km程度、日本周辺の距離向け）。initArrival()の後に使用すること
+ */
+uint32_t greatCircleDistanceKm10(float lat1, float lon1, float lat2, float lon2);
+
+/**
+ * @brief 設置場所へのP波・S波の走時を推定
+ * @param data 地震情報（緯度・経度・深さを使用）
+ * @param estimate 推定結果（出力先）
+ * @return 推定できた場合true（設置場所が未設定、震源が不明、走時表の範囲外の場合はfalse）
+ */
+bool estimateArrival(const EarthquakeData &data, ArrivalEstimate &estimate);
+
+/**
+ * @brief S波の到達前であれば到達までのカウントダウンを開始
+ * @param data 地震情報
+ * @details カウントダウン中の地震よりS波の到達が遅い地震では切り替えない
+ */
+void startArrivalCountdown(const EarthquakeData &data);
+
+/**
+ * @brief カウントダウンを表示中かを取得（ヘッダーの時刻表示の更新を止めるために使用）
+ * @return 表示中ならtrue
+ */
+bool isArrivalCountdownActive();
+
+/**
+ * @brief 到達予測の回数と1回あたりのサイクル数をログ出力してリセット
+ */
+void logArrivalStats();
+
+#endif // ARRIVAL_H
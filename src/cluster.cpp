@@ -0,0 +1,216 @@
+/**
+ * @file cluster.cpp
+ * @brief 余震クラスタの判定の実装
+ * @details クラスタは固定長の表（CLUSTER_SLOTS件）に保持し、起点の地震の格子ごとにハッシュ表のバケットへ
+ *          単方向リストで連結する。距離は短距離向けの正距円筒近似（経度差×cos緯度）で求める
+ */
+
+#include "cluster.h"
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+static const float KM_PER_DEGREE = 111.2f;
+static const int8_t NO_SLOT = -1;
+
+/**
+ * @brief クラスタ
+ */
+struct Cluster {
+    uint16_t id;         // 識別子（0は未使用）
+    int16_t cellLat;     // 起点の格子（緯度方向）
+    int16_t cellLon;     // 起点の格子（経度方向）
+    float latitude;      // 起点の震央の緯度（度）
+    float longitude;     // 起点の震央の経度（度）
+    time_t firstTime;    // 最古の地震の発生時刻（UTC）
+    time_t latestTime;   // 最新の地震の発生時刻（UTC）
+    uint16_t members;    // 割り当てた地震の件数（ログ用）
+    bool expanded;       // リストで展開表示中か
+    int8_t next;         // 同じバケットの次のクラスタ（NO_SLOTは終端）
+};
+
+static Cluster clusters[CLUSTER_SLOTS];
+static int8_t buckets[CLUSTER_BUCKETS];  // 格子のハッシュ → 先頭のクラスタ
+static bool bucketsReady = false;
+static uint16_t nextClusterId = 1;
+
+/**
+ * @brief 格子のハッシュ値を計算
+ */
+static uint8_t cellHash(int16_t cellLat, int16_t cellLon) {
+    uint32_t h = (uint32_t)(uint16_t)cellLat * 73856093u ^ (uint32_t)(uint16_t)cellLon * 19349663u;
+    return (uint8_t)(h & (CLUSTER_BUCKETS - 1));
+}
+
+/**
+ * @brief ハッシュ表を初期化（初回のみ）
+ */
+static void ensureBuckets() {
+    if (bucketsReady) {
+        return;
+    }
+    for (int8_t &head : buckets) {
+        head = NO_SLOT;
+    }
+    bucketsReady = true;
+}
+
+/**
+ * @brief クラスタをハッシュ表から外す
+ */
+static void unlinkCluster(int8_t slot) {
+    int8_t *link = &buckets[cellHash(clusters[slot].cellLat, clusters[slot].cellLon)];
+    while (*link != NO_SLOT) {
+        if (*link == slot) {
+            *link = clusters[slot].next;
+            return;
+        }
+        link = &clusters[*link].next;
+    }
+}
+
+/**
+ * @brief 新しいクラスタの格納先を確保（空きがなければ最新の地震が最も古いクラスタを破棄）
+ */
+static int8_t allocateSlot() {
+    int8_t oldest = 0;
+    for (int8_t i = 0; i < CLUSTER_SLOTS; i++) {
+        if (clusters[i].id == 0) {
+            return i;
+        }
+        if (clusters[i].latestTime < clusters[oldest].latestTime) {
+            oldest = i;
+        }
+    }
+    unlinkCluster(oldest);
+    return oldest;
+}
+
+/**
+ * @brief 地震がクラスタの条件に合うかを判定
+ */
+static bool matchesCluster(const Cluster &cluster, const EarthquakeData &data) {
+    if (data.originTime + CLUSTER_WINDOW_S < cluster.firstTime || data.originTime > cluster.latestTime + CLUSTER_WINDOW_S) {
+        return false;
+    }
+    float dy = (data.latitude - cluster.latitude) * KM_PER_DEGREE;
+    float dx = (data.longitude - cluster.longitude) * KM_PER_DEGREE * cosf(cluster.latitude * DEG_TO_RAD);
+    return dx * dx + dy * dy <= (float)CLUSTER_RADIUS_KM * CLUSTER_RADIUS_KM;
+}
+
+uint16_t assignCluster(EarthquakeData &data) {
+    if (data.clusterId != 0) {
+        return data.clusterId;
+    }
+    if (data.originTime == 0 || (data.latitude == 0 && data.longitude == 0)) {
+        return 0;
+    }
+    ensureBuckets();
+
+    int16_t cellLat = (int16_t)floorf(data.latitude / CLUSTER_CELL_DEG);
+    int16_t cellLon = (int16_t)floorf(data.longitude / CLUSTER_CELL_DEG);
+
+    // 周囲3×3の格子のクラスタのみを調べる（半径は格子の幅より小さいため、これで漏れはない）
+    for (int16_t dLat = -1; dLat <= 1; dLat++) {
+        for (int16_t dLon = -1; dLon <= 1; dLon++) {
+            int16_t lat = cellLat + dLat;
+            int16_t lon = cellLon + dLon;
+            for (int8_t slot = buckets[cellHash(lat, lon)]; slot != NO_SLOT; slot = clusters[slot].next) {
+                Cluster &cluster = clusters[slot];
+                if (cluster.cellLat != lat || cluster.cellLon != lon || !matchesCluster(cluster, data)) {
+                    continue;
+                }
+                if (data.originTime < cluster.firstTime) {
+                    cluster.firstTime = data.originTime;
+                }
+                if (data.originTime > cluster.latestTime) {
+                    cluster.latestTime = data.originTime;
+                }
+                cluster.members++;
+                data.clusterId = cluster.id;
+                return cluster.id;
+            }
+        }
+    }
+
+    // 新しいクラスタ（この地震が起点）
+    int8_t slot = allocateSlot();
+    Cluster &cluster = clusters[slot];
+    cluster.id = nextClusterId++;
+    if (nextClusterId == 0) {
+        nextClusterId = 1;  // 0は未所属を表すため使わない
+    }
+    cluster.cellLat = cellLat;
+    cluster.cellLon = cellLon;
+    cluster.latitude = data.latitude;
+    cluster.longitude = data.longitude;
+    cluster.firstTime = data.originTime;
+    cluster.latestTime = data.originTime;
+    cluster.members = 1;
+    cluster.expanded = false;
+    uint8_t bucket = cellHash(cellLat, cellLon);
+    cluster.next = buckets[bucket];
+    buckets[bucket] = slot;
+    data.clusterId = cluster.id;
+    return cluster.id;
+}
+
+/**
+ * @brief 識別子からクラスタを検索
+ * @return クラスタ（破棄済みはnullptr）
+ */
+static Cluster *findCluster(uint16_t clusterId) {
+    if (clusterId == 0) {
+        return nullptr;
+    }
+    for (Cluster &cluster : clusters) {
+        if (cluster.id == clusterId) {
+            return &cluster;
+        }
+    }
+    return nullptr;
+}
+
+uint16_t reassignCluster(uint16_t previousId, EarthquakeData &data) {
+    data.clusterId = 0;
+    if (previousId == 0) {
+        return assignCluster(data);
+    }
+
+    Cluster *cluster = findCluster(previousId);
+    if (cluster != nullptr && data.originTime != 0 && !(data.latitude == 0 && data.longitude == 0) &&
+        matchesCluster(*cluster, data)) {
+        if (data.originTime < cluster->firstTime) {
+            cluster->firstTime = data.originTime;
+        }
+        if (data.originTime > cluster->latestTime) {
+            cluster->latestTime = data.originTime;
+        }
+        data.clusterId = previousId;
+        return previousId;
+    }
+
+    // 震央が元のクラスタから外れた（または元のクラスタが破棄済み）
+    if (cluster != nullptr && cluster->members > 0) {
+        cluster->members--;
+    }
+    uint16_t id = assignCluster(data);
+    consoleLog("[Cluster] 続報で震央が移動: #" + String(previousId) + " → #" + String(id));
+    return id;
+}
+
+bool isClusterExpanded(uint16_t clusterId) {
+    Cluster *cluster = findCluster(clusterId);
+    return cluster != nullptr && cluster->expanded;
+}
+
+bool toggleClusterExpanded(uint16_t clusterId) {
+    Cluster *cluster = findCluster(clusterId);
+    if (cluster == nullptr) {
+        return false;
+    }
+    cluster->expanded = !cluster->expanded;
+    consoleLog("[Cluster] #" + String(clusterId) + (cluster->expanded ? "を展開" : "を折りたたみ") + " (" +
+               String(cluster->members) + "件)");
+    return cluster->expanded;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file cluster.h
+ * @brief 余震クラスタ（同じ震源域で続けて起きた地震のまとまり）の判定
+ * @details 受信時に震央を緯度・経度の格子（CLUSTER_CELL_DEG度）に割り当て、格子のハッシュ表から
+ *          周囲3×3の格子に登録されたクラスタのみを調べるため、割り当てはクラスタ数に依存しない定数時間で済む。
+ *          クラスタの識別子はEarthquakeData::clusterIdに設定し、リスト表示で折りたたみに使う
+ */
+
+#ifndef CLUSTER_H
+#define CLUSTER_H
+
+#include <Arduino.h>
+#include "earthquake.h"
+
+// クラスタの判定条件
+#define CLUSTER_RADIUS_KM 30        // 最初の地震の震央からの距離の上限（km、格子の幅より小さくすること）
+#define CLUSTER_WINDOW_S 86400      // クラスタ内の最新（最古）の地震からの時間の上限（秒）
+#define CLUSTER_CELL_DEG 0.5f       // 格子の幅（度、経度0.5度は北緯45度で約39km）
+
+// 格子のハッシュ表の大きさ
+#define CLUSTER_SLOTS 16            // 同時に保持するクラスタ数（満杯時は最も古いクラスタを破棄）
+#define CLUSTER_BUCKETS 32          // ハッシュ表のバケット数（2のべき乗）
+
+// 表示設定
+#define CLUSTER_COLLAPSE_MIN 3      // リスト内にこの件数以上あるクラスタを1枚のカードに折りたたむ
+
+/**
+ * @brief 地震をクラスタに割り当て
+ * @param data 地震情報（clusterIdを設定、割り当て済みの場合は何もしない）
+ * @return クラスタの識別子（震源・発生時刻が不明な地震は0）
+ * @details 条件に合うクラスタがなければ、この地震を起点とする新しいクラスタを作る
+ */
+uint16_t assignCluster(EarthquakeData &data);
+
+/**
+ * @brief 続報で震源が変わった地震のクラスタを判定し直す
+ * @param previousId 続報前のクラスタの識別子（0は未割り当て）
+ * @param data 続報の地震情報（clusterIdを設定）
+ * @return クラスタの識別子
+ * @details 震央が元のクラスタの条件内にあれば同じクラスタに残す（件数は数え直さない）。
+ *          外れた場合は元のクラスタから外し、assignCluster()で割り当て直す
+ */
+uint16_t reassignCluster(uint16_t previousId, EarthquakeData &data);
+
+/**
+ * @brief クラスタの展開状態を取得
+ * @param clusterId クラスタの識別子
+ * @return 展開中ならtrue（破棄済みのクラスタはfalse）
+ */
+bool isClusterExpanded(uint16_t clusterId);
+
+/**
+ * @brief クラスタの展開状態を切り替え
+ * @param clusterId クラスタの識別子
+ * @return 切り替え後の展開状態
+ */
+bool toggleClusterExpanded(uint16_t clusterId);
+
+#endif // CLUSTER_H
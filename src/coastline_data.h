@@ -0,0 +1,62 @@
+/**
+ * @file coastline_data.h
+ * @brief 日本の海岸線データ（tools/gen_coastline.pyで生成、手動で編集しないこと）
+ * @details 出典: tools/gen_coastline.pyに内蔵した主要な島の概形。緯度・経度は0.01度単位。
+ *          各折れ線は始点の絶対座標と、COASTLINE_DELTASの差分（緯度, 経度の順のint8の組）で表す
+ */
+
+#ifndef COASTLINE_DATA_H
+#define COASTLINE_DATA_H
+
+#include <stdint.h>
+
+#define COASTLINE_POLYLINE_COUNT 12  // 折れ線の数
+#define COASTLINE_POINT_COUNT 225   // 点の総数（始点を含む）
+
+/**
+ * @brief 海岸線の折れ線（始点と差分列の位置）
+ */
+struct CoastlinePolyline {
+    int16_t lat;         // 始点の緯度（0.01度）
+    int16_t lon;         // 始点の経度（0.01度）
+    uint16_t offset;     // COASTLINE_DELTASでの差分の開始位置（組の番号）
+    uint16_t count;      // 差分の組の数（線分の数）
+};
+
+static const CoastlinePolyline COASTLINE_POLYLINES[COASTLINE_POLYLINE_COUNT] = {
+    {4552, 14194, 0, 33},  // 北海道
+    {4126, 14035, 33, 98},  // 本州
+    {3418, 13462, 131, 16},  // 四国
+    {3395, 13096, 147, 34},  // 九州
+    {3833, 13850, 181, 6},  // 佐渡島
+    {3460, 13498, 187, 3},  // 淡路島
+    {3083, 13105, 190, 4},  // 種子島
+    {3045, 13050, 194, 4},  // 屋久島
+    {2852, 12970, 198, 3},  // 奄美大島
+    {2687, 12826, 201, 6},  // 沖縄本島
+    {2493, 12528, 207, 3},  // 宮古島
+    {2460, 12430, 210, 3},  // 石垣島
+};
+
+static const int8_t COASTLINE_DELTAS[213 * 2] = {
+    -58,70,-58,71,-34,92,-11,40,43,66,-68,-20,-33,45,5,24,-30,-70,-10,-74,-70,-106,-36,-7,
+    36,-82,35,-83,-31,-63,15,-11,-22,-59,-44,91,-4,-45,-37,-53,3,-10,44,3,58,-28,25,21,
+    28,45,35,-16,-13,43,4,57,61,17,9,12,94,10,53,-7,11,27,-22,29,-21,10,7,12,
+    -3,27,38,2,-10,-35,39,11,-11,55,-46,-8,-45,15,-33,27,-64,27,-65,-49,-61,-7,13,-21,
+    -16,-28,-66,-6,-65,-6,-36,-24,-28,-8,-61,29,-45,-47,-35,-51,41,-10,27,28,5,-27,-18,-15,
+    -31,-2,16,-15,-5,-32,-29,-6,-36,-25,37,-8,13,9,-13,-46,-37,-18,6,-49,-8,-71,47,-17,
+    -9,-22,-24,-11,-24,33,-21,5,-20,-70,-64,-44,25,-42,20,-19,35,0,34,30,11,-2,-4,-44,
+    13,-31,-15,-53,-14,-20,-3,-57,-22,-82,12,-11,-18,-22,-21,-12,7,-31,0,-23,-10,-32,3,-32,
+    12,-3,30,28,4,22,26,44,75,79,14,42,-3,18,-9,10,9,89,24,100,-28,16,16,68,
+    29,-9,27,18,38,45,30,17,40,-5,10,18,13,45,-48,-37,-20,1,-9,23,42,103,19,30,
+    56,50,29,42,34,8,36,27,80,23,26,-35,12,28,10,5,40,-18,18,35,48,15,-11,-4,
+    -24,17,-58,-57,25,-61,-12,-29,-66,-26,20,-32,54,-28,-12,-40,16,36,57,62,-10,28,15,37,
+    18,15,5,25,-17,57,-23,4,-12,20,0,50,-32,-20,-3,38,-30,7,-37,-25,-121,-35,10,-25,
+    -47,-44,40,14,18,-23,-35,8,4,-35,75,-11,48,39,12,-11,16,13,37,-22,3,-18,-8,-8,
+    -25,-2,-7,27,-18,-18,12,1,1,-33,-15,-12,60,-5,17,-15,-5,30,30,30,0,25,25,10,
+    10,46,-13,5,-38,-27,3,-6,23,0,22,15,3,13,-25,-11,-13,-17,38,28,-38,-7,-8,-10,
+    35,7,11,10,-17,15,-5,-20,12,-7,10,12,-40,-45,33,25,7,20,-28,-29,11,-9,-26,-17,
+    -32,-5,5,16,70,44,-21,17,1,-20,20,3,-27,-5,7,-15,20,20,
+};
+
+#endif // COASTLINE_DATA_H
@@ -0,0 +1,428 @@
+/**
+ * @file config.cpp
+ * @brief SDカード設定ファイルの読み込みとNVSキャッシュの実装
+ * @details 設定ファイルは固定長の行バッファで1回だけストリーミング読み込みし、
+ *          読み込みと同時にFNV-1aハッシュを計算する。NVSにはファイルごとの
+ *          サイズ・更新日時・ハッシュ（フィンガープリント）と解析結果を保存する
+ */
+
+#include "config.h"
+#include <SD.h>
+#include <Preferences.h>
+#include <stddef.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+// NVSキャッシュ設定
+static const char *CONFIG_NAMESPACE = "config";
+static const char *CONFIG_CACHE_KEY = "cache";
+static const uint32_t CONFIG_CACHE_MAGIC = 0x47464E43;  // "CNFG"
+static const uint8_t CONFIG_CACHE_VERSION = 5;           // AppConfig変更時に更新（旧キャッシュは破棄）
+static const uint32_t FILE_ABSENT = 0xFFFFFFFF;          // ファイルなしを表すサイズ
+
+// FNV-1aハッシュ定数
+static const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+/**
+ * @brief 設定ファイルのフィンガープリント（変更検出用）
+ */
+struct FileFingerprint {
+    uint32_t size;   // ファイルサイズ（FILE_ABSENTはファイルなし）
+    uint32_t mtime;  // 更新日時（0は取得不可）
+    uint32_t hash;   // 内容のFNV-1aハッシュ（statのみの場合は0）
+};
+
+/**
+ * @brief NVSに保存するキャッシュ
+ * @details NVSは平文のため、WiFiパスワードは保存しない（config.passwordは常に空）。
+ *          パスワードはWiFiドライバが自身の設定として保持しており、キャッシュから起動した場合は
+ *          接続開始時にそこから取得する（network.cpp）
+ */
+struct ConfigCache {
+    uint32_t magic;                // CONFIG_CACHE_MAGIC
+    uint8_t version;               // CONFIG_CACHE_VERSION
+    uint8_t reserved[3];
+    FileFingerprint wifiFile;      // wifi.iniのフィンガープリント
+    FileFingerprint configFile;    // config.iniのフィンガープリント
+    AppConfig config;              // 解析結果
+};
+
+/**
+ * @brief 1行分の処理関数
+ * @param lineNumber 行番号（1始まり、空行・コメント行を含む）
+ * @param line 前後の空白を除去した行（NUL終端、変更可）
+ * @param config 出力先
+ */
+typedef void (*ConfigLineHandler)(int lineNumber, char *line, AppConfig &config);
+
+/**
+ * @brief config.iniのキーと格納先（文字列フィールド）
+ */
+struct ConfigKeyField {
+    const char *key;   // キー名（大文字小文字を区別）
+    size_t offset;     // AppConfig内のオフセット
+    size_t size;       // フィールドサイズ（NUL終端を含む）
+};
+
+static const ConfigKeyField CONFIG_KEY_FIELDS[] = {
+    {"timezone", offsetof(AppConfig, timezone), sizeof(AppConfig::timezone)},
+    {"network", offsetof(AppConfig, network), sizeof(AppConfig::network)},
+    {"node", offsetof(AppConfig, node), sizeof(AppConfig::node)},
+    {"address", offsetof(AppConfig, address), sizeof(AppConfig::address)},
+    {"pubKey", offsetof(AppConfig, pubKey), sizeof(AppConfig::pubKey)},
+    {"staticIp", offsetof(AppConfig, staticIp), sizeof(AppConfig::staticIp)},
+    {"gateway", offsetof(AppConfig, gateway), sizeof(AppConfig::gateway)},
+    {"subnet", offsetof(AppConfig, subnet), sizeof(AppConfig::subnet)},
+    {"dns", offsetof(AppConfig, dns), sizeof(AppConfig::dns)},
+    {"latitude", offsetof(AppConfig, latitude), sizeof(AppConfig::latitude)},
+    {"longitude", offsetof(AppConfig, longitude), sizeof(AppConfig::longitude)},
+    {"alertBeep", offsetof(AppConfig, alertBeep), sizeof(AppConfig::alertBeep)},
+    {"alertFlash", offsetof(AppConfig, alertFlash), sizeof(AppConfig::alertFlash)},
+};
+static const int CONFIG_KEY_FIELD_COUNT = sizeof(CONFIG_KEY_FIELDS) / sizeof(CONFIG_KEY_FIELDS[0]);
+
+static AppConfig appConfig;
+static bool sdMounted = false;
+
+/**
+ * @brief FNV-1aハッシュを更新
+ * @param hash 現在のハッシュ値
+ * @param data データ
+ * @param length データ長（バイト）
+ * @return 更新後のハッシュ値
+ */
+static uint32_t fnv1a(uint32_t hash, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief 文字列の前後の空白（CR含む）をその場で除去
+ * @param text NUL終端文字列
+ * @return 先頭の空白を除いた位置
+ */
+static char *trimInPlace(char *text) {
+    while (*text == ' ' || *text == '\t' || *text == '\r') {
+        text++;
+    }
+    size_t length = strlen(text);
+    while (length > 0 && (text[length - 1] == ' ' || text[length - 1] == '\t' || text[length - 1] == '\r')) {
+        text[--length] = '\0';
+    }
+    return text;
+}
+
+/**
+ * @brief 値を固定長フィールドにコピー（超過分は切り捨てて警告）
+ * @param dest コピー先
+ * @param size コピー先のサイズ（NUL終端を含む）
+ * @param value 値
+ * @param name ログ用の項目名
+ */
+static void copyValue(char *dest, size_t size, const char *value, const char *name) {
+    size_t length = strlen(value);
+    if (length >= size) {
+        consoleLog("Warning: " + String(name) + " too long. Truncating to " + String((int)(size - 1)) + " chars.");
+        length = size - 1;
+    }
+    memcpy(dest, value, length);
+    dest[length] = '\0';
+}
+
+/**
+ * @brief wifi.iniの1行を処理（1行目: SSID、2行目: パスワード）
+ */
+static void handleWiFiLine(int lineNumber, char *line, AppConfig &config) {
+    if (lineNumber == 1) {
+        copyValue(config.ssid, sizeof(config.ssid), line, "SSID");
+    } else if (lineNumber == 2) {
+        copyValue(config.password, sizeof(config.password), line, "Password");
+    }
+}
+
+/**
+ * @brief config.iniの1行を処理（key=value形式、#はコメント）
+ * @details 空の値は未設定として無視する（ハードコード値・デフォルト値を使用）
+ */
+static void handleConfigLine(int lineNumber, char *line, AppConfig &config) {
+    // コメント行と空行をスキップ
+    if (line[0] == '\0' || line[0] == '#') {
+        return;
+    }
+
+    char *separator = strchr(line, '=');
+    if (separator == nullptr) {
+        return;
+    }
+    *separator = '\0';
+    const char *key = trimInPlace(line);
+    const char *value = trimInPlace(separator + 1);
+    if (value[0] == '\0') {
+        return;
+    }
+
+    // hedgeNode=（複数行指定可、SYMBOL_MAX_HEDGE_NODESまで）
+    if (strcmp(key, "hedgeNode") == 0) {
+        if (config.hedgeNodeCount >= SYMBOL_MAX_HEDGE_NODES) {
+            consoleLog("Symbol Config Warning: Too many hedgeNode entries, ignoring: " + String(value));
+            return;
+        }
+        copyValue(config.hedgeNodes[config.hedgeNodeCount], sizeof(config.hedgeNodes[0]), value, key);
+        config.hedgeNodeCount++;
+        return;
+    }
+
+    for (int i = 0; i < CONFIG_KEY_FIELD_COUNT; i++) {
+        const ConfigKeyField &field = CONFIG_KEY_FIELDS[i];
+        if (strcmp(key, field.key) == 0) {
+            copyValue((char *)&config + field.offset, field.size, value, key);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 設定ファイルのサイズと更新日時を取得（内容は読まない）
+ * @param path ファイルパス
+ * @param fingerprint 出力先（hashは0）
+ */
+static void statConfigFile(const char *path, FileFingerprint &fingerprint) {
+    fingerprint.size = FILE_ABSENT;
+    fingerprint.mtime = 0;
+    fingerprint.hash = 0;
+
+    File file = SD.open(path, FILE_READ);
+    if (!file) {
+        return;
+    }
+    fingerprint.size = file.size();
+    fingerprint.mtime = (uint32_t)file.getLastWrite();
+    file.close();
+}
+
+/**
+ * @brief 設定ファイルを1回のストリーミング読み込みで解析
+ * @param path ファイルパス
+ * @param maxSize 最大サイズ（バイト、超過したファイルは読み込まない）
+ * @param handler 1行分の処理関数
+ * @param config 出力先
+ * @param fingerprint 出力先（サイズ、更新日時、内容のハッシュ）
+ * @return 読み込めた場合true（ファイルなし、サイズ超過の場合false）
+ * @details 128バイト単位で読み込み、固定長の行バッファで行を組み立てる（Stringの一時オブジェクトを生成しない）
+ */
+static bool parseConfigFile(const char *path, size_t maxSize, ConfigLineHandler handler, AppConfig &config,
+                            FileFingerprint &fingerprint) {
+    fingerprint.size = FILE_ABSENT;
+    fingerprint.mtime = 0;
+    fingerprint.hash = 0;
+
+    File file = SD.open(path, FILE_READ);
+    if (!file) {
+        return false;
+    }
+    fingerprint.size = file.size();
+    fingerprint.mtime = (uint32_t)file.getLastWrite();
+
+    // ファイルサイズチェック
+    if (fingerprint.size > maxSize) {
+        consoleLog(String(path) + " file too large (" + String(fingerprint.size) + " > " + String(maxSize) + " bytes).");
+        file.close();
+        return false;
+    }
+
+    uint8_t chunk[128];
+    char line[CONFIG_LINE_MAX];
+    size_t lineLength = 0;
+    int lineNumber = 0;
+    uint32_t hash = FNV_OFFSET_BASIS;
+
+    size_t readLength;
+    while ((readLength = file.read(chunk, sizeof(chunk))) > 0) {
+        hash = fnv1a(hash, chunk, readLength);
+        for (size_t i = 0; i < readLength; i++) {
+            char c = (char)chunk[i];
+            if (c == '\n') {
+                line[lineLength] = '\0';
+                handler(++lineNumber, trimInPlace(line), config);
+                lineLength = 0;
+            } else if (lineLength < sizeof(line) - 1) {
+                line[lineLength++] = c;
+            }
+        }
+    }
+    if (lineLength > 0) {
+        // 最終行（改行なし）
+        line[lineLength] = '\0';
+        handler(++lineNumber, trimInPlace(line), config);
+    }
+
+    file.close();
+    fingerprint.hash = hash;
+    return true;
+}
+
+/**
+ * @brief SDカードをマウント（高速クロック、失敗時は低速クロックで再試行）
+ * @return マウント成功時true
+ */
+static bool mountSDCard() {
+    consoleLog("Mounting SD card...");
+
+    // SDカードマウント（M5Stack Core用のピン設定）
+    // TFCARD_CS_PIN = 4 (M5Stack.hで定義)
+    if (SD.begin(TFCARD_CS_PIN, SPI, SD_FAST_FREQUENCY)) {
+        consoleLog("SD card mounted successfully");
+        return true;
+    }
+
+    // 配線・カードによっては高速クロックで失敗するため従来の安定値で再試行
+    SD.end();
+    if (SD.begin(TFCARD_CS_PIN, SPI, SD_SAFE_FREQUENCY)) {
+        consoleLog("SD card mounted successfully (fallback " + String(SD_SAFE_FREQUENCY / 1000000) + "MHz)");
+        return true;
+    }
+
+    consoleLog("SD card mount failed.");
+    return false;
+}
+
+/**
+ * @brief NVSからキャッシュを読み込み
+ * @param cache 出力先
+ * @return 有効なキャッシュがあればtrue
+ */
+static bool loadConfigCache(ConfigCache &cache) {
+    Preferences prefs;
+    if (!prefs.begin(CONFIG_NAMESPACE, true)) {
+        return false;
+    }
+    size_t length = prefs.getBytesLength(CONFIG_CACHE_KEY);
+    bool valid = false;
+    if (length == sizeof(ConfigCache)) {
+        prefs.getBytes(CONFIG_CACHE_KEY, &cache, sizeof(ConfigCache));
+        valid = (cache.magic == CONFIG_CACHE_MAGIC && cache.version == CONFIG_CACHE_VERSION);
+    }
+    prefs.end();
+    return valid;
+}
+
+/**
+ * @brief NVSにキャッシュを書き込み
+ * @param cache 書き込む内容（パスワードは除いて保存）
+ */
+static void saveConfigCache(const ConfigCache &cache) {
+    Preferences prefs;
+    if (!prefs.begin(CONFIG_NAMESPACE, false)) {
+        consoleLog("[Config] NVSオープン失敗、キャッシュを保存しません");
+        return;
+    }
+    // パスワードは平文で残さない
+    ConfigCache stored = cache;
+    memset(stored.config.password, 0, sizeof(stored.config.password));
+    prefs.putBytes(CONFIG_CACHE_KEY, &stored, sizeof(ConfigCache));
+    prefs.end();
+}
+
+/**
+ * @brief フィンガープリントのサイズと更新日時が一致するかを判定
+ * @details 更新日時が取得できない場合（0）は一致とみなさない（内容のハッシュで判定する）
+ */
+static bool sameStat(const FileFingerprint &a, const FileFingerprint &b) {
+    if (a.size != b.size) {
+        return false;
+    }
+    if (a.size == FILE_ABSENT) {
+        return true;
+    }
+    return a.mtime != 0 && a.mtime == b.mtime;
+}
+
+/**
+ * @brief SDカードから両ファイルを解析
+ * @param cache 出力先（フィンガープリントと解析結果）
+ */
+static void parseConfigFiles(ConfigCache &cache) {
+    memset(&cache.config, 0, sizeof(cache.config));
+
+    // wifi.ini（SSIDとパスワードの2行）
+    if (parseConfigFile(CONFIG_FILE_PATH, WIFI_FILE_MAX_SIZE, handleWiFiLine, cache.config, cache.wifiFile)) {
+        if (cache.config.ssid[0] == '\0' || cache.config.password[0] == '\0') {
+            consoleLog("Invalid wifi.ini: SSID or password is empty.");
+        } else {
+            cache.config.hasWiFi = true;
+        }
+    } else if (cache.wifiFile.size == FILE_ABSENT) {
+        consoleLog("wifi.ini not found.");
+    }
+
+    // config.ini（key=value形式）
+    if (parseConfigFile(CONFIG_TIMEZONE_FILE_PATH, CONFIG_FILE_MAX_SIZE, handleConfigLine, cache.config, cache.configFile)) {
+        cache.config.hasConfigFile = true;
+    } else if (cache.configFile.size == FILE_ABSENT) {
+        consoleLog("config.ini not found.");
+    }
+}
+
+bool loadAppConfig() {
+    unsigned long startTime = millis();
+    memset(&appConfig, 0, sizeof(appConfig));
+
+    sdMounted = mountSDCard();
+    unsigned long mountTime = millis() - startTime;
+
+    ConfigCache cached;
+    bool hasCache = loadConfigCache(cached);
+    const char *source;
+
+    if (!sdMounted) {
+        // SDカードなし: キャッシュした設定で起動
+        if (hasCache) {
+            appConfig = cached.config;
+            source = "cache (no SD card)";
+        } else {
+            source = "none";
+        }
+    } else {
+        // サイズと更新日時が前回と同じなら読み込みを省略
+        FileFingerprint wifiStat;
+        FileFingerprint configStat;
+        statConfigFile(CONFIG_FILE_PATH, wifiStat);
+        statConfigFile(CONFIG_TIMEZONE_FILE_PATH, configStat);
+
+        if (hasCache && sameStat(wifiStat, cached.wifiFile) && sameStat(configStat, cached.configFile)) {
+            appConfig = cached.config;
+            source = "cache (unchanged)";
+        } else {
+            ConfigCache parsed;
+            memset(&parsed, 0, sizeof(parsed));
+            parsed.magic = CONFIG_CACHE_MAGIC;
+            parsed.version = CONFIG_CACHE_VERSION;
+            parseConfigFiles(parsed);
+            appConfig = parsed.config;
+            source = "SD";
+
+            // フィンガープリントが変わった場合のみNVSに書き込み（更新日時のみの変化も次回の省略のため保存）
+            if (!hasCache || memcmp(&parsed.wifiFile, &cached.wifiFile, sizeof(FileFingerprint)) != 0 ||
+                memcmp(&parsed.configFile, &cached.configFile, sizeof(FileFingerprint)) != 0) {
+                saveConfigCache(parsed);
+            }
+        }
+    }
+
+    consoleLog("[Config] 設定読み込み完了: " + String(source) + ", " + String(millis() - startTime) +
+               "ms (マウント" + String(mountTime) + "ms)");
+    return appConfig.hasWiFi || appConfig.hasConfigFile;
+}
+
+const AppConfig &getAppConfig() {
+    return appConfig;
+}
+
+bool isSDCardMounted() {
+    return sdMounted;
+}
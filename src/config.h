@@ -0,0 +1,74 @@
+/**
+ * @file config.h
+ * @brief SDカード設定ファイル（wifi.ini, config.ini）の読み込みとNVSキャッシュ
+ * @details 各ファイルを1回のストリーミング読み込みで型付き構造体に変換し、NVSにキャッシュする。
+ *          次回以降の起動ではファイルのサイズ・更新日時が一致すれば読み込みを省略し、
+ *          SDカードがない場合もキャッシュした設定で起動する
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <Arduino.h>
+#include "network.h"
+
+// 設定ファイル読み込み設定
+#define CONFIG_LINE_MAX 256              // 1行の最大長（超過分は切り捨て）
+#define CONFIG_TIMEZONE_NAME_MAX 32      // タイムゾーン名の最大長
+#define CONFIG_IP_ADDRESS_MAX 16         // IPv4アドレス文字列の最大長（NUL終端を含む）
+#define CONFIG_COORDINATE_MAX 16         // 緯度・経度文字列の最大長（NUL終端を含む）
+#define CONFIG_INTENSITY_MAX 8           // 震度文字列の最大長（NUL終端を含む、"5弱"は7バイト）
+#define SD_FAST_FREQUENCY 25000000       // SDカードのSPIクロック（高速、ミリ秒単位の読み込み向け）
+#define SD_SAFE_FREQUENCY 4000000        // 高速マウント失敗時のSPIクロック（従来の安定値）
+
+/**
+ * @brief SDカード設定ファイルの内容
+ * @details NVSにそのまま保存するため固定長の文字配列のみで構成する。
+ *          値の検証（URL形式、アドレス長など）は利用側（network.cpp）で行う
+ */
+struct AppConfig {
+    // wifi.ini
+    bool hasWiFi;                                         // wifi.iniを読み込めたか
+    char ssid[SSID_MAX_LENGTH + 1];                       // WiFi SSID
+    char password[PASSWORD_MAX_LENGTH + 1];               // WiFiパスワード（NVSキャッシュから起動した場合は空）
+
+    // config.ini
+    bool hasConfigFile;                                   // config.iniが存在したか
+    char timezone[CONFIG_TIMEZONE_NAME_MAX];              // timezone=（空なら未設定）
+    char network[8];                                      // network=
+    char node[SYMBOL_NODE_MAX_LENGTH + 1];                // node=
+    char address[SYMBOL_ADDRESS_LENGTH + 1];              // address=
+    char pubKey[SYMBOL_PUBKEY_LENGTH + 1];                // pubKey=
+    char hedgeNodes[SYMBOL_MAX_HEDGE_NODES][SYMBOL_NODE_MAX_LENGTH + 1];  // hedgeNode=（複数行）
+    uint8_t hedgeNodeCount;                               // hedgeNodeの件数
+    char staticIp[CONFIG_IP_ADDRESS_MAX];                 // staticIp=（空ならDHCP）
+    char gateway[CONFIG_IP_ADDRESS_MAX];                  // gateway=
+    char subnet[CONFIG_IP_ADDRESS_MAX];                   // subnet=
+    char dns[CONFIG_IP_ADDRESS_MAX];                      // dns=（空ならgatewayを使用）
+    char latitude[CONFIG_COORDINATE_MAX];                 // latitude=（設置場所の緯度、空なら未設定）
+    char longitude[CONFIG_COORDINATE_MAX];                // longitude=（設置場所の経度）
+    char alertBeep[CONFIG_INTENSITY_MAX];                 // alertBeep=（ビープ音を鳴らす推定震度の下限）
+    char alertFlash[CONFIG_INTENSITY_MAX];                // alertFlash=（点滅する推定震度の下限）
+};
+
+/**
+ * @brief SDカードをマウントし、設定ファイルを読み込み（setup()で1回呼び出し）
+ * @return SDカードまたはキャッシュから設定を取得できた場合true
+ * @details 高速クロックでマウントし、失敗時は低速クロックで再試行する。
+ *          ファイルが前回から変更されていなければNVSのキャッシュを使用する
+ */
+bool loadAppConfig();
+
+/**
+ * @brief 読み込み済みの設定を取得
+ * @return 設定（loadAppConfig()未実行または設定なしの場合は空）
+ */
+const AppConfig &getAppConfig();
+
+/**
+ * @brief SDカードがマウント済みかを取得
+ * @return マウント済みならtrue
+ */
+bool isSDCardMounted();
+
+#endif // CONFIG_H
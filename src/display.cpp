@@ -6,6 +6,14 @@
 #include "display.h"
 #include <M5Unified.h>
 #include "earthquake.h"
+#include "scheduler.h"
+#include "snapshot.h"
+#include "history.h"
+#include "instrumental.h"
+#include "epicentermap.h"
+#include "notification.h"
+#include "cluster.h"
+#include "rendertarget.h"
 #include <lgfx/v1/lgfx_fonts.hpp>
 #include <time.h>
 
@@ -29,12 +37,7 @@ extern void consoleLog(String message);
 #define COLOR_TEXT_PRIMARY TFT_WHITE            // テキスト色: 白
 #define COLOR_TEXT_SECONDARY TFT_LIGHTGREY      // セカンダリテキスト色: ライトグレー
 
-// 震度別カラー（RGB565形式）
-#define COLOR_INTENSITY_1_2 0x0320      // 震度1-2: 暗い緑
-#define COLOR_INTENSITY_3_4 0x8420      // 震度3-4: 暗い黄
-#define COLOR_INTENSITY_5L_6L 0xC320    // 震度5弱-6弱: 暗い橙
-#define COLOR_INTENSITY_6H_7 0xB000     // 震度6強-7: 暗い赤
-#define COLOR_INTENSITY_UNKNOWN 0x4208  // 震度不明: 暗いグレー
+// 震度別カラーはintensity.hのテーブルで定義
 
 // UIコンポーネントカラー
 #define COLOR_SCROLLBAR 0x8410          // スクロールバー: ミディアムグレー
@@ -78,16 +81,73 @@ extern void consoleLog(String message);
 #define LOCATION_Y_OFFSET 10
 #define DETAIL_Y_OFFSET 32
 
+// クラスタのカード定数
+#define CLUSTER_MEMBER_BAR_WIDTH 3  // 展開中のクラスタのメンバーを示す左端の帯の幅
+#define COLOR_CLUSTER_BAR TFT_LIGHTGREY
+
+// 詳細画面定数（カードのタップで震央地図を表示）
+#define TAP_SLOP 8             // タップとみなす指の移動量の上限（ピクセル）
+#define DETAIL_PANEL_X 6       // 地図左上の情報欄のX座標（地図の範囲では朝鮮半島付近の海域）
+#define DETAIL_BADGE_WIDTH 90  // 震度表示の幅
+#define DETAIL_BADGE_HEIGHT 28 // 震度表示の高さ
+
+// バンド描画（リストを横長のバンドに分けて合成し、DMAで転送する）
+// 2枚のバンドを交互に使い、1枚をDMAで転送している間にもう1枚を合成する（メモリはSCREEN_WIDTH×LIST_BAND_HEIGHT×2バイト×2枚）
+// platformio.iniのbuild_flagsに-DLIST_RENDER_DIRECTを追加すると従来の直接描画（描画時間の比較用）
+#ifndef LIST_RENDER_DIRECT
+#define USE_BAND_RENDERING
+#endif
+#define LIST_BAND_HEIGHT 15     // バンドの高さ（VISIBLE_AREA_HEIGHTの約数、2枚で19200バイト）
+#define LIST_BAND_COUNT (VISIBLE_AREA_HEIGHT / LIST_BAND_HEIGHT)
+static_assert(VISIBLE_AREA_HEIGHT % LIST_BAND_HEIGHT == 0, "LIST_BAND_HEIGHT must divide VISIBLE_AREA_HEIGHT");
+
+// 1回の描画で表示するカードの最大数（一部が見えるカードを含む）
+#define LIST_VISIBLE_CARDS_MAX (VISIBLE_AREA_HEIGHT / (CARD_HEIGHT + CARD_MARGIN) + 2)
+
 // スクロールバー定数
 #define SCROLLBAR_WIDTH 5
 #define SCROLLBAR_MARGIN 2
 #define SCROLLBAR_RADIUS 2
 #define SCROLLBAR_X (SCREEN_WIDTH - SCROLLBAR_WIDTH - SCROLLBAR_MARGIN)
 
+// 履歴表示キャッシュ（表示範囲の約2画面分、直接マップ）
+#define HISTORY_VIEW_SLOTS 8
+
 // 地震情報リストデータ
 static EarthquakeData earthquakeList[MAX_EARTHQUAKE_LIST];
 static int earthquakeCount = 0;
 
+/**
+ * @brief リストの表示行（表示リストの地震1件、または余震クラスタのカード）
+ * @details 表示リストの変更時にrebuildListRows()で作り直す。履歴の行は表示行の後に1件ずつ続く
+ */
+struct ListRow {
+    int16_t index;          // 表示リストのインデックス（クラスタのカードはクラスタ内で最新の地震）
+    uint16_t clusterId;     // クラスタのカード・展開中のメンバーはクラスタの識別子（単独のカードは0）
+    uint8_t clusterCount;   // クラスタのカードの件数（0はクラスタのカードでない）
+    Intensity clusterMax;   // クラスタのカードの最大震度
+};
+static ListRow listRows[MAX_EARTHQUAKE_LIST * 2];  // 展開中のクラスタはカード + メンバー
+static int listRowCount = 0;
+
+// リスト末尾に続けて表示するSDカード上の履歴
+// 表示リストの最古より前に発生した最新の履歴レコードから、古い方向へ辿る
+static int32_t historyTailStart = -1;  // 末尾に続く最初の履歴レコードのインデックス（-1はなし）
+
+/**
+ * @brief 履歴表示キャッシュの1枠（履歴レコードは不変のため、インデックスが一致すれば再利用できる）
+ */
+struct HistoryViewSlot {
+    int32_t index = -1;   // 履歴レコードのインデックス（-1は未使用）
+    EarthquakeData data;  // 読み出した地震情報
+};
+static HistoryViewSlot historyView[HISTORY_VIEW_SLOTS];
+
+// スナップショット保存状態
+static int snapshotTimerId = SCHEDULER_INVALID_TIMER;  // 遅延書き込みタイマー
+static unsigned long lastSnapshotSaveTime = 0;         // 前回の書き込み時刻（millis）
+static bool snapshotSavedOnce = false;                 // 起動後に書き込み済みか
+
 // スクロール状態管理（Phase 2）
 static int scrollOffset = 0;           // 現在のスクロールオフセット（ピクセル単位）
 static int scrollVelocity = 0;         // スクロール速度（慣性スクロール用）
@@ -95,6 +155,59 @@ static int maxScrollOffset = 0;        // 最大スクロールオフセット
 static int lastTouchY = -1;            // 前回のタッチY座標
 static bool isDragging = false;        // ドラッグ中フラグ
 static int lastScrollOffset = -1;      // 前回の描画時のスクロールオフセット（再描画判定用）
+static int touchStartY = -1;           // タッチ開始時のY座標（タップ判定用）
+static bool touchMoved = false;        // タッチ開始からTAP_SLOPを超えて動いたか
+
+// 詳細画面の状態
+static bool isDetailOpen = false;      // 詳細画面を表示中か
+static EarthquakeData detailData;      // 表示中の地震情報（履歴キャッシュの入れ替えに影響されないよう複製）
+
+/**
+ * @brief 描画するカードの内容（描画前に1回だけ組み立て、バンドごとの合成で使い回す）
+ * @details 履歴の読み出し（SDカード）と文字列の組み立てはここで済ませ、合成中はSPIバスに触れない
+ */
+struct ListCard {
+    int16_t itemY;          // カードのY座標
+    Intensity intensity;    // 背景色と左側の震度（クラスタのカードは最大震度）
+    bool memberBar;         // 左端の帯（クラスタのカード・展開中のメンバー）
+    uint16_t footerColor;   // 4行目の文字色
+    String timeLine;        // 1行目: 発生時刻
+    String location;        // 2行目: 震源地
+    String detail;          // 3行目: 深さ・M・震度（クラスタは件数・最大震度）
+    String footer;          // 4行目: 津波（クラスタは操作）
+};
+static ListCard visibleCards[LIST_VISIBLE_CARDS_MAX];
+static int visibleCardCount = 0;
+
+#ifdef USE_BAND_RENDERING
+// バンド描画のスプライト（初回の描画時に確保し、以降は再利用）
+static M5Canvas listBands[2];
+static bool listBandsReady = false;
+static bool listBandsFailed = false;  // 確保に失敗した場合は直接描画を続ける
+#endif
+
+/**
+ * @brief renderList()の描画コスト統計
+ */
+struct RenderStats {
+    uint32_t renders = 0;            // 描画回数
+    uint32_t totalMicros = 0;        // 累積描画時間（マイクロ秒）
+    uint32_t maxMicros = 0;          // 最大描画時間（マイクロ秒）
+    uint32_t prepareMicros = 0;      // うちカードの準備（履歴の読み出し・文字列の組み立て）の累積時間（マイクロ秒）
+    uint32_t timeFormatMicros = 0;   // うち時刻整形の累積時間（マイクロ秒）
+    uint32_t drawCalls = 0;          // 累積描画呼び出し数（Screenの集計値）
+    uint32_t pixels = 0;             // 累積書き込み画素数
+    uint32_t spiBytes = 0;           // 累積SPI転送量の推定値（バイト）
+};
+static RenderStats renderStats;
+
+// 前方宣言
+static void prepareVisibleCards();
+static void renderVisibleCards(int top, int bottom);
+static void renderRow(int i);
+static void openDetail(int touchY);
+static void renderDetail();
+static void rebuildListRows();
 
 // ========================================
 // EarthquakeListManager - リスト管理関数
@@ -130,24 +243,142 @@ static void addEarthquakesToList(const EarthquakeData* data, int count) {
     consoleLog("[Display] データ追加完了: " + String(earthquakeCount) + "件");
 }
 
+/**
+ * @brief リスト末尾に続く履歴の開始位置を更新（表示リストの変更後に呼び出し）
+ * @details 表示リストの最古の発生時刻より前の履歴を疎インデックスで検索する。
+ *          表示リストが空の場合は履歴全体を表示する。履歴の途中への挿入でインデックスがずれるため、
+ *          読み出し済みの履歴の表示キャッシュも破棄する
+ */
+static void updateHistoryTail() {
+    for (int i = 0; i < HISTORY_VIEW_SLOTS; i++) {
+        historyView[i].index = -1;
+    }
+
+    if (earthquakeCount == 0) {
+        historyTailStart = (int32_t)getHistoryCount() - 1;
+        return;
+    }
+
+    time_t oldest = 0;
+    for (int i = earthquakeCount - 1; i >= 0 && oldest == 0; i--) {
+        oldest = earthquakeList[i].originTime;
+    }
+    historyTailStart = (oldest > 0) ? findHistoryBefore(oldest) : -1;
+}
+
 /**
  * @brief 指定インデックスの地震情報を取得
- * @param index インデックス（0始まり）
- * @return 地震情報へのポインタ（範囲外の場合nullptr）
+ * @param index インデックス（0始まり、表示リストの後に履歴が続く）
+ * @return 地震情報へのポインタ（範囲外、履歴の読み出し失敗時はnullptr）
+ * @details 履歴は表示キャッシュ経由で読み出すため、スクロール中も表示範囲の数件分しかSDカードを読まない
  */
 static EarthquakeData* getEarthquakeAt(int index) {
-    if (index < 0 || index >= earthquakeCount) {
+    if (index < 0) {
+        return nullptr;
+    }
+    if (index < earthquakeCount) {
+        return &earthquakeList[index];
+    }
+
+    int32_t historyIndex = historyTailStart - (index - earthquakeCount);
+    if (historyIndex < 0) {
         return nullptr;
     }
-    return &earthquakeList[index];
+    HistoryViewSlot& slot = historyView[historyIndex % HISTORY_VIEW_SLOTS];
+    if (slot.index != historyIndex) {
+        if (!readHistory((uint32_t)historyIndex, slot.data)) {
+            slot.index = -1;
+            return nullptr;
+        }
+        slot.index = historyIndex;
+    }
+    return &slot.data;
 }
 
 /**
- * @brief 地震情報リストの件数を取得
- * @return リスト内のデータ件数
+ * @brief 表示する地震情報の件数を取得
+ * @return 表示リストと、末尾に続く履歴の合計件数
  */
 static int getEarthquakeCount() {
-    return earthquakeCount;
+    return earthquakeCount + (int)(historyTailStart + 1);
+}
+
+/**
+ * @brief 表示行を作り直す（表示リストの変更後に呼び出し）
+ * @details 未割り当ての地震を古い順にクラスタへ割り当て、リスト内にCLUSTER_COLLAPSE_MIN件以上ある
+ *          クラスタを最新の地震の位置で1枚のカードにまとめる（展開中はカードの後にメンバーを続ける）。
+ *          表示リストは最大MAX_EARTHQUAKE_LIST件のため、件数の集計は全件の走査で行う
+ */
+static void rebuildListRows() {
+    for (int i = earthquakeCount - 1; i >= 0; i--) {
+        assignCluster(earthquakeList[i]);
+    }
+
+    listRowCount = 0;
+    int collapsedClusters = 0;
+    int collapsedEvents = 0;
+    for (int i = 0; i < earthquakeCount; i++) {
+        uint16_t id = earthquakeList[i].clusterId;
+        int members = 0;
+        bool newest = true;
+        Intensity maxIntensity = Intensity::Unknown;
+        for (int j = 0; id != 0 && j < earthquakeCount; j++) {
+            if (earthquakeList[j].clusterId != id) {
+                continue;
+            }
+            if (j < i) {
+                newest = false;
+            }
+            members++;
+            if (intensityRank(earthquakeList[j].maxIntensity) > intensityRank(maxIntensity)) {
+                maxIntensity = earthquakeList[j].maxIntensity;
+            }
+        }
+
+        if (members < CLUSTER_COLLAPSE_MIN) {
+            listRows[listRowCount++] = {(int16_t)i, 0, 0, Intensity::Unknown};
+            continue;
+        }
+        bool expanded = isClusterExpanded(id);
+        if (newest) {
+            listRows[listRowCount++] = {(int16_t)i, id, (uint8_t)members, maxIntensity};
+            if (!expanded) {
+                collapsedClusters++;
+                collapsedEvents += members;
+            }
+        }
+        if (expanded) {
+            listRows[listRowCount++] = {(int16_t)i, id, 0, Intensity::Unknown};
+        }
+    }
+
+    if (collapsedClusters > 0) {
+        consoleLog("[Display] 表示行: " + String(listRowCount) + "行 (" + String(collapsedEvents) + "件を" +
+                   String(collapsedClusters) + "クラスタに折りたたみ)");
+    }
+}
+
+/**
+ * @brief 表示行の件数を取得
+ * @return 表示リストの表示行と、末尾に続く履歴の合計
+ */
+static int getRowCount() {
+    return listRowCount + (int)(historyTailStart + 1);
+}
+
+/**
+ * @brief 表示行の地震情報を取得
+ * @param row 表示行（0始まり）
+ * @param listRow 表示行の情報（出力先、履歴の行はnullptr）
+ * @return 地震情報へのポインタ（範囲外、履歴の読み出し失敗時はnullptr）
+ */
+static EarthquakeData* getEarthquakeAtRow(int row, const ListRow** listRow) {
+    if (row >= 0 && row < listRowCount) {
+        *listRow = &listRows[row];
+        return &earthquakeList[listRows[row].index];
+    }
+    *listRow = nullptr;
+    return getEarthquakeAt(earthquakeCount + (row - listRowCount));
 }
 
 // ========================================
@@ -160,7 +391,7 @@ static int getEarthquakeCount() {
  */
 static int calculateMaxScrollOffset() {
     // 総コンテンツ高さ = リスト項目数 × (項目高さ + マージン)
-    int totalContentHeight = earthquakeCount * (CARD_HEIGHT + CARD_MARGIN);
+    int totalContentHeight = getRowCount() * (CARD_HEIGHT + CARD_MARGIN);
 
     // 最大スクロール = 総コンテンツ高さ - 表示可能エリア高さ
     int maxOffset = totalContentHeight - VISIBLE_AREA_HEIGHT;
@@ -230,11 +461,16 @@ static void handleTouch() {
             // ドラッグ開始
             isDragging = true;
             lastTouchY = currentY;
+            touchStartY = currentY;
+            touchMoved = isNotificationActive();  // 点滅中断のタッチはタップとして扱わない
             scrollVelocity = 0;  // 慣性をリセット
             consoleLog("[Touch] ドラッグ開始: Y=" + String(currentY));
         } else {
             // ドラッグ中
             int deltaY = currentY - lastTouchY;
+            if (abs(currentY - touchStartY) > TAP_SLOP) {
+                touchMoved = true;
+            }
 
             if (deltaY != 0) {
                 // スクロールオフセットを更新（deltaYの符号を反転）
@@ -252,6 +488,11 @@ static void handleTouch() {
             isDragging = false;
             lastTouchY = -1;
             // scrollVelocityは慣性スクロールで使用
+            if (!touchMoved) {
+                // ほとんど動かずに離した場合はタップとしてカードの詳細を表示
+                scrollVelocity = 0;
+                openDetail(touchStartY);
+            }
         }
     } else {
         // タッチなし
@@ -273,37 +514,17 @@ static void handleTouch() {
  * @param font フォントサイズ（デフォルト: FONT_SIZE_LOCATION）
  */
 static void drawJapaneseText(const String& text, int x, int y, uint16_t color, const lgfx::v1::IFont* font = FONT_SIZE_LOCATION) {
-    M5.Display.setFont(font);
-    M5.Display.setTextColor(color);
-    M5.Display.setTextDatum(TL_DATUM);  // 左上基準
-    M5.Display.drawString(text, x, y);
-    M5.Display.setFont(nullptr);  // デフォルトフォントに戻す
+    Screen.setFont(font);
+    Screen.setTextColor(color);
+    Screen.setTextDatum(TL_DATUM);  // 左上基準
+    Screen.drawString(text, x, y);
+    Screen.setFont(nullptr);  // デフォルトフォントに戻す
 }
 
 // ========================================
 // ListRenderer - リスト描画関数
 // ========================================
 
-/**
- * @brief 震度に応じた背景色を取得
- * @param intensity 震度文字列（"1", "2", "3", "4", "5弱", "5強", "6弱", "6強", "7"）
- * @return 背景色（uint16_t）
- * @note 震度が不明または不正な場合はCOLOR_INTENSITY_UNKNOWNを返す
- */
-uint16_t getIntensityColor(const String& intensity) {
-    if (intensity == "1" || intensity == "2") {
-        return COLOR_INTENSITY_1_2;  // 緑
-    } else if (intensity == "3" || intensity == "4") {
-        return COLOR_INTENSITY_3_4;  // 黄
-    } else if (intensity.startsWith("5") || intensity == "6弱") {
-        return COLOR_INTENSITY_5L_6L;  // 橙
-    } else if (intensity == "6強" || intensity == "7") {
-        return COLOR_INTENSITY_6H_7;  // 赤（6強, 7）
-    } else {
-        return COLOR_INTENSITY_UNKNOWN;  // 震度不明または不正な値
-    }
-}
-
 /**
  * @brief ユーザーがスクロール中かを判定
  * @return スクロール中ならtrue、停止中ならfalse
@@ -314,51 +535,38 @@ bool isUserScrolling() {
 }
 
 /**
- * @brief 空のリスト時のメッセージを表示
+ * @brief スクロールアニメーション中かを判定
+ * @return ドラッグ中または慣性スクロール中ならtrue
+ * @details loop()はアニメーション中はアイドル待機せずに毎回描画する
  */
-static void renderEmptyMessage() {
-    drawJapaneseText("データ取得中...", 100, 120, COLOR_TEXT);
+bool isDisplayAnimating() {
+    return isDragging || scrollVelocity != 0;
 }
 
 /**
- * @brief ISO8601形式の時刻文字列をUnix timestampに変換
- * @param datetime ISO8601形式の時刻文字列（例: "2024-12-03T14:30:00+09:00"）
- * @return Unix timestamp（秒単位）、失敗時は0
+ * @brief 空のリスト時のメッセージを表示
  */
-static time_t parseISO8601(const String& datetime) {
-    if (datetime.length() < 19) {
-        return 0;
-    }
-
-    struct tm timeinfo = {0};
-    timeinfo.tm_year = datetime.substring(0, 4).toInt() - 1900;  // 年（1900年からのオフセット）
-    timeinfo.tm_mon = datetime.substring(5, 7).toInt() - 1;      // 月（0-11）
-    timeinfo.tm_mday = datetime.substring(8, 10).toInt();        // 日
-    timeinfo.tm_hour = datetime.substring(11, 13).toInt();       // 時
-    timeinfo.tm_min = datetime.substring(14, 16).toInt();        // 分
-    timeinfo.tm_sec = datetime.substring(17, 19).toInt();        // 秒
-
-    return mktime(&timeinfo);
+static void renderEmptyMessage() {
+    drawJapaneseText("データ取得中...", 100, 120, COLOR_TEXT);
 }
 
 /**
- * @brief ISO8601形式の時刻文字列を読みやすい形式に変換（絶対時刻）
- * @param datetime ISO8601形式の時刻文字列（例: "2024-12-03T14:30:00+09:00"）
- * @return 日本語形式の時刻文字列（例: "12/03 14:30"）
- * @note 19文字未満の場合は"時刻不明"を返す
+ * @brief 発生時刻を絶対時刻で整形（発生時刻文字列のUTCオフセットで表示）
+ * @param eq 地震情報
+ * @param buffer 出力先
+ * @param size 出力先のサイズ
+ * @details 例: "12/03 14:30"。発生時刻が不明の場合は"時刻不明"
  */
-static String formatTime(const String& datetime) {
-    if (datetime.length() < 19) {
-        return "時刻不明";
+static void formatAbsoluteTime(const EarthquakeData& eq, char* buffer, size_t size) {
+    if (eq.originTime == 0) {
+        snprintf(buffer, size, "時刻不明");
+        return;
     }
 
-    // "2024-12-03T14:30:00+09:00" -> "12/03 14:30"
-    String month = datetime.substring(5, 7);   // "12"
-    String day = datetime.substring(8, 10);    // "03"
-    String hour = datetime.substring(11, 13);  // "14"
-    String minute = datetime.substring(14, 16); // "30"
-
-    return month + "/" + day + " " + hour + ":" + minute;
+    time_t localTime = eq.originTime + (time_t)eq.utcOffsetMinutes * 60;
+    struct tm timeinfo;
+    gmtime_r(&localTime, &timeinfo);
+    snprintf(buffer, size, "%02d/%02d %02d:%02d", timeinfo.tm_mon + 1, timeinfo.tm_mday, timeinfo.tm_hour, timeinfo.tm_min);
 }
 
 /**
@@ -386,43 +594,39 @@ static String formatTsunamiInfo(const String& tsunamiCode) {
 }
 
 /**
- * @brief ISO8601形式の時刻を相対時刻または絶対時刻で表示
- * @param datetime ISO8601形式の時刻文字列
- * @return 24時間以内なら相対時刻（"3分前"）、それ以降は絶対時刻（"12/03 14:30"）
- * @note NTP未同期の場合は常に絶対時刻を返す
+ * @brief 発生時刻を相対時刻または絶対時刻で整形
+ * @param eq 地震情報
+ * @param buffer 出力先
+ * @param size 出力先のサイズ
+ * @details 24時間以内なら相対時刻（"3分前"）、それ以降は絶対時刻（"12/03 14:30"）。
+ *          発生時刻は受信時に変換済みのUTC時刻を使用し、描画ごとの文字列解析・mktime()は行わない
+ * @note 時刻未取得の場合は常に絶対時刻を返す
  */
-static String formatTimeWithRelative(const String& datetime) {
-    // NTP未同期の場合は絶対時刻にフォールバック
-    extern bool isNTPSynced;
-    if (!isNTPSynced) {
-        return formatTime(datetime);
-    }
-
-    // ISO8601をUnix timestampに変換
-    time_t eventTime = parseISO8601(datetime);
-    if (eventTime == 0) {
-        return "時刻不明";
+static void formatTimeWithRelative(const EarthquakeData& eq, char* buffer, size_t size) {
+    // 時刻未取得の場合は絶対時刻にフォールバック
+    extern bool isTimeSynced;
+    if (!isTimeSynced || eq.originTime == 0) {
+        formatAbsoluteTime(eq, buffer, size);
+        return;
     }
 
     // 現在時刻を取得
-    time_t now = time(nullptr);
-    long diffSeconds = now - eventTime;
+    long diffSeconds = (long)(time(nullptr) - eq.originTime);
 
     // 24時間以内なら相対時刻
     if (diffSeconds < 86400 && diffSeconds >= 0) {
         if (diffSeconds < 60) {
-            return String(diffSeconds) + "秒前";
+            snprintf(buffer, size, "%ld秒前", diffSeconds);
         } else if (diffSeconds < 3600) {
-            int minutes = diffSeconds / 60;
-            return String(minutes) + "分前";
+            snprintf(buffer, size, "%ld分前", diffSeconds / 60);
         } else {
-            int hours = diffSeconds / 3600;
-            return String(hours) + "時間前";
+            snprintf(buffer, size, "%ld時間前", diffSeconds / 3600);
         }
+        return;
     }
 
     // 24時間以上前または未来の場合は絶対時刻
-    return formatTime(datetime);
+    formatAbsoluteTime(eq, buffer, size);
 }
 
 /**
@@ -440,7 +644,7 @@ static void renderScrollIndicator() {
 
     // スクロールバーの高さを計算
     // バーの高さ = (表示可能エリアの高さ / 総コンテンツ高さ) × 表示可能エリアの高さ
-    int totalContentHeight = earthquakeCount * (CARD_HEIGHT + CARD_MARGIN);
+    int totalContentHeight = getRowCount() * (CARD_HEIGHT + CARD_MARGIN);
     int barHeight = (SCROLLBAR_HEIGHT * SCROLLBAR_HEIGHT) / totalContentHeight;
 
     // 最小高さ制限
@@ -453,110 +657,508 @@ static void renderScrollIndicator() {
     int barY = SCROLLBAR_Y;
     if (maxScrollOffset > 0) {
         int travelDistance = SCROLLBAR_HEIGHT - barHeight;
-        barY = SCROLLBAR_Y + (scrollOffset * travelDistance) / maxScrollOffset;
+        barY = SCROLLBAR_Y + (int)((int64_t)scrollOffset * travelDistance / maxScrollOffset);  // 履歴が多い場合の桁あふれ防止
     }
 
     // スクロールバーを描画（半透明グレー）
 #ifdef USE_ROUNDED_SCROLLBAR
-    M5.Display.fillRoundRect(SCROLLBAR_X, barY, SCROLLBAR_WIDTH, barHeight, SCROLLBAR_RADIUS, COLOR_SCROLLBAR);
+    Screen.fillRoundRect(SCROLLBAR_X, barY, SCROLLBAR_WIDTH, barHeight, SCROLLBAR_RADIUS, COLOR_SCROLLBAR);
 #else
-    M5.Display.fillRect(SCROLLBAR_X, barY, SCROLLBAR_WIDTH, barHeight, COLOR_SCROLLBAR);
+    Screen.fillRect(SCROLLBAR_X, barY, SCROLLBAR_WIDTH, barHeight, COLOR_SCROLLBAR);
 #endif
 }
 
+/**
+ * @brief リストを画面に直接描画
+ */
+static void renderListDirect() {
+    prepareVisibleCards();
+
+    // メイン表示エリアをクリア（ヘッダーは既存のdrawMainHeader()が描画）
+    Screen.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, COLOR_BG);
+
+    renderVisibleCards(HEADER_HEIGHT, SCREEN_HEIGHT);
+
+    // スクロールインジケーターを描画
+    renderScrollIndicator();
+}
+
+#ifdef USE_BAND_RENDERING
+/**
+ * @brief バンド描画のスプライトを確保（初回のみ）
+ * @return 確保済みならtrue
+ * @details DMAで転送するため内部RAMに確保する（PSRAMは使わない）
+ */
+static bool prepareListBands() {
+    if (listBandsReady) {
+        return true;
+    }
+    if (listBandsFailed) {
+        return false;
+    }
+    for (M5Canvas &band : listBands) {
+        band.setColorDepth(16);
+        band.setPsram(false);
+        if (band.createSprite(SCREEN_WIDTH, LIST_BAND_HEIGHT) == nullptr) {
+            for (M5Canvas &created : listBands) {
+                created.deleteSprite();
+            }
+            listBandsFailed = true;
+            consoleLog("[Display] バンドの確保に失敗、直接描画を使用 (Free heap: " + String(ESP.getFreeHeap()) + " bytes)");
+            return false;
+        }
+    }
+    listBandsReady = true;
+    consoleLog("[Display] バンド描画: " + String(LIST_BAND_COUNT) + "バンド, " +
+               String(listBands[0].bufferLength() * 2) + "バイト");
+    return true;
+}
+
+/**
+ * @brief リストをバンドごとに合成して転送
+ * @details バンドと重なるカードのみを合成する（カードはバンドの境界で切り取られ、複数のバンドで描画される）。
+ *          転送はDMAで行い、完了を待たずに次のバンドを合成する。SDカードはパネルとSPIバスを共有するため、
+ *          履歴の読み出しを含むカードの準備はバスを確保する前に済ませる
+ */
+static void renderListInBands() {
+    prepareVisibleCards();
+
+    Screen.beginTransfer();
+    for (int i = 0; i < LIST_BAND_COUNT; i++) {
+        M5Canvas &band = listBands[i & 1];
+        int bandY = HEADER_HEIGHT + i * LIST_BAND_HEIGHT;
+        Screen.beginBand(band, bandY);
+        band.fillScreen(COLOR_BG);
+        renderVisibleCards(bandY, bandY + LIST_BAND_HEIGHT);
+        renderScrollIndicator();
+        Screen.endBand();
+        Screen.pushBand(band, bandY);
+    }
+    Screen.endTransfer();
+}
+#endif
+
 /**
  * @brief 地震情報リストを画面に描画（Phase 2: スクロール対応）
+ * @details 詳細画面の表示中は詳細画面を再描画する（視覚通知の終了時などの画面復元用）
  */
 void renderList() {
-    // メイン表示エリアをクリア（ヘッダーは既存のdrawMainHeader()が描画）
-    M5.Display.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, COLOR_BG);
+    if (isDetailOpen) {
+        renderDetail();
+        return;
+    }
 
-    if (earthquakeCount == 0) {
+    unsigned long renderStart = micros();
+    RenderCounters before = Screen.counters();
+
+    if (getEarthquakeCount() == 0) {
+        // メイン表示エリアをクリア（ヘッダーは既存のdrawMainHeader()が描画）
+        Screen.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, COLOR_BG);
         renderEmptyMessage();
         return;
     }
 
+#ifdef USE_BAND_RENDERING
+    if (prepareListBands()) {
+        renderListInBands();
+    } else {
+        renderListDirect();
+    }
+#else
+    renderListDirect();
+#endif
+
+    // 描画コストを集計
+    uint32_t elapsed = micros() - renderStart;
+    renderStats.renders++;
+    renderStats.totalMicros += elapsed;
+    if (elapsed > renderStats.maxMicros) {
+        renderStats.maxMicros = elapsed;
+    }
+    const RenderCounters &after = Screen.counters();
+    renderStats.drawCalls += after.drawCalls - before.drawCalls;
+    renderStats.pixels += after.pixels - before.pixels;
+    renderStats.spiBytes += after.spiBytes - before.spiBytes;
+}
+
+/**
+ * @brief 表示行のカードの内容を組み立て
+ * @param i 表示行（0始まり）
+ * @param card 出力先
+ * @return 描画する場合true（データなし、画面外・ヘッダーに重なる行はfalse）
+ * @details 履歴の行はここでSDカードから読み出す（表示キャッシュ経由）
+ */
+static bool prepareCard(int i, ListCard& card) {
+    // 項目のY座標を計算（スクロールオフセットを適用）
+    int itemY = HEADER_HEIGHT + (i * (CARD_HEIGHT + CARD_MARGIN)) - scrollOffset;
+
+    // 画面外の項目はスキップ（最適化）
+    // ヘッダー領域に重なる場合もスキップ
+    if (itemY < HEADER_HEIGHT || itemY + CARD_HEIGHT + CARD_MARGIN < HEADER_HEIGHT || itemY > SCREEN_HEIGHT) {
+        return false;
+    }
+
+    const ListRow* row = nullptr;
+    EarthquakeData* eq = getEarthquakeAtRow(i, &row);
+    if (eq == nullptr) return false;
+
+    card.itemY = (int16_t)itemY;
+    char timeText[24];
+    unsigned long formatStart = micros();
+    formatTimeWithRelative(*eq, timeText, sizeof(timeText));
+    renderStats.timeFormatMicros += micros() - formatStart;
+
+    // 折りたたんだ余震クラスタ（件数・最大震度・最新の発生時刻）
+    if (row != nullptr && row->clusterCount > 0) {
+        card.intensity = row->clusterMax;
+        card.memberBar = true;
+        card.footerColor = COLOR_TEXT_SECONDARY;
+        card.timeLine = "最新 " + String(timeText);
+        card.location = eq->hypocenterName + " 周辺";
+        card.detail = "地震 " + String(row->clusterCount) + "件・最大震度 " + intensityLabel(row->clusterMax);
+        card.footer = isClusterExpanded(row->clusterId) ? "タップで折りたたむ" : "タップで一覧を表示";
+        return true;
+    }
+
+    card.intensity = eq->maxIntensity;
+    card.memberBar = (row != nullptr && row->clusterId != 0);  // 展開中のクラスタのメンバー
+    card.footerColor = COLOR_TEXT;
+    card.timeLine = timeText;
+    card.location = eq->hypocenterName;
+    card.detail = "深さ " + String(eq->depth) + "km・M" + String(eq->magnitude, 1) + "・震度 " + intensityLabel(eq->maxIntensity);
+    float localInstrumental;
+    if (findLocalInstrumental(eq->originTime, localInstrumental)) {
+        card.detail += "・本機" + String(localInstrumental, 1);  // 本機で計測した計測震度
+    }
+    card.footer = "津波：" + formatTsunamiInfo(eq->tsunami);
+    return true;
+}
+
+/**
+ * @brief 組み立て済みのカードを描画
+ * @param card カードの内容
+ */
+static void drawCard(const ListCard& card) {
+    int itemY = card.itemY;
+
+    // 背景色塗りつぶし（震度別）
+    Screen.fillRect(0, itemY, SCREEN_WIDTH, CARD_HEIGHT, intensityColor(card.intensity));
+
+    // カード下部にマージン（黒背景）を描画
+    Screen.fillRect(0, itemY + CARD_HEIGHT, SCREEN_WIDTH, CARD_MARGIN, COLOR_BG_PRIMARY);
+
+    // 震度表示（左側大きく表示）
+    Screen.setTextColor(COLOR_TEXT);
+    Screen.setFont(FONT_SIZE_INTENSITY);
+    Screen.setTextDatum(TL_DATUM);
+    Screen.drawString(intensityLabel(card.intensity), INTENSITY_X, itemY + 25);
+    Screen.setFont(nullptr);
+
+    // 1〜4行目
+    drawJapaneseText(card.timeLine, CONTENT_AREA_X, itemY + 6, COLOR_TEXT, FONT_SIZE_DETAIL);
+    drawJapaneseText(card.location, CONTENT_AREA_X, itemY + 22, COLOR_TEXT, FONT_SIZE_LOCATION);
+    drawJapaneseText(card.detail, CONTENT_AREA_X, itemY + 42, COLOR_TEXT, FONT_SIZE_DETAIL);
+    drawJapaneseText(card.footer, CONTENT_AREA_X, itemY + 58, card.footerColor, FONT_SIZE_DETAIL);
+
+    // クラスタのカード・展開中のメンバー（左端の帯）
+    if (card.memberBar) {
+        Screen.fillRect(0, itemY, CLUSTER_MEMBER_BAR_WIDTH, CARD_HEIGHT, COLOR_CLUSTER_BAR);
+    }
+
+    // 区切り線を描画（項目の下部、2ピクセルの暗いグレー線）
+    Screen.drawLine(0, itemY + CARD_HEIGHT - 1, SCREEN_WIDTH - 5, itemY + CARD_HEIGHT - 1, TFT_DARKGREY);
+}
+
+/**
+ * @brief 表示範囲内のカードの内容を組み立て（1回の描画で1回だけ呼び出し）
+ */
+static void prepareVisibleCards() {
+    unsigned long prepareStart = micros();
+
     // 表示範囲を計算（スクロールオフセットを考慮）
-    // 最初に表示する項目のインデックス = scrollOffset / (CARD_HEIGHT + CARD_MARGIN)
+    // 最初に表示する項目のインデックス = スクロールオフセット / (CARD_HEIGHT + CARD_MARGIN)
     int firstVisibleIndex = scrollOffset / (CARD_HEIGHT + CARD_MARGIN);
 
-    // 最後に表示する項目のインデックス
-    // (scrollOffset + VISIBLE_AREA_HEIGHT) / (CARD_HEIGHT + CARD_MARGIN) + 1（余裕を持たせる）
-    int lastVisibleIndex = (scrollOffset + VISIBLE_AREA_HEIGHT) / (CARD_HEIGHT + CARD_MARGIN) + 1;
+    // 最後に表示する項目のインデックス（表示エリアの下端を含む項目の次）
+    int lastVisibleIndex = (VISIBLE_AREA_HEIGHT - 1 + scrollOffset) / (CARD_HEIGHT + CARD_MARGIN) + 1;
 
     // 範囲チェック
     if (firstVisibleIndex < 0) firstVisibleIndex = 0;
-    if (lastVisibleIndex > earthquakeCount) lastVisibleIndex = earthquakeCount;
+    int totalCount = getRowCount();
+    if (lastVisibleIndex > totalCount) lastVisibleIndex = totalCount;
 
-    // 表示範囲内の項目を描画
-    for (int i = firstVisibleIndex; i < lastVisibleIndex; i++) {
-        EarthquakeData* eq = getEarthquakeAt(i);
-        if (eq == nullptr) continue;
+    visibleCardCount = 0;
+    for (int i = firstVisibleIndex; i < lastVisibleIndex && visibleCardCount < LIST_VISIBLE_CARDS_MAX; i++) {
+        if (prepareCard(i, visibleCards[visibleCardCount])) {
+            visibleCardCount++;
+        }
+    }
 
-        // 項目のY座標を計算（スクロールオフセットを適用）
-        int itemY = HEADER_HEIGHT + (i * (CARD_HEIGHT + CARD_MARGIN)) - scrollOffset;
+    renderStats.prepareMicros += micros() - prepareStart;
+}
 
-        // 画面外の項目はスキップ（最適化）
-        // ヘッダー領域に重なる場合もスキップ
-        if (itemY < HEADER_HEIGHT || itemY + CARD_HEIGHT + CARD_MARGIN < HEADER_HEIGHT || itemY > SCREEN_HEIGHT) {
-            continue;
+/**
+ * @brief 組み立て済みのカードのうち、指定範囲と重なるものを描画
+ * @param top 描画する範囲の上端（画面上のY座標）
+ * @param bottom 描画する範囲の下端（この座標は含まない）
+ */
+static void renderVisibleCards(int top, int bottom) {
+    for (int i = 0; i < visibleCardCount; i++) {
+        const ListCard& card = visibleCards[i];
+        if (card.itemY < bottom && card.itemY + CARD_HEIGHT + CARD_MARGIN > top) {
+            drawCard(card);
         }
+    }
+}
+
+/**
+ * @brief 表示行のカードを1枚描画
+ * @param i 表示行（0始まり）
+ * @details 画面外・ヘッダーに重なる行は描画しない
+ */
+static void renderRow(int i) {
+    ListCard card;
+    if (prepareCard(i, card)) {
+        drawCard(card);
+    }
+}
+
+// ========================================
+// DetailView - 詳細画面（震央地図）
+// ========================================
 
-        // 背景色塗りつぶし（震度別）
-        uint16_t bgColor = getIntensityColor(eq->maxIntensity);
-        M5.Display.fillRect(0, itemY, SCREEN_WIDTH, CARD_HEIGHT, bgColor);
+/**
+ * @brief 詳細画面を描画（震央地図と左上の情報欄）
+ */
+static void renderDetail() {
+    bool epicenterShown = drawEpicenterMap(detailData, HEADER_HEIGHT);
+
+    // 震度（震度別の背景色）
+    int y = HEADER_HEIGHT + 6;
+    Screen.fillRoundRect(DETAIL_PANEL_X, y, DETAIL_BADGE_WIDTH, DETAIL_BADGE_HEIGHT, CARD_CORNER_RADIUS,
+                             intensityColor(detailData.maxIntensity));
+    drawJapaneseText("震度" + String(intensityLabel(detailData.maxIntensity)), DETAIL_PANEL_X + 6, y + 4, COLOR_TEXT,
+                     &fonts::lgfxJapanGothic_20);
+    y += DETAIL_BADGE_HEIGHT + 6;
+
+    drawJapaneseText(detailData.hypocenterName, DETAIL_PANEL_X, y, COLOR_TEXT, FONT_SIZE_LOCATION);
+    y += FONT_SIZE_LOCATION_NUM + 4;
+
+    char timeText[24];
+    formatAbsoluteTime(detailData, timeText, sizeof(timeText));
+    drawJapaneseText(timeText, DETAIL_PANEL_X, y, COLOR_TEXT, FONT_SIZE_DETAIL);
+    y += FONT_SIZE_DETAIL_NUM + 4;
+    drawJapaneseText("M" + String(detailData.magnitude, 1) + "・深さ" + String(detailData.depth) + "km", DETAIL_PANEL_X, y,
+                     COLOR_TEXT, FONT_SIZE_DETAIL);
+    y += FONT_SIZE_DETAIL_NUM + 4;
+    drawJapaneseText(formatTsunamiInfo(detailData.tsunami), DETAIL_PANEL_X, y, COLOR_TEXT, FONT_SIZE_DETAIL);
+    y += FONT_SIZE_DETAIL_NUM + 4;
+    if (detailData.hasSiteEstimate) {
+        drawJapaneseText("設置場所 震度" + String(intensityLabel(detailData.siteIntensity)), DETAIL_PANEL_X, y,
+                         EPICENTER_MAP_COLOR_SITE, FONT_SIZE_DETAIL);
+        y += FONT_SIZE_DETAIL_NUM + 4;
+    }
+    if (!epicenterShown) {
+        drawJapaneseText("震央は地図の範囲外", DETAIL_PANEL_X, y, COLOR_TEXT_SECONDARY, FONT_SIZE_DETAIL);
+    }
 
-        // カード下部にマージン（黒背景）を描画
-        M5.Display.fillRect(0, itemY + CARD_HEIGHT, SCREEN_WIDTH, CARD_MARGIN, COLOR_BG_PRIMARY);
+    drawJapaneseText("タッチで戻る", DETAIL_PANEL_X, SCREEN_HEIGHT - FONT_SIZE_DETAIL_NUM - 4, COLOR_TEXT_SECONDARY,
+                     FONT_SIZE_DETAIL);
+}
 
-        // テキスト色設定
-        M5.Display.setTextColor(COLOR_TEXT);
+/**
+ * @brief タップした位置のカードの詳細画面を開く
+ * @param touchY タップ位置のY座標
+ * @details 余震クラスタのカードの場合は詳細画面の代わりに展開・折りたたみを切り替える
+ */
+static void openDetail(int touchY) {
+    int contentY = touchY - HEADER_HEIGHT + scrollOffset;
+    if (contentY < 0 || contentY % (CARD_HEIGHT + CARD_MARGIN) >= CARD_HEIGHT) {
+        return;  // カード間のマージン
+    }
+    const ListRow* row;
+    EarthquakeData* eq = getEarthquakeAtRow(contentY / (CARD_HEIGHT + CARD_MARGIN), &row);
+    if (eq == nullptr) {
+        return;
+    }
 
-        // 震度表示（左側大きく表示）
-        M5.Display.setFont(FONT_SIZE_INTENSITY);
-        M5.Display.setTextDatum(TL_DATUM);
-        M5.Display.drawString(eq->maxIntensity, INTENSITY_X, itemY + 25);
-        M5.Display.setFont(nullptr);
+    // 余震クラスタのカードは展開・折りたたみを切り替える
+    if (row != nullptr && row->clusterCount > 0) {
+        toggleClusterExpanded(row->clusterId);
+        rebuildListRows();
+        setScrollOffset(scrollOffset);  // 最大スクロールオフセットを再計算
+        renderList();
+        lastScrollOffset = scrollOffset;
+        return;
+    }
 
-        // 1行目: 時刻
-        M5.Display.setFont(FONT_SIZE_DETAIL);
-        M5.Display.setTextDatum(TL_DATUM);
-        M5.Display.drawString(formatTimeWithRelative(eq->datetime), CONTENT_AREA_X, itemY + 6);
-        M5.Display.setFont(nullptr);
+    detailData = *eq;
+    isDetailOpen = true;
+    consoleLog("[Display] 詳細画面を表示: " + detailData.hypocenterName);
+    renderDetail();
+}
 
-        // 2行目: 震源地
-        drawJapaneseText(eq->hypocenterName, CONTENT_AREA_X, itemY + 22, COLOR_TEXT, FONT_SIZE_LOCATION);
+/**
+ * @brief 詳細画面を閉じてリストに戻る
+ */
+static void closeDetail() {
+    isDetailOpen = false;
+    renderList();
+    lastScrollOffset = scrollOffset;
+}
 
-        // 3行目: 深さ・M・震度
-        String detailLine = "深さ " + String(eq->depth) + "km・M" + String(eq->magnitude, 1) + "・震度 " + eq->maxIntensity;
-        drawJapaneseText(detailLine, CONTENT_AREA_X, itemY + 42, COLOR_TEXT, FONT_SIZE_DETAIL);
+void logRenderStats() {
+    if (renderStats.renders == 0) {
+        return;
+    }
+#ifdef USE_BAND_RENDERING
+    const char *mode = listBandsReady ? "バンド" : "直接";
+#else
+    const char *mode = "直接";
+#endif
+    consoleLog("[Display] renderList(" + String(mode) + "): " + String(renderStats.renders) + "回, 平均" +
+               String(renderStats.totalMicros / renderStats.renders) + "us, 最大" +
+               String(renderStats.maxMicros) + "us (カード準備 平均" +
+               String(renderStats.prepareMicros / renderStats.renders) + "us, うち時刻整形 平均" +
+               String(renderStats.timeFormatMicros / renderStats.renders) + "us), 1回あたり描画" +
+               String(renderStats.drawCalls / renderStats.renders) + "回, " + String(renderStats.pixels / renderStats.renders) +
+               "画素, SPI" + String(renderStats.spiBytes / renderStats.renders) + "バイト");
+    renderStats = RenderStats();
+}
 
-        // 4行目: 津波
-        String tsunamiLine = "津波：" + formatTsunamiInfo(eq->tsunami);
-        drawJapaneseText(tsunamiLine, CONTENT_AREA_X, itemY + 58, COLOR_TEXT, FONT_SIZE_DETAIL);
+/**
+ * @brief スナップショット書き込みタイマーのコールバック
+ * @param arg 未使用
+ */
+static void onSnapshotTimer(void *arg) {
+    saveListSnapshot(earthquakeList, earthquakeCount);
+    lastSnapshotSaveTime = millis();
+    snapshotSavedOnce = true;
+}
 
-        // 区切り線を描画（項目の下部、2ピクセルの暗いグレー線）
-        M5.Display.drawLine(0, itemY + CARD_HEIGHT - 1, SCREEN_WIDTH - 5, itemY + CARD_HEIGHT - 1, TFT_DARKGREY);
+/**
+ * @brief リスト変更後のスナップショット書き込みを予約
+ * @details 変更からSNAPSHOT_SETTLE_MS後、かつ前回の書き込みからSNAPSHOT_MIN_INTERVAL_MS以上経過後に書き込む。
+ *          予約済みの場合は何もしない（連続した変更を1回の書き込みにまとめる）
+ */
+static void requestSnapshotSave() {
+    if (snapshotTimerId == SCHEDULER_INVALID_TIMER) {
+        snapshotTimerId = schedulerCreateTimer("snapshot", onSnapshotTimer);
+    }
+    if (schedulerIsActive(snapshotTimerId)) {
+        return;
     }
 
-    // スクロールインジケーターを描画
-    renderScrollIndicator();
+    unsigned long delayMs = SNAPSHOT_SETTLE_MS;
+    if (snapshotSavedOnce) {
+        unsigned long sinceLastSave = millis() - lastSnapshotSaveTime;
+        if (sinceLastSave < SNAPSHOT_MIN_INTERVAL_MS && SNAPSHOT_MIN_INTERVAL_MS - sinceLastSave > delayMs) {
+            delayMs = SNAPSHOT_MIN_INTERVAL_MS - sinceLastSave;
+        }
+    }
+    schedulerStart(snapshotTimerId, delayMs);
 }
 
 /**
- * @brief 地震情報表示機能を初期化
+ * @brief リストを初期化し、前回保存したリストを復元（WiFi接続前の起動直後に呼び出し）
+ * @return 復元した件数
+ * @details 描画はinitDisplay()で行う
  */
-void initDisplay() {
+int restoreDisplaySnapshot() {
     initEarthquakeList();
     initScrollEngine();
 
-    // 初期データ取得（earthquake.cppのグローバルバッファから読み込み、Phase 1暫定実装）
-    extern EarthquakeData earthquakeDataBuffer[];
-    extern int earthquakeDataBufferCount;
-    if (earthquakeDataBufferCount > 0) {
-        addEarthquakesToList(earthquakeDataBuffer, earthquakeDataBufferCount);
-        consoleLog("[Display] 初期データ読み込み完了: " + String(earthquakeDataBufferCount) + "件");
-        // データを読み込んだ後、リストを描画
+    earthquakeCount = loadListSnapshot(earthquakeList, MAX_EARTHQUAKE_LIST);
+    rebuildListRows();
+    updateHistoryTail();
+    if (earthquakeCount > 0) {
+        setScrollOffset(0);  // 最大スクロールオフセットを再計算
+    }
+    return earthquakeCount;
+}
+
+/**
+ * @brief SDカードの履歴をリスト末尾に接続（initHistory()の後に呼び出し）
+ * @details スナップショットを表示済みの場合は、スクロール範囲を更新して再描画する
+ */
+void attachDisplayHistory() {
+    updateHistoryTail();
+    setScrollOffset(scrollOffset);  // 最大スクロールオフセットを再計算
+    consoleLog("[Display] 履歴を接続: " + String(historyTailStart + 1) + "件");
+    if (earthquakeCount > 0) {
+        renderList();
+    }
+}
+
+/**
+ * @brief 表示中のリストとREST APIの取得結果を統合
+ * @param fresh REST APIで取得した地震情報（新しい順）
+ * @param freshCount 件数
+ * @details 取得結果の期間内は取得結果を正とする。表示中のリストからは、取得結果より新しい地震
+ *          （取得中にWebSocketで受信したもの）を先頭に、取得結果より古い地震（復元データ）を後ろに残す
+ */
+static void reconcileWithFreshData(const EarthquakeData* fresh, int freshCount) {
+    // 取得結果の期間（最古・最新の発生時刻）
+    time_t oldestFresh = 0;
+    time_t newestFresh = 0;
+    for (int i = 0; i < freshCount; i++) {
+        time_t t = fresh[i].originTime;
+        if (t == 0) {
+            continue;
+        }
+        if (oldestFresh == 0 || t < oldestFresh) {
+            oldestFresh = t;
+        }
+        if (t > newestFresh) {
+            newestFresh = t;
+        }
+    }
+
+    // 表示中のリストを「取得結果より新しい」「取得結果より古い」に分けて先頭に詰める（期間内は除外）
+    int newer = 0;
+    int kept = 0;
+    for (int i = 0; i < earthquakeCount; i++) {
+        time_t t = earthquakeList[i].originTime;
+        if (oldestFresh == 0 || (t >= oldestFresh && t <= newestFresh)) {
+            continue;
+        }
+        if (kept != i) {
+            earthquakeList[kept] = earthquakeList[i];
+        }
+        if (t > newestFresh) {
+            newer++;  // リストは新しい順のため、新しい地震は常に先頭側に集まる
+        }
+        kept++;
+    }
+    int newerInList = newer;
+    int older = kept - newer;
+    if (newer > MAX_EARTHQUAKE_LIST - freshCount) {
+        newer = MAX_EARTHQUAKE_LIST - freshCount;
+    }
+    if (older > MAX_EARTHQUAKE_LIST - freshCount - newer) {
+        older = MAX_EARTHQUAKE_LIST - freshCount - newer;
+    }
+
+    // 古い地震を後ろにずらし、新しい地震の後に取得結果を配置
+    for (int i = older - 1; i >= 0; i--) {
+        earthquakeList[newer + freshCount + i] = earthquakeList[newerInList + i];
+    }
+    for (int i = 0; i < freshCount; i++) {
+        earthquakeList[newer + i] = fresh[i];
+    }
+    earthquakeCount = newer + freshCount + older;
+
+    consoleLog("[Display] 表示中リストと統合: 取得" + String(freshCount) + "件 + 新着" + String(newer) +
+               "件 + 保持" + String(older) + "件");
+}
+
+/**
+ * @brief 地震情報表示機能を初期化（メイン画面への遷移時に呼び出し）
+ * @details restoreDisplaySnapshot()で復元済み、または受信済みのリストがあれば描画し、
+ *          なければ空メッセージを表示する。REST APIの取得結果はmergeFetchedEarthquakes()で反映する
+ */
+void initDisplay() {
+    if (getEarthquakeCount() > 0) {
         renderList();
     } else {
         renderEmptyMessage();
@@ -565,6 +1167,37 @@ void initDisplay() {
     consoleLog("[Display] 初期化完了");
 }
 
+/**
+ * @brief REST APIで取得した地震情報をリストに反映
+ * @param fresh 取得した地震情報（新しい順）
+ * @param freshCount 件数
+ * @details 復元済みまたはWebSocketで受信済みのリストがある場合は統合する
+ */
+void mergeFetchedEarthquakes(const EarthquakeData* fresh, int freshCount) {
+    if (freshCount <= 0) {
+        return;
+    }
+
+    if (earthquakeCount > 0) {
+        reconcileWithFreshData(fresh, freshCount);
+    } else {
+        addEarthquakesToList(fresh, freshCount);
+        consoleLog("[Display] 初期データ読み込み完了: " + String(freshCount) + "件");
+    }
+
+    // 履歴には古い順に記録（記録済みの地震は記録されず、WebSocketで先に受信した地震より古いものは途中に挿入される）
+    for (int i = freshCount - 1; i >= 0; i--) {
+        appendHistory(fresh[i]);
+    }
+    rebuildListRows();
+    updateHistoryTail();
+    if (!isUserScrolling()) {
+        setScrollOffset(0);  // 最大スクロールオフセットを再計算
+    }
+    requestSnapshotSave();
+    renderList();
+}
+
 /**
  * @brief 慣性スクロール処理
  */
@@ -591,7 +1224,15 @@ static void applyInertiaScroll() {
  * @brief 地震情報表示を更新（loop()から呼び出し）
  */
 void updateDisplay() {
-    if (earthquakeCount == 0) {
+    if (getEarthquakeCount() == 0) {
+        return;
+    }
+
+    // 詳細画面の表示中はタッチ（離した時点）でリストに戻る
+    if (isDetailOpen) {
+        if (M5.Touch.getDetail().wasReleased()) {
+            closeDetail();
+        }
         return;
     }
 
@@ -608,17 +1249,78 @@ void updateDisplay() {
     }
 }
 
+/**
+ * @brief 表示リストの地震情報を続報で置き換え
+ * @param index 表示リストのインデックス
+ * @param data 続報の地震情報
+ * @details 表示行が変わらなければ該当のカードのみ再描画する（震源が移ってクラスタが変わった場合などはリスト全体）。
+ *          クラスタは震央が元のクラスタの範囲内なら引き継ぐ。SDカードの履歴は同じ位置のレコードを書き換え、
+ *          リストから外れた後も続報の内容を表示する
+ */
+static void updateEarthquakeInList(int index, const EarthquakeData& data) {
+    EarthquakeData& entry = earthquakeList[index];
+    consoleLog("[Display] 続報で更新: " + entry.hypocenterName + " 震度" + intensityLabel(entry.maxIntensity) +
+               " → " + data.hypocenterName + " 震度" + intensityLabel(data.maxIntensity));
+
+    bool wasDetail = isDetailOpen && isSameEvent(detailData, entry);
+    ListRow previousRows[MAX_EARTHQUAKE_LIST * 2];
+    int previousRowCount = listRowCount;
+    memcpy(previousRows, listRows, sizeof(ListRow) * listRowCount);
+
+    uint16_t previousClusterId = entry.clusterId;
+    entry = data;
+    reassignCluster(previousClusterId, entry);
+    appendHistory(entry);
+    rebuildListRows();
+    updateHistoryTail();
+
+    if (wasDetail) {
+        detailData = entry;
+        renderDetail();
+    } else if (!isDetailOpen) {
+        bool rowsChanged = (listRowCount != previousRowCount);
+        for (int r = 0; !rowsChanged && r < listRowCount; r++) {
+            rowsChanged = listRows[r].index != previousRows[r].index || listRows[r].clusterId != previousRows[r].clusterId ||
+                          listRows[r].clusterCount != previousRows[r].clusterCount ||
+                          listRows[r].clusterMax != previousRows[r].clusterMax;
+        }
+        if (rowsChanged) {
+            setScrollOffset(scrollOffset);  // 最大スクロールオフセットを再計算
+            renderList();
+        } else {
+            for (int r = 0; r < listRowCount; r++) {
+                if (listRows[r].index == index) {
+                    renderRow(r);
+                    break;
+                }
+            }
+            renderScrollIndicator();
+        }
+        lastScrollOffset = scrollOffset;
+    }
+
+    requestSnapshotSave();
+}
+
 /**
  * @brief WebSocketから受信した新規地震情報をリストに追加
  * @param data 地震情報データ
  */
 void addEarthquakeToDisplay(const EarthquakeData& data) {
     // 入力検証
-    if (data.maxIntensity.length() == 0) {
+    if (data.maxIntensity == Intensity::Unknown) {
         consoleLog("[Display] 不正なデータ、追加をスキップ");
         return;
     }
 
+    // 同じ地震の続報は、既存のカードを置き換える
+    for (int k = 0; k < earthquakeCount; k++) {
+        if (isSameEvent(earthquakeList[k], data)) {
+            updateEarthquakeInList(k, data);
+            return;
+        }
+    }
+
     // リストが満杯の場合、最古データを削除（末尾）
     if (earthquakeCount >= MAX_EARTHQUAKE_LIST) {
         earthquakeCount = MAX_EARTHQUAKE_LIST - 1;
@@ -633,9 +1335,15 @@ void addEarthquakeToDisplay(const EarthquakeData& data) {
     // 先頭に新規データを挿入
     earthquakeList[0] = data;
     earthquakeCount++;
+    appendHistory(data);
+    rebuildListRows();
+    updateHistoryTail();
 
     consoleLog("[Display] リストに追加: " + data.hypocenterName +
-               " 震度" + data.maxIntensity + " (" + String(earthquakeCount) + "件)");
+               " 震度" + intensityLabel(data.maxIntensity) + " (" + String(earthquakeCount) + "件)");
+
+    // 新しい地震はリストで知らせるため、詳細画面は閉じる
+    isDetailOpen = false;
 
     // スクロール状態を確認
     if (!isUserScrolling()) {
@@ -649,4 +1357,7 @@ void addEarthquakeToDisplay(const EarthquakeData& data) {
 
     // リストを再描画
     renderList();
+
+    // スナップショットの書き込みを予約
+    requestSnapshotSave();
 }
@@ -10,11 +10,32 @@
 #include "earthquake.h"
 
 /**
- * @brief 地震情報表示機能を初期化
- * @details リストデータ構造を初期化し、初期メッセージを表示
+ * @brief 地震情報表示機能を初期化（メイン画面への遷移時に呼び出し）
+ * @details 復元済み・受信済みのリストがあれば描画し、なければ空メッセージを表示
  */
 void initDisplay();
 
+/**
+ * @brief REST APIで取得した地震情報をリストに反映
+ * @param fresh 取得した地震情報（新しい順）
+ * @param freshCount 件数
+ * @details 復元済みまたはWebSocketで受信済みのリストがある場合は統合する
+ */
+void mergeFetchedEarthquakes(const EarthquakeData* fresh, int freshCount);
+
+/**
+ * @brief リストを初期化し、前回保存したリストを復元（WiFi接続前の起動直後に呼び出し）
+ * @return 復元した件数
+ * @details 描画はinitDisplay()で行う。復元したリストはmergeFetchedEarthquakes()でREST APIの取得結果と統合される
+ */
+int restoreDisplaySnapshot();
+
+/**
+ * @brief SDカードの履歴をリスト末尾に接続（initHistory()の後に呼び出し）
+ * @details 表示リストの最古より前の履歴を、リストに続けてスクロール表示する
+ */
+void attachDisplayHistory();
+
 /**
  * @brief 地震情報表示を更新（loop()から呼び出し）
  * @details タッチ処理、スクロール、リスト描画を実行
@@ -27,14 +48,6 @@ void updateDisplay();
  */
 void addEarthquakeToDisplay(const EarthquakeData& data);
 
-/**
- * @brief 震度に応じた背景色を取得
- * @param intensity 震度文字列（"1", "2", "3", "4", "5弱", "5強", "6弱", "6強", "7"）
- * @return 背景色（uint16_t RGB565形式）
- * @details notification.cppから視覚通知の点滅色として使用
- */
-uint16_t getIntensityColor(const String& intensity);
-
 /**
  * @brief ユーザーがスクロール中かを判定
  * @return スクロール中ならtrue、停止中ならfalse
@@ -42,10 +55,23 @@ uint16_t getIntensityColor(const String& intensity);
  */
 bool isUserScrolling();
 
+/**
+ * @brief スクロールアニメーション中かを判定
+ * @return ドラッグ中または慣性スクロール中ならtrue
+ * @details loop()はアニメーション中はアイドル待機せずに毎回描画する
+ */
+bool isDisplayAnimating();
+
 /**
  * @brief 地震情報リストを画面に描画
  * @details notification.cppから視覚通知終了時に呼び出し
  */
 void renderList();
 
+/**
+ * @brief renderList()の描画コスト統計をシリアルに出力して集計をリセット
+ * @details 描画回数、平均・最大描画時間、うち時刻整形の平均時間。描画がなかった期間は出力しない
+ */
+void logRenderStats();
+
 #endif // DISPLAY_H
@@ -4,6 +4,9 @@
  */
 
 #include "earthquake.h"
+#include "timesync.h"
+#include "alertpolicy.h"
+#include "arrival.h"
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
@@ -163,6 +166,93 @@ static String decodeHexMessage(const String &hexMessage) {
     return result;
 }
 
+/**
+ * @brief 固定桁の10進数を読み取り
+ * @param text 読み取り位置
+ * @param digits 桁数
+ * @return 値、数字以外を含む場合-1
+ */
+static int readDigits(const char *text, int digits) {
+    int value = 0;
+    for (int i = 0; i < digits; i++) {
+        if (text[i] < '0' || text[i] > '9') {
+            return -1;
+        }
+        value = value * 10 + (text[i] - '0');
+    }
+    return value;
+}
+
+/**
+ * @brief ISO8601形式の発生時刻をUTCのUnix時刻とUTCオフセットに変換（ヒープ確保なし）
+ * @param text 発生時刻（例: "2024-12-03T14:30:00+09:00"、"2024/12/03 14:30:00"、"...Z"）
+ * @param utc UTCのUnix時刻（出力パラメータ）
+ * @param offsetMinutes UTCオフセット（分、出力パラメータ）
+ * @return 変換成功時true
+ * @details 小数秒は切り捨てる。オフセットがない場合は気象庁の発表時刻としてJST（+09:00）とみなす。
+ *          オフセットは"Z"、"±HH"、"±HHMM"、"±HH:MM"のみ受け付ける
+ */
+static bool parseOriginTime(const char *text, time_t &utc, int16_t &offsetMinutes) {
+    if (strlen(text) < 19) {
+        return false;
+    }
+    int year = readDigits(text, 4);
+    int month = readDigits(text + 5, 2);
+    int day = readDigits(text + 8, 2);
+    int hour = readDigits(text + 11, 2);
+    int minute = readDigits(text + 14, 2);
+    int second = readDigits(text + 17, 2);
+    if (year < 0 || month < 1 || month > 12 || day < 1 || day > 31 ||
+        hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 60) {
+        return false;
+    }
+
+    // 小数秒を読み飛ばしてタイムゾーン指定を解析
+    const char *zone = text + 19;
+    if (*zone == '.') {
+        zone++;
+        while (*zone >= '0' && *zone <= '9') {
+            zone++;
+        }
+    }
+    // 長さを確かめてから読む（"±HH"、"±HHMM"、"±HH:MM"のみ受け付け、後続の文字があれば不正）
+    size_t zoneLength = strlen(zone);
+    int offset = 9 * 60;
+    if (zoneLength == 0) {
+        // オフセットなし: JST
+    } else if (*zone == 'Z') {
+        if (zoneLength != 1) {
+            return false;
+        }
+        offset = 0;
+    } else if (*zone == '+' || *zone == '-') {
+        int offsetHour = readDigits(zone + 1, 2);
+        int offsetMinute;
+        if (zoneLength == 3) {
+            offsetMinute = 0;
+        } else if (zoneLength == 5) {
+            offsetMinute = readDigits(zone + 3, 2);
+        } else if (zoneLength == 6 && zone[3] == ':') {
+            offsetMinute = readDigits(zone + 4, 2);
+        } else {
+            return false;
+        }
+        if (offsetHour < 0 || offsetHour > 23 || offsetMinute < 0 || offsetMinute > 59) {
+            return false;
+        }
+        offset = offsetHour * 60 + offsetMinute;
+        if (*zone == '-') {
+            offset = -offset;
+        }
+    } else {
+        return false;
+    }
+
+    utc = makeUtcTime(year, month, day, hour, minute, second) - (time_t)offset * 60;
+    offsetMinutes = (int16_t)offset;
+    return true;
+}
+
 /**
  * @brief 地震情報JSONをパースしてデータ構造体に変換
  * @param earthquakeJson 地震情報JSON文字列
@@ -192,29 +282,23 @@ static bool parseEarthquakeJson(const String &earthquakeJson, EarthquakeData &da
         return false;
     }
 
-    // フィールドを格納
+    // フィールドを格納（発生時刻はここで1回だけUTCに変換し、表示時は整数のみで整形する）
     data.datetime = eq["time"] | "";
+    if (!parseOriginTime(data.datetime.c_str(), data.originTime, data.utcOffsetMinutes)) {
+        consoleLog("発生時刻の形式が不正です: " + data.datetime);
+        data.originTime = 0;
+        data.utcOffsetMinutes = 0;
+    }
     data.hypocenterName = eq["hypocenter"]["name"] | "";
     data.latitude = eq["hypocenter"]["latitude"] | 0.0f;
     data.longitude = eq["hypocenter"]["longitude"] | 0.0f;
     data.depth = eq["hypocenter"]["depth"] | 0;
     data.magnitude = eq["hypocenter"]["magnitude"] | 0.0f;
 
-    // maxScaleを震度文字列に変換（10=震度1, 20=震度2, ...）
+    // maxScaleを震度に変換（10=震度1, 20=震度2, ..., 45=5弱, 70=7）
     int maxScale = eq["maxScale"] | 0;
-    if (maxScale >= 10 && maxScale <= 40) {
-        data.maxIntensity = String(maxScale / 10);
-    } else if (maxScale == 45) {
-        data.maxIntensity = "5弱";
-    } else if (maxScale == 50) {
-        data.maxIntensity = "5強";
-    } else if (maxScale == 55) {
-        data.maxIntensity = "6弱";
-    } else if (maxScale == 60) {
-        data.maxIntensity = "6強";
-    } else if (maxScale == 70) {
-        data.maxIntensity = "7";
-    } else {
+    data.maxIntensity = intensityFromMaxScale(maxScale);
+    if (data.maxIntensity == Intensity::Unknown) {
         // 震度が不明な場合は無効なデータとして扱う
         consoleLog("震度が不明なため、このデータをスキップします");
         return false;
@@ -232,6 +316,9 @@ static bool parseEarthquakeJson(const String &earthquakeJson, EarthquakeData &da
         return false;
     }
 
+    // 設置場所の震度を推定（受信時に1回のみ、通知の段階付けに使用）
+    estimateSiteIntensity(data);
+
     return true;
 }
 
@@ -246,7 +333,10 @@ static void printEarthquakeData(const EarthquakeData &data, int index, int total
     consoleLog("発生時刻: " + data.datetime);
     consoleLog("震源地: " + data.hypocenterName);
     consoleLog("マグニチュード: M" + String(data.magnitude, 1));
-    consoleLog("最大震度: " + data.maxIntensity);
+    consoleLog("最大震度: " + String(intensityLabel(data.maxIntensity)));
+    if (data.hasSiteEstimate) {
+        consoleLog("推定震度（設置場所）: " + String(intensityLabel(data.siteIntensity)));
+    }
     consoleLog("深さ: " + String(data.depth) + "km");
     consoleLog("津波: " + data.tsunami);
     consoleLog("---");
@@ -273,10 +363,18 @@ static bool sendHttpsRequest(const String &url, String &response) {
         return false;
     }
 
+    // 時計設定用にDateヘッダーを保持（NTP応答を待たずに時刻を取得する）
+    const char *headerKeys[] = {"Date"};
+    http.collectHeaders(headerKeys, 1);
+
     // GETリクエスト送信
     int httpCode = http.GET();
     consoleLog("HTTP Status: " + String(httpCode));
 
+    if (httpCode > 0 && http.hasHeader("Date")) {
+        seedClockFromHttpDate(http.header("Date"));
+    }
+
     if (httpCode != HTTP_CODE_OK) {
         consoleLog("HTTP Error: " + String(httpCode));
         http.end();
@@ -356,3 +454,19 @@ bool parseWebSocketMessage(const String &hexMessage, EarthquakeData &data) {
 
     return true;
 }
+
+bool isSameEvent(const EarthquakeData &a, const EarthquakeData &b) {
+    if (a.originTime == 0 || b.originTime == 0) {
+        return false;
+    }
+    time_t diff = (a.originTime > b.originTime) ? a.originTime - b.originTime : b.originTime - a.originTime;
+    if (diff > EVENT_SAME_TIME_S) {
+        return false;
+    }
+    bool aKnown = !(a.latitude == 0 && a.longitude == 0);
+    bool bKnown = !(b.latitude == 0 && b.longitude == 0);
+    if (!aKnown || !bKnown) {
+        return true;
+    }
+    return greatCircleDistanceKm10(a.latitude, a.longitude, b.latitude, b.longitude) <= (uint32_t)EVENT_SAME_DISTANCE_KM * 10;
+}
@@ -9,10 +9,15 @@
 
 #include <Arduino.h>
 #include "network.h"  // SymbolConfig構造体を使用
+#include "intensity.h"
 
 // main.cppで定義されているconsoleLog関数の宣言
 extern void consoleLog(String message);
 
+// 同一の地震の判定（気象庁の続報は同じ地震について発生時刻・震源を改めて発表する）
+#define EVENT_SAME_TIME_S 60         // 発生時刻の差の上限（秒）
+#define EVENT_SAME_DISTANCE_KM 100   // 震央間の距離の上限（km、速報と詳細で震源が移る分を含む）
+
 // タイムアウト設定
 #define HTTP_CONNECT_TIMEOUT 10000  // HTTP接続タイムアウト（ミリ秒）
 #define HTTP_READ_TIMEOUT 10000     // HTTP読み取りタイムアウト（ミリ秒）
@@ -22,14 +27,19 @@ extern void consoleLog(String message);
  * @details Symbol blockchainから取得した地震情報を格納
  */
 struct EarthquakeData {
-    String datetime;           // 発生時刻（例: "2024-01-15T14:30:00+09:00"）
+    String datetime;           // 発生時刻の元の文字列（ログ用、例: "2024-01-15T14:30:00+09:00"）
+    time_t originTime = 0;     // 発生時刻（UTC、Unix時刻・秒、0は不明）
+    int16_t utcOffsetMinutes = 0;  // 発生時刻文字列のUTCオフセット（分、表示用、例: +09:00は540）
     String hypocenterName;     // 震源地名（例: "茨城県沖"）
     float latitude;            // 緯度（度）
     float longitude;           // 経度（度）
     int depth;                 // 深さ（km）
     float magnitude;           // マグニチュード
-    String maxIntensity;       // 最大震度（例: "5弱", "4", "7"）
+    Intensity maxIntensity = Intensity::Unknown;  // 最大震度（表示文字列はintensityLabel()）
     String tsunami;            // 津波警報状態（例: "なし", "注意報", "警報"）
+    bool hasSiteEstimate = false;                  // 設置場所の震度を推定済みか（受信時に計算、保存はしない）
+    Intensity siteIntensity = Intensity::Unknown;  // 設置場所の推定震度（推定済みでUnknownは震度0）
+    uint16_t clusterId = 0;    // 余震クラスタの識別子（表示リストへの追加時に割り当て、保存はしない、0は未所属）
 };
 
 // グローバルデータバッファ（display.cppとの連携用、Phase 1暫定実装）
@@ -54,4 +64,14 @@ bool fetchEarthquakeData(const SymbolConfig &config, int count = 10);
  */
 bool parseWebSocketMessage(const String &hexMessage, EarthquakeData &data);
 
+/**
+ * @brief 2件の地震情報が同じ地震の報（続報・訂正）かを判定
+ * @param a 地震情報
+ * @param b 地震情報
+ * @return 発生時刻の差がEVENT_SAME_TIME_S以内で、震央間の距離がEVENT_SAME_DISTANCE_KM以内ならtrue
+ *         （どちらかの震源が不明の場合は発生時刻のみで判定、発生時刻が不明の場合はfalse）
+ * @details 距離はgreatCircleDistanceKm10()で求めるため、initArrival()の後に使用すること
+ */
+bool isSameEvent(const EarthquakeData &a, const EarthquakeData &b);
+
 #endif // EARTHQUAKE_H
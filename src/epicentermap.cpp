@@ -0,0 +1,186 @@
+/**
+ * @file epicentermap.cpp
+ * @brief 震央地図の描画の実装
+ * @details 投影は基準緯度36度の正距円筒図法（経度方向をcos36°で縮める）で、
+ *          0.01度単位の整数座標にQ16の倍率を掛けてピクセルに変換する（tools/gen_coastline.pyのプレビューと同じ計算）。
+ *          線分はスプライトのバッファにBresenham法で直接描画し、描画APIの1画素ごとの呼び出しを避ける
+ */
+
+#include "epicentermap.h"
+#include "arrival.h"
+#include "coastline_data.h"
+#include "rendertarget.h"
+#include <M5Unified.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+// 投影（地図の左上が北緯46度・東経110度、緯度1度が9.5ピクセル）
+static const int32_t MAP_LAT_TOP = 4600;      // 地図の上端の緯度（0.01度）
+static const int32_t MAP_LON_LEFT = 11000;    // 地図の左端の経度（0.01度）
+static const int32_t MAP_SCALE_X_Q16 = 5037;  // 経度0.01度あたりのピクセル（9.5×cos36°/100、Q16）
+static const int32_t MAP_SCALE_Y_Q16 = 6226;  // 緯度0.01度あたりのピクセル（9.5/100、Q16）
+static const int MAP_STRIDE = (EPICENTER_MAP_WIDTH + 7) / 8;  // ビットマップ1行のバイト数
+
+// 経緯線（5度間隔、4ピクセルごとの点線）
+static const int32_t GRATICULE_STEP = 500;    // 0.01度単位
+static const int GRATICULE_DOT_SPACING = 4;
+
+// 印の大きさ
+static const int EPICENTER_MARK_SIZE = 6;     // 震央の×印の半径
+static const int SITE_MARK_SIZE = 3;          // 設置場所の印の半径
+
+// 海岸線を描画済みのスプライト（初回表示時に作成し、以降は再利用）
+static M5Canvas mapSprite(&M5.Display);
+static bool mapReady = false;
+
+/**
+ * @brief 0.01度単位の座標を地図上の座標に投影
+ */
+static inline void project(int32_t lat100, int32_t lon100, int &x, int &y) {
+    x = (int)(((lon100 - MAP_LON_LEFT) * MAP_SCALE_X_Q16) >> 16);
+    y = (int)(((MAP_LAT_TOP - lat100) * MAP_SCALE_Y_Q16) >> 16);
+}
+
+bool projectToEpicenterMap(float latitude, float longitude, int &x, int &y) {
+    project(lroundf(latitude * 100), lroundf(longitude * 100), x, y);
+    return x >= 0 && x < EPICENTER_MAP_WIDTH && y >= 0 && y < EPICENTER_MAP_HEIGHT;
+}
+
+/**
+ * @brief ビットマップの1画素を設定（範囲外は無視）
+ */
+static inline void setPixel(uint8_t *bitmap, int x, int y) {
+    if ((unsigned)x < EPICENTER_MAP_WIDTH && (unsigned)y < EPICENTER_MAP_HEIGHT) {
+        bitmap[y * MAP_STRIDE + (x >> 3)] |= 0x80 >> (x & 7);
+    }
+}
+
+/**
+ * @brief ビットマップに線分を描画（Bresenham法）
+ */
+static void drawSegment(uint8_t *bitmap, int x0, int y0, int x1, int y1) {
+    int dx = abs(x1 - x0);
+    int dy = -abs(y1 - y0);
+    int sx = (x0 < x1) ? 1 : -1;
+    int sy = (y0 < y1) ? 1 : -1;
+    int error = dx + dy;
+    while (true) {
+        setPixel(bitmap, x0, y0);
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+        int e2 = 2 * error;
+        if (e2 >= dy) {
+            error += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            error += dx;
+            y0 += sy;
+        }
+    }
+}
+
+/**
+ * @brief 経緯線を点線で描画
+ */
+static void drawGraticule(uint8_t *bitmap) {
+    int x;
+    int y;
+    for (int32_t lat = 2500; lat <= 4500; lat += GRATICULE_STEP) {
+        project(lat, MAP_LON_LEFT, x, y);
+        for (int px = 0; px < EPICENTER_MAP_WIDTH; px += GRATICULE_DOT_SPACING) {
+            setPixel(bitmap, px, y);
+        }
+    }
+    for (int32_t lon = 12000; lon <= 15000; lon += GRATICULE_STEP) {
+        project(MAP_LAT_TOP, lon, x, y);
+        for (int py = 0; py < EPICENTER_MAP_HEIGHT; py += GRATICULE_DOT_SPACING) {
+            setPixel(bitmap, x, py);
+        }
+    }
+}
+
+uint32_t rasterizeCoastline(uint8_t *bitmap) {
+    drawGraticule(bitmap);
+
+    uint32_t segments = 0;
+    for (const CoastlinePolyline &line : COASTLINE_POLYLINES) {
+        int32_t lat = line.lat;
+        int32_t lon = line.lon;
+        int x0;
+        int y0;
+        project(lat, lon, x0, y0);
+        const int8_t *delta = &COASTLINE_DELTAS[line.offset * 2];
+        for (uint16_t i = 0; i < line.count; i++) {
+            lat += delta[0];
+            lon += delta[1];
+            delta += 2;
+            int x1;
+            int y1;
+            project(lat, lon, x1, y1);
+            if (x1 != x0 || y1 != y0) {
+                drawSegment(bitmap, x0, y0, x1, y1);
+                segments++;
+            }
+            x0 = x1;
+            y0 = y1;
+        }
+    }
+    return segments;
+}
+
+/**
+ * @brief 海岸線のスプライトを作成（初回のみ）
+ * @return 作成済みならtrue
+ */
+static bool prepareMapSprite() {
+    if (mapReady) {
+        return true;
+    }
+    unsigned long start = micros();
+    mapSprite.setColorDepth(1);
+    if (mapSprite.createSprite(EPICENTER_MAP_WIDTH, EPICENTER_MAP_HEIGHT) == nullptr) {
+        consoleLog("[Map] スプライトの確保に失敗 (Free heap: " + String(ESP.getFreeHeap()) + " bytes)");
+        return false;
+    }
+    mapSprite.setPaletteColor(0, EPICENTER_MAP_COLOR_SEA);
+    mapSprite.setPaletteColor(1, EPICENTER_MAP_COLOR_LINE);
+    mapSprite.fillScreen(0);
+    uint32_t segments = rasterizeCoastline((uint8_t *)mapSprite.getBuffer());
+    mapReady = true;
+    consoleLog("[Map] 海岸線を描画: " + String(COASTLINE_POINT_COUNT) + "点, " + String(segments) + "線分, " +
+               String(micros() - start) + "us (スプライト" + String(mapSprite.bufferLength()) + "バイト)");
+    return true;
+}
+
+bool drawEpicenterMap(const EarthquakeData &data, int y) {
+    if (prepareMapSprite()) {
+        Screen.pushCanvas(mapSprite, 0, y);
+    } else {
+        Screen.fillRect(0, y, EPICENTER_MAP_WIDTH, EPICENTER_MAP_HEIGHT, EPICENTER_MAP_COLOR_SEA);
+    }
+
+    int px;
+    int py;
+    float siteLatitude;
+    float siteLongitude;
+    if (getSiteLocation(siteLatitude, siteLongitude) && projectToEpicenterMap(siteLatitude, siteLongitude, px, py)) {
+        Screen.fillRect(px - SITE_MARK_SIZE, y + py - SITE_MARK_SIZE, SITE_MARK_SIZE * 2 + 1, SITE_MARK_SIZE * 2 + 1,
+                            EPICENTER_MAP_COLOR_SITE);
+    }
+
+    // 震源が不明な地震（緯度・経度が0）は印を付けない
+    bool shown = !(data.latitude == 0 && data.longitude == 0) && projectToEpicenterMap(data.latitude, data.longitude, px, py);
+    if (shown) {
+        int cy = y + py;
+        for (int offset = -1; offset <= 1; offset++) {
+            Screen.drawLine(px - EPICENTER_MARK_SIZE + offset, cy - EPICENTER_MARK_SIZE, px + EPICENTER_MARK_SIZE + offset,
+                                cy + EPICENTER_MARK_SIZE, EPICENTER_MAP_COLOR_EPICENTER);
+            Screen.drawLine(px - EPICENTER_MARK_SIZE + offset, cy + EPICENTER_MARK_SIZE, px + EPICENTER_MARK_SIZE + offset,
+                                cy - EPICENTER_MARK_SIZE, EPICENTER_MAP_COLOR_EPICENTER);
+        }
+    }
+    return shown;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file epicentermap.h
+ * @brief 震央地図（日本の海岸線と震央・設置場所の印）の描画
+ * @details 海岸線はビルド時に生成した差分符号化の折れ線（coastline_data.h、フラッシュに配置）を
+ *          固定小数点で投影し、初回表示時に1ビットのスプライトへ1回だけ描画して以降は再利用する。
+ *          ヒープはスプライトのバッファ（EPICENTER_MAP_WIDTH×EPICENTER_MAP_HEIGHT/8バイト）のみ使用する
+ */
+
+#ifndef EPICENTERMAP_H
+#define EPICENTERMAP_H
+
+#include <Arduino.h>
+#include "earthquake.h"
+
+// 地図の大きさ（ヘッダー下のメイン表示エリア全体）
+#define EPICENTER_MAP_WIDTH 320
+#define EPICENTER_MAP_HEIGHT 210
+
+// 地図の色（RGB565）
+#define EPICENTER_MAP_COLOR_SEA 0x0008       // 海: 暗い紺
+#define EPICENTER_MAP_COLOR_LINE 0x8C71      // 海岸線・経緯線: グレー
+#define EPICENTER_MAP_COLOR_EPICENTER TFT_RED
+#define EPICENTER_MAP_COLOR_SITE TFT_GREEN
+
+/**
+ * @brief 緯度・経度を地図上の座標に投影（固定小数点）
+ * @param latitude 緯度（度）
+ * @param longitude 経度（度）
+ * @param x X座標（出力先、地図の左上基準のピクセル）
+ * @param y Y座標（出力先）
+ * @return 地図の範囲内ならtrue
+ */
+bool projectToEpicenterMap(float latitude, float longitude, int &x, int &y);
+
+/**
+ * @brief 海岸線と経緯線を1ビットのビットマップに描画
+ * @param bitmap 描画先（1行 (EPICENTER_MAP_WIDTH+7)/8 バイト、MSBが左端、EPICENTER_MAP_HEIGHT行、0で初期化済み）
+ * @return 描画した線分の数
+ * @details スプライトのバッファに直接描画する（1ビットスプライトと同じ画素配置）。ホスト上でも動作する
+ */
+uint32_t rasterizeCoastline(uint8_t *bitmap);
+
+/**
+ * @brief 震央地図を描画
+ * @param data 地震情報（震央の印に緯度・経度を使用）
+ * @param y 描画先のY座標（地図の上端）
+ * @return 震央を地図上に表示できた場合true（震源が不明・範囲外の場合はfalse、海岸線と設置場所は描画する）
+ * @details 初回のみ海岸線をスプライトに描画し、以降はスプライトの転送と印の描画のみ行う
+ */
+bool drawEpicenterMap(const EarthquakeData &data, int y);
+
+#endif // EPICENTERMAP_H
@@ -0,0 +1,627 @@
+/**
+ * @file history.cpp
+ * @brief SDカード上の追記専用地震履歴ストアの実装
+ * @details 履歴ファイルは「ヘッダー + EventRecord×件数」で、レコードiの位置は計算で求まる。
+ *          電源断で末尾に書きかけのレコードが残った場合は件数に含めず、次の追記で上書きする。
+ *          インデックスファイルはレコードHISTORY_INDEX_STRIDE件ごとに発生時刻（uint32_t）を1つ追記する。
+ *          最新より古い地震は後ろのレコードを1件ずつずらして挿入する（ずらしている途中の電源断では
+ *          1件が重複して残るが、発生時刻の順序は保たれる）。続報は記録済みのレコードを同じ位置で書き換える
+ */
+
+#include "history.h"
+#include "config.h"
+#include "snapshot.h"
+#include <SD.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+static const uint32_t HISTORY_MAGIC = 0x53485145;  // "EQHS"
+static const uint8_t HISTORY_VERSION = 1;           // EventRecordの形式変更時に更新（旧形式は作り直す）
+static const uint32_t HISTORY_MAX_RECORDS = (uint32_t)HISTORY_INDEX_STRIDE * HISTORY_INDEX_CAPACITY;
+
+/**
+ * @brief 履歴ファイルのヘッダー
+ */
+struct HistoryHeader {
+    uint32_t magic;       // HISTORY_MAGIC
+    uint8_t version;      // HISTORY_VERSION
+    uint8_t reserved;     // 予約（0）
+    uint16_t recordSize;  // sizeof(EventRecord)
+};
+static_assert(sizeof(HistoryHeader) == 8, "HistoryHeader layout changed, bump HISTORY_VERSION");
+
+/**
+ * @brief LRUキャッシュの1ページ（連続するHISTORY_PAGE_RECORDS件）
+ */
+struct HistoryPage {
+    int32_t page;          // ページ番号（-1は未使用）
+    uint32_t lastUsed;     // 最終参照の通し番号（LRU判定用）
+    uint8_t count;         // 有効なレコード数（末尾ページは満たないことがある）
+    EventRecord records[HISTORY_PAGE_RECORDS];
+};
+
+// 履歴の状態
+static bool historyReady = false;
+static uint32_t recordCount = 0;      // 有効なレコード数
+static uint32_t newestTime = 0;       // 最新レコードの発生時刻（末尾への追記か途中への挿入かの判定用）
+static bool capacityLogged = false;   // 容量上限のログ出力済みフラグ
+
+// 疎インデックス（timeIndex[k]はレコードk×HISTORY_INDEX_STRIDEの発生時刻）
+static uint32_t timeIndex[HISTORY_INDEX_CAPACITY];
+static uint32_t indexCount = 0;
+
+// ページキャッシュと読み出し用ファイル（追記後は閉じて開き直す）
+static HistoryPage cachePages[HISTORY_CACHE_PAGES];
+static uint32_t useCounter = 0;
+static File readFile;
+static bool readFileOpen = false;
+
+static HistoryStats stats;
+
+/**
+ * @brief レコードのファイル内オフセットを計算
+ * @param index レコードのインデックス
+ */
+static uint32_t recordOffset(uint32_t index) {
+    return sizeof(HistoryHeader) + index * sizeof(EventRecord);
+}
+
+/**
+ * @brief 読み出し用ファイルを閉じる（ファイルサイズが変わる追記の前後に呼び出し）
+ */
+static void closeReadFile() {
+    if (readFileOpen) {
+        readFile.close();
+        readFileOpen = false;
+    }
+}
+
+/**
+ * @brief ページキャッシュを全て無効化
+ */
+static void clearPageCache() {
+    for (int i = 0; i < HISTORY_CACHE_PAGES; i++) {
+        cachePages[i].page = -1;
+        cachePages[i].lastUsed = 0;
+        cachePages[i].count = 0;
+    }
+}
+
+/**
+ * @brief 指定ページをSDカードからキャッシュに読み込み
+ * @param slot 読み込み先のキャッシュページ
+ * @param page ページ番号
+ * @return 成功時true
+ */
+static bool loadPage(HistoryPage &slot, int32_t page) {
+    unsigned long startMicros = micros();
+
+    if (!readFileOpen) {
+        readFile = SD.open(HISTORY_FILE_PATH, FILE_READ);
+        if (!readFile) {
+            return false;
+        }
+        readFileOpen = true;
+    }
+
+    uint32_t first = (uint32_t)page * HISTORY_PAGE_RECORDS;
+    uint32_t count = recordCount - first;
+    if (count > HISTORY_PAGE_RECORDS) {
+        count = HISTORY_PAGE_RECORDS;
+    }
+    size_t bytes = count * sizeof(EventRecord);
+    if (!readFile.seek(recordOffset(first)) || readFile.read((uint8_t *)slot.records, bytes) != bytes) {
+        slot.page = -1;
+        closeReadFile();
+        return false;
+    }
+    slot.page = page;
+    slot.count = (uint8_t)count;
+
+    uint32_t elapsed = micros() - startMicros;
+    stats.pageMisses++;
+    stats.missMicrosTotal += elapsed;
+    if (elapsed > stats.missMicrosMax) {
+        stats.missMicrosMax = elapsed;
+    }
+    return true;
+}
+
+/**
+ * @brief キャッシュ経由でレコードを取得
+ * @param index レコードのインデックス
+ * @return レコードへのポインタ（次の取得まで有効、失敗時はnullptr）
+ */
+static const EventRecord *getRecord(uint32_t index) {
+    if (!historyReady || index >= recordCount) {
+        return nullptr;
+    }
+    stats.reads++;
+
+    int32_t page = (int32_t)(index / HISTORY_PAGE_RECORDS);
+    uint32_t offset = index % HISTORY_PAGE_RECORDS;
+
+    // キャッシュ済みならそのまま、なければ最も長く参照されていないページを置き換え
+    HistoryPage *victim = &cachePages[0];
+    for (int i = 0; i < HISTORY_CACHE_PAGES; i++) {
+        HistoryPage &slot = cachePages[i];
+        if (slot.page == page && offset < slot.count) {
+            slot.lastUsed = ++useCounter;
+            return &slot.records[offset];
+        }
+        if (slot.page == -1 || (victim->page != -1 && slot.lastUsed < victim->lastUsed)) {
+            victim = &slot;
+        }
+    }
+
+    if (!loadPage(*victim, page)) {
+        return nullptr;
+    }
+    victim->lastUsed = ++useCounter;
+    return &victim->records[offset];
+}
+
+/**
+ * @brief レコードの発生時刻を取得
+ * @param index レコードのインデックス
+ * @param originTime 出力先
+ * @return 成功時true
+ */
+static bool readRecordTime(uint32_t index, uint32_t &originTime) {
+    const EventRecord *record = getRecord(index);
+    if (record == nullptr) {
+        return false;
+    }
+    originTime = record->originTime;
+    return true;
+}
+
+/**
+ * @brief 空の履歴ファイルを作成（既存のファイルとインデックスは削除）
+ * @return 成功時true
+ */
+static bool createHistoryFile() {
+    closeReadFile();
+    SD.remove(HISTORY_FILE_PATH);
+    SD.remove(HISTORY_INDEX_PATH);
+
+    File file = SD.open(HISTORY_FILE_PATH, FILE_WRITE);
+    if (!file) {
+        return false;
+    }
+    HistoryHeader header;
+    header.magic = HISTORY_MAGIC;
+    header.version = HISTORY_VERSION;
+    header.reserved = 0;
+    header.recordSize = sizeof(EventRecord);
+    bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+    file.close();
+
+    recordCount = 0;
+    indexCount = 0;
+    return ok;
+}
+
+/**
+ * @brief 既存の履歴ファイルのヘッダーを検証し、件数を取得
+ * @return 形式が一致する場合true
+ */
+static bool openExistingHistory() {
+    File file = SD.open(HISTORY_FILE_PATH, FILE_READ);
+    if (!file) {
+        return false;
+    }
+    HistoryHeader header;
+    size_t size = file.size();
+    bool valid = file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+                 header.magic == HISTORY_MAGIC && header.version == HISTORY_VERSION &&
+                 header.recordSize == sizeof(EventRecord);
+    file.close();
+    if (!valid) {
+        consoleLog("[History] 形式不一致のため作り直し (version=" + String(header.version) + ")");
+        return false;
+    }
+
+    // 末尾の書きかけレコードは件数に含めない（次の追記で上書き）
+    recordCount = (size - sizeof(HistoryHeader)) / sizeof(EventRecord);
+    if ((size - sizeof(HistoryHeader)) % sizeof(EventRecord) != 0) {
+        consoleLog("[History] 末尾の不完全なレコードを破棄");
+    }
+    if (recordCount > HISTORY_MAX_RECORDS) {
+        recordCount = HISTORY_MAX_RECORDS;
+    }
+    return true;
+}
+
+/**
+ * @brief 疎インデックスを読み込み（件数と一致しない場合は履歴ファイルから再構築）
+ */
+static void loadTimeIndex() {
+    uint32_t expected = (recordCount + HISTORY_INDEX_STRIDE - 1) / HISTORY_INDEX_STRIDE;
+
+    File file = SD.open(HISTORY_INDEX_PATH, FILE_READ);
+    if (file) {
+        bool match = file.size() == expected * sizeof(uint32_t) &&
+                     file.read((uint8_t *)timeIndex, expected * sizeof(uint32_t)) == expected * sizeof(uint32_t);
+        file.close();
+        if (match) {
+            indexCount = expected;
+            return;
+        }
+    }
+
+    // 再構築（HISTORY_INDEX_STRIDE件ごとに1レコードを読む）
+    unsigned long startTime = millis();
+    indexCount = 0;
+    for (uint32_t k = 0; k < expected; k++) {
+        uint32_t originTime;
+        if (!readRecordTime(k * HISTORY_INDEX_STRIDE, originTime)) {
+            break;
+        }
+        timeIndex[indexCount++] = originTime;
+    }
+    if (indexCount < expected) {
+        // 読み出せない区間以降は使用しない
+        recordCount = indexCount * HISTORY_INDEX_STRIDE;
+    }
+
+    SD.remove(HISTORY_INDEX_PATH);
+    file = SD.open(HISTORY_INDEX_PATH, FILE_WRITE);
+    if (file) {
+        file.write((const uint8_t *)timeIndex, indexCount * sizeof(uint32_t));
+        file.close();
+    }
+    consoleLog("[History] インデックス再構築: " + String(indexCount) + "件 (" + String(millis() - startTime) + "ms)");
+}
+
+bool initHistory() {
+    unsigned long startTime = millis();
+    historyReady = false;
+    recordCount = 0;
+    indexCount = 0;
+    newestTime = 0;
+    closeReadFile();
+    clearPageCache();
+
+    if (!isSDCardMounted()) {
+        consoleLog("[History] SDカードなしのため履歴を無効化");
+        return false;
+    }
+
+    if (!SD.exists(HISTORY_FILE_PATH) || !openExistingHistory()) {
+        if (!createHistoryFile()) {
+            consoleLog("[History] 履歴ファイル作成失敗");
+            return false;
+        }
+    }
+
+    // 以降のレコード読み出しにはキャッシュを使用
+    historyReady = true;
+    loadTimeIndex();
+    if (recordCount > 0 && !readRecordTime(recordCount - 1, newestTime)) {
+        newestTime = 0;
+    }
+
+    consoleLog("[History] 初期化完了: " + String(recordCount) + "件, インデックス" + String(indexCount) + "件 (" +
+               String(millis() - startTime) + "ms)");
+    return true;
+}
+
+/**
+ * @brief 同じ地震の記録を探し、なければ発生時刻の順の挿入位置を求める
+ * @param data 地震情報
+ * @param position 記録済みならそのレコードの位置、なければ挿入位置（発生時刻がdataより後の最初のレコード）
+ * @return 同じ地震が記録済みならtrue
+ * @details 発生時刻の差がEVENT_SAME_TIME_S以内のレコードのみを調べる（末尾への追記ではキャッシュ済みの末尾ページのみ）
+ */
+static bool findRecordedEvent(const EarthquakeData &data, uint32_t &position) {
+    uint32_t target = (uint32_t)data.originTime;
+    int32_t before = findHistoryBefore(data.originTime > EVENT_SAME_TIME_S ? data.originTime - EVENT_SAME_TIME_S : 1);
+    uint32_t index = (uint32_t)(before + 1);
+    position = recordCount;
+    bool positionFound = false;
+
+    EarthquakeData recorded;
+    for (; index < recordCount; index++) {
+        const EventRecord *record = getRecord(index);
+        if (record == nullptr || record->originTime > target + EVENT_SAME_TIME_S) {
+            break;
+        }
+        if (!positionFound && record->originTime > target) {
+            position = index;
+            positionFound = true;
+        }
+        unpackEventRecord(*record, recorded);
+        if (isSameEvent(recorded, data)) {
+            position = index;
+            return true;
+        }
+    }
+    if (!positionFound) {
+        position = index;
+    }
+    return false;
+}
+
+/**
+ * @brief 挿入位置から末尾までのレコードを1件ずつ後ろへずらす
+ * @param file 履歴ファイル（読み書き）
+ * @param position 挿入位置
+ * @return 成功時true
+ * @details ページキャッシュの1ページを作業領域に使い、末尾側からページ単位で移す（キャッシュは呼び出し側で破棄する）
+ */
+static bool shiftRecords(File &file, uint32_t position) {
+    EventRecord *buffer = cachePages[0].records;
+    uint32_t end = recordCount;
+    while (end > position) {
+        uint32_t start = (end - position > HISTORY_PAGE_RECORDS) ? end - HISTORY_PAGE_RECORDS : position;
+        size_t bytes = (end - start) * sizeof(EventRecord);
+        if (!file.seek(recordOffset(start)) || file.read((uint8_t *)buffer, bytes) != bytes ||
+            !file.seek(recordOffset(start + 1)) || file.write((const uint8_t *)buffer, bytes) != bytes) {
+            return false;
+        }
+        end = start;
+    }
+    return true;
+}
+
+/**
+ * @brief 挿入でずれた区間の疎インデックスを更新
+ * @param file 履歴ファイル（挿入後の内容）
+ * @param position 挿入位置
+ */
+static void updateTimeIndexFrom(File &file, uint32_t position) {
+    File indexFile = SD.open(HISTORY_INDEX_PATH, "r+");
+    for (uint32_t k = (position + HISTORY_INDEX_STRIDE - 1) / HISTORY_INDEX_STRIDE;
+         k * HISTORY_INDEX_STRIDE < recordCount + 1 && k < HISTORY_INDEX_CAPACITY; k++) {
+        uint32_t originTime;
+        if (!file.seek(recordOffset(k * HISTORY_INDEX_STRIDE) + offsetof(EventRecord, originTime)) ||
+            file.read((uint8_t *)&originTime, sizeof(originTime)) != sizeof(originTime)) {
+            break;
+        }
+        timeIndex[k] = originTime;
+        if (k == indexCount) {
+            indexCount++;
+        }
+        // 開けない場合はファイルの件数が合わなくなり、次回起動時に再構築される
+        if (indexFile && indexFile.seek(k * sizeof(uint32_t))) {
+            indexFile.write((const uint8_t *)&originTime, sizeof(originTime));
+        }
+    }
+    if (indexFile) {
+        indexFile.close();
+    }
+}
+
+/**
+ * @brief 記録済みのレコードを続報の内容で書き換え
+ * @param index レコードのインデックス
+ * @param data 続報の地震情報
+ * @return 書き換えた場合true（内容が同じ場合はfalse）
+ * @details 発生時刻が前後のレコードとの順序を崩す場合は、記録済みの発生時刻を残す
+ */
+static bool rewriteRecord(uint32_t index, const EarthquakeData &data) {
+    const EventRecord *current = getRecord(index);
+    if (current == nullptr) {
+        return false;
+    }
+    EventRecord previous = *current;
+
+    EventRecord record;
+    memset(&record, 0, sizeof(record));  // パディングを0にしてファイル内容を決定的にする
+    packEventRecord(data, record);
+    uint32_t lower = 0;
+    uint32_t upper = UINT32_MAX;
+    if ((index > 0 && !readRecordTime(index - 1, lower)) || (index + 1 < recordCount && !readRecordTime(index + 1, upper))) {
+        return false;
+    }
+    if (record.originTime < lower || record.originTime > upper) {
+        record.originTime = previous.originTime;
+    }
+    if (memcmp(&record, &previous, sizeof(record)) == 0) {
+        return false;  // REST APIでの再取得など、内容が同じ
+    }
+
+    closeReadFile();
+    File file = SD.open(HISTORY_FILE_PATH, "r+");
+    if (!file) {
+        consoleLog("[History] 履歴ファイルを開けません");
+        return false;
+    }
+    bool ok = file.seek(recordOffset(index)) && file.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+    file.close();
+    if (!ok) {
+        consoleLog("[History] 書き換え失敗");
+        return false;
+    }
+
+    // 書き換えたレコードのページを破棄し、発生時刻が変わった場合はインデックスも更新
+    int32_t page = (int32_t)(index / HISTORY_PAGE_RECORDS);
+    for (int i = 0; i < HISTORY_CACHE_PAGES; i++) {
+        if (cachePages[i].page == page) {
+            cachePages[i].page = -1;
+        }
+    }
+    if (record.originTime != previous.originTime) {
+        if (index % HISTORY_INDEX_STRIDE == 0) {
+            timeIndex[index / HISTORY_INDEX_STRIDE] = record.originTime;
+            File indexFile = SD.open(HISTORY_INDEX_PATH, "r+");
+            if (indexFile) {
+                if (indexFile.seek((index / HISTORY_INDEX_STRIDE) * sizeof(uint32_t))) {
+                    indexFile.write((const uint8_t *)&record.originTime, sizeof(record.originTime));
+                }
+                indexFile.close();
+            }
+        }
+        if (index == recordCount - 1) {
+            newestTime = record.originTime;
+        }
+    }
+
+    consoleLog("[History] 続報で書き換え: " + data.hypocenterName + " (" + String(index) + "件目)");
+    stats.revisions++;
+    return true;
+}
+
+bool appendHistory(const EarthquakeData &data) {
+    if (!historyReady || data.originTime <= 0) {
+        return false;
+    }
+    uint32_t position = recordCount;
+    if (recordCount > 0 && findRecordedEvent(data, position)) {
+        return rewriteRecord(position, data);  // 記録済み（続報、REST APIでの再取得）
+    }
+    if (recordCount >= HISTORY_MAX_RECORDS) {
+        if (!capacityLogged) {
+            consoleLog("[History] 容量上限のため追記を停止");
+            capacityLogged = true;
+        }
+        return false;
+    }
+    if (recordCount - position > HISTORY_INSERT_MAX_SHIFT) {
+        stats.dropped++;
+        consoleLog("[History] 古すぎるため記録せず: " + data.hypocenterName + " (最新から" +
+                   String(recordCount - position) + "件前)");
+        return false;
+    }
+
+    EventRecord record;
+    memset(&record, 0, sizeof(record));  // パディングを0にしてファイル内容を決定的にする
+    packEventRecord(data, record);
+
+    // 書きかけのレコードが残っていても上書きできるよう、追記モードではなく位置を指定して書き込む
+    closeReadFile();
+    File file = SD.open(HISTORY_FILE_PATH, "r+");
+    if (!file) {
+        consoleLog("[History] 履歴ファイルを開けません");
+        return false;
+    }
+
+    if (position < recordCount) {
+        // 最新より古い地震: 後ろのレコードをずらして挿入し、ずれた区間のインデックスを更新
+        clearPageCache();
+        bool ok = shiftRecords(file, position) && file.seek(recordOffset(position)) &&
+                  file.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+        if (ok) {
+            updateTimeIndexFrom(file, position);
+        }
+        file.close();
+        if (!ok) {
+            consoleLog("[History] 挿入失敗");
+            return false;
+        }
+        consoleLog("[History] 発生時刻の順に挿入: " + data.hypocenterName + " (最新から" +
+                   String(recordCount - position) + "件前)");
+        recordCount++;
+        stats.appends++;
+        stats.inserts++;
+        return true;
+    }
+
+    bool ok = file.seek(recordOffset(recordCount)) &&
+              file.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+    file.close();
+    if (!ok) {
+        consoleLog("[History] 書き込み失敗");
+        return false;
+    }
+
+    if (recordCount % HISTORY_INDEX_STRIDE == 0) {
+        File indexFile = SD.open(HISTORY_INDEX_PATH, FILE_APPEND);
+        if (indexFile) {
+            indexFile.write((const uint8_t *)&record.originTime, sizeof(record.originTime));
+            indexFile.close();
+        }
+        timeIndex[indexCount++] = record.originTime;
+    }
+
+    // 末尾ページのキャッシュは件数が変わるため破棄
+    int32_t page = (int32_t)(recordCount / HISTORY_PAGE_RECORDS);
+    for (int i = 0; i < HISTORY_CACHE_PAGES; i++) {
+        if (cachePages[i].page == page) {
+            cachePages[i].page = -1;
+        }
+    }
+
+    recordCount++;
+    newestTime = record.originTime;
+    stats.appends++;
+    return true;
+}
+
+uint32_t getHistoryCount() {
+    return historyReady ? recordCount : 0;
+}
+
+bool readHistory(uint32_t index, EarthquakeData &data) {
+    const EventRecord *record = getRecord(index);
+    if (record == nullptr) {
+        return false;
+    }
+    unpackEventRecord(*record, data);
+    return true;
+}
+
+int32_t findHistoryBefore(time_t originTime) {
+    if (!historyReady || recordCount == 0 || indexCount == 0 || originTime <= 0) {
+        return -1;
+    }
+    uint32_t target = (uint32_t)originTime;
+
+    // 疎インデックスで、先頭が指定時刻より前の最後の区間を探す
+    uint32_t lo = 0;
+    uint32_t hi = indexCount;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (timeIndex[mid] < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0) {
+        return -1;
+    }
+
+    // 区間内で、指定時刻より前の最後のレコードを探す（区間の先頭は条件を満たす）
+    uint32_t first = (lo - 1) * HISTORY_INDEX_STRIDE;
+    uint32_t last = first + HISTORY_INDEX_STRIDE - 1;
+    if (last >= recordCount) {
+        last = recordCount - 1;
+    }
+    while (first < last) {
+        uint32_t mid = first + (last - first + 1) / 2;
+        uint32_t t;
+        if (!readRecordTime(mid, t)) {
+            break;
+        }
+        if (t < target) {
+            first = mid;
+        } else {
+            last = mid - 1;
+        }
+    }
+    return (int32_t)first;
+}
+
+void logHistoryStats() {
+    if (stats.reads == 0 && stats.appends == 0 && stats.dropped == 0 && stats.revisions == 0) {
+        return;
+    }
+    String message = "[History] 読み出し" + String(stats.reads) + "件 (ページ読み込み" + String(stats.pageMisses) + "回";
+    if (stats.pageMisses > 0) {
+        message += ", 平均" + String(stats.missMicrosTotal / stats.pageMisses) + "us, 最大" +
+                   String(stats.missMicrosMax) + "us";
+    }
+    message += "), 追記" + String(stats.appends) + "件";
+    if (stats.inserts > 0 || stats.dropped > 0) {
+        message += " (うち挿入" + String(stats.inserts) + "件, 記録せず" + String(stats.dropped) + "件)";
+    }
+    if (stats.revisions > 0) {
+        message += ", 続報で書き換え" + String(stats.revisions) + "件";
+    }
+    message += ", 総数" + String(recordCount) + "件";
+    consoleLog(message);
+    stats = HistoryStats();
+}
@@ -0,0 +1,87 @@
+/**
+ * @file history.h
+ * @brief SDカード上の追記専用地震履歴ストア
+ * @details 受信した地震情報を固定長レコード（EventRecord）としてSDカードに追記し、
+ *          再起動後もリスト末尾から過去の履歴をスクロール表示できるようにする。
+ *          レコードは発生時刻の昇順に並び、一定間隔ごとの発生時刻を疎インデックスとして保持する。
+ *          読み出しは数件単位のページをLRUキャッシュし、件数に依存しないコストで行う
+ */
+
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+#include "earthquake.h"
+
+// 履歴ファイル
+#define HISTORY_FILE_PATH "/history.bin"     // レコード本体（ヘッダー + 固定長レコード×件数）
+#define HISTORY_INDEX_PATH "/history.idx"    // 疎インデックス（HISTORY_INDEX_STRIDE件ごとの発生時刻）
+
+// インデックス・キャッシュ設定
+#define HISTORY_INDEX_STRIDE 256             // 疎インデックスの間隔（レコード数）
+#define HISTORY_INDEX_CAPACITY 1024          // 疎インデックスの最大エントリ数（最大約26万件）
+#define HISTORY_PAGE_RECORDS 16              // キャッシュ1ページのレコード数
+#define HISTORY_CACHE_PAGES 6                // LRUキャッシュのページ数（約8KB）
+#define HISTORY_INSERT_MAX_SHIFT 128         // 最新より古い地震の挿入で後ろへずらす最大レコード数（約10KB）
+
+/**
+ * @brief 履歴読み出しの統計
+ */
+struct HistoryStats {
+    uint32_t reads;            // レコード読み出し回数
+    uint32_t pageMisses;       // うちSDカードからページを読み込んだ回数
+    uint32_t missMicrosTotal;  // ページ読み込みの累積時間（マイクロ秒）
+    uint32_t missMicrosMax;    // ページ読み込みの最大時間（マイクロ秒）
+    uint32_t appends;          // 追記件数（途中への挿入を含む）
+    uint32_t inserts;          // うち最新より古い地震の途中への挿入件数
+    uint32_t revisions;        // 続報で書き換えたレコード数
+    uint32_t dropped;          // 挿入位置が古すぎて記録しなかった件数
+};
+
+/**
+ * @brief 履歴ファイルを開き、疎インデックスを読み込み（loadAppConfig()の後に1回呼び出し）
+ * @return 履歴が利用可能な場合true（SDカードなし、ファイル作成失敗時はfalse）
+ * @details 形式の異なるファイルは作り直す。インデックスが件数と一致しない場合は再構築する
+ */
+bool initHistory();
+
+/**
+ * @brief 地震情報を履歴に記録
+ * @param data 地震情報
+ * @return 記録した、または記録済みのレコードを書き換えた場合true
+ * @details 記録済みの同じ地震（isSameEvent()、続報やREST APIでの再取得）は新たに記録せず、
+ *          内容が変わっていればそのレコードを同じ位置で書き換える（リストから外れた後も最新の報を表示する）。
+ *          記録済みの最新より古い地震（起動時の統合でWebSocketの受信が先に記録された場合など）は、
+ *          後ろのレコードをずらして発生時刻の順に挿入する。ずらす件数がHISTORY_INSERT_MAX_SHIFTを超える
+ *          古い地震は記録せず、件数を統計に数えてログ出力する
+ */
+bool appendHistory(const EarthquakeData &data);
+
+/**
+ * @brief 履歴の件数を取得
+ * @return 件数（履歴が利用できない場合は0）
+ */
+uint32_t getHistoryCount();
+
+/**
+ * @brief 履歴のレコードを読み出し
+ * @param index インデックス（0が最古）
+ * @param data 出力先
+ * @return 読み出せた場合true
+ */
+bool readHistory(uint32_t index, EarthquakeData &data);
+
+/**
+ * @brief 指定時刻より前に発生した最新のレコードを検索
+ * @param originTime 発生時刻（UTC、Unix時刻・秒）
+ * @return インデックス（該当なしは-1）
+ * @details 疎インデックスで区間を絞り、区間内を二分探索する
+ */
+int32_t findHistoryBefore(time_t originTime);
+
+/**
+ * @brief 読み出し統計をログ出力してリセット
+ */
+void logHistoryStats();
+
+#endif // HISTORY_H
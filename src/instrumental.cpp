@@ -0,0 +1,208 @@
+/**
+ * @file instrumental.cpp
+ * @brief 計測震度の算出の実装
+ * @details 1秒ごとにリングバッファの直近1窓をコピーし、intensityfilter.cppで計測震度を求めて揺れの記録に反映する
+ */
+
+#include "instrumental.h"
+#include "intensityfilter.h"
+#include "timesync.h"
+#include <M5Unified.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+static const float GAL_PER_MG = 0.980665f;
+
+static IntensityWindow scratch;  // 1窓分の作業領域（約3KB）
+
+/**
+ * @brief 揺れの記録（計測震度INSTRUMENTAL_RECORD_MIN以上が続いた期間）
+ */
+struct ShakeRecord {
+    time_t startTime;      // 開始時刻（UTC、時計未設定時は0）
+    time_t lastTime;       // 最後に下限以上だった時刻（UTC、時計未設定時は0）
+    uint32_t lastMillis;   // 最後に下限以上だった時刻（millis）
+    float maxInstrumental; // 期間中の計測震度の最大値
+};
+static ShakeRecord records[INSTRUMENTAL_RECORDS];
+static int recordCount = 0;
+static int recordHead = -1;  // 最新の記録の位置（-1は記録なし）
+static portMUX_TYPE recordMux = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief 計算統計
+ */
+struct InstrumentalStats {
+    uint32_t windows = 0;        // 計算した窓数
+    uint32_t cyclesTotal = 0;    // 累積サイクル数
+    uint32_t cyclesMax = 0;      // 最大サイクル数
+    float latest = -1.0f;        // 最新の計測震度
+    float maxValue = -1.0f;      // 期間中の最大値
+};
+static InstrumentalStats stats;
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+static bool instrumentalRunning = false;
+
+/**
+ * @brief 計算結果を揺れの記録に反映
+ * @param instrumental 計測震度
+ */
+static void updateRecords(float instrumental) {
+    if (instrumental < INSTRUMENTAL_RECORD_MIN) {
+        return;
+    }
+    time_t now = isClockValid() ? time(nullptr) : 0;
+    uint32_t nowMillis = millis();
+
+    portENTER_CRITICAL(&recordMux);
+    ShakeRecord *current = (recordHead >= 0) ? &records[recordHead] : nullptr;
+    if (current != nullptr && nowMillis - current->lastMillis < (uint32_t)INSTRUMENTAL_RECORD_GAP_S * 1000) {
+        if (instrumental > current->maxInstrumental) {
+            current->maxInstrumental = instrumental;
+        }
+        current->lastMillis = nowMillis;
+        current->lastTime = now;
+        if (current->startTime == 0) {
+            current->startTime = now;
+        }
+    } else {
+        recordHead = (recordHead + 1) % INSTRUMENTAL_RECORDS;
+        if (recordCount < INSTRUMENTAL_RECORDS) {
+            recordCount++;
+        }
+        ShakeRecord &record = records[recordHead];
+        record.startTime = now;
+        record.lastTime = now;
+        record.lastMillis = nowMillis;
+        record.maxInstrumental = instrumental;
+    }
+    portEXIT_CRITICAL(&recordMux);
+}
+
+/**
+ * @brief 基準波形で自己診断（1Hz、振幅100galの正弦波をX成分に入力）
+ * @details フィルタ後の振幅は約99.6gal、0.3秒ルールで約99.2galとなり、I = 4.933…の期待値は4.9
+ */
+static void runSelfTest() {
+    const float amplitudeMilliG = 100.0f / GAL_PER_MG;
+    for (int i = 0; i < INSTRUMENTAL_WINDOW_SAMPLES; i++) {
+        float t = (float)i / SEISMIC_SAMPLE_RATE_HZ;
+        scratch.samples[i].x = (int16_t)lroundf(amplitudeMilliG * sinf(2.0f * (float)M_PI * t));
+        scratch.samples[i].y = 0;
+        scratch.samples[i].z = 1000;  // 重力（平均除去で消える）
+    }
+    uint32_t startCycles = ESP.getCycleCount();
+    float value = roundInstrumental(computeInstrumentalRaw(scratch));
+    uint32_t cycles = ESP.getCycleCount() - startCycles;
+    consoleLog("[Intensity] 自己診断: 1Hz 100gal正弦波 → 計測震度" + String(value, 1) + " (期待値 4.9), " +
+               String(cycles) + "サイクル (" + String(cycles / ESP.getCpuFreqMHz()) + "us)");
+}
+
+/**
+ * @brief 計測震度の計算タスク（コア0で実行）
+ * @param param 未使用
+ */
+static void instrumentalTask(void *param) {
+    runSelfTest();
+
+    TickType_t lastWake = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(INSTRUMENTAL_INTERVAL_MS));
+        if (copyRecentSamples(scratch.samples, INSTRUMENTAL_WINDOW_SAMPLES) == 0) {
+            continue;  // 窓長分のサンプルが溜まるまで待つ
+        }
+
+        uint32_t startCycles = ESP.getCycleCount();
+        float value = roundInstrumental(computeInstrumentalRaw(scratch));
+        uint32_t cycles = ESP.getCycleCount() - startCycles;  // サンプリングタスクの割り込み分を含む
+
+        updateRecords(value);
+
+        portENTER_CRITICAL(&statsMux);
+        stats.windows++;
+        stats.cyclesTotal += cycles;
+        if (cycles > stats.cyclesMax) {
+            stats.cyclesMax = cycles;
+        }
+        stats.latest = value;
+        if (value > stats.maxValue) {
+            stats.maxValue = value;
+        }
+        portEXIT_CRITICAL(&statsMux);
+    }
+}
+
+bool initInstrumentalIntensity() {
+#if SEISMIC_ENABLED
+    if (!M5.Imu.isEnabled()) {
+        return false;
+    }
+    initIntensityFilter();
+    if (xTaskCreatePinnedToCore(instrumentalTask, "instrumental", INSTRUMENTAL_TASK_STACK_SIZE, nullptr,
+                                INSTRUMENTAL_TASK_PRIORITY, nullptr, SEISMIC_TASK_CORE) != pdPASS) {
+        consoleLog("[Intensity] 計算タスクの作成失敗");
+        return false;
+    }
+    instrumentalRunning = true;
+    consoleLog("[Intensity] 計測震度の計算開始: 窓" + String(INSTRUMENTAL_WINDOW_SAMPLES) + "サンプル, " +
+               String(INSTRUMENTAL_INTERVAL_MS) + "ms間隔");
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool findLocalInstrumental(time_t originTime, float &instrumental) {
+    if (originTime <= 0) {
+        return false;
+    }
+    bool found = false;
+    portENTER_CRITICAL(&recordMux);
+    for (int i = 0; i < recordCount; i++) {
+        const ShakeRecord &record = records[i];
+        if (record.startTime == 0) {
+            continue;
+        }
+        // 揺れの期間が [発生時刻, 発生時刻 + INSTRUMENTAL_MATCH_WINDOW_S] と重なるか
+        if (record.lastTime >= originTime && record.startTime <= originTime + INSTRUMENTAL_MATCH_WINDOW_S) {
+            if (!found || record.maxInstrumental > instrumental) {
+                instrumental = record.maxInstrumental;
+            }
+            found = true;
+        }
+    }
+    portEXIT_CRITICAL(&recordMux);
+    return found;
+}
+
+bool getInstrumentalSince(uint32_t sinceMillis, float &instrumental) {
+    bool found = false;
+    portENTER_CRITICAL(&recordMux);
+    if (recordHead >= 0 && (int32_t)(records[recordHead].lastMillis - sinceMillis) >= 0) {
+        instrumental = records[recordHead].maxInstrumental;
+        found = true;
+    }
+    portEXIT_CRITICAL(&recordMux);
+    return found;
+}
+
+void logInstrumentalStats() {
+    if (!instrumentalRunning) {
+        return;
+    }
+    portENTER_CRITICAL(&statsMux);
+    InstrumentalStats snapshot = stats;
+    stats.windows = 0;
+    stats.cyclesTotal = 0;
+    stats.cyclesMax = 0;
+    stats.maxValue = -1.0f;
+    portEXIT_CRITICAL(&statsMux);
+
+    if (snapshot.windows == 0) {
+        return;
+    }
+    consoleLog("[Intensity] 計測震度: 最新" + String(snapshot.latest, 1) + ", 最大" + String(snapshot.maxValue, 1) +
+               " (" + String(snapshot.windows) + "窓, 平均" + String(snapshot.cyclesTotal / snapshot.windows) +
+               "サイクル, 最大" + String(snapshot.cyclesMax) + "サイクル)");
+}
@@ -0,0 +1,56 @@
+/**
+ * @file instrumental.h
+ * @brief 内蔵IMUの加速度による計測震度の算出
+ * @details 気象庁の計測震度の算出方法に準じ、直近の加速度（SEISMIC_RING_SAMPLES件、約5秒）を
+ *          周波数領域でフィルタ処理し、3成分のベクトル和が0.3秒以上継続する値から計測震度を求める。
+ *          1秒ごとに低優先度タスク（コア0）で計算し、0.5以上の揺れを「揺れの記録」としてまとめる。
+ *          窓長が短いため長周期成分の寄与は実際の計測震度より小さくなる（目安値）
+ */
+
+#ifndef INSTRUMENTAL_H
+#define INSTRUMENTAL_H
+
+#include <Arduino.h>
+#include "seismic.h"
+
+// 計算設定
+#define INSTRUMENTAL_WINDOW_SAMPLES SEISMIC_RING_SAMPLES  // 窓長（サンプル数、2のべき乗）
+#define INSTRUMENTAL_INTERVAL_MS 1000      // 計算間隔（ミリ秒）
+#define INSTRUMENTAL_TASK_STACK_SIZE 4096  // 計算タスクのスタックサイズ
+#define INSTRUMENTAL_TASK_PRIORITY 1       // 計算タスクの優先度（サンプリングタスクより低い）
+
+// 揺れの記録
+#define INSTRUMENTAL_RECORDS 16            // 保持する揺れの記録数
+#define INSTRUMENTAL_RECORD_MIN 0.5f       // 記録する計測震度の下限（震度1相当）
+#define INSTRUMENTAL_RECORD_GAP_S 30       // この秒数以上途切れたら別の揺れとして記録
+#define INSTRUMENTAL_MATCH_WINDOW_S 180    // 地震の発生時刻から揺れの到達までとみなす最大秒数
+
+/**
+ * @brief 計測震度の計算を開始（initSeismic()の後に1回呼び出し）
+ * @return 計算タスクを開始した場合true（揺れ検知が無効の場合はfalse）
+ * @details 開始時に基準波形（1Hz、振幅100galの正弦波）で自己診断し、結果と計算時間をログ出力する
+ */
+bool initInstrumentalIntensity();
+
+/**
+ * @brief 地震の発生時刻に対応する本機の計測震度を取得
+ * @param originTime 発生時刻（UTC、Unix時刻・秒）
+ * @param instrumental 計測震度（出力先、発生時刻からINSTRUMENTAL_MATCH_WINDOW_S秒以内に記録した揺れの最大値）
+ * @return 対応する揺れの記録がある場合true
+ */
+bool findLocalInstrumental(time_t originTime, float &instrumental);
+
+/**
+ * @brief 指定時刻以降に計算した計測震度の最大値を取得（揺れ検知の震度更新用）
+ * @param sinceMillis 基準時刻（millis）
+ * @param instrumental 計測震度（出力先）
+ * @return 基準時刻以降に更新された揺れの記録がある場合true
+ */
+bool getInstrumentalSince(uint32_t sinceMillis, float &instrumental);
+
+/**
+ * @brief 計算回数と1窓あたりのサイクル数をログ出力してリセット
+ */
+void logInstrumentalStats();
+
+#endif // INSTRUMENTAL_H
@@ -0,0 +1,144 @@
+/**
+ * @file intensity.h
+ * @brief 震度（気象庁震度階級）の型と表示・通知属性のテーブル
+ * @details 震度は受信時（parseEarthquakeJson）に列挙型へ変換し、以降の描画・通知・並べ替えは
+ *          コンパイル時テーブルの参照のみで行う（文字列比較を行わない）
+ */
+
+#ifndef INTENSITY_H
+#define INTENSITY_H
+
+#include <Arduino.h>
+
+/**
+ * @brief 震度階級（値は序列、大きいほど強い）
+ */
+enum class Intensity : uint8_t {
+    Unknown = 0,  // 不明
+    Int1,         // 震度1
+    Int2,         // 震度2
+    Int3,         // 震度3
+    Int4,         // 震度4
+    Int5Lower,    // 震度5弱
+    Int5Upper,    // 震度5強
+    Int6Lower,    // 震度6弱
+    Int6Upper,    // 震度6強
+    Int7,         // 震度7
+    Count
+};
+
+/**
+ * @brief 震度ごとの属性
+ */
+struct IntensityInfo {
+    const char *label;   // 表示文字列（UTF-8）
+    uint16_t color;      // カード背景・点滅色（RGB565、暗めの色で視認性向上）
+    uint8_t beepCount;   // 通知時のビープ回数
+    uint8_t maxScale;    // P2P地震情報のmaxScale値（0は対応なし）
+    uint8_t minInstrumental10;  // 計測震度の下限×10（0は対応なし）
+};
+
+// 震度別カラー（RGB565形式）
+#define COLOR_INTENSITY_1_2 0x0320      // 震度1-2: 暗い緑
+#define COLOR_INTENSITY_3_4 0x8420      // 震度3-4: 暗い黄
+#define COLOR_INTENSITY_5L_6L 0xC320    // 震度5弱-6弱: 暗い橙
+#define COLOR_INTENSITY_6H_7 0xB000     // 震度6強-7: 暗い赤
+#define COLOR_INTENSITY_UNKNOWN 0x4208  // 震度不明: 暗いグレー
+
+// 震度属性テーブル（Intensityの値で添字参照）
+constexpr IntensityInfo INTENSITY_TABLE[] = {
+    {"?",   COLOR_INTENSITY_UNKNOWN, 1, 0,  0},
+    {"1",   COLOR_INTENSITY_1_2,     1, 10, 5},
+    {"2",   COLOR_INTENSITY_1_2,     1, 20, 15},
+    {"3",   COLOR_INTENSITY_3_4,     2, 30, 25},
+    {"4",   COLOR_INTENSITY_3_4,     2, 40, 35},
+    {"5弱", COLOR_INTENSITY_5L_6L,   3, 45, 45},
+    {"5強", COLOR_INTENSITY_5L_6L,   3, 50, 50},
+    {"6弱", COLOR_INTENSITY_5L_6L,   3, 55, 55},
+    {"6強", COLOR_INTENSITY_6H_7,    3, 60, 60},
+    {"7",   COLOR_INTENSITY_6H_7,    3, 70, 65},
+};
+static_assert(sizeof(INTENSITY_TABLE) / sizeof(INTENSITY_TABLE[0]) == (size_t)Intensity::Count,
+              "INTENSITY_TABLE must have one entry per Intensity");
+
+/**
+ * @brief 震度の属性を取得
+ * @param intensity 震度
+ * @return 属性（範囲外はUnknownの属性）
+ */
+constexpr const IntensityInfo &intensityInfo(Intensity intensity) {
+    return INTENSITY_TABLE[(uint8_t)intensity < (uint8_t)Intensity::Count ? (uint8_t)intensity : 0];
+}
+
+/**
+ * @brief 震度の表示文字列を取得
+ * @param intensity 震度
+ * @return 表示文字列（"1"〜"7"、"5弱"など、不明は"?"）
+ */
+constexpr const char *intensityLabel(Intensity intensity) {
+    return intensityInfo(intensity).label;
+}
+
+/**
+ * @brief 震度に応じた背景色を取得
+ * @param intensity 震度
+ * @return 背景色（RGB565）
+ */
+constexpr uint16_t intensityColor(Intensity intensity) {
+    return intensityInfo(intensity).color;
+}
+
+/**
+ * @brief 震度に応じたビープ回数を取得
+ * @param intensity 震度
+ * @return ビープ回数（震度1-2: 1回、震度3-4: 2回、震度5弱以上: 3回）
+ */
+constexpr uint8_t intensityBeepCount(Intensity intensity) {
+    return intensityInfo(intensity).beepCount;
+}
+
+/**
+ * @brief 震度の序列を取得（並べ替え・重要度計算用）
+ * @param intensity 震度
+ * @return 序列（震度1=1 〜 震度7=9、不明は0）
+ */
+constexpr int intensityRank(Intensity intensity) {
+    return (uint8_t)intensity < (uint8_t)Intensity::Count ? (int)intensity : 0;
+}
+
+/**
+ * @brief P2P地震情報のmaxScale値を震度に変換
+ * @param maxScale maxScale値（10=震度1, 20=震度2, ..., 45=5弱, 50=5強, 55=6弱, 60=6強, 70=7）
+ * @return 震度（対応しない値はUnknown）
+ */
+constexpr Intensity intensityFromMaxScale(int maxScale) {
+    for (uint8_t i = 1; i < (uint8_t)Intensity::Count; i++) {
+        if (INTENSITY_TABLE[i].maxScale == maxScale) {
+            return (Intensity)i;
+        }
+    }
+    return Intensity::Unknown;
+}
+
+static_assert(intensityFromMaxScale(45) == Intensity::Int5Lower, "maxScale table mismatch");
+static_assert(intensityFromMaxScale(99) == Intensity::Unknown, "maxScale table mismatch");
+
+/**
+ * @brief 計測震度を震度階級に変換
+ * @param instrumental 計測震度（小数第2位まで）
+ * @return 震度（0.5未満の震度0はUnknown）
+ */
+constexpr Intensity intensityFromInstrumental(float instrumental) {
+    for (uint8_t i = (uint8_t)Intensity::Count - 1; i >= 1; i--) {
+        if (instrumental * 10.0f >= INTENSITY_TABLE[i].minInstrumental10 - 0.001f) {
+            return (Intensity)i;
+        }
+    }
+    return Intensity::Unknown;
+}
+
+static_assert(intensityFromInstrumental(4.49f) == Intensity::Int4, "instrumental table mismatch");
+static_assert(intensityFromInstrumental(4.5f) == Intensity::Int5Lower, "instrumental table mismatch");
+static_assert(intensityFromInstrumental(0.4f) == Intensity::Unknown, "instrumental table mismatch");
+
+#endif // INTENSITY_H
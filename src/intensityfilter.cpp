@@ -0,0 +1,171 @@
+/**
+ * @file intensityfilter.cpp
+ * @brief 計測震度の算出の実装
+ * @details 1窓の処理:
+ *          1. 3成分をgalに変換し平均を除去、両端5%にコサインテーパーをかける
+ *          2. 実数2成分を1つの複素数列（X + iY）にまとめてFFT（Zは単独）、計2回の複素FFTで3成分を処理
+ *          3. 周期効果・ハイカット・ローカットの3フィルタの積（実数・偶対称）を掛けて逆FFT
+ *             （実数フィルタのため、逆変換の実部がX、虚部がYのフィルタ後の波形になる）
+ *          4. ベクトル和の2乗を求め、大きい方から0.3秒分（30サンプル）目の値aから I = 2log10(a) + 0.94
+ *          FFTは単精度の基数2（ひねり係数とビット反転表は起動時に1回だけ計算）。作業領域は全て静的に確保する
+ */
+
+#include "intensityfilter.h"
+#include <algorithm>
+#include <math.h>
+
+static const int WINDOW = INSTRUMENTAL_WINDOW_SAMPLES;
+static const int TAPER_SAMPLES = WINDOW / 20;                  // テーパー長（片側、窓の5%）
+static const int EXCEED_SAMPLES = SEISMIC_SAMPLE_RATE_HZ * 3 / 10;  // 0.3秒分のサンプル数
+static const float GAL_PER_MG = 0.980665f;
+static_assert((WINDOW & (WINDOW - 1)) == 0, "INSTRUMENTAL_WINDOW_SAMPLES must be a power of two");
+
+// FFT作業領域（複素数はre, imの交互配置）
+static float bufferXY[WINDOW * 2];       // X + iY
+static float bufferZ[WINDOW * 2];        // Z + i0
+static float twiddle[WINDOW];            // ひねり係数（cos, -sinの交互、WINDOW/2個）
+static uint16_t bitReverse[WINDOW];      // ビット反転表
+static float filterGain[WINDOW / 2 + 1]; // フィルタ特性（逆FFTの1/WINDOWを含む）
+static float taper[TAPER_SAMPLES];       // コサインテーパー
+
+void initIntensityFilter() {
+    int bits = 0;
+    while ((1 << bits) < WINDOW) {
+        bits++;
+    }
+    for (int i = 0; i < WINDOW; i++) {
+        int reversed = 0;
+        for (int b = 0; b < bits; b++) {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        bitReverse[i] = (uint16_t)reversed;
+    }
+    for (int k = 0; k < WINDOW / 2; k++) {
+        float angle = 2.0f * (float)M_PI * k / WINDOW;
+        twiddle[2 * k] = cosf(angle);
+        twiddle[2 * k + 1] = -sinf(angle);
+    }
+
+    // 周期効果フィルタ F1 = √(1/f)、ハイカット F2（X = f/10）、ローカット F3 = √(1 - exp(-(f/0.5)³))
+    filterGain[0] = 0.0f;
+    for (int k = 1; k <= WINDOW / 2; k++) {
+        float f = (float)k * SEISMIC_SAMPLE_RATE_HZ / WINDOW;
+        float x = f / 10.0f;
+        float x2 = x * x;
+        float poly = 1.0f + x2 * (0.694f + x2 * (0.241f + x2 * (0.0557f + x2 * (0.009664f + x2 * (0.00134f + x2 * 0.000155f)))));
+        float f1 = sqrtf(1.0f / f);
+        float f2 = 1.0f / sqrtf(poly);
+        float f3 = sqrtf(1.0f - expf(-(f / 0.5f) * (f / 0.5f) * (f / 0.5f)));
+        filterGain[k] = f1 * f2 * f3 / WINDOW;
+    }
+
+    for (int i = 0; i < TAPER_SAMPLES; i++) {
+        taper[i] = 0.5f * (1.0f - cosf((float)M_PI * (i + 0.5f) / TAPER_SAMPLES));
+    }
+}
+
+/**
+ * @brief 複素FFT（基数2、時間間引き、その場で変換）
+ * @param data 複素数列（re, imの交互配置、WINDOW個）
+ * @param inverse trueで逆変換（1/WINDOWのスケーリングは行わない）
+ */
+static void fft(float *data, bool inverse) {
+    for (int i = 0; i < WINDOW; i++) {
+        int j = bitReverse[i];
+        if (i < j) {
+            std::swap(data[2 * i], data[2 * j]);
+            std::swap(data[2 * i + 1], data[2 * j + 1]);
+        }
+    }
+
+    float sign = inverse ? -1.0f : 1.0f;
+    for (int size = 2; size <= WINDOW; size <<= 1) {
+        int half = size >> 1;
+        int step = WINDOW / size;
+        for (int k = 0; k < half; k++) {
+            float wr = twiddle[2 * k * step];
+            float wi = sign * twiddle[2 * k * step + 1];
+            for (int start = 0; start < WINDOW; start += size) {
+                float *a = &data[2 * (start + k)];
+                float *b = &data[2 * (start + k + half)];
+                float br = b[0] * wr - b[1] * wi;
+                float bi = b[0] * wi + b[1] * wr;
+                b[0] = a[0] - br;
+                b[1] = a[1] - bi;
+                a[0] += br;
+                a[1] += bi;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 周波数領域でフィルタ特性を掛ける（正負の周波数に同じ実数値）
+ * @param data FFT済みの複素数列
+ */
+static void applyFilter(float *data) {
+    data[0] = 0.0f;
+    data[1] = 0.0f;
+    for (int k = 1; k < WINDOW / 2; k++) {
+        float gain = filterGain[k];
+        data[2 * k] *= gain;
+        data[2 * k + 1] *= gain;
+        data[2 * (WINDOW - k)] *= gain;
+        data[2 * (WINDOW - k) + 1] *= gain;
+    }
+    data[WINDOW] *= filterGain[WINDOW / 2];
+    data[WINDOW + 1] *= filterGain[WINDOW / 2];
+}
+
+float computeInstrumentalRaw(IntensityWindow &window) {
+    // 平均を除去してgalに変換、両端にテーパー
+    int32_t sum[3] = {0, 0, 0};
+    for (int i = 0; i < WINDOW; i++) {
+        sum[0] += window.samples[i].x;
+        sum[1] += window.samples[i].y;
+        sum[2] += window.samples[i].z;
+    }
+    float mean[3] = {(float)sum[0] / WINDOW, (float)sum[1] / WINDOW, (float)sum[2] / WINDOW};
+    for (int i = 0; i < WINDOW; i++) {
+        float w = GAL_PER_MG;
+        if (i < TAPER_SAMPLES) {
+            w *= taper[i];
+        } else if (i >= WINDOW - TAPER_SAMPLES) {
+            w *= taper[WINDOW - 1 - i];
+        }
+        const SeismicSample &s = window.samples[i];
+        bufferXY[2 * i] = (s.x - mean[0]) * w;
+        bufferXY[2 * i + 1] = (s.y - mean[1]) * w;
+        bufferZ[2 * i] = (s.z - mean[2]) * w;
+        bufferZ[2 * i + 1] = 0.0f;
+    }
+
+    fft(bufferXY, false);
+    fft(bufferZ, false);
+    applyFilter(bufferXY);
+    applyFilter(bufferZ);
+    fft(bufferXY, true);
+    fft(bufferZ, true);
+
+    // ここから入力サンプル領域をベクトル和の2乗に再利用
+    for (int i = 0; i < WINDOW; i++) {
+        float x = bufferXY[2 * i];
+        float y = bufferXY[2 * i + 1];
+        float z = bufferZ[2 * i];
+        window.magnitudeSquared[i] = x * x + y * y + z * z;
+    }
+
+    // 0.3秒ルール: ベクトル和がa以上の時間の合計が0.3秒となるa（大きい方から30番目）
+    float *threshold = &window.magnitudeSquared[WINDOW - EXCEED_SAMPLES];
+    std::nth_element(window.magnitudeSquared, threshold, window.magnitudeSquared + WINDOW);
+    if (*threshold <= 0.0f) {
+        return -1.0f;
+    }
+
+    // I = 2log10(a) + 0.94 = log10(a²) + 0.94
+    return log10f(*threshold) + 0.94f;
+}
+
+float roundInstrumental(float value) {
+    return floorf(roundf(value * 100.0f) / 10.0f) / 10.0f;
+}
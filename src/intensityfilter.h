@@ -0,0 +1,42 @@
+/**
+ * @file intensityfilter.h
+ * @brief 計測震度の算出（1窓分の加速度のフィルタ処理と0.3秒ルール）
+ * @details 気象庁の計測震度の算出方法に準じ、周期効果・ハイカット・ローカットフィルタを周波数領域で適用し、
+ *          3成分のベクトル和が0.3秒以上継続する値から計測震度を求める。
+ *          タスク・時刻・IMUに依存しない計算部分のみで、ホストテストから基準波形を入力して確認できる
+ */
+
+#ifndef INTENSITY_FILTER_H
+#define INTENSITY_FILTER_H
+
+#include <Arduino.h>
+#include "instrumental.h"
+
+/**
+ * @brief 1窓分の作業領域（入力サンプルとフィルタ後のベクトル和は同時に使わないため領域を共有）
+ */
+union IntensityWindow {
+    SeismicSample samples[INSTRUMENTAL_WINDOW_SAMPLES]; // 入力（古い順、mg）
+    float magnitudeSquared[INSTRUMENTAL_WINDOW_SAMPLES]; // フィルタ後のベクトル和の2乗（gal²）
+};
+
+/**
+ * @brief FFTの係数表とフィルタ特性を計算（computeInstrumentalRaw()の前に1回呼び出し）
+ */
+void initIntensityFilter();
+
+/**
+ * @brief 窓の加速度から計測震度を計算（丸め前）
+ * @param window 入力サンプルを格納した作業領域（計算後はベクトル和の2乗で上書きされる）
+ * @return 計測震度（丸め前、揺れがない場合は負の値）
+ */
+float computeInstrumentalRaw(IntensityWindow &window);
+
+/**
+ * @brief 計測震度を気象庁と同じく小数第1位に丸める
+ * @param value 丸め前の計測震度
+ * @return 小数第3位を四捨五入し、第2位以下を切り捨てた値（4.4951 → 4.50 → 4.5）
+ */
+float roundInstrumental(float value);
+
+#endif // INTENSITY_FILTER_H
@@ -1,9 +1,20 @@
 #include <M5Unified.h>
+#include <WiFi.h>
 #include "network.h"
 #include "earthquake.h"
 #include "websocket.h"
 #include "display.h"
 #include "notification.h"
+#include "scheduler.h"
+#include "config.h"
+#include "timesync.h"
+#include "history.h"
+#include "seismic.h"
+#include "instrumental.h"
+#include "waveform.h"
+#include "arrival.h"
+#include "alertpolicy.h"
+#include "rendertarget.h"
 
 // カラー定義
 #define COLOR_BG        TFT_BLACK
@@ -62,10 +73,28 @@
 // ステータスメッセージ表示位置
 #define STATUS_MESSAGE_Y 160       // ステータスメッセージのY座標
 
+// ループ設定
+#define LOOP_IDLE_ENABLED true     // 期限がない間loop()をアイドル待機させる（falseで従来の連続ループ、比較計測用）
+#define LOOP_IDLE_MAX_MS 10        // アイドル待機の上限（タッチ・受信ポーリング間隔、ミリ秒）
+#define LOOP_STATS_INTERVAL 10000  // ループ統計のログ出力間隔（ミリ秒）
+#define CLOCK_RETRY_INTERVAL 1000  // 時刻未取得時の時刻表示再試行間隔（ミリ秒）
+
+// 起動処理設定
+#define BOOT_POLL_INTERVAL 100          // 起動処理の状態確認間隔（ミリ秒）
+#define BOOT_SLOW_POLL_INTERVAL 1000    // WiFi・時刻取得タイムアウト後の状態確認間隔（ミリ秒）
+#define REST_TASK_STACK_SIZE 12288      // REST API取得タスクのスタックサイズ（HTTPS使用のため大きめ）
+#define REST_TASK_PRIORITY 1            // REST API取得タスクの優先度（loop()と同じ）
+#define REST_TASK_CORE 0                // REST API取得タスクの実行コア（loop()はコア1）
+
+// 起動画面（プログレスバー）表示中か（スナップショット復元時は表示しない）
+static bool isStartupScreenVisible = false;
+// メイン画面への遷移済みか
+static bool isStartupCompleted = false;
+
 // WiFi接続状態
 bool isWiFiConnected = false;
-// NTP同期状態
-bool isNTPSynced = false;
+// 時刻取得状態（Symbol/HTTP Date/NTPのいずれかで時計を設定済み）
+bool isTimeSynced = false;
 
 // コンソールにログを追加
 void consoleLog(String message) {
@@ -80,10 +109,10 @@ void consoleLog(String message) {
 void drawWebSocketIndicator(bool connected) {
     uint16_t color = connected ? COLOR_GOOD : COLOR_GRID;
 
-    M5.Display.setTextSize(1);
-    M5.Display.setTextColor(color);
-    M5.Display.setTextDatum(TL_DATUM);
-    M5.Display.drawString("WS", WS_INDICATOR_X, WS_INDICATOR_Y, 1);
+    Screen.setTextSize(1);
+    Screen.setTextColor(color);
+    Screen.setTextDatum(TL_DATUM);
+    Screen.drawString("WS", WS_INDICATOR_X, WS_INDICATOR_Y, 1);
 }
 
 /**
@@ -98,17 +127,17 @@ void drawWiFiIcon(bool connected) {
 
     // 携帯電波マーク（3本の縦線、高さが異なる）
     // 左の線（低）
-    M5.Display.fillRect(baseX, baseY - 4, 2, 4, color);
+    Screen.fillRect(baseX, baseY - 4, 2, 4, color);
 
     // 中央の線（中）
-    M5.Display.fillRect(baseX + 4, baseY - 8, 2, 8, color);
+    Screen.fillRect(baseX + 4, baseY - 8, 2, 8, color);
 
     // 右の線（高）
-    M5.Display.fillRect(baseX + 8, baseY - 12, 2, 12, color);
+    Screen.fillRect(baseX + 8, baseY - 12, 2, 12, color);
 
     // 接続失敗時は斜め線を追加
     if (!connected) {
-        M5.Display.drawLine(WIFI_ICON_X + 5, WIFI_ICON_Y + 4,
+        Screen.drawLine(WIFI_ICON_X + 5, WIFI_ICON_Y + 4,
                         WIFI_ICON_X + 18, WIFI_ICON_Y + 15, COLOR_GRID);
     }
 }
@@ -119,29 +148,29 @@ void drawWiFiIcon(bool connected) {
  */
 void drawMainHeader() {
     // ヘッダー背景
-    M5.Display.fillRect(0, 0, SCREEN_WIDTH, HEADER_HEIGHT, COLOR_HEADER);
-    M5.Display.setTextSize(1);
-    M5.Display.setTextDatum(TL_DATUM);
+    Screen.fillRect(0, 0, SCREEN_WIDTH, HEADER_HEIGHT, COLOR_HEADER);
+    Screen.setTextSize(1);
+    Screen.setTextDatum(TL_DATUM);
 
 #if SHOW_HEADER_TITLE
     // タイトル表示（左寄せ）
-    M5.Display.setTextColor(COLOR_TEXT);
-    M5.Display.drawString("Earthquake Monitor", HEADER_TITLE_X, HEADER_TITLE_Y, 2);
+    Screen.setTextColor(COLOR_TEXT);
+    Screen.drawString("Earthquake Monitor", HEADER_TITLE_X, HEADER_TITLE_Y, 2);
 #endif
 
     // 時刻表示（中央寄せ）
-    M5.Display.setTextDatum(TC_DATUM);
-    if (isNTPSynced) {
+    Screen.setTextDatum(TC_DATUM);
+    if (isTimeSynced) {
         struct tm timeinfo;
         if (getLocalTime(&timeinfo)) {
             char timeStr[20];
             strftime(timeStr, sizeof(timeStr), "%Y/%m/%d %H:%M", &timeinfo);
-            M5.Display.drawString(timeStr, TIME_DISPLAY_X, TIME_DISPLAY_Y, 2);
+            Screen.drawString(timeStr, TIME_DISPLAY_X, TIME_DISPLAY_Y, 2);
         } else {
-            M5.Display.drawString("No Time Data", TIME_DISPLAY_X, TIME_DISPLAY_Y, 2);
+            Screen.drawString("No Time Data", TIME_DISPLAY_X, TIME_DISPLAY_Y, 2);
         }
     } else {
-        M5.Display.drawString("No Time Data", TIME_DISPLAY_X, TIME_DISPLAY_Y, 2);
+        Screen.drawString("No Time Data", TIME_DISPLAY_X, TIME_DISPLAY_Y, 2);
     }
 
     // WiFiアイコン
@@ -149,14 +178,16 @@ void drawMainHeader() {
 }
 
 /**
- * @brief メイン画面ヘッダーのWiFiアイコンと時刻表示を更新
- * @details WiFi接続状態が変化した場合のみアイコンを再描画し、
- *          時刻が変更された場合のみ時刻表示を再描画する（差分更新によるフリッカー防止）。
- *          時刻表示のクリア領域は、M5GFX textWidth()を使用して文字列の実際の幅を動的に計算し、
- *          前の時刻表示が完全に消去されるように最適化されている。
- *          また、タイトルやWiFiアイコンと重ならないよう境界チェックを実施する。
+ * @brief メイン画面ヘッダーのWiFiアイコンとWebSocketインジケーターを更新
+ * @details WiFi接続状態・WebSocket接続状態が変化した場合のみ再描画する（差分更新によるフリッカー防止）。
+ *          フラグ比較のみのため毎ループ呼び出してよい。時刻表示はupdateHeaderClock()で更新する
  */
 void updateMainHeader() {
+    // 起動画面の表示中はヘッダーを描画しない
+    if (!isStartupCompleted) {
+        return;
+    }
+
     static bool lastWiFiState = false;
     static bool lastWsState = false;
 
@@ -172,15 +203,33 @@ void updateMainHeader() {
         drawWebSocketIndicator(currentWsState);
         lastWsState = currentWsState;
     }
+}
 
+/**
+ * @brief メイン画面ヘッダーの時刻表示を更新
+ * @return 次の分境界までのミリ秒（時刻未取得時はCLOCK_RETRY_INTERVAL）
+ * @details 時刻が変更された場合のみ時刻表示を再描画する（差分更新によるフリッカー防止）。
+ *          時刻表示のクリア領域は、M5GFX textWidth()を使用して文字列の実際の幅を動的に計算し、
+ *          前の時刻表示が完全に消去されるように最適化されている。
+ *          また、タイトルやWiFiアイコンと重ならないよう境界チェックを実施する。
+ */
+static unsigned long updateHeaderClock() {
     // 時刻表示の差分更新
     static char lastTimeStr[20] = "";
     char currentTimeStr[20];
+    unsigned long nextUpdateMs = CLOCK_RETRY_INTERVAL;
+
+    // 到達カウントダウン・集約通知のバナーの表示中は描画しない（終了時にヘッダー全体を再描画）
+    if (isArrivalCountdownActive() || isNotificationBannerShown()) {
+        return CLOCK_RETRY_INTERVAL;
+    }
 
-    if (isNTPSynced) {
+    if (isTimeSynced) {
         struct tm timeinfo;
         if (getLocalTime(&timeinfo)) {
             strftime(currentTimeStr, sizeof(currentTimeStr), "%Y/%m/%d %H:%M", &timeinfo);
+            // 次の分境界の直後に再度呼び出す
+            nextUpdateMs = (60 - timeinfo.tm_sec) * 1000UL + 20;
         } else {
             strcpy(currentTimeStr, "No Time Data");
         }
@@ -190,9 +239,9 @@ void updateMainHeader() {
 
     if (strcmp(currentTimeStr, lastTimeStr) != 0) {
         // 文字列の実際の幅を取得
-        M5.Display.setTextSize(1);
-        M5.Display.setTextDatum(TC_DATUM);
-        int16_t textWidth = M5.Display.textWidth(currentTimeStr, &fonts::Font2);
+        Screen.setTextSize(1);
+        Screen.setTextDatum(TC_DATUM);
+        int16_t textWidth = Screen.textWidth(currentTimeStr, &fonts::Font2);
 
         // textWidth()の妥当性チェック（エラーハンドリング）
         if (textWidth <= 0 || textWidth > TIME_DISPLAY_MAX_WIDTH) {
@@ -228,14 +277,14 @@ void updateMainHeader() {
         }
 
         // 時刻表示領域のクリア（動的に計算された正確な範囲）
-        M5.Display.fillRect(clearX, TIME_DISPLAY_Y,
+        Screen.fillRect(clearX, TIME_DISPLAY_Y,
                            clearWidth, TIME_DISPLAY_HEIGHT, COLOR_HEADER);
 
         // 新しい時刻を描画
-        M5.Display.setTextSize(1);
-        M5.Display.setTextDatum(TC_DATUM);
-        M5.Display.setTextColor(COLOR_TEXT);
-        M5.Display.drawString(currentTimeStr, TIME_DISPLAY_X, TIME_DISPLAY_Y, 2);
+        Screen.setTextSize(1);
+        Screen.setTextDatum(TC_DATUM);
+        Screen.setTextColor(COLOR_TEXT);
+        Screen.drawString(currentTimeStr, TIME_DISPLAY_X, TIME_DISPLAY_Y, 2);
 
         // WebSocketインジケーターを再描画（時刻更新で消えるのを防ぐ）
         drawWebSocketIndicator(getWebSocketConnected());
@@ -245,6 +294,54 @@ void updateMainHeader() {
 
         strcpy(lastTimeStr, currentTimeStr);
     }
+
+    return nextUpdateMs;
+}
+
+/**
+ * @brief 時刻表示タイマーのコールバック
+ * @param arg 未使用
+ * @details 分境界ごとに時刻表示を更新し、次の分境界でタイマーを再設定する
+ */
+static int clockTimerId = SCHEDULER_INVALID_TIMER;
+static void onClockTimer(void *arg) {
+    schedulerStart(clockTimerId, updateHeaderClock());
+}
+
+// ループ統計（LOOP_STATS_INTERVALごとにリセット）
+static uint32_t loopIterations = 0;     // ループ回数
+static uint32_t loopBusyMicros = 0;     // 処理時間の合計（アイドル待機を除く）
+static unsigned long loopStatsStart = 0; // 統計期間の開始時刻（micros）
+
+/**
+ * @brief ループ統計をログ出力（LOOP_STATS_INTERVAL周期のタイマー）
+ * @param arg 未使用
+ * @details 1秒あたりのループ回数とCPUアイドル率（アイドル待機時間の割合）を出力
+ */
+static void logLoopStats(void *arg) {
+    unsigned long now = micros();
+    unsigned long elapsed = now - loopStatsStart;
+    if (elapsed == 0) {
+        return;
+    }
+
+    float iterationsPerSecond = loopIterations * 1000000.0f / elapsed;
+    float idlePercent = 100.0f - (loopBusyMicros * 100.0f / elapsed);
+    if (idlePercent < 0) {
+        idlePercent = 0;
+    }
+    consoleLog("[Loop] iterations/s=" + String(iterationsPerSecond, 1) +
+               ", CPU idle=" + String(idlePercent, 1) + "%");
+    logRenderStats();
+    logHistoryStats();
+    logSeismicStats();
+    logInstrumentalStats();
+    logWaveformStats();
+    logArrivalStats();
+
+    loopIterations = 0;
+    loopBusyMicros = 0;
+    loopStatsStart = now;
 }
 
 /**
@@ -264,7 +361,7 @@ void drawProgressBar(int x, int y, int width, int height, int progress) {
     int fillWidth = (width - 4) * progress / 100;
 
     // 進捗バーを描画（枠線から2px内側）
-    M5.Display.fillRect(x + 2, y + 2, fillWidth, height - 4, COLOR_GOOD);
+    Screen.fillRect(x + 2, y + 2, fillWidth, height - 4, COLOR_GOOD);
 }
 
 /**
@@ -272,26 +369,28 @@ void drawProgressBar(int x, int y, int width, int height, int progress) {
  * @details タイトル、バージョン情報、プログレスバー枠を描画
  */
 void showStartupScreen() {
+    isStartupScreenVisible = true;
+
     // 画面全体をクリア
-    M5.Display.fillScreen(COLOR_BG);
+    Screen.fillScreen(COLOR_BG);
 
     // 文字色設定
-    M5.Display.setTextColor(COLOR_TEXT);
+    Screen.setTextColor(COLOR_TEXT);
 
     // テキスト配置設定（中央寄せ）
-    M5.Display.setTextDatum(TC_DATUM);
+    Screen.setTextDatum(TC_DATUM);
 
     // タイトル表示
-    M5.Display.drawString("Earthquake Monitor", SCREEN_WIDTH / 2, 10, 4);
+    Screen.drawString("Earthquake Monitor", SCREEN_WIDTH / 2, 10, 4);
 
     // バージョン表示
-    M5.Display.drawString(VERSION_TEXT, SCREEN_WIDTH / 2, 50, 2);
+    Screen.drawString(VERSION_TEXT, SCREEN_WIDTH / 2, 50, 2);
 
     // プログレスバーの枠線を描画
-    M5.Display.drawRect(PROGRESS_BAR_X, PROGRESS_BAR_Y, PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT, COLOR_GRID);
+    Screen.drawRect(PROGRESS_BAR_X, PROGRESS_BAR_Y, PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT, COLOR_GRID);
 
     // 初期ステータスメッセージ表示
-    M5.Display.drawString("Initializing...", SCREEN_WIDTH / 2, STATUS_MESSAGE_Y, 2);
+    Screen.drawString("Initializing...", SCREEN_WIDTH / 2, STATUS_MESSAGE_Y, 2);
 }
 
 /**
@@ -301,21 +400,27 @@ void showStartupScreen() {
  * @param isSuccess 状態表示（1: 成功/緑色、0: 失敗/オレンジ色、-1: 進行中/白色、デフォルト: -1）
  */
 void updateStartupProgress(const String &message, int progress, int isSuccess = -1) {
+    // スナップショット復元時はリストを表示したままログのみ出力
+    if (!isStartupScreenVisible) {
+        consoleLog(message);
+        return;
+    }
+
     // 前回のステータスメッセージエリアをクリア（フリッカー防止）
-    M5.Display.fillRect(0, STATUS_MESSAGE_Y - 10, SCREEN_WIDTH, 30, COLOR_BG);
+    Screen.fillRect(0, STATUS_MESSAGE_Y - 10, SCREEN_WIDTH, 30, COLOR_BG);
 
     // isSuccessに応じて文字色を設定
     if (isSuccess == 1) {
-        M5.Display.setTextColor(COLOR_GOOD);  // 成功: 緑色
+        Screen.setTextColor(COLOR_GOOD);  // 成功: 緑色
     } else if (isSuccess == 0) {
-        M5.Display.setTextColor(COLOR_POOR);  // 失敗: オレンジ色
+        Screen.setTextColor(COLOR_POOR);  // 失敗: オレンジ色
     } else {
-        M5.Display.setTextColor(COLOR_TEXT);  // 進行中: 白色
+        Screen.setTextColor(COLOR_TEXT);  // 進行中: 白色
     }
 
     // ステータスメッセージを表示
-    M5.Display.setTextDatum(TC_DATUM);
-    M5.Display.drawString(message, SCREEN_WIDTH / 2, STATUS_MESSAGE_Y, 2);
+    Screen.setTextDatum(TC_DATUM);
+    Screen.drawString(message, SCREEN_WIDTH / 2, STATUS_MESSAGE_Y, 2);
 
     // プログレスバーを更新
     drawProgressBar(PROGRESS_BAR_X, PROGRESS_BAR_Y, PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT, progress);
@@ -326,28 +431,154 @@ void updateStartupProgress(const String &message, int progress, int isSuccess =
 
 /**
  * @brief 起動処理完了を表示し、メイン画面に遷移
+ * @details WiFi接続完了（またはタイムアウト）時に呼び出す。時刻同期とREST APIの取得は待たない
  */
 void completeStartup() {
-    // プログレスバーを100%に更新
-    drawProgressBar(PROGRESS_BAR_X, PROGRESS_BAR_Y, PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT, 100);
+    if (isStartupCompleted) {
+        return;
+    }
+    isStartupCompleted = true;
+
+    if (isStartupScreenVisible) {
+        // プログレスバーを100%に更新
+        drawProgressBar(PROGRESS_BAR_X, PROGRESS_BAR_Y, PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT, 100);
 
-    // 「準備完了」メッセージを表示
-    M5.Display.fillRect(0, STATUS_MESSAGE_Y - 10, SCREEN_WIDTH, 30, COLOR_BG);
-    M5.Display.setTextColor(COLOR_GOOD);
-    M5.Display.setTextDatum(TC_DATUM);
-    M5.Display.drawString("Ready", SCREEN_WIDTH / 2, STATUS_MESSAGE_Y, 4);
+        // 画面をクリア（メイン画面への遷移準備）
+        Screen.fillScreen(COLOR_BG);
+        isStartupScreenVisible = false;
+    }
 
     // シリアルログに出力
     consoleLog("Startup complete.");
 
-    // 1秒待機
-    delay(1000);
+    // メイン画面ヘッダーを描画（WiFi・時刻の状態を反映）
+    drawMainHeader();
+    drawWebSocketIndicator(getWebSocketConnected());
+
+    // 地震情報表示初期化（復元済み・受信済みのリストを描画）
+    initDisplay();
 
-    // 画面をクリア（メイン画面への遷移準備）
-    M5.Display.fillScreen(COLOR_BG);
+    // 時刻表示とループ統計のタイマーを開始
+    clockTimerId = schedulerCreateTimer("clock", onClockTimer);
+    schedulerStart(clockTimerId, 0);
+    int statsTimerId = schedulerCreateTimer("loop-stats", logLoopStats);
+    schedulerStart(statsTimerId, LOOP_STATS_INTERVAL, LOOP_STATS_INTERVAL);
+    loopStatsStart = micros();
+}
 
-    // メイン画面ヘッダーを描画
-    drawMainHeader();
+// ========================================
+// 起動処理（WiFi接続、時刻取得、REST API取得を並行実行）
+// ========================================
+
+static int bootTimerId = SCHEDULER_INVALID_TIMER;  // 起動処理の状態確認タイマー
+static unsigned long bootWiFiStartTime = 0;        // WiFi接続開始時刻（millis）
+static unsigned long bootClockStartTime = 0;       // 時刻取得開始時刻（millis）
+static bool bootLinkHandled = false;               // WiFi接続後の処理を開始済みか
+static bool bootWiFiTimedOut = false;              // WiFi接続タイムアウト済みか
+static bool bootClockTimedOut = false;             // 時刻取得タイムアウト済みか
+static bool bootRestStarted = false;               // REST API取得タスクを開始済みか
+static bool bootRestMerged = false;                // REST API取得結果をリストに反映済みか
+static volatile bool bootRestDone = false;         // REST API取得タスクの完了フラグ（タスクから設定）
+static SymbolConfig bootSymbolConfig;              // 起動時に読み込んだSymbol設定（REST API取得タスクと共有）
+static const char *bootTimezone = DEFAULT_TIMEZONE_POSIX;  // 起動時に読み込んだタイムゾーン（POSIX TZ規則）
+
+/**
+ * @brief REST API取得タスク（コア0で実行）
+ * @param param 未使用
+ * @details HTTPS通信の間もloop()（WebSocket受信、タッチ、描画）を止めないよう別タスクで実行する。
+ *          結果はearthquakeDataBufferに格納し、反映はloop()側の起動処理タイマーで行う
+ */
+static void restFetchTask(void *param) {
+    fetchEarthquakeData(bootSymbolConfig, PAGE_SIZE);
+    bootRestDone = true;
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @brief WiFi接続完了時の処理（NTP同期とREST API取得をバックグラウンドで開始）
+ * @details 時計はNTPを待たず、最初に届いたREST応答のDateヘッダーまたはSymbolのタイムスタンプで設定される
+ */
+static void onBootLinkUp() {
+    bootLinkHandled = true;
+    consoleLog("WiFi connected. IP: " + WiFi.localIP().toString());
+    consoleLog("[Boot] WiFi接続: " + String(millis()) + "ms");
+    updateStartupProgress("WiFi Connected", 50, 1);
+
+    // NTP時刻同期をバックグラウンドで開始（時計設定後はスルーで補正）
+    beginNTPSync();
+    bootClockStartTime = millis();
+
+    // REST API取得タスクを開始
+    if (xTaskCreatePinnedToCore(restFetchTask, "rest-fetch", REST_TASK_STACK_SIZE, nullptr,
+                                REST_TASK_PRIORITY, nullptr, REST_TASK_CORE) == pdPASS) {
+        bootRestStarted = true;
+    } else {
+        consoleLog("[Boot] REST API取得タスクの作成失敗");
+        bootRestMerged = true;  // 取得なしで続行（WebSocketで受信した地震は表示される）
+    }
+
+    // WebSocketはWiFi監視から通知され即座に接続する（時刻取得・RESTは待たない）
+    completeStartup();
+    schedulerStart(bootTimerId, BOOT_POLL_INTERVAL, BOOT_POLL_INTERVAL);
+}
+
+/**
+ * @brief WiFiリンク状態変化のコールバック（WiFi監視から呼び出し）
+ * @param connected IP取得済みならtrue、切断ならfalse
+ * @details 初回接続時のみ起動処理を進める。isWiFiConnectedの更新とWebSocket層への通知はWiFi監視が行う
+ */
+static void onWiFiLinkChanged(bool connected) {
+    if (connected && !bootLinkHandled) {
+        onBootLinkUp();
+    }
+}
+
+/**
+ * @brief 起動処理タイマーのコールバック（WiFi接続、時刻取得、REST API取得の進行を確認）
+ * @param arg 未使用
+ * @details すべて完了したらタイマーを停止する。WiFi接続タイムアウト後も接続を待ち続け、
+ *          接続した時点（onWiFiLinkChanged()）で残りの処理を開始する
+ */
+static void onBootTimer(void *arg) {
+    unsigned long now = millis();
+
+    // WiFi接続待ち（接続はonWiFiLinkChanged()で通知される）
+    if (!bootLinkHandled) {
+        if (!bootWiFiTimedOut && now - bootWiFiStartTime >= WIFI_CONNECT_TIMEOUT) {
+            bootWiFiTimedOut = true;
+            consoleLog("WiFi connection failed. Operating without network.");
+            updateStartupProgress("WiFi Connection Failed", 100, 0);
+            completeStartup();
+            schedulerStart(bootTimerId, BOOT_SLOW_POLL_INTERVAL, BOOT_SLOW_POLL_INTERVAL);
+        }
+        return;
+    }
+
+    // 時刻取得待ち（Dateヘッダー・Symbolタイムスタンプ・NTPのいずれか、タイムアウト後も確認を続ける）
+    if (!isTimeSynced) {
+        if (isClockValid()) {
+            isTimeSynced = true;
+            consoleLog("[Boot] 時刻取得（" + String(clockSourceName(getClockSource())) + "）: " + String(now) + "ms");
+            schedulerStart(clockTimerId, 0);  // 時刻表示を即座に更新
+            renderList();  // 相対時刻表示に切り替え
+        } else if (!bootClockTimedOut && now - bootClockStartTime > NTP_SYNC_TIMEOUT) {
+            bootClockTimedOut = true;
+            consoleLog("Time sync timeout (continuing in background).");
+            schedulerStart(bootTimerId, BOOT_SLOW_POLL_INTERVAL, BOOT_SLOW_POLL_INTERVAL);
+        }
+    }
+
+    // REST API取得結果の反映
+    if (bootRestStarted && bootRestDone && !bootRestMerged) {
+        bootRestMerged = true;
+        mergeFetchedEarthquakes(earthquakeDataBuffer, earthquakeDataBufferCount);
+        consoleLog("[Boot] 最新データ表示: " + String(now) + "ms");
+    }
+
+    if (isTimeSynced && bootRestMerged) {
+        schedulerStop(bootTimerId);
+        consoleLog("[Boot] 起動処理完了: " + String(now) + "ms");
+    }
 }
 
 void setup() {
@@ -355,85 +586,111 @@ void setup() {
     cfg.serial_baudrate = 115200;
     cfg.clear_display = true;
     cfg.output_power = true;
-    cfg.internal_imu = false;
-    cfg.internal_rtc = false;
+    cfg.internal_imu = SEISMIC_ENABLED;  // 揺れ検知（seismic.cpp）で使用
+    cfg.internal_rtc = true;   // RTC搭載ボードでは起動直後から時刻を表示
     cfg.internal_spk = true;  // 通知機能のためスピーカーを有効化
     cfg.internal_mic = false;
     M5.begin(cfg);
+    Screen.begin();
 
     // 通知機能初期化
     initNotification();
 
-    // 起動画面を表示
-    showStartupScreen();
+    // RTCから時計を設定（RTC搭載ボードではネットワーク接続前から時刻・相対時刻を表示）
+    initClock();
+    isTimeSynced = isClockValid();
+
+    // 内蔵IMUの揺れ検知を開始（RTCの読み取り後、以降のRTCアクセスはバスを排他）
+    bool seismicStarted = initSeismic();
+    if (seismicStarted) {
+        initInstrumentalIntensity();
+    }
+
+    // 前回のリストを復元できた場合は、WiFi接続を待たずにメイン画面を表示
+    if (restoreDisplaySnapshot() > 0) {
+        completeStartup();
+        consoleLog("[Boot] 初回表示（スナップショット）: " + String(millis()) + "ms");
+    } else {
+        // 起動画面を表示
+        showStartupScreen();
+    }
 
     Serial.println();
     Serial.println("========================================");
     Serial.println("M5Stack Jishin Monitor");
     Serial.println("========================================");
 
-    // WiFi設定取得とWiFi接続
-    String ssid, password;
-    getWiFiCredentials(ssid, password);
-
-    // Symbol設定を事前に宣言（後続の処理で使用）
-    SymbolConfig symbolConfig;
-
-    // WiFi接続中表示
-    updateStartupProgress("Connecting to WiFi...", 25);
-    isWiFiConnected = connectToWiFi(ssid, password);
-
-    // WiFi接続結果表示
-    if (isWiFiConnected) {
-        updateStartupProgress("WiFi Connected", 50, 1);
+    // SD設定ファイル読み込み（変更がなければNVSキャッシュを使用、SDカードなしでもキャッシュで起動）
+    loadAppConfig();
 
-        // タイムゾーン設定取得
-        int32_t timezoneOffset = getTimezoneConfig();
+    // 設置場所（P波・S波の到達予測、推定震度による通知の段階付け用）
+    initArrival();
+    initAlertPolicy();
 
-        // Symbol設定取得
-        symbolConfig = getSymbolConfig();
+    // SDカードの地震履歴を開き、リスト末尾に接続
+    initHistory();
+    attachDisplayHistory();
 
-        // NTP時刻同期中表示
-        updateStartupProgress("Syncing Time...", 75);
-        isNTPSynced = syncNTP(timezoneOffset);
-
-        // NTP同期結果表示
-        if (isNTPSynced) {
-            updateStartupProgress("Time Synced", 100, 1);
-        } else {
-            updateStartupProgress("Time Sync Failed", 100, 0);
-        }
-    } else {
-        updateStartupProgress("WiFi Connection Failed", 100, 0);
+    // 揺れの波形記録（SDカードと揺れ検知の両方が必要）
+    if (seismicStarted) {
+        initWaveform();
     }
 
-    // 起動完了処理
-    completeStartup();
+    // WiFi設定取得とWiFi接続開始（接続処理はWiFiタスクで進行）
+    String ssid, password;
+    getWiFiCredentials(ssid, password);
+    updateStartupProgress("Connecting to WiFi...", 25);
+    beginWiFiConnection(ssid, password, onWiFiLinkChanged);
+    bootWiFiStartTime = millis();
 
-    // 地震情報を取得（WiFi接続時のみ）
-    if (isWiFiConnected) {
-        fetchEarthquakeData(symbolConfig, PAGE_SIZE);
+    // WiFi接続中に設定値を検証
+    bootTimezone = getTimezoneConfig();
+    bootSymbolConfig = getSymbolConfig();
+    initTimeSync(bootTimezone, bootSymbolConfig.network);
 
-        // WebSocket初期化（REST API取得後）
-        initWebSocket(symbolConfig);
-    }
+    // WebSocket初期化（WiFi接続後、再接続タイマーが即座に接続する）
+    initWebSocket(bootSymbolConfig);
 
-    // 地震情報表示初期化（データ取得後に実行）
-    initDisplay();
+    // 起動処理タイマーを開始（以降はloop()内で進行）
+    bootTimerId = schedulerCreateTimer("boot", onBootTimer);
+    schedulerStart(bootTimerId, BOOT_POLL_INTERVAL, BOOT_POLL_INTERVAL);
+    consoleLog("[Boot] setup()完了: " + String(millis()) + "ms");
 }
 
 void loop() {
+    unsigned long loopStart = micros();
+
     M5.update();
 
-    // メイン画面ヘッダーのWiFi状態を更新
+    // メイン画面ヘッダーのWiFi/WebSocket状態を更新（差分描画）
     updateMainHeader();
 
     // 地震情報表示更新（タッチ処理を含む）
     updateDisplay();
 
-    // WebSocketループ処理
+    // WebSocketループ処理（受信ポーリング）
     webSocketLoop();
 
-    // 通知処理更新（ノンブロッキング音声再生、視覚通知、キュー処理）
+    // 通知処理更新（点滅中のタッチ中断検出）
     updateNotification();
+
+    // 揺れ検知のトリガー確認（通知はloop()側で投入）
+    updateSeismic();
+
+    // 期限到来した周期処理を実行（時刻表示、Ping、再接続、メモリ監視、ビープ音など）
+    schedulerRun();
+
+    loopIterations++;
+    loopBusyMicros += micros() - loopStart;
+
+    // 次の期限まで待機（スクロール中は待機しない、点滅はタイマー駆動のため待機可能）
+    // delay()はFreeRTOSのアイドルタスクに制御を渡すため、待機中はCPUが解放される
+#if LOOP_IDLE_ENABLED
+    if (!isDisplayAnimating()) {
+        unsigned long idleMs = schedulerTimeUntilNext(LOOP_IDLE_MAX_MS);
+        if (idleMs > 0) {
+            delay(idleMs);
+        }
+    }
+#endif
 }
@@ -1,260 +1,94 @@
 /**
  * @file network.cpp
- * @brief WiFi接続およびNTP時刻同期の実装
+ * @brief WiFi接続および設定取得の実装
  */
 
 #include "network.h"
+#include "config.h"
+#include "timezone.h"
+#include "scheduler.h"
+#include "websocket.h"
 #include <WiFi.h>
-#include <SD.h>
-#include <time.h>
+#include <Preferences.h>
+#include <esp_wifi.h>
 
-// タイムゾーンマッピング構造体
-struct TimezoneMapping {
-    const char* name;        // タイムゾーン名（最大30文字）
-    int32_t offsetSeconds;   // UTC offset（秒単位）
-};
-
-// タイムゾーン名をPROGMEMに配置
-const char tz_tokyo[] PROGMEM = "Asia/Tokyo";
-const char tz_new_york[] PROGMEM = "America/New_York";
-const char tz_shanghai[] PROGMEM = "Asia/Shanghai";
-const char tz_singapore[] PROGMEM = "Asia/Singapore";
-const char tz_hong_kong[] PROGMEM = "Asia/Hong_Kong";
-const char tz_seoul[] PROGMEM = "Asia/Seoul";
-const char tz_bangkok[] PROGMEM = "Asia/Bangkok";
-const char tz_dubai[] PROGMEM = "Asia/Dubai";
-const char tz_kolkata[] PROGMEM = "Asia/Kolkata";
-const char tz_chicago[] PROGMEM = "America/Chicago";
-const char tz_denver[] PROGMEM = "America/Denver";
-const char tz_los_angeles[] PROGMEM = "America/Los_Angeles";
-const char tz_sao_paulo[] PROGMEM = "America/Sao_Paulo";
-const char tz_london[] PROGMEM = "Europe/London";
-const char tz_paris[] PROGMEM = "Europe/Paris";
-const char tz_berlin[] PROGMEM = "Europe/Berlin";
-const char tz_moscow[] PROGMEM = "Europe/Moscow";
-const char tz_auckland[] PROGMEM = "Pacific/Auckland";
-const char tz_sydney[] PROGMEM = "Australia/Sydney";
-const char tz_utc[] PROGMEM = "UTC";
-const char tz_gmt[] PROGMEM = "GMT";
-
-// タイムゾーンマッピングテーブル
-static const TimezoneMapping timezoneTable[] PROGMEM = {
-    {tz_tokyo, 9 * 3600},           // UTC+9
-    {tz_new_york, -5 * 3600},       // UTC-5
-    {tz_shanghai, 8 * 3600},        // UTC+8
-    {tz_singapore, 8 * 3600},       // UTC+8
-    {tz_hong_kong, 8 * 3600},       // UTC+8
-    {tz_seoul, 9 * 3600},           // UTC+9
-    {tz_bangkok, 7 * 3600},         // UTC+7
-    {tz_dubai, 4 * 3600},           // UTC+4
-    {tz_kolkata, 19800},            // UTC+5.5 (5.5 * 3600)
-    {tz_chicago, -6 * 3600},        // UTC-6
-    {tz_denver, -7 * 3600},         // UTC-7
-    {tz_los_angeles, -8 * 3600},    // UTC-8
-    {tz_sao_paulo, -3 * 3600},      // UTC-3
-    {tz_london, 0},                 // UTC+0
-    {tz_paris, 1 * 3600},           // UTC+1
-    {tz_berlin, 1 * 3600},          // UTC+1
-    {tz_moscow, 3 * 3600},          // UTC+3
-    {tz_auckland, 12 * 3600},       // UTC+12
-    {tz_sydney, 10 * 3600},         // UTC+10
-    {tz_utc, 0},                    // UTC+0
-    {tz_gmt, 0}                     // UTC+0
-};
-
-const int timezoneTableSize = sizeof(timezoneTable) / sizeof(TimezoneMapping);
-
-bool loadWiFiConfigFromSD(String &ssid, String &password) {
-    consoleLog("Mounting SD card...");
-
-    // SDカードマウント（M5Stack Core用のピン設定）
-    // TFCARD_CS_PIN = 4 (M5Stack.hで定義)
-    // クロック速度を下げて安定性向上（40MHz → 4MHz）
-    if (!SD.begin(TFCARD_CS_PIN, SPI, 4000000)) {
-        consoleLog("SD card mount failed.");
-        return false;
-    }
-    consoleLog("SD card mounted successfully");
-
-    // ファイル存在確認
-    if (!SD.exists(CONFIG_FILE_PATH)) {
-        consoleLog("wifi.ini not found.");
-        return false;
-    }
+// WiFi接続状態（main.cppで定義）
+extern bool isWiFiConnected;
 
-    // ファイルオープン
-    File configFile = SD.open(CONFIG_FILE_PATH, FILE_READ);
-    if (!configFile) {
-        consoleLog("Failed to open wifi.ini.");
-        return false;
-    }
-
-    // ファイルサイズチェック
-    if (configFile.size() > CONFIG_FILE_MAX_SIZE) {
-        consoleLog("wifi.ini file too large.");
-        configFile.close();
-        return false;
-    }
-
-    // SSID読み込み（1行目）
-    if (!configFile.available()) {
-        consoleLog("wifi.ini format error: no SSID line.");
-        configFile.close();
-        return false;
-    }
-    ssid = configFile.readStringUntil('\n');
-    ssid.trim();  // CRLF対応
-
-    // パスワード読み込み（2行目）
-    if (!configFile.available()) {
-        consoleLog("wifi.ini format error: no password line.");
-        configFile.close();
-        return false;
-    }
-    password = configFile.readStringUntil('\n');
-    password.trim();  // CRLF対応
-
-    configFile.close();
-
-    // 空文字列チェック
-    if (ssid.length() == 0 || password.length() == 0) {
-        consoleLog("Invalid wifi.ini: SSID or password is empty.");
-        return false;
-    }
-
-    // SSID文字数チェック
-    if (ssid.length() > SSID_MAX_LENGTH) {
-        consoleLog("Warning: SSID too long. Truncating to 32 chars.");
-        ssid = ssid.substring(0, SSID_MAX_LENGTH);
-    }
-
-    // パスワード文字数チェック
-    if (password.length() > PASSWORD_MAX_LENGTH) {
-        consoleLog("Warning: Password too long. Truncating to 63 chars.");
-        password = password.substring(0, PASSWORD_MAX_LENGTH);
-    }
-
-    consoleLog("WiFi SSID loaded from SD: " + ssid);
-
-    return true;
-}
+// 自発的な切断（設定変更・再接続開始）時の切断理由（WIFI_REASON_ASSOC_LEAVE）
+#define WIFI_REASON_LOCAL_LEAVE 8
 
 /**
- * @brief タイムゾーン名からUTC offsetを検索
- * @param timezoneName タイムゾーン名（例: "Asia/Tokyo", "asia/tokyo"）
- * @return offset値（秒単位）、見つからない場合はDEFAULT_TIMEZONE_OFFSET
+ * @brief 前回接続したアクセスポイントの情報（NVSに保存、高速再接続用）
  */
-static int32_t findTimezoneOffset(const String &timezoneName) {
-    // マッピングテーブルを線形探索
-    for (int i = 0; i < timezoneTableSize; i++) {
-        // PROGMEMから読み込み
-        const char* tableName = (const char*)pgm_read_ptr(&timezoneTable[i].name);
-        int32_t tableOffset = pgm_read_dword(&timezoneTable[i].offsetSeconds);
-
-        // 大文字小文字を区別せずに比較
-        String tableNameStr = String(tableName);
-        if (timezoneName.equalsIgnoreCase(tableNameStr)) {
-            return tableOffset;
-        }
-    }
-
-    // 見つからない場合はデフォルト値
-    return DEFAULT_TIMEZONE_OFFSET;
-}
+struct WiFiLinkCache {
+    uint32_t magic;      // WIFI_LINK_CACHE_MAGIC
+    uint32_t ssidHash;   // SSIDのハッシュ（SSID変更時は無効）
+    uint8_t bssid[6];    // アクセスポイントのBSSID
+    uint8_t channel;     // チャンネル
+    uint8_t reserved;
+};
+static const uint32_t WIFI_LINK_CACHE_MAGIC = 0x4B4E4C57;  // "WLNK"
 
 /**
- * @brief SDカードからタイムゾーン設定を読み込み
- * @param timezoneOffset タイムゾーンoffset（秒単位、出力パラメータ）
- * @return 成功時true、失敗時false
+ * @brief WiFi監視の状態
  */
-bool loadTimezoneFromSD(int32_t &timezoneOffset) {
-    // デフォルト値設定
-    timezoneOffset = DEFAULT_TIMEZONE_OFFSET;
-
-    // config.iniファイル存在確認（SD.begin()は既にwifi.iniで呼び出し済みを想定）
-    if (!SD.exists(CONFIG_TIMEZONE_FILE_PATH)) {
-        consoleLog("config.ini not found. Using default timezone: Asia/Tokyo (UTC+9)");
-        return false;
-    }
-
-    // ファイルオープン
-    File configFile = SD.open(CONFIG_TIMEZONE_FILE_PATH, FILE_READ);
-    if (!configFile) {
-        consoleLog("Failed to open config.ini.");
-        return false;
-    }
-
-    // ファイルサイズチェック
-    if (configFile.size() > CONFIG_FILE_MAX_SIZE) {
-        consoleLog("config.ini file too large.");
-        configFile.close();
-        return false;
-    }
-
-    // ファイル解析（行ごと）
-    bool found = false;
-    while (configFile.available()) {
-        String line = configFile.readStringUntil('\n');
-        line.trim();  // CRLF対応、前後空白削除
-
-        // コメント行と空行をスキップ
-        if (line.length() == 0 || line.startsWith("#")) {
-            continue;
-        }
-
-        // timezone=行を検索
-        if (line.startsWith("timezone=")) {
-            String timezoneName = line.substring(9);  // "timezone="の後
-            timezoneName.trim();  // 前後空白削除
-
-            if (timezoneName.length() > 0) {
-                // タイムゾーン名がマッピングテーブルに存在するか確認
-                bool foundInTable = false;
-                for (int i = 0; i < timezoneTableSize; i++) {
-                    const char* tableName = (const char*)pgm_read_ptr(&timezoneTable[i].name);
-                    if (timezoneName.equalsIgnoreCase(String(tableName))) {
-                        foundInTable = true;
-                        break;
-                    }
-                }
-
-                if (foundInTable) {
-                    // タイムゾーン名からoffset検索
-                    int32_t offset = findTimezoneOffset(timezoneName);
-                    timezoneOffset = offset;
-                    consoleLog("Timezone loaded from config.ini: " + timezoneName + " (UTC" + String(offset / 3600.0, 1) + ")");
-                    found = true;
-                    break;
-                } else {
-                    consoleLog("Unknown timezone: " + timezoneName + ". Using default: Asia/Tokyo (UTC+9)");
-                }
-            }
-        }
-    }
+enum class WiFiLinkState : uint8_t {
+    Connecting,  // 接続試行中
+    Connected,   // IP取得済み
+    WaitRetry    // 接続失敗後の再試行待ち
+};
 
-    configFile.close();
-
-    if (!found) {
-        consoleLog("No valid timezone found in config.ini. Using default: Asia/Tokyo (UTC+9)");
-        return false;
-    }
-
-    return true;
-}
+// 接続情報
+static String wifiSsid;
+static String wifiPassword;
+static WiFiLinkCallback linkCallback = nullptr;
+static WiFiLinkCache linkCache;
+static bool linkCacheValid = false;
+
+// WiFiイベント（WiFiイベントタスクから設定、監視タイマーで処理）
+static volatile bool gotIpEvent = false;
+static volatile bool disconnectEvent = false;
+static volatile uint8_t disconnectReason = 0;
+
+// 監視状態
+static int wifiTimerId = SCHEDULER_INVALID_TIMER;
+static WiFiLinkState linkState = WiFiLinkState::Connecting;
+static bool attemptFast = false;                 // 現在の試行がBSSID/チャンネル指定か
+static bool everConnected = false;               // 1回以上接続したか（初回接続と再接続の区別）
+static unsigned long attemptStartTime = 0;       // 現在の試行の開始時刻（millis）
+static unsigned long linkDownTime = 0;           // 切断時刻（millis、再接続時間の計測用）
+static unsigned long retryInterval = WIFI_RETRY_INTERVAL;
+static unsigned long retryAt = 0;
+
+// 再接続時間の統計（高速経路/フルスキャン）
+static uint32_t fastReconnects = 0;
+static uint32_t fastReconnectMsTotal = 0;
+static uint32_t fullReconnects = 0;
+static uint32_t fullReconnectMsTotal = 0;
 
 /**
- * @brief タイムゾーン設定を取得（SD優先、フォールバックはデフォルト値）
- * @return タイムゾーンoffset（秒単位）
+ * @brief タイムゾーン設定を取得（config.ini優先、フォールバックはデフォルト値）
+ * @return POSIX TZ規則（夏時間規則を含む、静的文字列）
  */
-int32_t getTimezoneConfig() {
-    int32_t timezoneOffset = DEFAULT_TIMEZONE_OFFSET;
+const char *getTimezoneConfig() {
+    const AppConfig &appConfig = getAppConfig();
+
+    if (appConfig.timezone[0] == '\0') {
+        consoleLog("No valid timezone found in config.ini. Using default: " DEFAULT_TIMEZONE_NAME " (" DEFAULT_TIMEZONE_POSIX ")");
+        return DEFAULT_TIMEZONE_POSIX;
+    }
 
-    if (!loadTimezoneFromSD(timezoneOffset)) {
-        // SD読み込み失敗時はデフォルト値を使用（既にログ出力済み）
-        timezoneOffset = DEFAULT_TIMEZONE_OFFSET;
+    // 完全ハッシュ表で検索（大文字小文字を区別しない）
+    const TimezoneInfo *info = findTimezone(appConfig.timezone);
+    if (info != nullptr) {
+        consoleLog("Timezone loaded from config.ini: " + String(info->name) + " (UTC" +
+                   String(info->standardOffset / 3600.0, 1) + ", TZ=" + String(info->posixTz) + ")");
+        return info->posixTz;
     }
 
-    return timezoneOffset;
+    consoleLog("Unknown timezone: " + String(appConfig.timezone) + ". Using default: " DEFAULT_TIMEZONE_NAME " (" DEFAULT_TIMEZONE_POSIX ")");
+    return DEFAULT_TIMEZONE_POSIX;
 }
 
 /**
@@ -345,148 +179,327 @@ static void checkNetworkAddressConsistency(const String &network, const String &
 }
 
 void getWiFiCredentials(String &ssid, String &password) {
-    if (!loadWiFiConfigFromSD(ssid, password)) {
-        // SD読み込み失敗時はソースコード定数を使用
+    const AppConfig &appConfig = getAppConfig();
+    if (!appConfig.hasWiFi) {
+        // wifi.ini読み込み失敗時はソースコード定数を使用
         ssid = WIFI_SSID;
         password = WIFI_PASSWORD;
         consoleLog("Using hardcoded WiFi settings.");
+        return;
     }
+
+    ssid = appConfig.ssid;
+    password = appConfig.password;
+    consoleLog("WiFi SSID loaded from config: " + ssid);
 }
 
-bool connectToWiFi(const String &ssid, const String &password) {
-    consoleLog("Connecting to WiFi...");
+/**
+ * @brief SSIDのハッシュを計算（FNV-1a）
+ * @param ssid SSID
+ * @return ハッシュ値
+ */
+static uint32_t hashSsid(const String &ssid) {
+    uint32_t hash = 2166136261u;
+    for (unsigned int i = 0; i < ssid.length(); i++) {
+        hash ^= (uint8_t)ssid.charAt(i);
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-    WiFi.begin(ssid.c_str(), password.c_str());
+/**
+ * @brief NVSからBSSID/チャンネルキャッシュを読み込み
+ */
+static void loadLinkCache() {
+    linkCacheValid = false;
+    Preferences prefs;
+    if (!prefs.begin(WIFI_CACHE_NAMESPACE, true)) {
+        return;
+    }
+    if (prefs.getBytesLength(WIFI_CACHE_KEY) == sizeof(WiFiLinkCache)) {
+        prefs.getBytes(WIFI_CACHE_KEY, &linkCache, sizeof(WiFiLinkCache));
+        linkCacheValid = (linkCache.magic == WIFI_LINK_CACHE_MAGIC && linkCache.ssidHash == hashSsid(wifiSsid) &&
+                          linkCache.channel > 0);
+    }
+    prefs.end();
+}
 
-    wl_status_t result = (wl_status_t)WiFi.waitForConnectResult(WIFI_CONNECT_TIMEOUT);
+/**
+ * @brief 接続中のアクセスポイントのBSSID/チャンネルをキャッシュ（変更時のみNVSに保存）
+ */
+static void updateLinkCache() {
+    const uint8_t *bssid = WiFi.BSSID();
+    int32_t channel = WiFi.channel();
+    if (bssid == nullptr || channel <= 0) {
+        return;
+    }
+    uint32_t ssidHash = hashSsid(wifiSsid);
+    if (linkCacheValid && linkCache.ssidHash == ssidHash && linkCache.channel == channel &&
+        memcmp(linkCache.bssid, bssid, sizeof(linkCache.bssid)) == 0) {
+        return;
+    }
+
+    linkCache.magic = WIFI_LINK_CACHE_MAGIC;
+    linkCache.ssidHash = ssidHash;
+    memcpy(linkCache.bssid, bssid, sizeof(linkCache.bssid));
+    linkCache.channel = (uint8_t)channel;
+    linkCache.reserved = 0;
+    linkCacheValid = true;
+
+    Preferences prefs;
+    if (prefs.begin(WIFI_CACHE_NAMESPACE, false)) {
+        prefs.putBytes(WIFI_CACHE_KEY, &linkCache, sizeof(WiFiLinkCache));
+        prefs.end();
+    }
+    consoleLog("[WiFi] BSSID/チャンネルを記録: ch" + String(channel));
+}
 
-    if (result == WL_CONNECTED) {
-        consoleLog("WiFi connected. IP: " + WiFi.localIP().toString());
-        return true;
-    } else {
-        consoleLog("WiFi connection failed. Operating without network.");
-        return false;
+/**
+ * @brief config.iniの固定IP設定を反映（DHCPを省略）
+ */
+static void applyStaticIpConfig() {
+    const AppConfig &appConfig = getAppConfig();
+    if (appConfig.staticIp[0] == '\0') {
+        return;
     }
-}
 
-bool syncNTP(int32_t timezoneOffset) {
-    consoleLog("Syncing NTP time...");
+    IPAddress ip, gateway, subnet, dns;
+    if (!ip.fromString(appConfig.staticIp) || !gateway.fromString(appConfig.gateway) ||
+        !subnet.fromString(appConfig.subnet)) {
+        consoleLog("[WiFi] 固定IP設定が不正なためDHCPを使用（staticIp, gateway, subnetが必要）");
+        return;
+    }
+    if (!dns.fromString(appConfig.dns)) {
+        dns = gateway;
+    }
+    WiFi.config(ip, gateway, subnet, dns);
+    consoleLog("[WiFi] 固定IP: " + String(appConfig.staticIp));
+}
 
-    // NTP設定（サーバー、タイムゾーン、夏時間オフセット）
-    configTime(timezoneOffset, 0, NTP_SERVER);
+/**
+ * @brief WiFiイベントハンドラー（WiFiイベントタスクで実行）
+ * @details フラグの設定のみ行い、処理は監視タイマー（loop()側）で行う
+ */
+static void onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        gotIpEvent = true;
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        disconnectReason = info.wifi_sta_disconnected.reason;
+        disconnectEvent = true;
+    }
+}
 
-    // NTP同期完了を待つ（タイムアウト付き）
-    unsigned long startTime = millis();
-    time_t now = 0;
+/**
+ * @brief 接続試行を開始
+ * @param fast trueならキャッシュしたBSSID/チャンネルを指定（スキャン省略）
+ */
+static void startConnectAttempt(bool fast) {
+    attemptFast = fast && linkCacheValid;
+    attemptStartTime = millis();
+    linkState = WiFiLinkState::Connecting;
 
-    while (now < 100000) {  // 1970年以降の妥当な時刻かチェック
-        time(&now);
+    if (attemptFast) {
+        WiFi.begin(wifiSsid.c_str(), wifiPassword.c_str(), linkCache.channel, linkCache.bssid);
+    } else {
+        WiFi.begin(wifiSsid.c_str(), wifiPassword.c_str());
+    }
+}
 
-        if (millis() - startTime > NTP_SYNC_TIMEOUT) {
-            consoleLog("NTP sync timeout.");
-            return false;
-        }
+/**
+ * @brief 接続失敗時の処理（高速経路失敗時はフルスキャン、フルスキャン失敗時は再試行待ち）
+ * @param reason 失敗理由（ログ用）
+ */
+static void handleConnectFailure(const String &reason) {
+    if (attemptFast) {
+        consoleLog("[WiFi] 高速接続失敗（" + reason + "）、フルスキャンで再試行");
+        startConnectAttempt(false);
+        return;
+    }
+    consoleLog("[WiFi] 接続失敗（" + reason + "）、" + String(retryInterval / 1000) + "秒後に再試行");
+    linkState = WiFiLinkState::WaitRetry;
+    retryAt = millis() + retryInterval;
+    retryInterval = min(retryInterval * 2, (unsigned long)WIFI_RETRY_MAX_INTERVAL);
+}
 
-        if (now > 100000) {
-            break;
+/**
+ * @brief IP取得時の処理（状態更新、キャッシュ更新、WebSocket層への通知）
+ */
+static void handleLinkUp() {
+    unsigned long now = millis();
+    linkState = WiFiLinkState::Connected;
+    retryInterval = WIFI_RETRY_INTERVAL;
+    isWiFiConnected = true;
+    updateLinkCache();
+
+    if (everConnected) {
+        // 再接続時間を経路別に集計
+        uint32_t elapsed = now - linkDownTime;
+        if (attemptFast) {
+            fastReconnects++;
+            fastReconnectMsTotal += elapsed;
+        } else {
+            fullReconnects++;
+            fullReconnectMsTotal += elapsed;
         }
-
-        delay(100);
+        consoleLog("[WiFi] 再接続: " + String(elapsed) + "ms（" + String(attemptFast ? "高速" : "フルスキャン") +
+                   "、今回の試行 " + String(now - attemptStartTime) + "ms）");
+        consoleLog("[WiFi] 再接続平均: 高速 " +
+                   String(fastReconnects > 0 ? fastReconnectMsTotal / fastReconnects : 0) + "ms (" +
+                   String(fastReconnects) + "回), フルスキャン " +
+                   String(fullReconnects > 0 ? fullReconnectMsTotal / fullReconnects : 0) + "ms (" +
+                   String(fullReconnects) + "回)");
     }
+    everConnected = true;
 
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo)) {
-        consoleLog("Failed to get local time.");
-        return false;
+    webSocketOnWiFiConnected();
+    if (linkCallback != nullptr) {
+        linkCallback(true);
     }
+}
 
-    char timeStr[64];
-    strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", &timeinfo);
-    consoleLog("NTP synced: " + String(timeStr));
+/**
+ * @brief 切断時の処理（状態更新、WebSocket層への通知、高速再接続の開始）
+ * @param reason 切断理由コード
+ */
+static void handleLinkDown(uint8_t reason) {
+    linkDownTime = millis();
+    isWiFiConnected = false;
+    consoleLog("[WiFi] 切断（理由: " + String(reason) + "）、再接続開始");
 
-    return true;
+    webSocketOnWiFiDisconnected();
+    if (linkCallback != nullptr) {
+        linkCallback(false);
+    }
+    startConnectAttempt(true);
 }
 
 /**
- * @brief SDカードからSymbol設定を読み込み
- * @param config Symbol設定構造体（出力パラメータ）
- * @return 成功時true、失敗時false
+ * @brief WiFi監視タイマーのコールバック
+ * @param arg 未使用
  */
-bool loadSymbolConfigFromSD(SymbolConfig &config) {
-    // config.iniファイル存在確認（SD.begin()は既にwifi.iniで呼び出し済みを想定）
-    if (!SD.exists(CONFIG_TIMEZONE_FILE_PATH)) {
-        consoleLog("config.ini not found. Using hardcoded Symbol config.");
-        return false;
+static void onWiFiSupervisorTimer(void *arg) {
+    if (gotIpEvent) {
+        gotIpEvent = false;
+        disconnectEvent = false;  // IP取得前の切断イベントは処理済みとみなす
+        if (linkState != WiFiLinkState::Connected) {
+            handleLinkUp();
+        }
+        return;
     }
 
-    // ファイルオープン
-    File configFile = SD.open(CONFIG_TIMEZONE_FILE_PATH, FILE_READ);
-    if (!configFile) {
-        consoleLog("Symbol Config Error: Corrupted config file. Using hardcoded fallback.");
-        return false;
+    if (disconnectEvent) {
+        disconnectEvent = false;
+        uint8_t reason = disconnectReason;
+        if (linkState == WiFiLinkState::Connected) {
+            handleLinkDown(reason);
+        } else if (linkState == WiFiLinkState::Connecting && reason != WIFI_REASON_LOCAL_LEAVE) {
+            handleConnectFailure("理由: " + String(reason));
+        }
+        return;
     }
 
-    // ファイルサイズチェック
-    if (configFile.size() > CONFIG_FILE_MAX_SIZE) {
-        consoleLog("Symbol Config Error: Corrupted config file. Using hardcoded fallback.");
-        configFile.close();
+    unsigned long now = millis();
+    if (linkState == WiFiLinkState::Connecting && attemptFast && now - attemptStartTime >= WIFI_FAST_CONNECT_TIMEOUT) {
+        handleConnectFailure("タイムアウト");
+    } else if (linkState == WiFiLinkState::WaitRetry && (long)(now - retryAt) >= 0) {
+        startConnectAttempt(true);
+    }
+}
+
+/**
+ * @brief WiFiドライバが保存している接続設定からパスワードを取得
+ * @details 設定キャッシュ（NVS）はパスワードを保存しないため、キャッシュから起動した場合に使用する。
+ *          ドライバの設定は前回のWiFi.begin()で保存されたもので、SSIDが一致する場合のみ採用する
+ * @return 取得できた場合true
+ */
+static bool loadStoredPassword() {
+    wifi_config_t stored;
+    if (esp_wifi_get_config(WIFI_IF_STA, &stored) != ESP_OK) {
+        return false;
+    }
+    char storedSsid[sizeof(stored.sta.ssid) + 1];
+    char storedPassword[sizeof(stored.sta.password) + 1];
+    memcpy(storedSsid, stored.sta.ssid, sizeof(stored.sta.ssid));
+    storedSsid[sizeof(stored.sta.ssid)] = '\0';
+    memcpy(storedPassword, stored.sta.password, sizeof(stored.sta.password));
+    storedPassword[sizeof(stored.sta.password)] = '\0';
+    if (wifiSsid != storedSsid || storedPassword[0] == '\0') {
         return false;
     }
+    wifiPassword = storedPassword;
+    return true;
+}
 
-    // ファイル解析ループ
-    bool found = false;
-    while (configFile.available()) {
-        String line = configFile.readStringUntil('\n');
-        line.trim();  // CRLF対応、前後空白削除
+void beginWiFiConnection(const String &ssid, const String &password, WiFiLinkCallback onLinkChange) {
+    consoleLog("Connecting to WiFi...");
 
-        // コメント行と空行をスキップ
-        if (line.length() == 0 || line.startsWith("#")) {
-            continue;
+    wifiSsid = ssid;
+    wifiPassword = password;
+    linkCallback = onLinkChange;
+    loadLinkCache();
+
+    // 再接続は監視タイマーで行う（WiFiライブラリの自動再接続はフルスキャンのため無効化）
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false);
+    if (wifiPassword.length() == 0) {
+        if (loadStoredPassword()) {
+            consoleLog("[WiFi] パスワードはWiFiドライバの保存設定を使用");
+        } else {
+            consoleLog("[WiFi] 保存されたパスワードがありません（wifi.iniを確認してください）");
         }
+    }
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    applyStaticIpConfig();
 
-        // network=行を検索
-        if (line.startsWith("network=")) {
-            String value = line.substring(8);  // "network="の後
-            value.trim();
-            if (value.length() > 0) {
-                config.network = value;
-                found = true;
-            }
-        }
+    if (linkCacheValid) {
+        consoleLog("[WiFi] 前回のアクセスポイントに接続（ch" + String(linkCache.channel) + "、スキャン省略）");
+    }
+    startConnectAttempt(true);
 
-        // node=行を検索
-        if (line.startsWith("node=")) {
-            String value = line.substring(5);  // "node="の後
-            value.trim();
-            if (value.length() > 0) {
-                config.node = value;
-                found = true;
-            }
-        }
+    wifiTimerId = schedulerCreateTimer("wifi", onWiFiSupervisorTimer);
+    schedulerStart(wifiTimerId, WIFI_SUPERVISOR_INTERVAL, WIFI_SUPERVISOR_INTERVAL);
+}
 
-        // address=行を検索
-        if (line.startsWith("address=")) {
-            String value = line.substring(8);  // "address="の後
-            value.trim();
-            if (value.length() > 0) {
-                config.address = value;
-                found = true;
-            }
-        }
+/**
+ * @brief config.iniのSymbol設定を反映
+ * @param config Symbol設定構造体（入出力パラメータ、未設定の項目は既存値を維持）
+ * @return config.iniにSymbol設定が1項目以上あればtrue、なければfalse
+ */
+static bool applySymbolConfigFromFile(SymbolConfig &config) {
+    const AppConfig &appConfig = getAppConfig();
+    if (!appConfig.hasConfigFile) {
+        consoleLog("config.ini not found. Using hardcoded Symbol config.");
+        return false;
+    }
 
-        // pubKey=行を検索
-        if (line.startsWith("pubKey=")) {
-            String value = line.substring(7);  // "pubKey="の後
-            value.trim();
-            if (value.length() > 0) {
-                config.pubKey = value;
-                found = true;
-            }
+    // 空の項目は未設定（ハードコード値を維持）
+    bool found = false;
+    if (appConfig.network[0] != '\0') {
+        config.network = appConfig.network;
+        found = true;
+    }
+    if (appConfig.node[0] != '\0') {
+        config.node = appConfig.node;
+        found = true;
+    }
+    if (appConfig.address[0] != '\0') {
+        config.address = appConfig.address;
+        found = true;
+    }
+    if (appConfig.pubKey[0] != '\0') {
+        config.pubKey = appConfig.pubKey;
+        found = true;
+    }
+    config.hedgeNodeCount = 0;
+    for (int i = 0; i < appConfig.hedgeNodeCount && i < SYMBOL_MAX_HEDGE_NODES; i++) {
+        String hedgeNode = appConfig.hedgeNodes[i];
+        if (validateSymbolNodeUrl(hedgeNode)) {
+            config.hedgeNodes[config.hedgeNodeCount++] = hedgeNode;
         }
+        found = true;
     }
 
-    configFile.close();
-
     if (!found) {
         consoleLog("No valid Symbol config found in config.ini. Using hardcoded values.");
         return false;
@@ -524,14 +537,17 @@ bool loadSymbolConfigFromSD(SymbolConfig &config) {
 
     // 成功ログ出力（address/pubKeyは表示しない）
     if (found) {
-        consoleLog("Symbol config loaded from SD: network=" + config.network + ", node=" + config.node);
+        consoleLog("Symbol config loaded from config.ini: network=" + config.network + ", node=" + config.node);
+    }
+    for (int i = 0; i < config.hedgeNodeCount; i++) {
+        consoleLog("Symbol hedge node " + String(i + 1) + ": " + config.hedgeNodes[i]);
     }
 
     return true;
 }
 
 /**
- * @brief Symbol設定を取得（SD優先、フォールバックはハードコード値）
+ * @brief Symbol設定を取得（config.ini優先、フォールバックはハードコード値）
  * @return Symbol設定構造体
  */
 SymbolConfig getSymbolConfig() {
@@ -543,14 +559,15 @@ SymbolConfig getSymbolConfig() {
     config.address = SYMBOL_DEFAULT_ADDRESS;
     config.pubKey = SYMBOL_DEFAULT_PUBKEY;
 
-    // SDカードから読み込み試行
-    if (!loadSymbolConfigFromSD(config)) {
+    // config.iniの設定を反映
+    if (!applySymbolConfigFromFile(config)) {
         // SD読み込み失敗時はハードコード値を使用（既にログ出力済み）
         consoleLog("Using hardcoded Symbol config (testnet)");
         config.network = SYMBOL_DEFAULT_NETWORK;
         config.node = SYMBOL_DEFAULT_NODE;
         config.address = SYMBOL_DEFAULT_ADDRESS;
         config.pubKey = SYMBOL_DEFAULT_PUBKEY;
+        config.hedgeNodeCount = 0;
     }
 
     return config;
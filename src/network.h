@@ -1,7 +1,7 @@
 /**
  * @file network.h
- * @brief WiFi接続およびNTP時刻同期の処理
- * @details WiFi設定の読み込み、WiFi接続、NTP時刻同期を行う関数群
+ * @brief WiFi接続および設定取得の処理
+ * @details WiFi設定の読み込み、WiFi接続、タイムゾーン・Symbol設定の取得を行う関数群
  */
 
 #ifndef NETWORK_H
@@ -20,15 +20,19 @@ extern void consoleLog(String message);
 #define WIFI_PASSWORD "xxxxxxxxx"
 #define WIFI_CONNECT_TIMEOUT 10000  // WiFi接続タイムアウト（ミリ秒）
 
-// NTP設定
-#define NTP_SERVER "ntp.nict.jp"           // 日本の公式NTPサーバー（NICT）
-#define NTP_TIMEZONE_JST 9 * 3600          // 日本標準時（UTC+9）
-#define NTP_SYNC_TIMEOUT 20000             // 20秒に延長
+// WiFi監視設定
+#define WIFI_SUPERVISOR_INTERVAL 100       // WiFiイベントの処理間隔（ミリ秒）
+#define WIFI_FAST_CONNECT_TIMEOUT 4000     // キャッシュしたBSSID/チャンネルでの接続タイムアウト（ミリ秒）
+#define WIFI_RETRY_INTERVAL 2000           // 接続失敗後の再試行間隔（初回、ミリ秒）
+#define WIFI_RETRY_MAX_INTERVAL 30000      // 接続失敗後の再試行間隔（上限、ミリ秒）
+#define WIFI_CACHE_NAMESPACE "wifi"        // BSSID/チャンネルキャッシュのNVS名前空間
+#define WIFI_CACHE_KEY "link"
 
 // タイムゾーン設定
 #define CONFIG_TIMEZONE_FILE_PATH "/config.ini"
+#define CONFIG_FILE_MAX_SIZE 32768   // config.iniの最大サイズ（128バイトずつ読むためメモリ使用量は変わらない）
 #define DEFAULT_TIMEZONE_NAME "Asia/Tokyo"
-#define DEFAULT_TIMEZONE_OFFSET (9 * 3600)  // JST (UTC+9) = 32400秒
+#define DEFAULT_TIMEZONE_POSIX "JST-9"    // JST (UTC+9、夏時間なし)
 
 // Symbol設定（SDカード読み込み失敗時のフォールバック）
 #define SYMBOL_DEFAULT_NETWORK "mainnet"
@@ -40,10 +44,11 @@ extern void consoleLog(String message);
 #define SYMBOL_ADDRESS_LENGTH 39
 #define SYMBOL_PUBKEY_LENGTH 64
 #define SYMBOL_NODE_MAX_LENGTH 200
+#define SYMBOL_MAX_HEDGE_NODES 1    // 追加購読ノードの最大数（主ノードと合わせて同時接続数）
 
 // SD WiFi設定ファイル
 #define CONFIG_FILE_PATH "/wifi.ini"
-#define CONFIG_FILE_MAX_SIZE 4096
+#define WIFI_FILE_MAX_SIZE 4096            // wifi.iniの最大サイズ
 #define SSID_MAX_LENGTH 32
 #define PASSWORD_MAX_LENGTH 63
 
@@ -55,55 +60,45 @@ struct SymbolConfig {
     String node;       // ノードURL（"https://..."で始まる、最大200文字）
     String address;    // Symbolアドレス（39文字、先頭N/T）
     String pubKey;     // 公開鍵（64文字の16進数）
+    String hedgeNodes[SYMBOL_MAX_HEDGE_NODES];  // 並行購読する追加ノードURL（先着優先、重複は破棄）
+    int hedgeNodeCount = 0;                     // 有効な追加ノード数（0なら単一ノード動作）
 };
 
 // WiFi関連関数の宣言
 
 /**
- * @brief SDカードからWiFi設定を読み込み
+ * @brief WiFi認証情報を取得（wifi.ini優先、フォールバックはハードコード値）
+ * @details loadAppConfig()実行後に呼び出すこと
  * @param ssid WiFi SSID（出力パラメータ）
  * @param password WiFiパスワード（出力パラメータ）
- * @return 成功時true、失敗時false
  */
-bool loadWiFiConfigFromSD(String &ssid, String &password);
+void getWiFiCredentials(String &ssid, String &password);
 
 /**
- * @brief WiFi認証情報を取得（SD優先、フォールバックはハードコード値）
- * @param ssid WiFi SSID（出力パラメータ）
- * @param password WiFiパスワード（出力パラメータ）
+ * @brief WiFiリンク状態変化のコールバック
+ * @param connected IP取得済みならtrue、切断ならfalse
  */
-void getWiFiCredentials(String &ssid, String &password);
+typedef void (*WiFiLinkCallback)(bool connected);
 
 /**
- * @brief WiFiに接続
+ * @brief WiFi接続を開始し、リンク監視を開始（ノンブロッキング）
  * @param ssid WiFi SSID
  * @param password WiFiパスワード
- * @return 接続成功時true、失敗時false
- */
-bool connectToWiFi(const String &ssid, const String &password);
-
-/**
- * @brief NTP時刻同期を実行
- * @param timezoneOffset タイムゾーンoffset（秒単位）
- * @return 同期成功時true、失敗時false
- */
-bool syncNTP(int32_t timezoneOffset);
-
-/**
- * @brief タイムゾーン設定を取得（SD優先、フォールバックはデフォルト値）
- * @return タイムゾーンoffset（秒単位）
+ * @param onLinkChange リンク状態変化時のコールバック（loop()側で呼び出される、省略可）
+ * @details WiFiイベントでリンク状態を追跡し、isWiFiConnectedの更新とWebSocket層への通知を行う。
+ *          切断時は前回のBSSID/チャンネル（と固定IP設定）で再接続し、スキャンとDHCPを省略する。
+ *          高速再接続に失敗した場合はフルスキャンで再試行する
  */
-int32_t getTimezoneConfig();
+void beginWiFiConnection(const String &ssid, const String &password, WiFiLinkCallback onLinkChange = nullptr);
 
 /**
- * @brief SDカードからSymbol設定を読み込み
- * @param config Symbol設定構造体（出力パラメータ）
- * @return 成功時true、失敗時false
+ * @brief タイムゾーン設定を取得（config.ini優先、フォールバックはデフォルト値）
+ * @return POSIX TZ規則（夏時間規則を含む、静的文字列）
  */
-bool loadSymbolConfigFromSD(SymbolConfig &config);
+const char *getTimezoneConfig();
 
 /**
- * @brief Symbol設定を取得（SD優先、フォールバックはハードコード値）
+ * @brief Symbol設定を取得（config.ini優先、フォールバックはハードコード値）
  * @return Symbol設定構造体
  */
 SymbolConfig getSymbolConfig();
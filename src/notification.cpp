@@ -4,6 +4,12 @@
  */
 
 #include "notification.h"
+#include "scheduler.h"
+#include "waveform.h"
+#include "arrival.h"
+#include "alertpolicy.h"
+#include "rendertarget.h"
+#include "websocket.h"
 #include <M5Unified.h>
 
 // 外部依存関数（main.cppで定義）
@@ -12,12 +18,52 @@ extern void consoleLog(String message);
 // スピーカー状態
 static bool isSpeakerEnabled = false;  // M5.Speaker初期化済みフラグ
 
-// 通知キュー（連続地震対応）
-#define NOTIFICATION_QUEUE_SIZE 3
-static EarthquakeData notificationQueue[NOTIFICATION_QUEUE_SIZE];
-static int queueHead = 0;  // キューの先頭インデックス（取り出し位置）
-static int queueTail = 0;  // キューの末尾インデックス（追加位置）
-static int queueCount = 0; // キュー内の通知数（0-3）
+// 通知キュー（連続地震対応、重要度順で保持）
+#define NOTIFICATION_QUEUE_SIZE 8
+/**
+ * @brief 通知待ちの地震情報
+ */
+struct PendingNotification {
+    EarthquakeData data;        // 地震情報
+    int severity;               // 重要度（computeSeverity()、大きいほど重要）
+    AlertLevel level;           // 通知の段階（decideAlertLevel()）
+    unsigned long receivedAt;   // 受信時刻（millis）
+};
+static PendingNotification notificationQueue[NOTIFICATION_QUEUE_SIZE];
+static int queueCount = 0; // キュー内の通知数（0-NOTIFICATION_QUEUE_SIZE）
+static int queueEvicted = 0; // 次の通知までにキュー満杯で押し出された件数（集約件数に含める）
+
+// 集約設定: 通知後COALESCE_WINDOW_MS以内に届いた地震は、より重要でない限り1件の集約通知にまとめる
+static const unsigned long COALESCE_WINDOW_MS = 10000;
+static unsigned long lastAlertTime = 0;   // 直前の通知開始時刻（millis）
+static int lastAlertSeverity = -1;        // 直前の通知の重要度（-1は通知なし）
+static int coalesceTimerId = SCHEDULER_INVALID_TIMER;  // 集約期間終了タイマー
+
+// 続報の判定: 最近通知した地震（キューに入れた時点で記録、リスト表示のみの地震を含む）
+#define RECENT_EVENT_SLOTS 8
+/**
+ * @brief 最近通知した地震の記録
+ */
+struct RecentEvent {
+    time_t originTime;   // 発生時刻（UTC、0は未使用）
+    float latitude;      // 震央の緯度（度）
+    float longitude;     // 震央の経度（度）
+    int severity;        // これまでの報の重要度の最大値
+    AlertLevel level;    // これまでの報の通知の段階の最大値
+};
+static RecentEvent recentEvents[RECENT_EVENT_SLOTS];
+static int recentEventNext = 0;  // 次に上書きする記録（古い順に上書き）
+
+// 通知統計
+static uint32_t statEventsReceived = 0;  // 受信した地震情報の件数
+static uint32_t statAlertsPlayed = 0;    // 再生した通知（ビープ音+点滅、点滅のみ）の回数
+static uint32_t statFlashOnly = 0;       // 点滅のみで通知した回数（statAlertsPlayedの内数）
+static uint32_t statListOnly = 0;        // 推定震度がしきい値未満でリスト表示のみとした件数
+static uint32_t statEventsCoalesced = 0; // 集約通知にまとめられた地震情報の件数（代表以外）
+static uint32_t statEventsEvicted = 0;   // キュー満杯で押し出された件数
+static uint32_t statRevisionsMerged = 0;     // キュー内の同じ地震に統合した続報の件数
+static uint32_t statRevisionsSuppressed = 0; // 重要度が上がらないため通知しなかった続報の件数
+static uint32_t statMaxLatencyMs = 0;    // 受信から通知開始までの最大遅延（ミリ秒）
 
 // 音声通知定数
 static const int BEEP_DURATION_MS = 150;  // ビープ音の長さ（ミリ秒）
@@ -28,37 +74,66 @@ static const int BEEP_VOLUME = 96;        // ビープ音の音量（0-255）
 // 音声通知状態
 static int beepCount = 0;              // 再生すべきビープ音の回数（0=停止）
 static int beepPlayed = 0;             // 再生済みビープ音の回数
-static unsigned long lastBeepTime = 0; // 最後のビープ音再生時刻（millis）
+static int beepTimerId = SCHEDULER_INVALID_TIMER;  // 次のビープ音のタイマー
 
 // 視覚通知定数
 static const int FLASH_DURATION_MS = 1500; // 点滅継続時間（ミリ秒）
 static const int FLASH_INTERVAL_MS = 300;  // 点滅間隔（ミリ秒、ON/OFF切り替え）
+static const int FLASH_PHASES = FLASH_DURATION_MS / FLASH_INTERVAL_MS;  // 点滅のエッジ数（ON/OFF合計）
+static const uint8_t FLASH_BACKLIGHT_DIM = 16;  // バックライト方式のOFF位相の輝度（0-255）
 static const uint16_t COLOR_BG = 0x0000;    // 通常の背景色（黒）
 
 // 画面レイアウト定数（display.cppと同じ値）
 static const int HEADER_HEIGHT = 30;
 static const int SCREEN_WIDTH = 320;
 static const int VISIBLE_AREA_HEIGHT = 210;  // SCREEN_HEIGHT - HEADER_HEIGHT
+static const int BANNER_WIDTH = 235;         // WebSocketインジケーターの手前まで（arrival.cppと同じ）
+static const uint16_t COLOR_BANNER = TFT_RED;
+static const uint16_t COLOR_BANNER_TEXT = TFT_WHITE;
+
+// 集約通知のバナー（ヘッダーに「N件: 最大震度X」を表示）
+static const unsigned long BANNER_HOLD_MS = 5000;  // 表示時間（ミリ秒）
+static bool bannerShown = false;
+static char bannerText[32] = "";
+static int bannerTimerId = SCHEDULER_INVALID_TIMER;  // バナー消去タイマー
 
 // 視覚通知状態
 static bool isFlashing = false;         // 画面点滅中フラグ
-static unsigned long flashStartTime = 0; // 点滅開始時刻（millis）
-static uint16_t flashColor = 0;         // 点滅色（RGB565）
+static int flashPhase = 0;              // 現在の位相（偶数=ON、奇数=OFF）
+static uint16_t flashColor = 0;         // 点滅色（RGB565、FLASH_MODE_FILLのみ使用）
+static uint8_t flashSavedBrightness = 0; // 点滅前の輝度（FLASH_MODE_BACKLIGHTのみ使用）
+static int flashTimerId = SCHEDULER_INVALID_TIMER;  // 点滅位相切り替えタイマー
+
+// 視覚通知の計測（点滅ごとにリセット）
+static uint32_t flashSpiBytes = 0;          // 点滅処理でのSPI転送量（バイト）
+static uint32_t flashEdgeMicrosMax = 0;     // エッジ処理の最大時間（マイクロ秒）
+static uint32_t flashLoopGapMax = 0;        // 点滅中のloop()呼び出し間隔の最大値（マイクロ秒）
+static unsigned long flashLastUpdateMicros = 0; // 前回のupdateNotification()呼び出し時刻
 
 // 外部関数宣言（display.h/cppで定義、Task 5-8で実装）
-extern uint16_t getIntensityColor(const String& intensity);
 extern void renderList();
 extern void addEarthquakeToDisplay(const EarthquakeData& data);
 
 // 外部関数宣言（main.cppで定義）
 extern void drawMainHeader();
+extern void drawWebSocketIndicator(bool connected);
 
 // 前方宣言
+static void enqueueNotification(const EarthquakeData& data);
 static void processNotificationQueue();
-static int getBeepCountForIntensity(const String& intensity);
+static void onCoalesceTimer(void *arg);
+static int computeSeverity(const EarthquakeData& data);
+static bool mergeRevision(const EarthquakeData& data);
 static void playBeepSound(int count);
+static void onBeepTimer(void *arg);
 static void flashScreen(uint16_t color);
+static void onFlashTimer(void *arg);
+static void applyFlashPhase(bool on);
+static void finishFlash(const char *reason);
 static void updateFlashScreen();
+static void showBanner(int total, Intensity maxIntensity);
+static void drawBanner();
+static void onBannerTimer(void *arg);
 
 /**
  * @brief 通知機能を初期化（M5.Speaker初期化、状態変数リセット）
@@ -67,6 +142,23 @@ static void updateFlashScreen();
 void initNotification() {
     consoleLog("[Notification] 初期化開始");
 
+    // ビープ音シーケンス用タイマー登録
+    if (beepTimerId == SCHEDULER_INVALID_TIMER) {
+        beepTimerId = schedulerCreateTimer("beep", onBeepTimer);
+    }
+    // 集約期間終了タイマー登録
+    if (coalesceTimerId == SCHEDULER_INVALID_TIMER) {
+        coalesceTimerId = schedulerCreateTimer("coalesce", onCoalesceTimer);
+    }
+    // 画面点滅の位相切り替え用タイマー登録
+    if (flashTimerId == SCHEDULER_INVALID_TIMER) {
+        flashTimerId = schedulerCreateTimer("flash", onFlashTimer);
+    }
+    // 集約通知のバナー消去タイマー登録
+    if (bannerTimerId == SCHEDULER_INVALID_TIMER) {
+        bannerTimerId = schedulerCreateTimer("banner", onBannerTimer);
+    }
+
     // スピーカー初期化試行
     if (!M5.Speaker.begin()) {
         consoleLog("[Notification] スピーカー初期化失敗、音声通知は無効化されます");
@@ -79,100 +171,233 @@ void initNotification() {
     consoleLog("[Notification] スピーカー初期化成功、音量=96");
 
     // 通知キューの初期化
-    queueHead = 0;
-    queueTail = 0;
     queueCount = 0;
+    queueEvicted = 0;
 
     consoleLog("[Notification] 初期化完了");
 }
 
 /**
- * @brief 新規地震情報を通知キューに追加
+ * @brief 新規地震情報をリストに追加し、通知キューに追加
  * @param data 地震情報データ
- * @details WebSocketメッセージ受信時に呼び出す。キューに追加し、順次処理を行う
+ * @details WebSocketメッセージ受信時に呼び出す。リストへの追加は即座に行うため、
+ *          通知が集約・破棄されても地震情報自体が失われることはない。
+ *          同じ地震の続報（速報→震源→詳細）はリストのカードを置き換え、重要度が上がった場合のみ通知する
  * @note 重複検出はwebsocket.cpp層で完了済みと想定
  */
 void notifyEarthquake(const EarthquakeData& data) {
+    // 入力検証
+    if (data.maxIntensity == Intensity::Unknown) {
+        consoleLog("[Notification] 震度データが不正、通知をスキップ");
+        return;
+    }
+
+    // S波の到達前ならカウントダウンを最初に表示（数秒の猶予を描画待ちで失わないため）
+    startArrivalCountdown(data);
+
+    // リストに地震情報を追加（通知の有無に関わらず）
+    addEarthquakeToDisplay(data);
+    // 揺れが予想される地震は、揺れ検知を待たずに波形の記録を開始
+    captureNetworkWaveform(data);
+    // 同じ地震の続報は、重要度が上がった場合のみ通知する
+    if (mergeRevision(data)) {
+        return;
+    }
+    enqueueNotification(data);
+}
+
+/**
+ * @brief 続報をキュー内の通知・最近の通知の記録と照合
+ * @param data 地震情報データ
+ * @return 統合・抑制した（キューに追加しない）場合true
+ * @details キューに同じ地震があれば内容を続報で置き換え、重要度・段階は大きい方を残す。
+ *          通知済みの地震の続報は、重要度も段階も上がらなければ通知しない。
+ *          同じ地震かどうかはisSameEvent()（発生時刻と震央の距離）で判定する
+ */
+static bool mergeRevision(const EarthquakeData& data) {
+    int severity = computeSeverity(data);
+    AlertLevel level = decideAlertLevel(data);
+
+    RecentEvent* recent = nullptr;
+    EarthquakeData key;
+    for (RecentEvent& entry : recentEvents) {
+        if (entry.originTime == 0) {
+            continue;
+        }
+        key.originTime = entry.originTime;
+        key.latitude = entry.latitude;
+        key.longitude = entry.longitude;
+        if (isSameEvent(key, data)) {
+            recent = &entry;
+            break;
+        }
+    }
+
+    // キュー内の同じ地震を続報で置き換え
+    for (int i = 0; i < queueCount; i++) {
+        PendingNotification& pending = notificationQueue[i];
+        if (!isSameEvent(pending.data, data)) {
+            continue;
+        }
+        pending.data = data;
+        if (severity > pending.severity) {
+            pending.severity = severity;
+        }
+        if (level > pending.level) {
+            pending.level = level;
+        }
+        if (recent != nullptr) {
+            recent->severity = pending.severity;
+            recent->level = pending.level;
+        }
+        statEventsReceived++;
+        statRevisionsMerged++;
+        consoleLog("[Notification] 続報をキュー内の通知に統合: " + data.hypocenterName + " 震度" +
+                   intensityLabel(data.maxIntensity) + " (重要度: " + String(pending.severity) + ")");
+        return true;
+    }
+
+    if (recent != nullptr) {
+        if (severity <= recent->severity && level <= recent->level) {
+            statEventsReceived++;
+            statRevisionsSuppressed++;
+            consoleLog("[Notification] 続報、重要度が上がらないため通知なし: " + data.hypocenterName + " 震度" +
+                       intensityLabel(data.maxIntensity) + " (重要度: " + String(severity) + " <= " +
+                       String(recent->severity) + ")");
+            return true;
+        }
+        consoleLog("[Notification] 続報で重要度が上昇: " + data.hypocenterName + " 震度" + intensityLabel(data.maxIntensity) +
+                   " (重要度: " + String(recent->severity) + " → " + String(severity) + ")");
+    } else {
+        recent = &recentEvents[recentEventNext];
+        recentEventNext = (recentEventNext + 1) % RECENT_EVENT_SLOTS;
+        recent->severity = severity;
+        recent->level = level;
+    }
+    recent->originTime = data.originTime;
+    recent->latitude = data.latitude;
+    recent->longitude = data.longitude;
+    if (severity > recent->severity) {
+        recent->severity = severity;
+    }
+    if (level > recent->level) {
+        recent->level = level;
+    }
+    return false;
+}
+
+void notifyLocalShake(const EarthquakeData& data) {
+    if (data.maxIntensity == Intensity::Unknown) {
+        return;
+    }
+    enqueueNotification(data);
+}
+
+/**
+ * @brief 通知キューに追加し、キュー処理を開始
+ * @param data 地震情報データ
+ * @details 設置場所の推定震度がしきい値未満の地震はキューに入れない（リスト表示のみ）。
+ *          キュー満杯時は最も重要度の低い（同じ重要度なら最古の）通知を押し出す
+ */
+static void enqueueNotification(const EarthquakeData& data) {
+    statEventsReceived++;
+
+    AlertLevel level = decideAlertLevel(data);
+    if (level == AlertLevel::ListOnly) {
+        statListOnly++;
+        consoleLog("[Notification] 推定震度" + String(intensityLabel(data.siteIntensity)) + "のためリスト表示のみ: " +
+                   data.hypocenterName + " 最大震度" + intensityLabel(data.maxIntensity));
+        return;
+    }
+
     // メモリチェック（メモリ不足時は通知をスキップ）
     if (ESP.getFreeHeap() < 15000) {
         consoleLog("[Notification] メモリ不足により通知をスキップ (Free heap: " + String(ESP.getFreeHeap()) + " bytes)");
         return;
     }
 
-    // 入力検証
-    if (data.maxIntensity.length() == 0) {
-        consoleLog("[Notification] 震度データが不正、通知をスキップ");
-        return;
-    }
+    int severity = computeSeverity(data);
 
-    // キューが満杯の場合、最古の通知を破棄
+    // キューが満杯の場合、最も重要度の低い通知を押し出す
     if (queueCount >= NOTIFICATION_QUEUE_SIZE) {
-        consoleLog("[Notification] キュー満杯、最古の通知を破棄");
-        queueHead = (queueHead + 1) % NOTIFICATION_QUEUE_SIZE;
+        int lowest = 0;
+        for (int i = 1; i < queueCount; i++) {
+            if (notificationQueue[i].severity < notificationQueue[lowest].severity) {
+                lowest = i;  // 同じ重要度なら古い方を押し出す
+            }
+        }
+        queueEvicted++;
+        statEventsEvicted++;
+        if (notificationQueue[lowest].severity > severity) {
+            // 新規通知の方が重要度が低い場合は新規通知を破棄（件数のみ集約通知に反映）
+            consoleLog("[Notification] キュー満杯、重要度の低い新規通知を集約: " + data.hypocenterName + " 震度" + intensityLabel(data.maxIntensity));
+            processNotificationQueue();
+            return;
+        }
+        consoleLog("[Notification] キュー満杯、重要度の低い通知を集約: " +
+                   notificationQueue[lowest].data.hypocenterName + " 震度" + intensityLabel(notificationQueue[lowest].data.maxIntensity));
+        // 押し出した位置を詰めて受信順を維持
+        for (int i = lowest; i < queueCount - 1; i++) {
+            notificationQueue[i] = notificationQueue[i + 1];
+        }
         queueCount--;
     }
 
-    // 新規通知をキューに追加
-    notificationQueue[queueTail] = data;
-    queueTail = (queueTail + 1) % NOTIFICATION_QUEUE_SIZE;
+    // 新規通知をキューに追加（受信順）
+    notificationQueue[queueCount].data = data;
+    notificationQueue[queueCount].severity = severity;
+    notificationQueue[queueCount].level = level;
+    notificationQueue[queueCount].receivedAt = millis();
     queueCount++;
 
-    consoleLog("[Notification] キューに追加: " + data.hypocenterName + " 震度" + data.maxIntensity + " (キュー内: " + String(queueCount) + "件)");
+    consoleLog("[Notification] キューに追加: " + data.hypocenterName + " 震度" + intensityLabel(data.maxIntensity) +
+               " (重要度: " + String(severity) + ", " + alertLevelName(level) + ", キュー内: " + String(queueCount) + "件)");
 
     // キュー処理を開始（現在通知中でなければ）
     processNotificationQueue();
 }
 
 /**
- * @brief 通知処理を更新（ノンブロッキング音声再生用）
- * @details loop()から毎回呼び出す。音声再生状態マシン、視覚通知、キュー処理を更新
+ * @brief 通知処理を更新（loop()から呼び出し）
+ * @details 点滅中のタッチによる中断を検出する。点滅の切り替え、ビープ音の状態遷移は
+ *          スケジューラのタイマーで実行される
  */
 void updateNotification() {
-    // ビープ音の状態マシン処理
-    if (beepPlayed < beepCount) {
-        unsigned long currentTime = millis();
-        // 前回のビープから (BEEP_DURATION_MS + BEEP_INTERVAL_MS) 経過したか確認
-        if (currentTime - lastBeepTime >= (BEEP_DURATION_MS + BEEP_INTERVAL_MS)) {
-            beepPlayed++;
-            if (beepPlayed < beepCount) {
-                // 次のビープ音を再生
-                if (isSpeakerEnabled) {
-                    M5.Speaker.tone(BEEP_FREQUENCY, BEEP_DURATION_MS);
-                }
-                lastBeepTime = currentTime;
-            } else {
-                // すべてのビープ音再生完了
-                consoleLog("[Notification] ビープ音再生完了");
-                beepCount = 0;  // ビープ音状態をリセット
-                // 次の通知をキューから処理
-                processNotificationQueue();
-            }
-        }
-    }
-
     // 視覚通知の更新
     updateFlashScreen();
 }
 
 /**
- * @brief 震度に応じたビープ回数を取得
- * @param intensity 震度文字列（"1", "2", "3", "4", "5弱", "5強", "6弱", "6強", "7"）
- * @return ビープ回数（1-3回）
+ * @brief 通知処理が進行中かを判定
+ * @return 画面点滅中ならtrue
  */
-static int getBeepCountForIntensity(const String& intensity) {
-    // 震度5弱以上: 3回
-    if (intensity == "5弱" || intensity == "5強" ||
-        intensity == "6弱" || intensity == "6強" ||
-        intensity == "7") {
-        return 3;
-    }
-    // 震度3-4: 2回
-    else if (intensity == "3" || intensity == "4") {
-        return 2;
-    }
-    // 震度1-2: 1回
-    else {
-        return 1;
+bool isNotificationActive() {
+    return isFlashing;
+}
+
+bool isNotificationBannerShown() {
+    return bannerShown;
+}
+
+/**
+ * @brief ビープ音タイマーのコールバック（ビープ音の状態マシン）
+ * @param arg 未使用
+ * @details 前回のビープから (BEEP_DURATION_MS + BEEP_INTERVAL_MS) 経過時に呼び出される
+ */
+static void onBeepTimer(void *arg) {
+    beepPlayed++;
+    if (beepPlayed < beepCount) {
+        // 次のビープ音を再生
+        if (isSpeakerEnabled) {
+            M5.Speaker.tone(BEEP_FREQUENCY, BEEP_DURATION_MS);
+        }
+        schedulerStart(beepTimerId, BEEP_DURATION_MS + BEEP_INTERVAL_MS);
+    } else {
+        // すべてのビープ音再生完了
+        consoleLog("[Notification] ビープ音再生完了");
+        beepCount = 0;  // ビープ音状態をリセット
+        // 次の通知をキューから処理
+        processNotificationQueue();
     }
 }
 
@@ -180,12 +405,12 @@ static int getBeepCountForIntensity(const String& intensity) {
  * @brief ビープ音を再生（状態マシン管理）
  * @param count ビープ回数（1-3回）
  * @details M5.Speaker.tone(BEEP_FREQUENCY, BEEP_DURATION_MS)でノンブロッキング再生
- *          updateNotification()で完了確認を行う
+ *          以降のビープ音と完了確認はonBeepTimer()で行う
  */
 static void playBeepSound(int count) {
     beepCount = count;
     beepPlayed = 0;
-    lastBeepTime = millis();
+    schedulerStart(beepTimerId, BEEP_DURATION_MS + BEEP_INTERVAL_MS);
 
     // 最初のビープ音を再生
     if (isSpeakerEnabled) {
@@ -196,13 +421,54 @@ static void playBeepSound(int count) {
     }
 }
 
+/**
+ * @brief 地震情報の重要度を計算
+ * @param data 地震情報データ
+ * @return 重要度（大きいほど重要）
+ * @details 津波情報は震度換算（注意報=5弱、警報=6弱、大津波警報=7相当）し、震度と大きい方を主キー、
+ *          津波の段階を副キーとする。遠地地震の大津波警報が小さな近地地震に埋もれないようにするため。
+ *          震度は設置場所の推定震度を優先する（alertIntensity()）
+ */
+static int computeSeverity(const EarthquakeData& data) {
+    int tsunamiLevel = 0;
+    int tsunamiRank = 0;
+    if (data.tsunami == "Watch") {
+        tsunamiLevel = 1;
+        tsunamiRank = 5;
+    } else if (data.tsunami == "Warning") {
+        tsunamiLevel = 2;
+        tsunamiRank = 7;
+    } else if (data.tsunami == "MajorWarning") {
+        tsunamiLevel = 3;
+        tsunamiRank = 9;
+    }
+
+    int rank = intensityRank(alertIntensity(data));
+    if (tsunamiRank > rank) {
+        rank = tsunamiRank;
+    }
+    return rank * 4 + tsunamiLevel;
+}
+
+/**
+ * @brief 集約期間終了タイマーのコールバック
+ * @param arg 未使用
+ */
+static void onCoalesceTimer(void *arg) {
+    processNotificationQueue();
+}
+
 /**
  * @brief 通知キューから次の通知を処理
- * @details キューに通知がある場合、先頭から取り出して通知処理を開始
+ * @details 通知中（ビープ音または点滅中）は何もしない。直前の通知からCOALESCE_WINDOW_MS以内で、
+ *          直前の通知より重要な地震がない場合は集約期間の終了まで保留する。
+ *          それ以外はキュー内の全件を最も重要な地震を代表とする1件の通知にまとめて再生する。
+ *          ビープ音はキュー内にビープ音の段階の地震がある場合のみ鳴らす。
+ *          2件以上をまとめた場合は件数とキュー内の最大震度をヘッダーにバナー表示する
  */
 static void processNotificationQueue() {
-    // 現在通知処理中の場合はスキップ
-    if (beepCount > 0) {
+    // 現在通知処理中の場合はスキップ（ビープ音・点滅の完了時に再度呼び出される）
+    if (beepCount > 0 || isFlashing) {
         return;
     }
 
@@ -211,77 +477,268 @@ static void processNotificationQueue() {
         return;
     }
 
-    // キューから先頭の通知を取り出し
-    EarthquakeData data = notificationQueue[queueHead];
-    queueHead = (queueHead + 1) % NOTIFICATION_QUEUE_SIZE;
-    queueCount--;
+    // 最も重要な通知を選択（同じ重要度なら先に受信した方）
+    int top = 0;
+    for (int i = 1; i < queueCount; i++) {
+        if (notificationQueue[i].severity > notificationQueue[top].severity) {
+            top = i;
+        }
+    }
+
+    // 集約期間中は、直前の通知より重要な地震が届くまで保留
+    unsigned long now = millis();
+    unsigned long sinceLastAlert = now - lastAlertTime;
+    if (lastAlertSeverity >= 0 && sinceLastAlert < COALESCE_WINDOW_MS &&
+        notificationQueue[top].severity <= lastAlertSeverity) {
+        if (!schedulerIsActive(coalesceTimerId)) {
+            schedulerStart(coalesceTimerId, COALESCE_WINDOW_MS - sinceLastAlert);
+        }
+        return;
+    }
+    schedulerStop(coalesceTimerId);
+
+    // キュー内の全件を1件の通知にまとめる
+    EarthquakeData data = notificationQueue[top].data;
+    int severity = notificationQueue[top].severity;
+    AlertLevel level = AlertLevel::Flash;
+    Intensity maxIntensity = data.maxIntensity;
+    for (int i = 0; i < queueCount; i++) {
+        if (notificationQueue[i].level > level) {
+            level = notificationQueue[i].level;
+        }
+        if (intensityRank(notificationQueue[i].data.maxIntensity) > intensityRank(maxIntensity)) {
+            maxIntensity = notificationQueue[i].data.maxIntensity;
+        }
+    }
+    int total = queueCount + queueEvicted;
+    unsigned long latency = now - notificationQueue[0].receivedAt;  // 最古の通知の待ち時間
+    if (latency > statMaxLatencyMs) {
+        statMaxLatencyMs = latency;
+    }
+    statEventsCoalesced += total - 1;
+    statAlertsPlayed++;
+    if (level == AlertLevel::Flash) {
+        statFlashOnly++;
+    }
+    queueCount = 0;
+    queueEvicted = 0;
 
-    consoleLog("[Notification] 通知処理開始: " + data.hypocenterName + " 震度" + data.maxIntensity);
+    lastAlertTime = now;
+    lastAlertSeverity = severity;
 
-    // ビープ音再生
-    int count = getBeepCountForIntensity(data.maxIntensity);
-    playBeepSound(count);
+    if (total > 1) {
+        consoleLog("[Notification] 集約通知開始: " + String(total) + "件: 最大震度" + intensityLabel(maxIntensity) +
+                   " (" + data.hypocenterName + ", 待機" + String(latency) + "ms)");
+        showBanner(total, maxIntensity);
+    } else {
+        consoleLog("[Notification] 通知処理開始: " + data.hypocenterName + " 震度" + intensityLabel(data.maxIntensity));
+    }
+    consoleLog("[Notification] 統計: 受信=" + String(statEventsReceived) + ", 通知=" + String(statAlertsPlayed) +
+               " (点滅のみ=" + String(statFlashOnly) + "), リストのみ=" + String(statListOnly) +
+               ", 集約=" + String(statEventsCoalesced) + ", 押し出し=" + String(statEventsEvicted) +
+               ", 続報統合=" + String(statRevisionsMerged) + ", 続報抑制=" + String(statRevisionsSuppressed) +
+               ", 最大待機=" + String(statMaxLatencyMs) + "ms");
+
+    // ビープ音再生（最も重要な地震の震度で決定、設置場所の推定震度を優先）
+    if (level == AlertLevel::Beep) {
+        int count = intensityBeepCount(alertIntensity(data));
+        playBeepSound(count);
+    } else {
+        consoleLog("[Notification] 推定震度" + String(intensityLabel(alertIntensity(data))) + "のため点滅のみ");
+    }
 
     // 視覚通知（画面点滅）
-    uint16_t color = getIntensityColor(data.maxIntensity);
+    uint16_t color = intensityColor(data.maxIntensity);
     flashScreen(color);
+}
 
-    // リストに地震情報を追加
-    addEarthquakeToDisplay(data);
+/**
+ * @brief 集約通知のバナーを表示し、BANNER_HOLD_MS後に消去
+ * @param total まとめた件数
+ * @param maxIntensity まとめた地震の最大震度
+ * @details 到達カウントダウンの表示中はヘッダーを譲り、表示しない
+ */
+static void showBanner(int total, Intensity maxIntensity) {
+    if (isArrivalCountdownActive()) {
+        return;
+    }
+    snprintf(bannerText, sizeof(bannerText), "%d件: 最大震度%s", total, intensityLabel(maxIntensity));
+    bannerShown = true;
+    drawBanner();
+    schedulerStart(bannerTimerId, BANNER_HOLD_MS);
+}
+
+/**
+ * @brief バナーをヘッダーに描画（到達カウントダウンと同じ体裁）
+ */
+static void drawBanner() {
+    Screen.fillRect(0, 0, BANNER_WIDTH, HEADER_HEIGHT, COLOR_BANNER);
+    Screen.setFont(&fonts::lgfxJapanGothic_16);
+    Screen.setTextColor(COLOR_BANNER_TEXT);
+    Screen.setTextDatum(MC_DATUM);
+    Screen.drawString(bannerText, BANNER_WIDTH / 2, HEADER_HEIGHT / 2);
+    Screen.setFont(nullptr);
+}
+
+/**
+ * @brief バナー消去タイマーのコールバック（ヘッダーを元に戻す）
+ * @param arg 未使用
+ * @details 表示中に到達カウントダウンが始まった場合はカウントダウンの終了時にヘッダーが再描画されるため描画しない
+ */
+static void onBannerTimer(void *arg) {
+    (void)arg;
+    bannerShown = false;
+    if (isArrivalCountdownActive()) {
+        return;
+    }
+    drawMainHeader();
+    drawWebSocketIndicator(getWebSocketConnected());
+}
+
+/**
+ * @brief 点滅方式の名前を取得（ログ用）
+ */
+static const char *flashModeName() {
+#if NOTIFICATION_FLASH_MODE == FLASH_MODE_INVERT
+    return "invert";
+#elif NOTIFICATION_FLASH_MODE == FLASH_MODE_BACKLIGHT
+    return "backlight";
+#else
+    return "fill";
+#endif
 }
 
 /**
  * @brief 画面点滅を開始
- * @param color 点滅色（RGB565）
- * @details isFlashing=trueを設定し、updateFlashScreen()で点滅処理を実行
+ * @param color 点滅色（RGB565、FLASH_MODE_FILLのみ使用）
+ * @details 最初のON位相を即座に適用し、以降の位相切り替えはFLASH_INTERVAL_MSごとのタイマーで行う。
+ *          ON/OFFのエッジ以外では画面に一切アクセスしない
  */
 static void flashScreen(uint16_t color) {
+    if (isFlashing) {
+        // 前の点滅が残っている場合は元に戻してから開始
+        finishFlash("次の通知により");
+    }
+
     isFlashing = true;
-    flashStartTime = millis();
+    flashPhase = 0;
     flashColor = color;
-    consoleLog("[Notification] 視覚通知開始（点滅色: 0x" + String(color, HEX) + "）");
+    flashSpiBytes = 0;
+    flashEdgeMicrosMax = 0;
+    flashLoopGapMax = 0;
+    flashLastUpdateMicros = micros();
+#if NOTIFICATION_FLASH_MODE == FLASH_MODE_BACKLIGHT
+    flashSavedBrightness = M5.Display.getBrightness();
+#endif
+
+    applyFlashPhase(true);
+    schedulerStart(flashTimerId, FLASH_INTERVAL_MS, FLASH_INTERVAL_MS);
+    consoleLog("[Notification] 視覚通知開始（方式: " + String(flashModeName()) +
+               ", 点滅色: 0x" + String(color, HEX) + "）");
 }
 
 /**
- * @brief 視覚通知の更新（タッチ検出、点滅アニメーション、自動終了）
- * @details updateNotification()から毎回呼び出される
+ * @brief 点滅位相切り替えタイマーのコールバック
+ * @param arg 未使用
+ * @details FLASH_PHASES回のエッジ後に点滅を終了する
  */
-static void updateFlashScreen() {
+static void onFlashTimer(void *arg) {
     if (!isFlashing) {
+        schedulerStop(flashTimerId);
         return;
     }
 
-    unsigned long currentTime = millis();
-
-    // タッチ検出（最優先、50ms以内の応答を保証）
-    auto touch = M5.Touch.getDetail();
-    if (touch.isPressed()) {
-        // 即座に点滅を終了
-        isFlashing = false;
-        M5.Display.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, COLOR_BG);  // メイン表示エリアのみクリア
-        drawMainHeader();  // ヘッダを再描画
-        renderList();  // リストを再描画
-        consoleLog("[Notification] タッチ操作により通知を中断");
+    flashPhase++;
+    if (flashPhase >= FLASH_PHASES) {
+        finishFlash(nullptr);
+        // 次の通知をキューから処理
+        processNotificationQueue();
         return;
     }
+    applyFlashPhase((flashPhase % 2) == 0);
+}
+
+/**
+ * @brief 点滅のON/OFF位相を画面に反映（エッジ時のみ呼び出す）
+ * @param on ON位相ならtrue
+ * @details 反転方式・バックライト方式ではフレームバッファに触れないため、
+ *          下のリスト表示はそのまま残り、終了後の再描画が不要
+ */
+static void applyFlashPhase(bool on) {
+    unsigned long edgeStart = micros();
+
+#if NOTIFICATION_FLASH_MODE == FLASH_MODE_INVERT
+    Screen.invertDisplay(on);
+    flashSpiBytes += 1;  // INVON/INVOFFコマンド（1バイト）
+#elif NOTIFICATION_FLASH_MODE == FLASH_MODE_BACKLIGHT
+    M5.Display.setBrightness(on ? flashSavedBrightness : FLASH_BACKLIGHT_DIM);
+#else
+    Screen.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, on ? flashColor : COLOR_BG);
+    flashSpiBytes += (uint32_t)SCREEN_WIDTH * VISIBLE_AREA_HEIGHT * 2;  // RGB565
+#endif
+
+    uint32_t edgeMicros = micros() - edgeStart;
+    if (edgeMicros > flashEdgeMicrosMax) {
+        flashEdgeMicrosMax = edgeMicros;
+    }
+}
 
-    // 時間経過による点滅処理
-    unsigned long elapsed = currentTime - flashStartTime;
-    if (elapsed >= FLASH_DURATION_MS) {
-        // 点滅終了
-        isFlashing = false;
-        M5.Display.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, COLOR_BG);  // メイン表示エリアのみクリア
-        drawMainHeader();  // ヘッダを再描画
-        renderList();  // リストを再描画
+/**
+ * @brief 画面点滅を終了し、表示を元に戻す
+ * @param reason 終了理由（ログ用、nullptrは時間経過による完了）
+ * @details 計測結果（SPI転送量、エッジ処理の最大時間、loop()停滞の最大値）をログ出力する
+ */
+static void finishFlash(const char *reason) {
+    isFlashing = false;
+    schedulerStop(flashTimerId);
+
+#if NOTIFICATION_FLASH_MODE == FLASH_MODE_INVERT
+    Screen.invertDisplay(false);
+    flashSpiBytes += 1;
+#elif NOTIFICATION_FLASH_MODE == FLASH_MODE_BACKLIGHT
+    M5.Display.setBrightness(flashSavedBrightness);
+#else
+    // 塗りつぶし方式のみリストを再描画
+    Screen.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, COLOR_BG);  // メイン表示エリアのみクリア
+    flashSpiBytes += (uint32_t)SCREEN_WIDTH * VISIBLE_AREA_HEIGHT * 2;
+    drawMainHeader();  // ヘッダを再描画
+    if (bannerShown) {
+        drawBanner();
+    }
+    renderList();  // リストを再描画
+#endif
+
+    if (reason != nullptr) {
+        consoleLog("[Notification] " + String(reason) + "通知を中断");
+    } else {
         consoleLog("[Notification] 視覚通知完了");
+    }
+    consoleLog("[Notification] 点滅統計: SPI=" + String(flashSpiBytes) + "B, エッジ処理最大=" +
+               String(flashEdgeMicrosMax) + "us, loop間隔最大=" + String(flashLoopGapMax / 1000) + "ms");
+}
+
+/**
+ * @brief 視覚通知の更新（タッチ検出、loop()停滞の計測）
+ * @details updateNotification()から毎回呼び出される。描画は行わない
+ */
+static void updateFlashScreen() {
+    if (!isFlashing) {
         return;
     }
 
-    // 点滅アニメーション（300ms間隔でON/OFF）
-    bool shouldShowColor = ((elapsed / FLASH_INTERVAL_MS) % 2) == 0;
-    if (shouldShowColor) {
-        M5.Display.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, flashColor);  // メイン表示エリアのみ点滅
-    } else {
-        M5.Display.fillRect(0, HEADER_HEIGHT, SCREEN_WIDTH, VISIBLE_AREA_HEIGHT, COLOR_BG);  // メイン表示エリアのみクリア
+    // 点滅中のloop()呼び出し間隔を計測（受信・タッチ処理の停滞の指標）
+    unsigned long now = micros();
+    uint32_t gap = now - flashLastUpdateMicros;
+    if (gap > flashLoopGapMax) {
+        flashLoopGapMax = gap;
+    }
+    flashLastUpdateMicros = now;
+
+    // タッチ検出（最優先、50ms以内の応答を保証）
+    auto touch = M5.Touch.getDetail();
+    if (touch.isPressed()) {
+        // 即座に点滅を終了
+        finishFlash("タッチ操作により");
+        processNotificationQueue();
     }
 }
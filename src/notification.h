@@ -9,6 +9,12 @@
 #include "earthquake.h"
 #include <M5Unified.h>
 
+// 視覚通知（点滅）方式
+#define FLASH_MODE_INVERT 0      // パネルの表示反転コマンド（INVON/INVOFF）で点滅、SPI転送は1エッジ1バイト
+#define FLASH_MODE_BACKLIGHT 1   // バックライト輝度の変調で点滅、SPI転送なし
+#define FLASH_MODE_FILL 2        // 震度色の塗りつぶし（エッジ時のみ描画、終了時にリスト再描画）
+#define NOTIFICATION_FLASH_MODE FLASH_MODE_INVERT
+
 /**
  * @brief 通知機能を初期化（M5.Speaker初期化、状態変数リセット）
  * @details setup()から呼び出す。M5.begin()実行後に呼び出すこと
@@ -24,9 +30,29 @@ void initNotification();
 void notifyEarthquake(const EarthquakeData& data);
 
 /**
- * @brief 通知処理を更新（ノンブロッキング音声再生用）
- * @details loop()から毎回呼び出す。音声再生状態マシン、視覚通知、キュー処理を更新
+ * @brief 本機の揺れ検知を通知キューに追加
+ * @param data 揺れ検知の情報（震源地名は"揺れ検知"、震度はIMUの最大加速度からの推定値）
+ * @details 地震情報と同じ重要度・集約の規則で通知する。リストと履歴には追加しない
+ */
+void notifyLocalShake(const EarthquakeData& data);
+
+/**
+ * @brief 通知処理を更新（loop()から呼び出し）
+ * @details 点滅中のタッチによる中断を検出する。点滅の切り替え、ビープ音の状態遷移、
+ *          キュー処理はスケジューラのタイマーで実行される
  */
 void updateNotification();
 
+/**
+ * @brief 通知処理が進行中かを判定
+ * @return 画面点滅中ならtrue
+ */
+bool isNotificationActive();
+
+/**
+ * @brief 集約通知のバナー（「N件: 最大震度X」）をヘッダーに表示中かを判定
+ * @return 表示中ならtrue（ヘッダーの時刻を描画しない）
+ */
+bool isNotificationBannerShown();
+
 #endif // NOTIFICATION_H
@@ -0,0 +1,433 @@
+/**
+ * @file rendertarget.cpp
+ * @brief 描画先の抽象化と描画コストの計測の実装
+ * @details SPI転送量は描画ウィンドウの設定回数と画素数から推定する（矩形は1ウィンドウ、
+ *          斜めの線・角丸・文字はLovyanGFXが短い線分や1文字ごとに分けて転送するため、その分を加える）
+ */
+
+#include "rendertarget.h"
+#if defined(RENDER_HEADLESS) && defined(ARDUINO)
+#include <SD.h>
+#elif defined(RENDER_HEADLESS)
+#include <stdio.h>
+#endif
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+RenderTarget Screen;
+
+#ifdef RENDER_HEADLESS
+// メモリ上のフレームバッファ（RGB565）
+static LGFX_Sprite frameBuffer;
+static bool frameBufferReady = false;
+#endif
+
+bool RenderTarget::begin() {
+    resetCounters();
+#ifdef RENDER_HEADLESS
+    if (!frameBufferReady) {
+        // PSRAMのないCoreでは内部RAMから確保し、RGB565（150KB）が入らなければRGB332（75KB）に落とす
+        frameBuffer.setPsram(psramFound());
+        frameBuffer.setColorDepth(16);
+        if (frameBuffer.createSprite(RENDER_TARGET_WIDTH, RENDER_TARGET_HEIGHT) == nullptr) {
+            frameBuffer.setColorDepth(8);
+            if (frameBuffer.createSprite(RENDER_TARGET_WIDTH, RENDER_TARGET_HEIGHT) == nullptr) {
+                consoleLog("[Render] フレームバッファの確保に失敗 (Free heap: " + String(ESP.getFreeHeap()) + " bytes)");
+                return false;
+            }
+        }
+        frameBufferReady = true;
+    }
+    frameBuffer.fillScreen(TFT_BLACK);
+    consoleLog("[Render] ヘッドレス描画: " + String(RENDER_TARGET_WIDTH) + "x" + String(RENDER_TARGET_HEIGHT) +
+               (frameBuffer.getColorDepth() == 16 ? " RGB565 (" : " RGB332 (") + String(frameBuffer.bufferLength()) +
+               "バイト, " + (psramFound() ? "PSRAM" : "内部RAM") + ", Free heap: " + String(ESP.getFreeHeap()) + " bytes)");
+#endif
+    return true;
+}
+
+lgfx::LovyanGFX &RenderTarget::gfx() {
+    if (band != nullptr) {
+        return *band;
+    }
+#ifdef RENDER_HEADLESS
+    return frameBuffer;
+#else
+    return M5.Display;
+#endif
+}
+
+/**
+ * @brief 描画1回分のコストを集計
+ * @param pixels 書き込んだ画素数
+ * @param windows 描画ウィンドウの設定回数
+ */
+void RenderTarget::count(uint32_t pixels, uint32_t windows) {
+    if (band != nullptr) {
+        return;  // メモリ上での合成（転送はpushBand()で数える）
+    }
+    stats.drawCalls++;
+    stats.pixels += pixels;
+    stats.spiBytes += windows * RENDER_SPI_WINDOW_BYTES + pixels * RENDER_SPI_PIXEL_BYTES;
+}
+
+/**
+ * @brief 文字列の描画コストを集計（外接矩形の画素、1文字1ウィンドウ）
+ */
+void RenderTarget::countText(const char *text, int32_t width, int32_t height) {
+    uint32_t glyphs = 0;
+    for (const char *p = text; *p != '\0'; p++) {
+        if (((uint8_t)*p & 0xC0) != 0x80) {
+            glyphs++;  // UTF-8の先頭バイトのみ数える
+        }
+    }
+    count((uint32_t)(width > 0 ? width : 0) * (uint32_t)(height > 0 ? height : 0), glyphs);
+}
+
+void RenderTarget::fillScreen(uint16_t color) {
+    gfx().fillScreen(color);
+    count(RENDER_TARGET_WIDTH * RENDER_TARGET_HEIGHT, 1);
+}
+
+void RenderTarget::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    gfx().fillRect(x, y - bandY, w, h, color);
+    if (w > 0 && h > 0) {
+        count((uint32_t)w * h, 1);
+    }
+}
+
+void RenderTarget::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint16_t color) {
+    gfx().fillRoundRect(x, y - bandY, w, h, r, color);
+    if (w > 0 && h > 0) {
+        count((uint32_t)w * h, 1 + 2 * (uint32_t)(r > 0 ? r : 0));  // 中央の矩形 + 角の行ごとの線分
+    }
+}
+
+void RenderTarget::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    gfx().drawRect(x, y - bandY, w, h, color);
+    if (w > 0 && h > 0) {
+        count((uint32_t)(2 * (w + h)), 4);
+    }
+}
+
+void RenderTarget::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color) {
+    gfx().drawLine(x0, y0 - bandY, x1, y1 - bandY, color);
+    uint32_t dx = abs(x1 - x0);
+    uint32_t dy = abs(y1 - y0);
+    count((dx > dy ? dx : dy) + 1, (dx < dy ? dx : dy) + 1);  // 水平・垂直の線分ごとに1ウィンドウ
+}
+
+size_t RenderTarget::drawString(const char *text, int32_t x, int32_t y) {
+    countText(text, gfx().textWidth(text), gfx().fontHeight());
+    return gfx().drawString(text, x, y - bandY);
+}
+
+size_t RenderTarget::drawString(const String &text, int32_t x, int32_t y) {
+    return drawString(text.c_str(), x, y);
+}
+
+/**
+ * @brief フォント番号に対応するフォントを取得（コストの集計用）
+ */
+static const lgfx::IFont *fontForNumber(uint8_t font) {
+    switch (font) {
+    case 2:
+        return &fonts::Font2;
+    case 4:
+        return &fonts::Font4;
+    default:
+        return &fonts::Font0;
+    }
+}
+
+size_t RenderTarget::drawString(const char *text, int32_t x, int32_t y, uint8_t font) {
+    const lgfx::IFont *face = fontForNumber(font);
+    countText(text, gfx().textWidth(text, face), gfx().fontHeight(face));
+    return gfx().drawString(text, x, y - bandY, font);
+}
+
+size_t RenderTarget::drawString(const String &text, int32_t x, int32_t y, uint8_t font) {
+    return drawString(text.c_str(), x, y, font);
+}
+
+void RenderTarget::pushCanvas(M5Canvas &canvas, int32_t x, int32_t y) {
+    canvas.pushSprite(&gfx(), x, y - bandY);
+    count((uint32_t)canvas.width() * canvas.height(), 1);
+}
+
+void RenderTarget::beginBand(M5Canvas &canvas, int32_t y) {
+    band = &canvas;
+    bandY = y;
+}
+
+void RenderTarget::endBand() {
+    band = nullptr;
+    bandY = 0;
+}
+
+void RenderTarget::pushBand(M5Canvas &canvas, int32_t y) {
+#ifdef RENDER_HEADLESS
+    canvas.pushSprite(&frameBuffer, 0, y);
+#else
+    // 16ビットのスプライトのバッファはパネルと同じ上位バイトが先のRGB565
+    M5.Display.pushImageDMA(0, y, canvas.width(), canvas.height(), (const lgfx::swap565_t *)canvas.getBuffer());
+#endif
+    count((uint32_t)canvas.width() * canvas.height(), 1);
+}
+
+void RenderTarget::beginTransfer() {
+#ifndef RENDER_HEADLESS
+    M5.Display.startWrite();
+#endif
+}
+
+void RenderTarget::endTransfer() {
+#ifndef RENDER_HEADLESS
+    M5.Display.waitDMA();
+    M5.Display.endWrite();
+#endif
+}
+
+void RenderTarget::invertDisplay(bool invert) {
+#ifndef RENDER_HEADLESS
+    M5.Display.invertDisplay(invert);  // 表示反転はパネルの状態のため、フレームバッファには反映しない
+#endif
+    stats.drawCalls++;
+    stats.spiBytes += 1;  // INVON/INVOFFコマンドのみ
+}
+
+void RenderTarget::setFont(const lgfx::IFont *font) {
+    gfx().setFont(font);
+}
+
+void RenderTarget::setTextColor(uint16_t color) {
+    gfx().setTextColor(color);
+}
+
+void RenderTarget::setTextColor(uint16_t color, uint16_t background) {
+    gfx().setTextColor(color, background);
+}
+
+void RenderTarget::setTextDatum(uint8_t datum) {
+    gfx().setTextDatum(datum);
+}
+
+void RenderTarget::setTextSize(float size) {
+    gfx().setTextSize(size);
+}
+
+int32_t RenderTarget::textWidth(const String &text, const lgfx::IFont *font) {
+    return gfx().textWidth(text, font);
+}
+
+#ifdef RENDER_HEADLESS
+/**
+ * @brief CRC32（IEEE 802.3）を計算
+ * @param data データ
+ * @param length データ長（バイト）
+ * @return CRC32値
+ */
+static uint32_t crc32(const uint8_t *data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief 画像ファイル（実機はSDカード、ホストはファイル）
+ */
+class ImageFile {
+public:
+    bool open(const char *path, bool write) {
+#ifdef ARDUINO
+        file = SD.open(path, write ? FILE_WRITE : FILE_READ);
+        return (bool)file;
+#else
+        file = fopen(path, write ? "wb" : "rb");
+        return file != nullptr;
+#endif
+    }
+
+    size_t read(uint8_t *data, size_t length) {
+#ifdef ARDUINO
+        return file.read(data, length);
+#else
+        return fread(data, 1, length, file);
+#endif
+    }
+
+    size_t write(const uint8_t *data, size_t length) {
+#ifdef ARDUINO
+        return file.write(data, length);
+#else
+        return fwrite(data, 1, length, file);
+#endif
+    }
+
+    void close() {
+#ifdef ARDUINO
+        file.close();
+#else
+        if (file != nullptr) {
+            fclose(file);
+            file = nullptr;
+        }
+#endif
+    }
+
+private:
+#ifdef ARDUINO
+    File file;
+#else
+    FILE *file = nullptr;
+#endif
+};
+
+/**
+ * @brief フレームバッファの1行をRGB888に変換
+ * @param y 行
+ * @param line 出力先（RENDER_TARGET_WIDTH×3バイト）
+ * @details RGB332で確保した場合もreadPixel()でRGB565に揃えてから変換する
+ */
+static void readRenderLine(int y, uint8_t *line) {
+    for (int x = 0; x < RENDER_TARGET_WIDTH; x++) {
+        uint16_t rgb = frameBuffer.readPixel(x, y);
+        line[x * 3] = (uint8_t)(((rgb >> 11) & 0x1F) * 255 / 31);
+        line[x * 3 + 1] = (uint8_t)(((rgb >> 5) & 0x3F) * 255 / 63);
+        line[x * 3 + 2] = (uint8_t)((rgb & 0x1F) * 255 / 31);
+    }
+}
+
+/**
+ * @brief PPMのヘッダーを読み込み
+ * @return 幅・高さがフレームバッファと同じで最大値が255のP6ならtrue
+ * @details 値の区切りは空白・改行、#から行末まではコメントとして読み飛ばす
+ */
+static bool readPpmHeader(ImageFile &file) {
+    uint8_t magic[2];
+    if (file.read(magic, 2) != 2 || magic[0] != 'P' || magic[1] != '6') {
+        return false;
+    }
+    long values[3];
+    for (long &value : values) {
+        uint8_t c;
+        do {
+            if (file.read(&c, 1) != 1) {
+                return false;
+            }
+            if (c == '#') {
+                while (c != '\n' && file.read(&c, 1) == 1) {
+                }
+            }
+        } while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+        value = 0;
+        while (c >= '0' && c <= '9') {
+            value = value * 10 + (c - '0');
+            if (file.read(&c, 1) != 1) {
+                return false;
+            }
+        }
+    }
+    return values[0] == RENDER_TARGET_WIDTH && values[1] == RENDER_TARGET_HEIGHT && values[2] == 255;
+}
+#endif
+
+uint32_t renderTargetChecksum() {
+#ifdef RENDER_HEADLESS
+    if (!frameBufferReady) {
+        return 0;
+    }
+    return crc32((const uint8_t *)frameBuffer.getBuffer(), frameBuffer.bufferLength());
+#else
+    return 0;
+#endif
+}
+
+bool checkRenderGolden(const char *name, const char *path) {
+#ifdef RENDER_HEADLESS
+    if (!frameBufferReady) {
+        return false;
+    }
+    ImageFile file;
+    if (!file.open(path, false)) {
+        consoleLog("[Render] " + String(name) + ": ゴールデン画像を開けない: " + String(path));
+        return false;
+    }
+    if (!readPpmHeader(file)) {
+        file.close();
+        consoleLog("[Render] " + String(name) + ": ゴールデン画像の形式が不正: " + String(path));
+        return false;
+    }
+
+    // 1行ずつ比較し、不一致の画素数と範囲を集計
+    uint8_t actual[RENDER_TARGET_WIDTH * 3];
+    uint8_t expected[RENDER_TARGET_WIDTH * 3];
+    uint32_t mismatched = 0;
+    int left = RENDER_TARGET_WIDTH, top = RENDER_TARGET_HEIGHT, right = -1, bottom = -1;
+    bool complete = true;
+    for (int y = 0; y < RENDER_TARGET_HEIGHT; y++) {
+        if (file.read(expected, sizeof(expected)) != sizeof(expected)) {
+            complete = false;
+            break;
+        }
+        readRenderLine(y, actual);
+        for (int x = 0; x < RENDER_TARGET_WIDTH; x++) {
+            if (memcmp(&actual[x * 3], &expected[x * 3], 3) != 0) {
+                mismatched++;
+                left = min(left, x);
+                right = max(right, x);
+                top = min(top, y);
+                bottom = max(bottom, y);
+            }
+        }
+    }
+    file.close();
+
+    const RenderCounters &stats = Screen.counters();
+    String result;
+    if (!complete) {
+        result = "ゴールデン画像が途中で終了";
+    } else if (mismatched == 0) {
+        result = "一致";
+    } else {
+        result = "不一致 " + String(mismatched) + "画素 (" + String(left) + "," + String(top) + ")-(" + String(right) + "," +
+                 String(bottom) + ")";
+    }
+    consoleLog("[Render] " + String(name) + ": " + result + ", CRC32=0x" + String(renderTargetChecksum(), HEX) + ", 描画" +
+               String(stats.drawCalls) + "回, " + String(stats.pixels) + "画素, SPI" + String(stats.spiBytes) + "バイト");
+    return complete && mismatched == 0;
+#else
+    consoleLog("[Render] ゴールデン比較はヘッドレス描画（RENDER_HEADLESS）でのみ使用可能: " + String(name));
+    return false;
+#endif
+}
+
+bool dumpRenderTarget(const char *path) {
+#ifdef RENDER_HEADLESS
+    if (!frameBufferReady) {
+        return false;
+    }
+    ImageFile file;
+    if (!file.open(path, true)) {
+        return false;
+    }
+    String header = "P6\n" + String(RENDER_TARGET_WIDTH) + " " + String(RENDER_TARGET_HEIGHT) + "\n255\n";
+    bool ok = file.write((const uint8_t *)header.c_str(), header.length()) == header.length();
+    uint8_t line[RENDER_TARGET_WIDTH * 3];
+    for (int y = 0; y < RENDER_TARGET_HEIGHT && ok; y++) {
+        readRenderLine(y, line);
+        ok = file.write(line, sizeof(line)) == sizeof(line);
+    }
+    file.close();
+    consoleLog("[Render] フレームバッファを書き出し: " + String(path) + (ok ? "" : " (失敗)"));
+    return ok;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,151 @@
+/**
+ * @file rendertarget.h
+ * @brief 描画先の抽象化（画面、またはメモリ上のRGB565フレームバッファ）と描画コストの計測
+ * @details 画面の描画はすべてScreen経由で行い、描画呼び出し数・書き込み画素数・SPI転送量の推定値を集計する。
+ *          ビルドフラグRENDER_HEADLESSを指定すると描画先をメモリ上のフレームバッファ（LGFX_Sprite）に切り替え、
+ *          パネルへの転送を除いた描画処理のみの時間を計測できる。
+ *          フレームバッファはゴールデン画像（PPM）と比較したり、PPM画像に書き出したりできる（host/のテストで使用）
+ */
+
+#ifndef RENDERTARGET_H
+#define RENDERTARGET_H
+
+#include <Arduino.h>
+#include <M5Unified.h>
+
+// ヘッドレス描画（platformio.iniのbuild_flagsに-DRENDER_HEADLESSを追加して有効化）
+// 有効時はRENDER_TARGET_WIDTH×RENDER_TARGET_HEIGHTのフレームバッファを確保する。PSRAMがあればPSRAMにRGB565（150KB）、
+// なければ内部RAMにRGB565、確保できなければRGB332（75KB）で確保する（いずれも計測用のビルドでのみ使用する）
+// #define RENDER_HEADLESS
+
+// フレームバッファの大きさ（画面と同じ）
+#define RENDER_TARGET_WIDTH 320
+#define RENDER_TARGET_HEIGHT 240
+
+// SPI転送量の推定（ILI9342C）: 描画ウィンドウの設定1回あたりCASET(1+4) + RASET(1+4) + RAMWR(1)バイト、1画素2バイト
+#define RENDER_SPI_WINDOW_BYTES 11
+#define RENDER_SPI_PIXEL_BYTES 2
+
+/**
+ * @brief 描画コストの集計値
+ * @details 画素数は描画範囲の外接矩形で数える（文字は透過部分を含むため上限の推定値）。
+ *          バンドへの合成（beginBand()〜endBand()）はパネルへの転送がないため数えず、pushBand()で転送分を数える
+ */
+struct RenderCounters {
+    uint32_t drawCalls = 0;  // 描画呼び出しの回数
+    uint32_t pixels = 0;     // 書き込んだ画素数
+    uint32_t spiBytes = 0;   // SPI転送量の推定値（バイト）
+};
+
+/**
+ * @brief 描画先
+ * @details 画面の描画で使うLovyanGFXの関数のみを転送し、描画系の関数でコストを集計する。
+ *          文字の設定（フォント・色・基準位置）は描画先の状態をそのまま使う
+ */
+class RenderTarget {
+public:
+    /**
+     * @brief 描画先を初期化（M5.begin()の後に呼び出し）
+     * @return 成功時true（ヘッドレス時にフレームバッファを確保できなければfalse、以降の描画は行われない）
+     */
+    bool begin();
+
+    // 描画（コストを集計）。色はRGB565（LovyanGFXはuint32_tの色をRGB888として扱うため16ビットで渡す）
+    void fillScreen(uint16_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint16_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color);
+    size_t drawString(const char *text, int32_t x, int32_t y);
+    size_t drawString(const String &text, int32_t x, int32_t y);
+    size_t drawString(const char *text, int32_t x, int32_t y, uint8_t font);
+    size_t drawString(const String &text, int32_t x, int32_t y, uint8_t font);
+    void pushCanvas(M5Canvas &canvas, int32_t x, int32_t y);
+    void invertDisplay(bool invert);
+
+    /**
+     * @brief 以降の描画をバンド（画面の横長の一部を写したスプライト）に切り替え
+     * @param band 描画先のスプライト（幅は画面と同じ、16ビット）
+     * @param y バンドの上端の画面上のY座標（描画のY座標はこの位置を0に変換し、範囲外はスプライトで切り取る）
+     */
+    void beginBand(M5Canvas &band, int32_t y);
+
+    /**
+     * @brief 描画先を画面に戻す
+     */
+    void endBand();
+
+    /**
+     * @brief バンドを画面に転送（DMA、転送の完了を待たずに戻る）
+     * @param band 転送するスプライト
+     * @param y 転送先のY座標
+     * @details 直前の転送が終わるまで待ってから開始するため、2枚のバンドを交互に使えば
+     *          1枚の転送中にもう1枚を合成できる。beginTransfer()〜endTransfer()の間で呼び出すこと
+     */
+    void pushBand(M5Canvas &band, int32_t y);
+
+    /**
+     * @brief パネルへの連続した転送を開始（SPIバスを確保）
+     */
+    void beginTransfer();
+
+    /**
+     * @brief DMA転送の完了を待ち、SPIバスを解放
+     */
+    void endTransfer();
+
+    // 文字の設定
+    void setFont(const lgfx::IFont *font);
+    void setTextColor(uint16_t color);
+    void setTextColor(uint16_t color, uint16_t background);
+    void setTextDatum(uint8_t datum);
+    void setTextSize(float size);
+    int32_t textWidth(const String &text, const lgfx::IFont *font);
+
+    /**
+     * @brief 集計値を取得
+     */
+    const RenderCounters &counters() const { return stats; }
+
+    /**
+     * @brief 集計値をリセット
+     */
+    void resetCounters() { stats = RenderCounters(); }
+
+private:
+    lgfx::LovyanGFX &gfx();
+    void count(uint32_t pixels, uint32_t windows);
+    void countText(const char *text, int32_t width, int32_t height);
+
+    RenderCounters stats;
+    M5Canvas *band = nullptr;  // 合成中のバンド（nullptrは画面に直接描画）
+    int32_t bandY = 0;         // 合成中のバンドの上端のY座標
+};
+
+// 画面の描画先（rendertarget.cppで定義）
+extern RenderTarget Screen;
+
+/**
+ * @brief フレームバッファのCRC32を計算
+ * @return CRC32値（ヘッドレス描画でない場合は0）
+ * @details 画素はLGFX_Spriteのバッファのまま（RGB565は上位バイトが先）で計算する
+ */
+uint32_t renderTargetChecksum();
+
+/**
+ * @brief フレームバッファをゴールデン画像と比較
+ * @param name 比較する画面の名前（ログ用）
+ * @param path ゴールデン画像（dumpRenderTarget()で書き出したPPM、ホストではファイルのパス、実機ではSDカードのパス）
+ * @return 全画素が一致した場合true（画像を読めない場合、ヘッドレス描画でない場合はfalse）
+ * @details 不一致の画素数と範囲、CRC32、集計値をシリアルに出力する
+ */
+bool checkRenderGolden(const char *name, const char *path);
+
+/**
+ * @brief フレームバッファをPPM画像（P6）に書き出し
+ * @param path 書き出し先（ホストではファイルのパス、実機ではSDカードのパス）
+ * @return 成功時true（ヘッドレス描画でない場合はfalse）
+ */
+bool dumpRenderTarget(const char *path);
+
+#endif // RENDERTARGET_H
@@ -0,0 +1,285 @@
+/**
+ * @file scheduler.cpp
+ * @brief 階層タイマーホイールによる周期処理スケジューラの実装
+ * @details 3段のホイール（各64スロット）で期限を管理する。
+ *          レベル0: 10ms刻み（〜640ms）、レベル1: 640ms刻み（〜41秒）、レベル2: 41秒刻み（〜44分）。
+ *          上位レベルのスロットは下位レベルが一周するたびに下位へ再配置（カスケード）される
+ */
+
+#include "scheduler.h"
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+// ホイール構成
+#define WHEEL_LEVELS 3
+#define WHEEL_SLOT_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_SLOT_BITS)   // 64
+#define WHEEL_SLOT_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_READY_LEVEL WHEEL_LEVELS         // 期限到来済みリスト
+
+// レベルごとの表現可能範囲（ティック数）
+static const uint32_t LEVEL_SPAN[WHEEL_LEVELS] = {
+    (uint32_t)1 << WHEEL_SLOT_BITS,            // 64
+    (uint32_t)1 << (WHEEL_SLOT_BITS * 2),      // 4096
+    (uint32_t)1 << (WHEEL_SLOT_BITS * 3)       // 262144
+};
+
+/**
+ * @brief タイマー管理情報
+ */
+struct SchedulerTimer {
+    const char *name;           // タイマー名
+    SchedulerCallback callback; // コールバック
+    void *arg;                  // ユーザー引数
+    uint32_t deadlineTick;      // 期限（ティック）
+    uint32_t periodTicks;       // 周期（ティック、0はワンショット）
+    bool active;                // 動作中フラグ
+    int8_t next;                // 同一スロット内の次のタイマー（-1は終端）
+    uint8_t level;              // 所属レベル（WHEEL_READY_LEVELは期限到来済み）
+    uint8_t slot;               // 所属スロット
+};
+
+static SchedulerTimer timers[SCHEDULER_MAX_TIMERS];
+static int timerCount = 0;
+
+// ホイール本体（各スロットはタイマーIDの単方向リスト）
+static int8_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static int8_t readyHead = -1;
+static bool wheelInitialized = false;
+
+// 現在ティックと、ティックに換算済みの時刻
+static uint32_t currentTick = 0;
+static unsigned long lastAdvanceMillis = 0;
+
+/**
+ * @brief ホイールを初期化（初回のタイマー登録時に実行）
+ */
+static void initWheel() {
+    for (int level = 0; level < WHEEL_LEVELS; level++) {
+        for (int slot = 0; slot < WHEEL_SLOTS; slot++) {
+            wheel[level][slot] = -1;
+        }
+    }
+    readyHead = -1;
+    currentTick = 0;
+    lastAdvanceMillis = millis();
+    wheelInitialized = true;
+}
+
+/**
+ * @brief ミリ秒をティックに変換（切り上げ、期限より早く発火しないようにする）
+ */
+static uint32_t msToTicks(unsigned long ms) {
+    return (uint32_t)((ms + SCHEDULER_TICK_MS - 1) / SCHEDULER_TICK_MS);
+}
+
+/**
+ * @brief タイマーを期限に応じたスロットへ挿入
+ * @param id タイマーID
+ */
+static void insertTimer(int id) {
+    SchedulerTimer &t = timers[id];
+    int32_t delta = (int32_t)(t.deadlineTick - currentTick);
+
+    int8_t *head;
+    if (delta <= 0) {
+        t.level = WHEEL_READY_LEVEL;
+        t.slot = 0;
+        head = &readyHead;
+    } else {
+        uint32_t deadline = t.deadlineTick;
+        if ((uint32_t)delta >= LEVEL_SPAN[WHEEL_LEVELS - 1]) {
+            // 範囲外は最上位レベルの最遠スロットに置き、カスケード時に再評価
+            deadline = currentTick + LEVEL_SPAN[WHEEL_LEVELS - 1] - 1;
+            delta = (int32_t)(LEVEL_SPAN[WHEEL_LEVELS - 1] - 1);
+        }
+        uint8_t level = 0;
+        while (level < WHEEL_LEVELS - 1 && (uint32_t)delta >= LEVEL_SPAN[level]) {
+            level++;
+        }
+        t.level = level;
+        t.slot = (deadline >> (WHEEL_SLOT_BITS * level)) & WHEEL_SLOT_MASK;
+        head = &wheel[level][t.slot];
+    }
+
+    t.next = *head;
+    *head = (int8_t)id;
+}
+
+/**
+ * @brief タイマーを所属スロットから取り外す
+ * @param id タイマーID
+ */
+static void unlinkTimer(int id) {
+    SchedulerTimer &t = timers[id];
+    int8_t *link = (t.level == WHEEL_READY_LEVEL) ? &readyHead : &wheel[t.level][t.slot];
+    while (*link != -1) {
+        if (*link == id) {
+            *link = t.next;
+            t.next = -1;
+            return;
+        }
+        link = &timers[*link].next;
+    }
+}
+
+/**
+ * @brief 上位レベルのスロットを下位レベルへ再配置
+ * @param level レベル（1以上）
+ * @param slot スロット
+ */
+static void cascade(int level, int slot) {
+    int8_t id = wheel[level][slot];
+    wheel[level][slot] = -1;
+    while (id != -1) {
+        int8_t next = timers[id].next;
+        insertTimer(id);
+        id = next;
+    }
+}
+
+/**
+ * @brief ホイールを1ティック進め、期限到来したタイマーを到来済みリストへ移動
+ */
+static void stepWheel() {
+    currentTick++;
+
+    uint32_t index0 = currentTick & WHEEL_SLOT_MASK;
+    if (index0 == 0) {
+        uint32_t index1 = (currentTick >> WHEEL_SLOT_BITS) & WHEEL_SLOT_MASK;
+        if (index1 == 0) {
+            cascade(2, (currentTick >> (WHEEL_SLOT_BITS * 2)) & WHEEL_SLOT_MASK);
+        }
+        cascade(1, index1);
+    }
+
+    int8_t id = wheel[0][index0];
+    wheel[0][index0] = -1;
+    while (id != -1) {
+        int8_t next = timers[id].next;
+        insertTimer(id);  // 期限到来済みなら到来済みリストへ、未到来なら再配置
+        id = next;
+    }
+}
+
+int schedulerCreateTimer(const char *name, SchedulerCallback callback, void *arg) {
+    if (!wheelInitialized) {
+        initWheel();
+    }
+    if (timerCount >= SCHEDULER_MAX_TIMERS) {
+        consoleLog("[Scheduler] タイマー登録数超過: " + String(name));
+        return SCHEDULER_INVALID_TIMER;
+    }
+
+    int id = timerCount++;
+    SchedulerTimer &t = timers[id];
+    t.name = name;
+    t.callback = callback;
+    t.arg = arg;
+    t.deadlineTick = 0;
+    t.periodTicks = 0;
+    t.active = false;
+    t.next = -1;
+    t.level = 0;
+    t.slot = 0;
+    return id;
+}
+
+void schedulerStart(int id, unsigned long delayMs, unsigned long periodMs) {
+    if (id < 0 || id >= timerCount) {
+        return;
+    }
+    SchedulerTimer &t = timers[id];
+    if (t.active) {
+        unlinkTimer(id);
+    }
+
+    // 前回のティック換算以降の端数を考慮して期限を計算
+    unsigned long pendingMs = millis() - lastAdvanceMillis;
+    t.deadlineTick = currentTick + msToTicks(delayMs + pendingMs);
+    t.periodTicks = msToTicks(periodMs);
+    if (periodMs > 0 && t.periodTicks == 0) {
+        t.periodTicks = 1;
+    }
+    t.active = true;
+    insertTimer(id);
+}
+
+void schedulerStop(int id) {
+    if (id < 0 || id >= timerCount) {
+        return;
+    }
+    SchedulerTimer &t = timers[id];
+    if (t.active) {
+        unlinkTimer(id);
+        t.active = false;
+    }
+}
+
+bool schedulerIsActive(int id) {
+    if (id < 0 || id >= timerCount) {
+        return false;
+    }
+    return timers[id].active;
+}
+
+void schedulerRun() {
+    if (!wheelInitialized) {
+        return;
+    }
+
+    // 経過時間分だけホイールを進める
+    unsigned long now = millis();
+    uint32_t elapsedTicks = (now - lastAdvanceMillis) / SCHEDULER_TICK_MS;
+    lastAdvanceMillis += elapsedTicks * SCHEDULER_TICK_MS;
+    while (elapsedTicks-- > 0) {
+        stepWheel();
+    }
+
+    // 期限到来済みのタイマーを実行
+    while (readyHead != -1) {
+        int id = readyHead;
+        SchedulerTimer &t = timers[id];
+        readyHead = t.next;
+        t.next = -1;
+
+        if (t.periodTicks > 0) {
+            // 周期タイマー: 期限基準で再設定（ドリフトなし）、取りこぼし分はスキップ
+            t.deadlineTick += t.periodTicks;
+            if ((int32_t)(t.deadlineTick - currentTick) <= 0) {
+                t.deadlineTick = currentTick + t.periodTicks;
+            }
+            insertTimer(id);
+        } else {
+            t.active = false;
+        }
+
+        // コールバック内でのschedulerStart()/schedulerStop()は安全
+        t.callback(t.arg);
+    }
+}
+
+unsigned long schedulerTimeUntilNext(unsigned long maxMs) {
+    if (readyHead != -1) {
+        return 0;
+    }
+
+    unsigned long pendingMs = millis() - lastAdvanceMillis;
+    unsigned long result = maxMs;
+    for (int id = 0; id < timerCount; id++) {
+        const SchedulerTimer &t = timers[id];
+        if (!t.active) {
+            continue;
+        }
+        int32_t deltaTicks = (int32_t)(t.deadlineTick - currentTick);
+        long remaining = (long)deltaTicks * SCHEDULER_TICK_MS - (long)pendingMs;
+        if (remaining <= 0) {
+            return 0;
+        }
+        if ((unsigned long)remaining < result) {
+            result = (unsigned long)remaining;
+        }
+    }
+    return result;
+}
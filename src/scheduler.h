@@ -0,0 +1,66 @@
+/**
+ * @file scheduler.h
+ * @brief 階層タイマーホイールによる周期処理スケジューラ
+ * @details 各モジュールは期限（ワンショット/周期）を登録し、loop()は期限到来分のみを実行する。
+ *          次の期限までの時間はschedulerTimeUntilNext()で取得し、loop()のアイドル待機に使用する
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+// スケジューラ設定
+#define SCHEDULER_MAX_TIMERS 24    // 登録可能なタイマー数
+#define SCHEDULER_TICK_MS 10       // ホイールの刻み（ミリ秒）
+#define SCHEDULER_INVALID_TIMER -1 // 無効なタイマーID
+
+/**
+ * @brief タイマー期限到来時のコールバック
+ * @param arg 登録時に指定したユーザー引数
+ */
+typedef void (*SchedulerCallback)(void *arg);
+
+/**
+ * @brief タイマーを登録（停止状態で作成）
+ * @param name タイマー名（ログ用、静的文字列）
+ * @param callback 期限到来時のコールバック
+ * @param arg コールバックに渡すユーザー引数
+ * @return タイマーID、登録数超過時はSCHEDULER_INVALID_TIMER
+ */
+int schedulerCreateTimer(const char *name, SchedulerCallback callback, void *arg = nullptr);
+
+/**
+ * @brief タイマーを開始（動作中の場合は期限を再設定）
+ * @param id タイマーID
+ * @param delayMs 初回期限までの時間（ミリ秒、0は次回のschedulerRun()で実行）
+ * @param periodMs 周期（ミリ秒、0はワンショット）
+ */
+void schedulerStart(int id, unsigned long delayMs, unsigned long periodMs = 0);
+
+/**
+ * @brief タイマーを停止
+ * @param id タイマーID
+ */
+void schedulerStop(int id);
+
+/**
+ * @brief タイマーが動作中かを判定
+ * @param id タイマーID
+ * @return 動作中ならtrue
+ */
+bool schedulerIsActive(int id);
+
+/**
+ * @brief 期限到来したタイマーのコールバックを実行（loop()から毎回呼び出し）
+ */
+void schedulerRun();
+
+/**
+ * @brief 次の期限までの時間を取得
+ * @param maxMs 上限値（ミリ秒）
+ * @return 次の期限までのミリ秒（期限到来済みは0、動作中タイマーなしはmaxMs）
+ */
+unsigned long schedulerTimeUntilNext(unsigned long maxMs);
+
+#endif // SCHEDULER_H
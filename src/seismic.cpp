@@ -0,0 +1,404 @@
+/**
+ * @file seismic.cpp
+ * @brief 内蔵IMUによる揺れ検知の実装
+ * @details 演算は全て整数（加速度はmgのQ12固定小数点）で行う。
+ *          1. 各軸に1次の高域通過フィルタ（約0.5Hz）をかけ、重力と姿勢の変化を除去
+ *          2. 3軸の絶対値和を特性関数とし、STA/LTAを指数移動平均（シフト演算）で更新
+ *          3. STA/LTA比がSEISMIC_TRIGGER_ON_Q8を超え、かつSTAが下限以上でトリガー開始、
+ *             SEISMIC_TRIGGER_OFF_Q8を下回ったら終了（トリガー中はLTAを凍結）
+ *          サンプリングタスクは判定結果を共有領域に置くだけで、通知はloop()側で行う
+ */
+
+#include "seismic.h"
+#include <M5Unified.h>
+#include "earthquake.h"
+#include "notification.h"
+#include "instrumental.h"
+#include "waveform.h"
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+static const int32_t ACCEL_CLIP_MG = 8000;       // 入力のクリップ値（mg、IMUのフルスケール±8g）
+static const int FIXED_SHIFT = 12;               // 固定小数点の小数部ビット数（Q12）
+static const int32_t HIGHPASS_COEF_Q15 = 31740;  // 高域通過フィルタ係数（1 - 2π×0.5Hz/100Hz、Q15）
+static const uint32_t SAMPLE_PERIOD_MS = 1000 / SEISMIC_SAMPLE_RATE_HZ;
+static const uint32_t WARMUP_SAMPLES = (uint32_t)1 << SEISMIC_LTA_SHIFT;  // LTAが安定するまでの判定停止期間
+static const int32_t LTA_FLOOR = (int32_t)1 << FIXED_SHIFT;  // LTAの下限（1mg、静穏時の比の発散防止）
+static_assert((SEISMIC_RING_SAMPLES & (SEISMIC_RING_SAMPLES - 1)) == 0, "SEISMIC_RING_SAMPLES must be a power of two");
+
+/**
+ * @brief 最大加速度（gal）から震度を推定するための目安
+ * @details 計測震度とは周期特性が異なるため、通知の重要度付け用の概算
+ */
+struct PgaIntensity {
+    uint16_t minGal;      // 下限（gal）
+    Intensity intensity;  // 震度
+};
+static constexpr PgaIntensity PGA_INTENSITY_TABLE[] = {
+    {400, Intensity::Int7},
+    {315, Intensity::Int6Upper},
+    {250, Intensity::Int6Lower},
+    {140, Intensity::Int5Upper},
+    {80, Intensity::Int5Lower},
+    {25, Intensity::Int4},
+    {8, Intensity::Int3},
+    {3, Intensity::Int2},
+};
+
+// 生データのリングバッファ（サンプリングタスクのみが書き込む）
+static SeismicSample ring[SEISMIC_RING_SAMPLES];
+static volatile uint32_t ringWriteCount = 0;
+
+// フィルタ・トリガーの状態（サンプリングタスク専用）
+static int32_t highpassPrevIn[3];
+static int32_t highpassOut[3];
+static int32_t sta = 0;
+static int32_t lta = 0;
+static bool triggered = false;
+static int64_t peakSquared = 0;        // トリガー中の最大加速度の2乗（Q12²）
+
+/**
+ * @brief サンプリングタスクからloop()へ渡すトリガー状態
+ */
+struct SeismicEvent {
+    uint32_t sequence;          // トリガー開始ごとに増加（0は未トリガー）
+    uint32_t onsetMillis;       // トリガー開始時刻（millis）
+    uint32_t onsetSample;       // トリガー開始サンプルの通し番号（波形記録の基準）
+    uint32_t peakGal10;         // 最大加速度（0.1gal単位）
+    uint32_t ratioQ8;           // トリガー開始時のSTA/LTA比（Q8）
+    bool active;                // トリガー中
+};
+static SeismicEvent sharedEvent;
+static portMUX_TYPE eventMux = portMUX_INITIALIZER_UNLOCKED;
+
+// loop()側の通知状態
+static uint32_t notifiedSequence = 0;                    // 通知済みのトリガー番号
+static Intensity notifiedIntensity = Intensity::Unknown; // 通知済みの推定震度
+static unsigned long lastTriggerEndMillis = 0;           // 前回のトリガー終了時刻（millis）
+static bool lastActive = false;                          // 前回確認時のトリガー状態
+
+// 統計（サンプリングタスクが更新、ログ出力時に読み取り）
+static SeismicStats stats;
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+// 内部I2Cバスの排他（RTCとIMUは同じバスに接続される）
+static SemaphoreHandle_t busMutex = nullptr;
+static bool seismicRunning = false;
+
+void lockInternalBus() {
+    if (busMutex != nullptr) {
+        xSemaphoreTake(busMutex, portMAX_DELAY);
+    }
+}
+
+void unlockInternalBus() {
+    if (busMutex != nullptr) {
+        xSemaphoreGive(busMutex);
+    }
+}
+
+/**
+ * @brief 加速度（g）をクリップ済みのmgに変換
+ */
+static int32_t toMilliG(float g) {
+    int32_t mg = (int32_t)(g * 1000.0f);
+    if (mg > ACCEL_CLIP_MG) {
+        return ACCEL_CLIP_MG;
+    }
+    if (mg < -ACCEL_CLIP_MG) {
+        return -ACCEL_CLIP_MG;
+    }
+    return mg;
+}
+
+/**
+ * @brief 整数の平方根（最大加速度の算出用、最大値の更新時のみ使用）
+ */
+static uint32_t isqrt64(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+/**
+ * @brief 1サンプルを処理（フィルタ、STA/LTA更新、トリガー判定）
+ * @param mg 3軸加速度（mg）
+ */
+static void processSample(const int32_t mg[3]) {
+    // 高域通過フィルタ: y[n] = x[n] - x[n-1] + a × y[n-1]
+    int32_t characteristic = 0;
+    int64_t magnitudeSquared = 0;
+    for (int axis = 0; axis < 3; axis++) {
+        int32_t in = mg[axis] << FIXED_SHIFT;
+        int32_t out = in - highpassPrevIn[axis] + (int32_t)(((int64_t)HIGHPASS_COEF_Q15 * highpassOut[axis]) >> 15);
+        highpassPrevIn[axis] = in;
+        highpassOut[axis] = out;
+        characteristic += (out < 0) ? -out : out;
+        magnitudeSquared += (int64_t)out * out;
+    }
+
+    // STA/LTA（指数移動平均、トリガー中はLTAを凍結して揺れに追従させない）
+    sta += (characteristic - sta) >> SEISMIC_STA_SHIFT;
+    if (!triggered) {
+        lta += (characteristic - lta) >> SEISMIC_LTA_SHIFT;
+    }
+    int32_t ltaForRatio = (lta > LTA_FLOOR) ? lta : LTA_FLOOR;
+
+    if (ringWriteCount < WARMUP_SAMPLES) {
+        return;
+    }
+
+    if (!triggered) {
+        if ((int64_t)sta * 256 <= (int64_t)ltaForRatio * SEISMIC_TRIGGER_ON_Q8 ||
+            sta <= ((int32_t)SEISMIC_MIN_STA_MG << FIXED_SHIFT)) {
+            return;
+        }
+        triggered = true;
+        peakSquared = 0;
+        portENTER_CRITICAL(&eventMux);
+        sharedEvent.sequence++;
+        sharedEvent.onsetMillis = millis();
+        sharedEvent.onsetSample = ringWriteCount;
+        sharedEvent.ratioQ8 = (uint32_t)(((int64_t)sta * 256) / ltaForRatio);
+        sharedEvent.peakGal10 = 0;
+        sharedEvent.active = true;
+        portEXIT_CRITICAL(&eventMux);
+        portENTER_CRITICAL(&statsMux);
+        stats.triggers++;
+        portEXIT_CRITICAL(&statsMux);
+    } else if ((int64_t)sta * 256 < (int64_t)ltaForRatio * SEISMIC_TRIGGER_OFF_Q8) {
+        triggered = false;
+        portENTER_CRITICAL(&eventMux);
+        sharedEvent.active = false;
+        portEXIT_CRITICAL(&eventMux);
+        return;
+    }
+
+    // トリガー中は最大加速度を更新（mg → 0.1gal: ×9.80665）
+    if (magnitudeSquared > peakSquared) {
+        peakSquared = magnitudeSquared;
+        uint32_t peakMilliG = isqrt64((uint64_t)peakSquared) >> FIXED_SHIFT;
+        uint32_t peakGal10 = (peakMilliG * 98067 + 5000) / 10000;
+        portENTER_CRITICAL(&eventMux);
+        sharedEvent.peakGal10 = peakGal10;
+        portEXIT_CRITICAL(&eventMux);
+    }
+}
+
+void feedSeismicSample(const int32_t mg[3]) {
+    SeismicSample &slot = ring[ringWriteCount & (SEISMIC_RING_SAMPLES - 1)];
+    slot.x = (int16_t)mg[0];
+    slot.y = (int16_t)mg[1];
+    slot.z = (int16_t)mg[2];
+    processSample(mg);
+    captureWaveformSample(ringWriteCount, slot);
+    ringWriteCount = ringWriteCount + 1;
+}
+
+/**
+ * @brief IMUサンプリングタスク（コア0で実行）
+ * @param param 未使用
+ * @details vTaskDelayUntil()で周期を保ち、読み取りから判定までを1周期内で完了する
+ */
+static void seismicTask(void *param) {
+    TickType_t lastWake = xTaskGetTickCount();
+    const TickType_t period = pdMS_TO_TICKS(SAMPLE_PERIOD_MS);
+
+    for (;;) {
+        vTaskDelayUntil(&lastWake, period);
+
+        // 周期を1回以上取りこぼした場合は計数（vTaskDelayUntil()は遅れを詰めて追いつく）
+        bool overrun = (xTaskGetTickCount() - lastWake) >= period;
+
+        unsigned long startMicros = micros();
+        float ax;
+        float ay;
+        float az;
+        lockInternalBus();
+        bool ok = M5.Imu.getAccel(&ax, &ay, &az);
+        unlockInternalBus();
+        if (!ok) {
+            portENTER_CRITICAL(&statsMux);
+            stats.readFailures++;
+            portEXIT_CRITICAL(&statsMux);
+            continue;
+        }
+
+        int32_t mg[3] = {toMilliG(ax), toMilliG(ay), toMilliG(az)};
+        feedSeismicSample(mg);
+
+        uint32_t elapsed = micros() - startMicros;
+        portENTER_CRITICAL(&statsMux);
+        stats.samples++;
+        stats.processMicrosTotal += elapsed;
+        if (elapsed > stats.processMicrosMax) {
+            stats.processMicrosMax = elapsed;
+        }
+        if (overrun) {
+            stats.overruns++;
+        }
+        portEXIT_CRITICAL(&statsMux);
+    }
+}
+
+bool initSeismic() {
+#if SEISMIC_ENABLED
+    if (!M5.Imu.isEnabled()) {
+        consoleLog("[Seismic] IMUなし、揺れ検知は無効");
+        return false;
+    }
+
+    busMutex = xSemaphoreCreateMutex();
+    if (busMutex == nullptr) {
+        consoleLog("[Seismic] ミューテックス作成失敗");
+        return false;
+    }
+    if (xTaskCreatePinnedToCore(seismicTask, "seismic", SEISMIC_TASK_STACK_SIZE, nullptr,
+                                SEISMIC_TASK_PRIORITY, nullptr, SEISMIC_TASK_CORE) != pdPASS) {
+        consoleLog("[Seismic] サンプリングタスクの作成失敗");
+        return false;
+    }
+    seismicRunning = true;
+    consoleLog("[Seismic] 揺れ検知開始: " + String(SEISMIC_SAMPLE_RATE_HZ) + "Hz, STA/LTA=" +
+               String(SEISMIC_TRIGGER_ON_Q8 / 256.0f, 1) + " (LTA安定まで約" +
+               String(WARMUP_SAMPLES / SEISMIC_SAMPLE_RATE_HZ) + "秒)");
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief 最大加速度から震度を推定
+ * @param peakGal10 最大加速度（0.1gal単位）
+ * @return 推定震度（震度1未満も震度1とする）
+ */
+static Intensity estimateIntensity(uint32_t peakGal10) {
+    for (const PgaIntensity &entry : PGA_INTENSITY_TABLE) {
+        if (peakGal10 >= (uint32_t)entry.minGal * 10) {
+            return entry.intensity;
+        }
+    }
+    return Intensity::Int1;
+}
+
+void updateSeismic() {
+    if (!seismicRunning) {
+        return;
+    }
+
+    portENTER_CRITICAL(&eventMux);
+    SeismicEvent event = sharedEvent;
+    portEXIT_CRITICAL(&eventMux);
+
+    if (lastActive && !event.active) {
+        lastTriggerEndMillis = millis();
+    }
+    lastActive = event.active;
+    if (event.sequence == 0 || event.peakGal10 == 0) {
+        return;
+    }
+
+    // トリガー直後は最大加速度からの概算、計測震度の計算後（約1秒後）はその震度階級を使用
+    Intensity intensity = estimateIntensity(event.peakGal10);
+    float measured;
+    if (getInstrumentalSince(event.onsetMillis, measured) && intensityFromInstrumental(measured) != Intensity::Unknown) {
+        intensity = intensityFromInstrumental(measured);
+    }
+    bool newTrigger = event.sequence != notifiedSequence;
+    if (newTrigger) {
+        // 波形を記録（記録中なら終了位置を延長、再トリガーも揺れの継続として記録する）
+        captureLocalWaveform(event.onsetSample);
+
+        // 前回の揺れの終了直後の再トリガーは通知しない（揺れの継続とみなす）
+        if (notifiedSequence != 0 && millis() - lastTriggerEndMillis < SEISMIC_REARM_MS) {
+            notifiedSequence = event.sequence;
+            notifiedIntensity = intensity;
+            consoleLog("[Seismic] 再トリガー（通知間隔内のため通知なし）");
+            return;
+        }
+    } else if (!event.active || intensityRank(intensity) <= intensityRank(notifiedIntensity)) {
+        return;
+    }
+
+    notifiedSequence = event.sequence;
+    notifiedIntensity = intensity;
+
+    EarthquakeData data;
+    data.hypocenterName = "揺れ検知";
+    data.originTime = time(nullptr);
+    data.latitude = 0;
+    data.longitude = 0;
+    data.depth = 0;
+    data.magnitude = 0;
+    data.maxIntensity = intensity;
+    data.hasSiteEstimate = true;  // 設置場所で実測した震度
+    data.siteIntensity = intensity;
+    data.tsunami = "None";
+
+    consoleLog("[Seismic] " + String(newTrigger ? "トリガー" : "推定震度上昇") + ": 最大" +
+               String(event.peakGal10 / 10.0f, 1) + "gal, 推定震度" + intensityLabel(intensity) + ", STA/LTA=" +
+               String(event.ratioQ8 / 256.0f, 1) + " (開始から" + String(millis() - event.onsetMillis) + "ms)");
+    notifyLocalShake(data);
+}
+
+uint32_t copyRecentSamples(SeismicSample *out, uint32_t count) {
+    uint32_t end = ringWriteCount;
+    if (count > SEISMIC_RING_SAMPLES || end < count) {
+        return 0;
+    }
+    // 古い順にコピー（上書きされ得るのは最古のサンプルのみ）
+    uint32_t start = end - count;
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = ring[(start + i) & (SEISMIC_RING_SAMPLES - 1)];
+    }
+    return end;
+}
+
+bool copySamples(uint32_t first, SeismicSample *out, uint32_t count) {
+    uint32_t end = ringWriteCount;
+    if (end - first < count || end - first > SEISMIC_RING_SAMPLES) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = ring[(first + i) & (SEISMIC_RING_SAMPLES - 1)];
+    }
+    // コピー中に先頭のサンプルが上書きされていないかを確認（通し番号first+SEISMIC_RING_SAMPLESの書き込みで上書き）
+    return ringWriteCount - first < SEISMIC_RING_SAMPLES;
+}
+
+uint32_t getSampleCount() {
+    return ringWriteCount;
+}
+
+void logSeismicStats() {
+    if (!seismicRunning) {
+        return;
+    }
+    portENTER_CRITICAL(&statsMux);
+    SeismicStats snapshot = stats;
+    stats = SeismicStats();
+    portEXIT_CRITICAL(&statsMux);
+
+    if (snapshot.samples == 0) {
+        consoleLog("[Seismic] サンプルなし (読み取り失敗" + String(snapshot.readFailures) + "回)");
+        return;
+    }
+    consoleLog("[Seismic] サンプル" + String(snapshot.samples) + "件, 処理平均" +
+               String(snapshot.processMicrosTotal / snapshot.samples) + "us, 最大" +
+               String(snapshot.processMicrosMax) + "us, 周期超過" + String(snapshot.overruns) + "回, 読み取り失敗" +
+               String(snapshot.readFailures) + "回, トリガー" + String(snapshot.triggers) + "回");
+}
@@ -0,0 +1,112 @@
+/**
+ * @file seismic.h
+ * @brief 内蔵IMUによる揺れ検知（STA/LTAトリガー）
+ * @details 専用タスク（コア0）が加速度を一定周期でサンプリングし、固定小数点の高域通過フィルタと
+ *          STA/LTA（短時間平均/長時間平均）比でトリガーを判定する。トリガー時はloop()側で
+ *          通知キューへ「揺れ検知」を投入する。処理は全て静的領域で行い、ヒープ確保はしない
+ */
+
+#ifndef SEISMIC_H
+#define SEISMIC_H
+
+#include <Arduino.h>
+
+// 揺れ検知の有効/無効（falseでIMUを使用しない）
+#define SEISMIC_ENABLED true
+
+// サンプリング設定
+#define SEISMIC_SAMPLE_RATE_HZ 100       // サンプリング周波数（Hz）
+#define SEISMIC_RING_SAMPLES 512         // 生データのリングバッファ長（約5秒分、2のべき乗、計測震度の窓長）
+#define SEISMIC_TASK_STACK_SIZE 3072     // サンプリングタスクのスタックサイズ
+#define SEISMIC_TASK_PRIORITY 3          // サンプリングタスクの優先度（REST API取得タスクより高い）
+#define SEISMIC_TASK_CORE 0              // サンプリングタスクの実行コア（loop()はコア1）
+
+// トリガー設定
+#define SEISMIC_STA_SHIFT 5              // STAの時定数（2^5サンプル = 0.32秒）
+#define SEISMIC_LTA_SHIFT 10             // LTAの時定数（2^10サンプル = 約10秒）
+#define SEISMIC_TRIGGER_ON_Q8 (3 * 256)  // トリガー開始のSTA/LTA比（Q8、3.0）
+#define SEISMIC_TRIGGER_OFF_Q8 (3 * 128) // トリガー終了のSTA/LTA比（Q8、1.5）
+#define SEISMIC_MIN_STA_MG 4             // トリガーに必要なSTAの下限（mg、机上の微振動を除外）
+#define SEISMIC_REARM_MS 10000           // トリガー終了から次の通知までの最小間隔（ミリ秒）
+
+/**
+ * @brief 1サンプル分の生加速度（リングバッファの要素）
+ */
+struct SeismicSample {
+    int16_t x;  // X軸加速度（mg）
+    int16_t y;  // Y軸加速度（mg）
+    int16_t z;  // Z軸加速度（mg）
+};
+
+/**
+ * @brief サンプリング・トリガー処理の統計
+ */
+struct SeismicStats {
+    uint32_t samples;            // 処理したサンプル数
+    uint32_t overruns;           // サンプリング周期に間に合わなかった回数
+    uint32_t readFailures;       // IMU読み取り失敗回数
+    uint32_t processMicrosTotal; // 読み取り+フィルタ+トリガー判定の累積時間（マイクロ秒）
+    uint32_t processMicrosMax;   // 同最大時間（マイクロ秒）
+    uint32_t triggers;           // トリガー回数
+};
+
+/**
+ * @brief 揺れ検知を開始（M5.begin()の後に1回呼び出し）
+ * @return サンプリングタスクを開始した場合true（IMUなし、無効設定時はfalse）
+ */
+bool initSeismic();
+
+/**
+ * @brief トリガーを確認し、揺れ検知を通知（loop()から毎回呼び出し）
+ * @details トリガー開始時と、揺れの最大加速度から推定した震度が上がった時に通知する
+ */
+void updateSeismic();
+
+/**
+ * @brief 1サンプルを取り込む（リングバッファへの格納、フィルタ、トリガー判定、波形記録）
+ * @param mg 3軸加速度（mg、±8000にクリップ済み）
+ * @details サンプリングタスクがIMUの読み取りごとに呼び出す。ホストテストは記録した波形を直接入力する
+ */
+void feedSeismicSample(const int32_t mg[3]);
+
+/**
+ * @brief 処理統計をログ出力してリセット
+ */
+void logSeismicStats();
+
+/**
+ * @brief リングバッファから直近のサンプルをコピー（計測震度の計算などに使用）
+ * @param out 出力先（古い順）
+ * @param count 件数（SEISMIC_RING_SAMPLES以下）
+ * @return コピーした最後のサンプルの通し番号+1（蓄積済みのサンプルがcount未満の場合は0）
+ * @details コピーは数十マイクロ秒で終わるため、サンプリングタスクに上書きされるのは最古の1件のみで、
+ *          その1件もコピー済みである
+ */
+uint32_t copyRecentSamples(SeismicSample *out, uint32_t count);
+
+/**
+ * @brief 通し番号を指定してリングバッファからサンプルをコピー（波形記録のトリガー前部分に使用）
+ * @param first 先頭サンプルの通し番号
+ * @param out 出力先（古い順）
+ * @param count 件数
+ * @return コピーできた場合true（未取得、または上書き済みのサンプルを含む場合はfalse）
+ */
+bool copySamples(uint32_t first, SeismicSample *out, uint32_t count);
+
+/**
+ * @brief これまでに取得したサンプル数（次のサンプルの通し番号）を取得
+ */
+uint32_t getSampleCount();
+
+/**
+ * @brief 内部I2Cバスを排他取得（サンプリングタスク以外からI2Cデバイス（RTCなど）にアクセスする前に呼び出し）
+ * @details 揺れ検知の開始前は何もしない
+ */
+void lockInternalBus();
+
+/**
+ * @brief 内部I2Cバスの排他を解放
+ */
+void unlockInternalBus();
+
+#endif // SEISMIC_H
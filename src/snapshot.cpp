@@ -0,0 +1,226 @@
+/**
+ * @file snapshot.cpp
+ * @brief 地震情報リストのスナップショット保存・復元の実装
+ * @details NVSの1つのblobに「ヘッダー + 固定長レコード×件数」を保存する。
+ *          CRC32はレコード部に対して計算し、内容が前回と同一なら書き込みを省略する
+ */
+
+#include "snapshot.h"
+#include <Preferences.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+// NVS設定
+static const char *SNAPSHOT_NAMESPACE = "snapshot";
+static const char *SNAPSHOT_KEY = "list";
+static const uint32_t SNAPSHOT_MAGIC = 0x534C5145;  // "EQLS"
+static const uint8_t SNAPSHOT_VERSION = 3;           // レコード形式変更時に更新（旧形式は読み捨て）
+
+/**
+ * @brief スナップショットのヘッダー
+ */
+struct SnapshotHeader {
+    uint32_t magic;       // SNAPSHOT_MAGIC
+    uint8_t version;      // SNAPSHOT_VERSION
+    uint8_t count;        // レコード数
+    uint16_t recordSize;  // sizeof(EventRecord)
+    uint32_t crc;         // レコード部のCRC32
+};
+
+// 前回書き込んだ（または読み込んだ）内容のCRC32（同一内容の書き込み省略用）
+static uint32_t lastSavedCrc = 0;
+static bool lastSavedValid = false;
+
+/**
+ * @brief CRC32（IEEE 802.3）を計算
+ * @param data データ
+ * @param length データ長（バイト）
+ * @return CRC32値
+ */
+static uint32_t crc32(const uint8_t *data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief 文字列を固定長フィールドにコピー（UTF-8の文字境界で切り詰め）
+ * @param dest コピー先
+ * @param size コピー先のサイズ（NUL終端を含む）
+ * @param src コピー元
+ */
+static void copyField(char *dest, size_t size, const String &src) {
+    size_t length = src.length();
+    if (length >= size) {
+        length = size - 1;
+        // マルチバイト文字の途中（継続バイト 10xxxxxx）で切れないよう先頭バイトまで戻す
+        while (length > 0 && (src[length] & 0xC0) == 0x80) {
+            length--;
+        }
+    }
+    memcpy(dest, src.c_str(), length);
+    dest[length] = '\0';
+}
+
+/**
+ * @brief 固定長フィールドからNUL終端文字列を取り出し
+ * @param src フィールド
+ * @param size フィールドのサイズ
+ * @return 文字列
+ */
+static String readField(const char *src, size_t size) {
+    char buffer[64];
+    size_t length = strnlen(src, size);
+    if (length >= sizeof(buffer)) {
+        length = sizeof(buffer) - 1;
+    }
+    memcpy(buffer, src, length);
+    buffer[length] = '\0';
+    return String(buffer);
+}
+
+void packEventRecord(const EarthquakeData &data, EventRecord &record) {
+    record.latitude = data.latitude;
+    record.longitude = data.longitude;
+    record.magnitude = data.magnitude;
+    record.depth = (int16_t)data.depth;
+    record.originTime = (uint32_t)data.originTime;
+    record.utcOffsetMinutes = data.utcOffsetMinutes;
+    copyField(record.hypocenterName, sizeof(record.hypocenterName), data.hypocenterName);
+    record.maxIntensity = (uint8_t)data.maxIntensity;
+    copyField(record.tsunami, sizeof(record.tsunami), data.tsunami);
+}
+
+void unpackEventRecord(const EventRecord &record, EarthquakeData &data) {
+    data.latitude = record.latitude;
+    data.longitude = record.longitude;
+    data.magnitude = record.magnitude;
+    data.depth = record.depth;
+    data.datetime = "";  // 元の文字列はログ用のため保存しない
+    data.originTime = (time_t)record.originTime;
+    data.utcOffsetMinutes = record.utcOffsetMinutes;
+    data.hypocenterName = readField(record.hypocenterName, sizeof(record.hypocenterName));
+    data.maxIntensity = (record.maxIntensity < (uint8_t)Intensity::Count) ? (Intensity)record.maxIntensity : Intensity::Unknown;
+    data.tsunami = readField(record.tsunami, sizeof(record.tsunami));
+}
+
+int loadListSnapshot(EarthquakeData *list, int maxCount) {
+    unsigned long startTime = millis();
+
+    Preferences prefs;
+    if (!prefs.begin(SNAPSHOT_NAMESPACE, true)) {
+        consoleLog("[Snapshot] スナップショットなし");
+        return 0;
+    }
+
+    size_t blobSize = prefs.getBytesLength(SNAPSHOT_KEY);
+    if (blobSize < sizeof(SnapshotHeader)) {
+        prefs.end();
+        consoleLog("[Snapshot] スナップショットなし");
+        return 0;
+    }
+
+    SnapshotHeader header;
+    uint8_t *buffer = (uint8_t *)malloc(blobSize);
+    if (buffer == nullptr) {
+        prefs.end();
+        consoleLog("[Snapshot] メモリ確保失敗");
+        return 0;
+    }
+    prefs.getBytes(SNAPSHOT_KEY, buffer, blobSize);
+    prefs.end();
+
+    memcpy(&header, buffer, sizeof(header));
+    size_t recordBytes = (size_t)header.count * sizeof(EventRecord);
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION ||
+        header.recordSize != sizeof(EventRecord) || header.count > SNAPSHOT_MAX_RECORDS ||
+        blobSize != sizeof(header) + recordBytes) {
+        free(buffer);
+        consoleLog("[Snapshot] 形式不一致のため破棄 (version=" + String(header.version) + ")");
+        return 0;
+    }
+
+    const uint8_t *recordData = buffer + sizeof(header);
+    if (crc32(recordData, recordBytes) != header.crc) {
+        free(buffer);
+        consoleLog("[Snapshot] CRC不一致のため破棄");
+        return 0;
+    }
+
+    int count = min((int)header.count, maxCount);
+    for (int i = 0; i < count; i++) {
+        EventRecord r;
+        memcpy(&r, recordData + i * sizeof(EventRecord), sizeof(r));  // 境界整列を仮定せずコピー
+        unpackEventRecord(r, list[i]);
+    }
+    free(buffer);
+
+    lastSavedCrc = header.crc;
+    lastSavedValid = true;
+    consoleLog("[Snapshot] 読み込み完了: " + String(count) + "件 (" + String(millis() - startTime) + "ms)");
+    return count;
+}
+
+bool saveListSnapshot(const EarthquakeData *list, int count) {
+    if (count > SNAPSHOT_MAX_RECORDS) {
+        count = SNAPSHOT_MAX_RECORDS;
+    }
+    if (count < 0) {
+        count = 0;
+    }
+
+    size_t recordBytes = (size_t)count * sizeof(EventRecord);
+    size_t blobSize = sizeof(SnapshotHeader) + recordBytes;
+    uint8_t *buffer = (uint8_t *)calloc(1, blobSize);  // パディングを0にしてCRCを決定的にする
+    if (buffer == nullptr) {
+        consoleLog("[Snapshot] メモリ確保失敗");
+        return false;
+    }
+
+    EventRecord *records = (EventRecord *)(buffer + sizeof(SnapshotHeader));
+    for (int i = 0; i < count; i++) {
+        packEventRecord(list[i], records[i]);
+    }
+
+    SnapshotHeader header;
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.count = (uint8_t)count;
+    header.recordSize = sizeof(EventRecord);
+    header.crc = crc32((const uint8_t *)records, recordBytes);
+
+    // 内容が前回と同一なら書き込みを省略（フラッシュ摩耗対策）
+    if (lastSavedValid && header.crc == lastSavedCrc) {
+        free(buffer);
+        return false;
+    }
+    memcpy(buffer, &header, sizeof(header));
+
+    unsigned long startTime = millis();
+    Preferences prefs;
+    if (!prefs.begin(SNAPSHOT_NAMESPACE, false)) {
+        free(buffer);
+        consoleLog("[Snapshot] NVSオープン失敗");
+        return false;
+    }
+    size_t written = prefs.putBytes(SNAPSHOT_KEY, buffer, blobSize);
+    prefs.end();
+    free(buffer);
+
+    if (written != blobSize) {
+        consoleLog("[Snapshot] 書き込み失敗");
+        return false;
+    }
+
+    lastSavedCrc = header.crc;
+    lastSavedValid = true;
+    consoleLog("[Snapshot] 書き込み完了: " + String(count) + "件, " + String(blobSize) + "bytes (" +
+               String(millis() - startTime) + "ms)");
+    return true;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file snapshot.h
+ * @brief 地震情報リストのスナップショット保存・復元（NVS）
+ * @details 起動直後、WiFi接続前に前回のリストを表示するために使用する。
+ *          固定長のバイナリレコードとCRC32で保存し、破損時は読み捨てる
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <Arduino.h>
+#include "earthquake.h"
+
+// スナップショット設定
+#define SNAPSHOT_MAX_RECORDS 50            // 保存する最大件数（display.cppのMAX_EARTHQUAKE_LISTと同じ値）
+#define SNAPSHOT_MIN_INTERVAL_MS 60000     // 書き込みの最小間隔（ミリ秒、フラッシュ摩耗対策）
+#define SNAPSHOT_SETTLE_MS 5000            // 変更から書き込みまでの待機時間（ミリ秒、連続受信をまとめる）
+
+/**
+ * @brief 地震情報1件分の固定長レコード（スナップショットと履歴ファイルで共通）
+ * @details 文字列はNUL終端、UTF-8の文字境界で切り詰める
+ */
+struct EventRecord {
+    float latitude;            // 緯度（度）
+    float longitude;           // 経度（度）
+    float magnitude;           // マグニチュード
+    uint32_t originTime;       // 発生時刻（UTC、Unix時刻・秒、0は不明）
+    int16_t utcOffsetMinutes;  // 発生時刻のUTCオフセット（分）
+    int16_t depth;             // 深さ（km）
+    char hypocenterName[48];   // 震源地名（UTF-8、全角15文字程度）
+    char tsunami[14];          // 津波情報コード（"MajorWarning"など）
+    uint8_t maxIntensity;      // 最大震度（Intensityの値）
+};
+static_assert(sizeof(EventRecord) == 84, "EventRecord layout changed, bump SNAPSHOT_VERSION and HISTORY_VERSION");
+
+/**
+ * @brief 地震情報を固定長レコードに変換
+ * @param data 地震情報
+ * @param record 出力先（パディングを含め呼び出し側で0初期化しておく）
+ */
+void packEventRecord(const EarthquakeData &data, EventRecord &record);
+
+/**
+ * @brief 固定長レコードを地震情報に変換
+ * @param record レコード
+ * @param data 出力先（datetimeは空文字列になる）
+ */
+void unpackEventRecord(const EventRecord &record, EarthquakeData &data);
+
+/**
+ * @brief スナップショットを読み込み
+ * @param list 出力先の配列（新しい順）
+ * @param maxCount 配列の要素数
+ * @return 読み込んだ件数（スナップショットなし、形式不一致、CRC不一致の場合は0）
+ */
+int loadListSnapshot(EarthquakeData *list, int maxCount);
+
+/**
+ * @brief スナップショットを書き込み
+ * @param list 保存する配列（新しい順）
+ * @param count 件数（SNAPSHOT_MAX_RECORDSを超える分は保存しない）
+ * @return 書き込んだ場合true（内容が前回と同一で書き込みを省略した場合、失敗時はfalse）
+ * @details 書き込み間隔の制御は呼び出し側で行う
+ */
+bool saveListSnapshot(const EarthquakeData *list, int count);
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,329 @@
+/**
+ * @file timesync.cpp
+ * @brief 時刻サービスの実装
+ */
+
+#include "timesync.h"
+#include "scheduler.h"
+#include "seismic.h"
+#include <M5Unified.h>
+#include <Preferences.h>
+#include <time.h>
+#include <sys/time.h>
+#include <esp_sntp.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+// 設定元タイムスタンプの妥当性下限（2024-01-01 00:00:00 UTC、これより前は未設定とみなす）
+static const time_t CLOCK_VALID_MIN = 1704067200;
+
+// 時計の設定元（REST取得タスク・SNTPタスクからも更新されるためvolatile）
+static volatile ClockSource clockSource = ClockSource::None;
+static uint32_t symbolEpoch = SYMBOL_EPOCH_MAINNET;
+static const char *timezoneRule = "JST-9";
+static portMUX_TYPE clockMux = portMUX_INITIALIZER_UNLOCKED;
+
+// RTC補正状態
+static bool rtcAvailable = false;               // RTCが使用可能か
+static bool ntpSyncPending = false;             // RTCへ未反映のNTP同期があるか（SNTPタスクから設定、clockMuxで保護）
+static struct timeval ntpSyncTime;              // 最後のNTP同期で取得した時刻（clockMuxで保護）
+static unsigned long ntpSyncMillis = 0;         // ntpSyncTimeを取得した時点のmillis()（clockMuxで保護）
+static uint32_t rtcLastSet = 0;                 // RTCを最後に書き込んだ時刻（Unix時刻・秒、0は未記録）
+static int32_t rtcDriftPpb = 0;                 // RTCの歩度（ppb）
+static int rtcTimerId = SCHEDULER_INVALID_TIMER;
+
+/**
+ * @brief 暦日からUnix時刻の日数を計算（UTC、タイムゾーン非依存）
+ * @param year 年
+ * @param month 月（1-12）
+ * @param day 日（1-31）
+ * @return 1970-01-01からの日数
+ */
+static long daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    long era = (year >= 0 ? year : year - 399) / 400;
+    long yearOfEra = year - era * 400;
+    long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+/**
+ * @brief 時計を設定元の時刻で初回設定
+ * @param utc UTC時刻（Unix時刻・秒）
+ * @param millisPart ミリ秒部分
+ * @param source 設定元
+ * @return 時計を設定した場合true（設定済み・時刻不正の場合false）
+ */
+static bool seedClock(time_t utc, long millisPart, ClockSource source) {
+    if (utc < CLOCK_VALID_MIN) {
+        return false;
+    }
+
+    // 複数タスクから同時に到着しても最初の1回のみ設定する
+    bool seeded = false;
+    portENTER_CRITICAL(&clockMux);
+    if (clockSource == ClockSource::None) {
+        clockSource = source;
+        seeded = true;
+    }
+    portEXIT_CRITICAL(&clockMux);
+    if (!seeded) {
+        return false;
+    }
+
+    struct timeval tv;
+    tv.tv_sec = utc;
+    tv.tv_usec = millisPart * 1000;
+    settimeofday(&tv, nullptr);
+
+    struct tm timeinfo;
+    char timeStr[32];
+    localtime_r(&utc, &timeinfo);
+    strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", &timeinfo);
+    consoleLog("[Time] 時計設定（" + String(clockSourceName(source)) + "）: " + String(timeStr) +
+               " (" + String(millis()) + "ms)");
+    return true;
+}
+
+/**
+ * @brief SNTP同期完了の通知コールバック（SNTPタスクで実行）
+ * @param tv SNTPで取得した時刻
+ * @details スルー補正モードでは、補正量が大きい場合（約35分超）のみ時計を直接設定する
+ */
+static void onSntpSync(struct timeval *tv) {
+    struct timeval current;
+    gettimeofday(&current, nullptr);
+    long offsetMs = (long)(tv->tv_sec - current.tv_sec) * 1000L +
+                    (long)(tv->tv_usec - current.tv_usec) / 1000L;
+
+    // RTCへの書き戻しはloop()側のタイマーで行う（I2Cをloop()と共有するため）。
+    // スルー補正中のシステム時計はまだNTP時刻に一致しないため、取得時刻と経過時間を渡す
+    portENTER_CRITICAL(&clockMux);
+    ClockSource previous = clockSource;
+    clockSource = ClockSource::Ntp;
+    ntpSyncTime = *tv;
+    ntpSyncMillis = millis();
+    ntpSyncPending = true;
+    portEXIT_CRITICAL(&clockMux);
+
+    consoleLog("[Time] NTP同期（補正前の設定元: " + String(clockSourceName(previous)) +
+               "、差: " + String(offsetMs) + "ms）");
+}
+
+/**
+ * @brief RTCの時刻を読み取り（UTC）
+ * @param utc 読み取った時刻（出力パラメータ、Unix時刻・秒）
+ * @return 読み取り成功時true
+ */
+static bool readRtc(time_t &utc) {
+    m5::rtc_datetime_t dt;
+    if (!M5.Rtc.getDateTime(&dt)) {
+        return false;
+    }
+    utc = makeUtcTime(dt.date.year, dt.date.month, dt.date.date, dt.time.hours, dt.time.minutes, dt.time.seconds);
+    return true;
+}
+
+/**
+ * @brief RTC補正状態をNVSに保存
+ */
+static void saveRtcState() {
+    Preferences prefs;
+    if (!prefs.begin(CLOCK_NAMESPACE, false)) {
+        return;
+    }
+    prefs.putUInt(CLOCK_RTC_SET_KEY, rtcLastSet);
+    prefs.putInt(CLOCK_DRIFT_KEY, rtcDriftPpb);
+    prefs.end();
+}
+
+/**
+ * @brief NTP同期結果をRTCへ書き戻し、歩度を更新（タイマーコールバック）
+ * @param arg 未使用
+ * @details RTCの誤差が1秒未満の場合は書き込まず、前回の書き込みを基準に誤差を蓄積させる
+ *          （1秒分解能のRTCで歩度を測定するため）。
+ *          基準時刻はシステム時計ではなく、NTPの取得時刻に取得後の経過時間を足して求める
+ *          （SNTP_SYNC_MODE_SMOOTHではシステム時計が補正の途中のため）
+ */
+static void onRtcDisciplineTimer(void *arg) {
+    portENTER_CRITICAL(&clockMux);
+    bool pending = ntpSyncPending;
+    struct timeval syncTime = ntpSyncTime;
+    unsigned long syncMillis = ntpSyncMillis;
+    ntpSyncPending = false;
+    portEXIT_CRITICAL(&clockMux);
+    if (!pending) {
+        return;
+    }
+
+    int64_t nowMs = (int64_t)syncTime.tv_sec * 1000 + syncTime.tv_usec / 1000 + (int64_t)(millis() - syncMillis);
+    time_t now = (time_t)(nowMs / 1000);
+    time_t rtcUtc = 0;
+    lockInternalBus();  // IMUのサンプリングタスクとI2Cバスを共有
+    bool rtcValid = !M5.Rtc.getVoltLow() && readRtc(rtcUtc) && rtcLastSet > 0;
+    unlockInternalBus();
+    long errorSec = rtcValid ? (long)(rtcUtc - now) : 0;
+
+    if (rtcValid && errorSec == 0) {
+        return;
+    }
+
+    // 十分な経過時間があれば歩度を更新（前回値との平均で平滑化）
+    long elapsed = (long)(now - (time_t)rtcLastSet);
+    if (rtcValid && elapsed >= RTC_DRIFT_MIN_ELAPSED) {
+        int64_t measured = (int64_t)errorSec * 1000000000LL / elapsed;
+        if (measured > -RTC_DRIFT_MAX_PPB && measured < RTC_DRIFT_MAX_PPB) {
+            rtcDriftPpb = (rtcDriftPpb == 0) ? (int32_t)measured : (int32_t)((rtcDriftPpb + measured) / 2);
+        }
+        consoleLog("[Time] RTC誤差: " + String(errorSec) + "s / " + String(elapsed) + "s (歩度 " +
+                   String(rtcDriftPpb / 1000.0, 1) + "ppm)");
+    }
+
+    struct tm utcTime;
+    gmtime_r(&now, &utcTime);
+    lockInternalBus();
+    M5.Rtc.setDateTime(&utcTime);
+    unlockInternalBus();
+    rtcLastSet = (uint32_t)now;
+    saveRtcState();
+    consoleLog("[Time] RTC更新（NTP同期結果）");
+}
+
+void initClock() {
+    Preferences prefs;
+    String savedTz;
+    if (prefs.begin(CLOCK_NAMESPACE, true)) {
+        savedTz = prefs.getString(CLOCK_TZ_KEY);
+        rtcLastSet = prefs.getUInt(CLOCK_RTC_SET_KEY, 0);
+        rtcDriftPpb = prefs.getInt(CLOCK_DRIFT_KEY, 0);
+        prefs.end();
+    }
+
+    // config.ini読み込み前の表示用に前回のタイムゾーンを反映（initTimeSync()で確定）
+    static char savedTzRule[48];
+    if (savedTz.length() > 0 && savedTz.length() < sizeof(savedTzRule)) {
+        strcpy(savedTzRule, savedTz.c_str());
+        timezoneRule = savedTzRule;
+    }
+    setenv("TZ", timezoneRule, 1);
+    tzset();
+
+    if (!M5.Rtc.isEnabled()) {
+        consoleLog("[Time] RTCなし（ネットワークから時刻取得）");
+        return;
+    }
+    rtcAvailable = true;
+
+    time_t rtcUtc = 0;
+    if (M5.Rtc.getVoltLow() || !readRtc(rtcUtc)) {
+        consoleLog("[Time] RTC時刻無効（電圧低下）");
+        rtcLastSet = 0;  // 次回のNTP同期で書き込み、歩度測定をやり直す
+        return;
+    }
+
+    // 前回の書き込みからの経過時間に歩度を掛けて補正
+    long correction = 0;
+    if (rtcLastSet > 0 && rtcUtc > (time_t)rtcLastSet) {
+        correction = (long)((int64_t)(rtcUtc - (time_t)rtcLastSet) * rtcDriftPpb / 1000000000LL);
+    }
+    if (seedClock(rtcUtc - correction, 0, ClockSource::Rtc) && correction != 0) {
+        consoleLog("[Time] RTC歩度補正: " + String(-correction) + "s");
+    }
+}
+
+void initTimeSync(const char *posixTz, const String &symbolNetwork) {
+    timezoneRule = posixTz;
+    symbolEpoch = symbolNetwork.equalsIgnoreCase("testnet") ? SYMBOL_EPOCH_TESTNET : SYMBOL_EPOCH_MAINNET;
+
+    // 時計設定前でもローカル時刻の変換が正しく行われるようタイムゾーンを先に反映
+    setenv("TZ", posixTz, 1);
+    tzset();
+
+    // 次回起動時のRTC表示用にタイムゾーンを保存（変更時のみ）
+    Preferences prefs;
+    if (prefs.begin(CLOCK_NAMESPACE, false)) {
+        if (prefs.getString(CLOCK_TZ_KEY) != posixTz) {
+            prefs.putString(CLOCK_TZ_KEY, posixTz);
+        }
+        prefs.end();
+    }
+
+    // NTP同期結果をRTCへ書き戻す（SNTPは既定で1時間ごとに再同期）
+    if (rtcAvailable && rtcTimerId == SCHEDULER_INVALID_TIMER) {
+        rtcTimerId = schedulerCreateTimer("rtc", onRtcDisciplineTimer);
+        schedulerStart(rtcTimerId, RTC_DISCIPLINE_INTERVAL, RTC_DISCIPLINE_INTERVAL);
+    }
+
+    // 初回設定後のNTP補正は時刻を飛ばさずにスルーする（相対時刻表示の逆行防止）
+    sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
+    sntp_set_time_sync_notification_cb(onSntpSync);
+}
+
+void beginNTPSync() {
+    consoleLog("Syncing NTP time (background)...");
+
+    // NTP設定（サーバー、POSIX TZ規則）。夏時間の切り替えはlibcが規則に従って行う
+    configTzTime(timezoneRule, NTP_SERVER);
+}
+
+bool seedClockFromSymbolTimestamp(uint64_t networkTimestampMs) {
+    if (clockSource != ClockSource::None || networkTimestampMs == 0) {
+        return false;
+    }
+    time_t utc = (time_t)(symbolEpoch + networkTimestampMs / 1000ULL);
+    return seedClock(utc, (long)(networkTimestampMs % 1000ULL), ClockSource::SymbolChain);
+}
+
+bool seedClockFromHttpDate(const String &httpDate) {
+    if (clockSource != ClockSource::None || httpDate.length() == 0) {
+        return false;
+    }
+
+    // "Sun, 06 Nov 1994 08:49:37 GMT"
+    static const char MONTHS[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    char monthName[4] = "";
+    int day = 0, year = 0, hour = 0, minute = 0, second = 0;
+    if (sscanf(httpDate.c_str(), "%*3s, %d %3s %d %d:%d:%d", &day, monthName, &year, &hour, &minute, &second) != 6) {
+        consoleLog("[Time] Dateヘッダー解析失敗: " + httpDate);
+        return false;
+    }
+
+    const char *found = strstr(MONTHS, monthName);
+    if (found == nullptr || strlen(monthName) != 3 || (found - MONTHS) % 3 != 0) {
+        consoleLog("[Time] Dateヘッダー解析失敗: " + httpDate);
+        return false;
+    }
+    int month = (int)(found - MONTHS) / 3 + 1;
+
+    time_t utc = makeUtcTime(year, month, day, hour, minute, second);
+    return seedClock(utc, 0, ClockSource::HttpDate);
+}
+
+time_t makeUtcTime(int year, int month, int day, int hour, int minute, int second) {
+    return (time_t)daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+}
+
+bool isClockValid() {
+    return clockSource != ClockSource::None;
+}
+
+ClockSource getClockSource() {
+    return clockSource;
+}
+
+const char *clockSourceName(ClockSource source) {
+    switch (source) {
+        case ClockSource::Rtc:
+            return "RTC";
+        case ClockSource::HttpDate:
+            return "HTTP Date";
+        case ClockSource::SymbolChain:
+            return "Symbol";
+        case ClockSource::Ntp:
+            return "NTP";
+        default:
+            return "未設定";
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * @file timesync.h
+ * @brief 時刻サービス（RTC・Symbolタイムスタンプ・HTTP Dateヘッダーによる即時設定とSNTPによる補正）
+ * @details NTP応答を待たずに、最初に得られた時刻情報（RTC、ブロック/トランザクションのタイムスタンプ、
+ *          REST応答のDateヘッダー）で時計を設定する。以降はSNTPがバックグラウンドで
+ *          スルー（adjtimeによる緩やかな補正）で精度を上げ、同期結果をRTCへ書き戻す
+ */
+
+#ifndef TIMESYNC_H
+#define TIMESYNC_H
+
+#include <Arduino.h>
+
+// NTP設定
+#define NTP_SERVER "ntp.nict.jp"           // 日本の公式NTPサーバー（NICT）
+#define NTP_SYNC_TIMEOUT 20000             // 時刻未取得のまま起動処理の確認間隔を延ばすまでの時間（ミリ秒）
+
+// RTC補正設定
+#define CLOCK_NAMESPACE "clock"                // NVS名前空間
+#define CLOCK_TZ_KEY "tz"                      // 前回のPOSIX TZ規則（起動直後の表示用）
+#define CLOCK_RTC_SET_KEY "rtcSet"             // RTCを最後に書き込んだ時刻（Unix時刻・秒）
+#define CLOCK_DRIFT_KEY "driftPpb"             // RTCの歩度（ppb、正はRTCが進む）
+#define RTC_DISCIPLINE_INTERVAL 60000          // NTP同期結果のRTC反映を確認する間隔（ミリ秒）
+#define RTC_DRIFT_MIN_ELAPSED (6 * 3600)       // 歩度を測定する最短経過時間（秒、RTCは1秒分解能のため）
+#define RTC_DRIFT_MAX_PPB 200000               // 歩度の上限（200ppm、超過は測定異常とみなす）
+
+// Symbol epoch（ネットワーク時刻の基準、Unix時刻・秒）
+#define SYMBOL_EPOCH_MAINNET 1615853185UL
+#define SYMBOL_EPOCH_TESTNET 1667250467UL
+
+/**
+ * @brief 時計の設定元（精度の低い順）
+ */
+enum class ClockSource : uint8_t {
+    None,         // 未設定
+    Rtc,          // RTC（前回のNTP同期からの歩度補正済み）
+    HttpDate,     // REST応答のDateヘッダー（秒精度）
+    SymbolChain,  // Symbolブロック/トランザクションのタイムスタンプ（ネットワーク時刻）
+    Ntp           // SNTP同期済み
+};
+
+/**
+ * @brief RTCから時計を設定（M5.begin()直後に呼び出し）
+ * @details 前回のタイムゾーンをNVSから復元し、RTCの時刻を記録済みの歩度で補正して設定する。
+ *          RTCがないボード・RTCの電圧低下時は何もしない
+ */
+void initClock();
+
+/**
+ * @brief 時刻サービスを初期化（タイムゾーン設定、SNTPのスルー補正モード設定）
+ * @param posixTz POSIX TZ規則（例: "JST-9"）
+ * @param symbolNetwork Symbolネットワーク種別（"mainnet" / "testnet"、epoch選択に使用）
+ * @details WiFi接続前に呼び出す。RTCがある場合はNTP同期結果をRTCへ書き戻すタイマーを開始する
+ */
+void initTimeSync(const char *posixTz, const String &symbolNetwork);
+
+/**
+ * @brief SNTP同期を開始（ノンブロッキング）
+ * @details WiFi接続後に呼び出す。同期完了は通知コールバックで記録され、待機は不要
+ */
+void beginNTPSync();
+
+/**
+ * @brief Symbolネットワーク時刻で時計を設定（未設定の場合のみ）
+ * @param networkTimestampMs Symbol epochからの経過ミリ秒（ブロック/トランザクションのtimestamp）
+ * @return 時計を設定した場合true
+ * @details REST取得タスク（コア0）からも呼び出し可能
+ */
+bool seedClockFromSymbolTimestamp(uint64_t networkTimestampMs);
+
+/**
+ * @brief HTTP Dateヘッダー（RFC 7231形式）で時計を設定（未設定の場合のみ）
+ * @param httpDate Dateヘッダー値（例: "Sun, 06 Nov 1994 08:49:37 GMT"）
+ * @return 時計を設定した場合true
+ * @details REST取得タスク（コア0）からも呼び出し可能
+ */
+bool seedClockFromHttpDate(const String &httpDate);
+
+/**
+ * @brief 時計が設定済みかを判定
+ * @return いずれかの設定元で時刻を取得済みならtrue
+ */
+bool isClockValid();
+
+/**
+ * @brief 時計の設定元を取得
+ * @return 最後に時計を設定/補正した設定元
+ */
+ClockSource getClockSource();
+
+/**
+ * @brief 暦日時からUnix時刻を計算（UTC、タイムゾーン非依存、mktime()を使用しない）
+ * @param year 年
+ * @param month 月（1-12）
+ * @param day 日（1-31）
+ * @param hour 時（0-23）
+ * @param minute 分（0-59）
+ * @param second 秒（0-60）
+ * @return Unix時刻（秒）
+ */
+time_t makeUtcTime(int year, int month, int day, int hour, int minute, int second);
+
+/**
+ * @brief 時計の設定元の名前を取得（ログ用）
+ * @param source 設定元
+ * @return 設定元名（静的文字列）
+ */
+const char *clockSourceName(ClockSource source);
+
+#endif // TIMESYNC_H
@@ -0,0 +1,125 @@
+/**
+ * @file timezone.cpp
+ * @brief タイムゾーン表（コンパイル時完全ハッシュ）の実装
+ * @details 名前を小文字化したFNV-1aハッシュ（シード付き）の上位ビットをスロット番号とし、
+ *          全エントリが衝突しないシードをコンパイル時に探索する。
+ *          エントリ追加で衝突が解消できない場合はstatic_assertでビルドエラーになる
+ */
+
+#include "timezone.h"
+#include <strings.h>
+
+// タイムゾーン表（夏時間規則はPOSIX TZ形式、"<+07>-7"は略称のない地域の表記）
+static constexpr TimezoneInfo TIMEZONE_TABLE[] = {
+    {"Asia/Tokyo", "JST-9", 9 * 3600},
+    {"America/New_York", "EST5EDT,M3.2.0,M11.1.0", -5 * 3600},
+    {"Asia/Shanghai", "CST-8", 8 * 3600},
+    {"Asia/Singapore", "<+08>-8", 8 * 3600},
+    {"Asia/Hong_Kong", "HKT-8", 8 * 3600},
+    {"Asia/Seoul", "KST-9", 9 * 3600},
+    {"Asia/Bangkok", "<+07>-7", 7 * 3600},
+    {"Asia/Dubai", "<+04>-4", 4 * 3600},
+    {"Asia/Kolkata", "IST-5:30", 19800},
+    {"America/Chicago", "CST6CDT,M3.2.0,M11.1.0", -6 * 3600},
+    {"America/Denver", "MST7MDT,M3.2.0,M11.1.0", -7 * 3600},
+    {"America/Los_Angeles", "PST8PDT,M3.2.0,M11.1.0", -8 * 3600},
+    {"America/Sao_Paulo", "<-03>3", -3 * 3600},
+    {"Europe/London", "GMT0BST,M3.5.0/1,M10.5.0", 0},
+    {"Europe/Paris", "CET-1CEST,M3.5.0,M10.5.0/3", 1 * 3600},
+    {"Europe/Berlin", "CET-1CEST,M3.5.0,M10.5.0/3", 1 * 3600},
+    {"Europe/Moscow", "MSK-3", 3 * 3600},
+    {"Pacific/Auckland", "NZST-12NZDT,M9.5.0,M4.1.0/3", 12 * 3600},
+    {"Australia/Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3", 10 * 3600},
+    {"UTC", "UTC0", 0},
+    {"GMT", "GMT0", 0}
+};
+static constexpr int TIMEZONE_COUNT = sizeof(TIMEZONE_TABLE) / sizeof(TIMEZONE_TABLE[0]);
+
+// ハッシュ設定
+static constexpr int SLOT_BITS = 6;                    // スロット数 = 64（エントリ数の約3倍）
+static constexpr int SLOT_COUNT = 1 << SLOT_BITS;
+static constexpr uint32_t SEED_SEARCH_LIMIT = 4096;    // シード探索の上限
+static constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static constexpr uint32_t FNV_PRIME = 16777619u;
+
+static_assert(TIMEZONE_COUNT < SLOT_COUNT, "Too many timezones for the slot table");
+
+static constexpr char toLowerAscii(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+/**
+ * @brief 大文字小文字を区別しないシード付きFNV-1aハッシュ
+ */
+static constexpr uint32_t hashName(const char *name, uint32_t seed) {
+    uint32_t hash = FNV_OFFSET_BASIS ^ seed;
+    for (const char *p = name; *p != '\0'; p++) {
+        hash ^= (uint8_t)toLowerAscii(*p);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static constexpr int slotOf(const char *name, uint32_t seed) {
+    return (int)(hashName(name, seed) >> (32 - SLOT_BITS));
+}
+
+/**
+ * @brief シードで全エントリが異なるスロットに割り当たるかを判定
+ */
+static constexpr bool isPerfectSeed(uint32_t seed) {
+    bool used[SLOT_COUNT] = {};
+    for (int i = 0; i < TIMEZONE_COUNT; i++) {
+        int slot = slotOf(TIMEZONE_TABLE[i].name, seed);
+        if (used[slot]) {
+            return false;
+        }
+        used[slot] = true;
+    }
+    return true;
+}
+
+static constexpr uint32_t findPerfectSeed() {
+    for (uint32_t seed = 0; seed < SEED_SEARCH_LIMIT; seed++) {
+        if (isPerfectSeed(seed)) {
+            return seed;
+        }
+    }
+    return SEED_SEARCH_LIMIT;
+}
+
+static constexpr uint32_t TIMEZONE_SEED = findPerfectSeed();
+static_assert(TIMEZONE_SEED < SEED_SEARCH_LIMIT, "No collision-free seed found; increase SLOT_BITS");
+
+/**
+ * @brief スロット番号からエントリ番号への対応表（-1は空き）
+ */
+struct SlotTable {
+    int8_t index[SLOT_COUNT];
+};
+
+static constexpr SlotTable buildSlotTable() {
+    SlotTable table = {};
+    for (int slot = 0; slot < SLOT_COUNT; slot++) {
+        table.index[slot] = -1;
+    }
+    for (int i = 0; i < TIMEZONE_COUNT; i++) {
+        table.index[slotOf(TIMEZONE_TABLE[i].name, TIMEZONE_SEED)] = (int8_t)i;
+    }
+    return table;
+}
+
+static constexpr SlotTable TIMEZONE_SLOTS = buildSlotTable();
+
+const TimezoneInfo *findTimezone(const char *name) {
+    if (name == nullptr) {
+        return nullptr;
+    }
+    int entry = TIMEZONE_SLOTS.index[slotOf(name, TIMEZONE_SEED)];
+    if (entry < 0) {
+        return nullptr;
+    }
+    // ハッシュは表外の名前でも衝突し得るため名前を1回照合
+    const TimezoneInfo &info = TIMEZONE_TABLE[entry];
+    return (strcasecmp(name, info.name) == 0) ? &info : nullptr;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file timezone.h
+ * @brief タイムゾーン名からPOSIX TZ規則への変換
+ * @details タイムゾーン表はコンパイル時に大文字小文字を区別しない完全ハッシュとして構築され、
+ *          検索はハッシュ1回と文字列比較1回で完了する
+ */
+
+#ifndef TIMEZONE_H
+#define TIMEZONE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief タイムゾーン情報
+ */
+struct TimezoneInfo {
+    const char *name;        // タイムゾーン名（例: "America/New_York"）
+    const char *posixTz;     // POSIX TZ規則（例: "EST5EDT,M3.2.0,M11.1.0"、夏時間を含む）
+    int32_t standardOffset;  // 標準時のUTC offset（秒単位、ログ表示用）
+};
+
+/**
+ * @brief タイムゾーン名を検索（大文字小文字を区別しない）
+ * @param name タイムゾーン名（例: "Asia/Tokyo", "asia/tokyo"）
+ * @return タイムゾーン情報、未対応の場合nullptr
+ */
+const TimezoneInfo *findTimezone(const char *name);
+
+#endif // TIMEZONE_H
@@ -0,0 +1,166 @@
+/**
+ * @file traveltime_table.h
+ * @brief P波・S波の走時表（tools/gen_traveltime.pyで生成、手動で編集しないこと）
+ * @details 1次元速度構造（ak135の上部マントルまでを折れ線で近似）の初動走時。
+ *          [震源深さ][震央距離]の0.1秒単位
+ */
+
+#ifndef TRAVELTIME_TABLE_H
+#define TRAVELTIME_TABLE_H
+
+#include <stdint.h>
+
+#define TRAVELTIME_DISTANCE_STEP_KM 10  // 震央距離の間隔（km）
+#define TRAVELTIME_DISTANCE_COUNT 201   // 震央距離の点数（0〜2000km）
+#define TRAVELTIME_DEPTH_STEP_KM 10     // 震源深さの間隔（km）
+#define TRAVELTIME_DEPTH_COUNT 71       // 震源深さの点数（0〜700km）
+
+static const uint16_t TRAVELTIME_P[TRAVELTIME_DEPTH_COUNT][TRAVELTIME_DISTANCE_COUNT] = {
+    {0,17,34,52,69,86,103,121,138,155,172,190,207,224,241,259,271,284,296,308,321,333,346,358,370,383,395,407,420,432,444,457,469,482,494,506,519,531,543,556,568,581,593,605,618,630,642,655,667,679,692,704,717,729,741,754,766,778,791,803,815,828,840,852,865,877,890,902,914,927,939,951,964,976,988,1001,1013,1025,1038,1050,1062,1075,1087,1100,1112,1124,1137,1149,1161,1174,1186,1198,1211,1223,1235,1248,1260,1272,1285,1297,1309,1322,1334,1346,1359,1371,1383,1396,1408,1420,1433,1445,1457,1470,1482,1494,1507,1519,1531,1543,1556,1568,1580,1593,1605,1617,1630,1642,1654,1667,1679,1691,1703,1716,1728,1740,1753,1765,1777,1790,1802,1814,1826,1839,1851,1863,1876,1888,1900,1912,1925,1937,1949,1962,1974,1986,1998,2011,2023,2035,2047,2060,2072,2084,2097,2109,2121,2133,2146,2158,2169,2181,2193,2205,2217,2228,2240,2252,2263,2275,2287,2298,2310,2321,2333,2344,2356,2367,2378,2390,2401,2412,2424,2435,2446,2457,2468,2480,2491,2502,2513},
+    {17,24,39,54,71,88,105,122,139,156,173,190,207,222,235,247,259,272,284,296,309,321,334,346,358,371,383,395,408,420,432,445,457,470,482,494,507,519,531,544,556,569,581,593,606,618,630,643,655,667,680,692,705,717,729,742,754,766,779,791,803,816,828,840,853,865,878,890,902,915,927,939,952,964,976,989,1001,1013,1026,1038,1050,1063,1075,1088,1100,1112,1125,1137,1149,1162,1174,1186,1199,1211,1223,1236,1248,1260,1273,1285,1297,1310,1322,1334,1347,1359,1371,1384,1396,1408,1421,1433,1445,1458,1470,1482,1494,1507,1519,1531,1544,1556,1568,1581,1593,1605,1618,1630,1642,1655,1667,1679,1691,1704,1716,1728,1741,1753,1765,1778,1790,1802,1814,1827,1839,1851,1864,1876,1888,1900,1913,1925,1937,1949,1962,1974,1986,1999,2011,2023,2035,2048,2060,2072,2084,2097,2109,2121,2133,2145,2157,2169,2180,2192,2204,2216,2227,2239,2251,2263,2274,2286,2297,2308,2320,2331,2343,2354,2365,2377,2388,2399,2411,2422,2433,2444,2455,2466,2478,2489,2500},
+    {34,39,49,62,77,93,109,125,142,159,173,185,198,210,223,235,247,260,272,284,297,309,322,334,346,359,371,383,396,408,420,433,445,458,470,482,495,507,519,532,544,557,569,581,594,606,618,631,643,655,668,680,693,705,717,730,742,754,767,779,791,804,816,828,841,853,866,878,890,903,915,927,940,952,964,977,989,1001,1014,1026,1038,1051,1063,1076,1088,1100,1113,1125,1137,1150,1162,1174,1187,1199,1211,1224,1236,1248,1261,1273,1285,1298,1310,1322,1335,1347,1359,1372,1384,1396,1409,1421,1433,1445,1458,1470,1482,1495,1507,1519,1532,1544,1556,1569,1581,1593,1606,1618,1630,1642,1655,1667,1679,1692,1704,1716,1729,1741,1753,1765,1778,1790,1802,1815,1827,1839,1851,1864,1876,1888,1901,1913,1925,1937,1950,1962,1974,1986,1999,2011,2023,2036,2048,2060,2072,2085,2097,2109,2121,2132,2144,2156,2168,2180,2191,2203,2215,2227,2238,2250,2261,2273,2284,2296,2307,2318,2330,2341,2352,2364,2375,2386,2397,2409,2420,2431,2442,2453,2464,2476,2487},
+    {50,53,60,70,83,96,111,125,139,152,164,176,189,201,213,226,238,251,263,275,288,300,312,325,337,350,362,374,387,399,411,424,436,449,461,473,486,498,510,523,535,547,560,572,585,597,609,622,634,646,659,671,683,696,708,721,733,745,758,770,782,795,807,819,832,844,856,869,881,894,906,918,931,943,955,968,980,992,1005,1017,1029,1042,1054,1066,1079,1091,1103,1116,1128,1140,1153,1165,1177,1190,1202,1214,1227,1239,1251,1264,1276,1288,1301,1313,1325,1338,1350,1362,1375,1387,1399,1412,1424,1436,1449,1461,1473,1486,1498,1510,1523,1535,1547,1559,1572,1584,1596,1609,1621,1633,1646,1658,1670,1682,1695,1707,1719,1732,1744,1756,1769,1781,1793,1805,1818,1830,1842,1855,1867,1879,1891,1904,1916,1928,1940,1953,1965,1977,1990,2002,2014,2026,2039,2051,2063,2075,2087,2099,2111,2123,2134,2146,2158,2170,2181,2193,2205,2217,2228,2240,2251,2262,2274,2285,2297,2308,2319,2331,2342,2353,2365,2376,2387,2398,2409,2420,2432,2443,2454,2465,2476},
+    {63,65,71,79,89,100,112,124,136,148,161,173,185,198,210,222,235,247,259,272,284,297,309,321,334,346,358,371,383,395,408,420,432,445,457,470,482,494,507,519,531,544,556,568,581,593,605,618,630,642,655,667,680,692,704,717,729,741,754,766,778,791,803,815,828,840,852,865,877,890,902,914,927,939,951,964,976,988,1001,1013,1025,1038,1050,1062,1075,1087,1099,1112,1124,1136,1149,1161,1173,1186,1198,1210,1223,1235,1247,1260,1272,1284,1297,1309,1321,1333,1346,1358,1370,1383,1395,1407,1420,1432,1444,1457,1469,1481,1494,1506,1518,1530,1543,1555,1567,1580,1592,1604,1617,1629,1641,1653,1666,1678,1690,1703,1715,1727,1739,1752,1764,1776,1789,1801,1813,1825,1838,1850,1862,1874,1887,1899,1911,1924,1936,1948,1960,1973,1985,1997,2009,2022,2034,2046,2057,2069,2081,2093,2105,2116,2128,2140,2152,2163,2175,2187,2198,2210,2221,2233,2244,2256,2267,2278,2290,2301,2312,2324,2335,2346,2357,2368,2380,2391,2402,2413,2424,2435,2446,2457,2468},
+    {76,77,82,88,96,106,117,128,139,151,163,175,187,199,211,224,236,248,260,273,285,297,309,322,334,346,359,371,383,396,408,420,433,445,457,470,482,494,507,519,531,544,556,568,581,593,605,618,630,642,655,667,679,692,704,716,729,741,753,766,778,790,803,815,827,840,852,864,877,889,901,914,926,938,951,963,975,988,1000,1012,1025,1037,1049,1062,1074,1086,1099,1111,1123,1136,1148,1160,1172,1185,1197,1209,1222,1234,1246,1259,1271,1283,1296,1308,1320,1333,1345,1357,1369,1382,1394,1406,1419,1431,1443,1456,1468,1480,1492,1505,1517,1529,1542,1554,1566,1578,1591,1603,1615,1628,1640,1652,1664,1677,1689,1701,1714,1726,1738,1750,1763,1775,1787,1799,1812,1824,1836,1849,1861,1873,1885,1898,1910,1922,1934,1947,1959,1971,1983,1995,2007,2018,2030,2042,2054,2066,2077,2089,2101,2113,2124,2136,2148,2159,2171,2182,2194,2205,2217,2228,2239,2251,2262,2273,2285,2296,2307,2318,2330,2341,2352,2363,2374,2385,2396,2408,2419,2430,2441,2452,2463},
+    {88,90,93,98,106,114,123,134,144,155,167,178,190,202,214,226,238,250,262,274,286,298,311,323,335,347,360,372,384,396,409,421,433,446,458,470,482,495,507,519,532,544,556,569,581,593,606,618,630,642,655,667,679,692,704,716,729,741,753,766,778,790,803,815,827,840,852,864,876,889,901,913,926,938,950,963,975,987,1000,1012,1024,1036,1049,1061,1073,1086,1098,1110,1123,1135,1147,1160,1172,1184,1196,1209,1221,1233,1246,1258,1270,1283,1295,1307,1319,1332,1344,1356,1369,1381,1393,1405,1418,1430,1442,1455,1467,1479,1491,1504,1516,1528,1541,1553,1565,1577,1590,1602,1614,1627,1639,1651,1663,1676,1688,1700,1712,1725,1737,1749,1761,1774,1786,1798,1810,1823,1835,1847,1859,1872,1884,1896,1908,1920,1932,1944,1956,1968,1979,1991,2003,2015,2027,2038,2050,2062,2074,2085,2097,2109,2120,2132,2143,2155,2166,2178,2189,2200,2212,2223,2234,2246,2257,2268,2280,2291,2302,2313,2324,2335,2347,2358,2369,2380,2391,2402,2413,2424,2435,2445,2455},
+    {101,102,105,109,116,123,131,141,151,161,172,183,194,206,217,229,241,253,264,276,288,301,313,325,337,349,361,373,385,398,410,422,434,447,459,471,483,496,508,520,532,545,557,569,581,594,606,618,631,643,655,667,680,692,704,717,729,741,753,766,778,790,803,815,827,839,852,864,876,889,901,913,926,938,950,962,975,987,999,1012,1024,1036,1048,1061,1073,1085,1098,1110,1122,1135,1147,1159,1171,1184,1196,1208,1220,1233,1245,1257,1270,1282,1294,1306,1319,1331,1343,1356,1368,1380,1392,1405,1417,1429,1442,1454,1466,1478,1491,1503,1515,1527,1540,1552,1564,1576,1589,1601,1613,1625,1638,1650,1662,1675,1687,1699,1711,1724,1736,1748,1760,1772,1785,1797,1809,1821,1834,1846,1858,1869,1881,1893,1905,1917,1929,1941,1952,1964,1976,1988,1999,2011,2023,2035,2046,2058,2070,2081,2093,2104,2116,2127,2139,2150,2162,2173,2184,2196,2207,2218,2230,2241,2252,2263,2274,2286,2297,2308,2319,2330,2341,2352,2363,2374,2385,2396,2407,2418,2428,2438,2448},
+    {113,114,117,121,126,133,140,149,158,168,178,188,199,210,222,233,244,256,268,280,291,303,315,327,339,351,363,375,387,399,412,424,436,448,460,472,485,497,509,521,533,546,558,570,582,595,607,619,631,643,656,668,680,692,705,717,729,742,754,766,778,791,803,815,827,840,852,864,876,889,901,913,926,938,950,962,975,987,999,1011,1024,1036,1048,1061,1073,1085,1097,1110,1122,1134,1146,1159,1171,1183,1196,1208,1220,1232,1245,1257,1269,1281,1294,1306,1318,1330,1343,1355,1367,1380,1392,1404,1416,1429,1441,1453,1465,1478,1490,1502,1514,1527,1539,1551,1563,1576,1588,1600,1612,1625,1637,1649,1661,1674,1686,1698,1710,1722,1735,1747,1759,1771,1783,1795,1807,1819,1831,1842,1854,1866,1878,1890,1902,1913,1925,1937,1949,1961,1972,1984,1996,2007,2019,2031,2042,2054,2065,2077,2088,2100,2111,2123,2134,2145,2157,2168,2179,2191,2202,2213,2225,2236,2247,2258,2269,2280,2292,2303,2314,2325,2336,2347,2358,2369,2380,2391,2401,2411,2421,2431,2440},
+    {126,126,129,132,137,143,150,158,166,175,185,195,205,216,227,238,249,260,272,283,295,307,318,330,342,354,366,378,390,402,414,426,438,450,462,474,486,498,510,523,535,547,559,571,583,596,608,620,632,644,657,669,681,693,705,718,730,742,754,767,779,791,803,816,828,840,852,865,877,889,901,914,926,938,950,963,975,987,999,1012,1024,1036,1048,1061,1073,1085,1097,1110,1122,1134,1146,1159,1171,1183,1195,1208,1220,1232,1244,1257,1269,1281,1293,1306,1318,1330,1342,1355,1367,1379,1391,1403,1416,1428,1440,1452,1465,1477,1489,1501,1514,1526,1538,1550,1563,1575,1587,1599,1612,1624,1636,1648,1660,1673,1685,1697,1709,1720,1732,1744,1756,1768,1780,1792,1804,1816,1827,1839,1851,1863,1875,1886,1898,1910,1922,1933,1945,1957,1969,1980,1992,2004,2015,2027,2038,2050,2061,2073,2084,2095,2107,2118,2129,2141,2152,2163,2175,2186,2197,2208,2219,2231,2242,2253,2264,2275,2286,2297,2308,2319,2330,2341,2352,2363,2374,2384,2394,2403,2413,2423,2433},
+    {138,139,141,144,148,154,160,167,175,184,193,202,212,222,233,243,254,265,276,288,299,311,322,334,345,357,369,381,392,404,416,428,440,452,464,476,488,500,512,524,536,549,561,573,585,597,609,621,633,646,658,670,682,694,706,719,731,743,755,767,780,792,804,816,828,841,853,865,877,890,902,914,926,938,951,963,975,987,1000,1012,1024,1036,1048,1061,1073,1085,1097,1110,1122,1134,1146,1159,1171,1183,1195,1207,1220,1232,1244,1256,1269,1281,1293,1305,1317,1330,1342,1354,1366,1379,1391,1403,1415,1428,1440,1452,1464,1476,1489,1501,1513,1525,1538,1550,1562,1574,1586,1598,1610,1622,1634,1646,1658,1670,1682,1694,1706,1718,1729,1741,1753,1765,1777,1789,1801,1812,1824,1836,1848,1860,1871,1883,1895,1906,1918,1930,1942,1953,1965,1976,1988,1999,2011,2022,2034,2045,2057,2068,2079,2091,2102,2113,2125,2136,2147,2158,2170,2181,2192,2203,2214,2226,2237,2248,2259,2270,2281,2292,2303,2314,2325,2336,2347,2357,2366,2376,2386,2396,2406,2416,2426},
+    {150,151,153,156,160,165,171,177,185,193,201,210,220,229,239,250,260,271,282,293,304,315,326,338,349,361,372,384,396,407,419,431,443,455,467,479,491,502,514,526,538,550,563,575,587,599,611,623,635,647,659,671,683,696,708,720,732,744,756,768,781,793,805,817,829,841,854,866,878,890,902,915,927,939,951,963,976,988,1000,1012,1024,1037,1049,1061,1073,1085,1098,1110,1122,1134,1146,1159,1171,1183,1195,1207,1220,1232,1244,1256,1268,1281,1293,1305,1317,1330,1342,1354,1366,1378,1391,1403,1415,1427,1439,1452,1464,1476,1488,1500,1512,1524,1536,1548,1560,1572,1584,1596,1608,1620,1631,1643,1655,1667,1679,1691,1703,1715,1726,1738,1750,1762,1774,1786,1797,1809,1821,1833,1844,1856,1868,1879,1891,1903,1915,1926,1938,1949,1961,1972,1984,1995,2007,2018,2029,2041,2052,2063,2075,2086,2097,2109,2120,2131,2142,2153,2165,2176,2187,2198,2209,2220,2231,2242,2254,2265,2276,2287,2298,2309,2319,2329,2339,2349,2359,2369,2379,2389,2399,2409,2418},
+    {163,163,165,168,171,176,181,188,195,202,210,219,228,237,247,256,267,277,287,298,309,320,331,342,354,365,376,388,399,411,423,434,446,458,470,481,493,505,517,529,541,553,565,577,589,601,613,625,637,649,661,673,685,697,709,721,733,745,758,770,782,794,806,818,830,842,855,867,879,891,903,915,928,940,952,964,976,988,1001,1013,1025,1037,1049,1061,1074,1086,1098,1110,1122,1134,1147,1159,1171,1183,1195,1208,1220,1232,1244,1256,1268,1281,1293,1305,1317,1329,1341,1353,1365,1377,1389,1402,1414,1426,1438,1450,1462,1474,1486,1498,1510,1521,1533,1545,1557,1569,1581,1593,1605,1617,1629,1641,1652,1664,1676,1688,1700,1712,1723,1735,1747,1759,1771,1782,1794,1806,1817,1829,1841,1853,1864,1876,1887,1899,1911,1922,1934,1945,1956,1968,1979,1991,2002,2013,2025,2036,2047,2059,2070,2081,2093,2104,2115,2126,2137,2148,2160,2171,2182,2193,2204,2215,2226,2237,2248,2259,2270,2281,2292,2302,2312,2322,2332,2342,2352,2362,2372,2381,2391,2401,2411},
+    {175,176,177,180,183,187,192,198,205,212,219,227,236,245,254,264,273,284,294,304,315,325,336,347,358,370,381,392,403,415,426,438,450,461,473,484,496,508,520,532,543,555,567,579,591,603,615,627,639,651,663,675,687,699,711,723,735,747,759,771,783,795,807,819,831,843,856,868,880,892,904,916,928,940,952,965,977,989,1001,1013,1025,1037,1049,1062,1074,1086,1098,1110,1122,1134,1146,1158,1171,1183,1195,1207,1219,1231,1243,1255,1267,1279,1291,1303,1316,1328,1340,1352,1364,1376,1388,1400,1412,1424,1436,1448,1459,1471,1483,1495,1507,1519,1531,1543,1555,1567,1579,1590,1602,1614,1626,1638,1650,1661,1673,1685,1697,1709,1720,1732,1744,1756,1767,1779,1791,1802,1814,1826,1837,1849,1860,1872,1884,1895,1906,1918,1929,1941,1952,1964,1975,1986,1998,2009,2020,2032,2043,2054,2065,2077,2088,2099,2110,2121,2132,2144,2155,2166,2177,2188,2199,2210,2221,2232,2243,2254,2265,2275,2285,2295,2305,2315,2325,2335,2345,2355,2364,2374,2384,2394,2404},
+    {188,188,190,192,195,199,204,209,215,222,229,237,245,253,262,271,281,291,300,311,321,331,342,353,363,374,385,397,408,419,430,442,453,465,476,488,499,511,523,534,546,558,570,581,593,605,617,629,641,653,665,676,688,700,712,724,736,748,760,772,784,796,808,820,832,844,856,868,880,893,905,917,929,941,953,965,977,989,1001,1013,1025,1037,1049,1061,1073,1086,1098,1110,1122,1134,1146,1158,1170,1182,1194,1206,1218,1230,1242,1254,1266,1278,1290,1302,1314,1326,1338,1350,1362,1374,1386,1398,1410,1422,1434,1446,1457,1469,1481,1493,1505,1517,1529,1541,1552,1564,1576,1588,1600,1612,1623,1635,1647,1659,1670,1682,1694,1706,1717,1729,1741,1752,1764,1776,1787,1799,1811,1822,1834,1845,1857,1868,1880,1891,1902,1914,1925,1937,1948,1959,1971,1982,1993,2005,2016,2027,2038,2049,2061,2072,2083,2094,2105,2116,2128,2139,2150,2161,2172,2183,2194,2205,2216,2227,2238,2248,2258,2268,2278,2288,2298,2308,2318,2328,2337,2347,2357,2367,2377,2387,2397},
+    {200,200,202,204,207,210,215,220,226,232,239,246,254,262,270,279,288,298,307,317,327,338,348,358,369,380,391,401,412,424,435,446,457,469,480,491,503,514,526,537,549,561,572,584,596,608,619,631,643,655,667,678,690,702,714,726,738,750,762,774,785,797,809,821,833,845,857,869,881,893,905,917,929,941,953,965,977,989,1001,1013,1025,1037,1049,1061,1073,1085,1097,1109,1121,1133,1145,1157,1169,1181,1193,1205,1217,1229,1241,1253,1265,1277,1289,1301,1313,1325,1337,1348,1360,1372,1384,1396,1408,1420,1432,1444,1455,1467,1479,1491,1503,1515,1526,1538,1550,1562,1574,1585,1597,1609,1621,1632,1644,1656,1668,1679,1691,1703,1714,1726,1738,1749,1761,1773,1784,1796,1807,1819,1830,1841,1853,1864,1876,1887,1898,1910,1921,1933,1944,1955,1966,1978,1989,2000,2011,2023,2034,2045,2056,2067,2078,2089,2101,2112,2123,2134,2145,2156,2167,2178,2189,2200,2211,2222,2232,2241,2251,2261,2271,2281,2291,2301,2311,2321,2330,2340,2350,2360,2370,2380,2390},
+    {212,213,214,216,219,222,226,231,236,242,249,256,263,271,279,288,296,305,315,324,334,344,354,364,375,385,396,407,417,428,439,450,461,473,484,495,507,518,529,541,552,564,575,587,599,610,622,634,645,657,669,680,692,704,716,728,739,751,763,775,787,799,811,822,834,846,858,870,882,894,906,918,930,942,954,966,977,989,1001,1013,1025,1037,1049,1061,1073,1085,1097,1109,1121,1133,1145,1157,1168,1180,1192,1204,1216,1228,1240,1252,1264,1276,1288,1299,1311,1323,1335,1347,1359,1371,1383,1394,1406,1418,1430,1442,1454,1465,1477,1489,1501,1513,1524,1536,1548,1560,1571,1583,1595,1607,1618,1630,1642,1653,1665,1677,1688,1700,1712,1723,1735,1746,1758,1769,1781,1792,1804,1815,1826,1838,1849,1861,1872,1883,1895,1906,1917,1928,1940,1951,1962,1973,1985,1996,2007,2018,2029,2040,2052,2063,2074,2085,2096,2107,2118,2129,2140,2151,2162,2173,2184,2195,2205,2215,2225,2235,2244,2254,2264,2274,2284,2294,2304,2314,2323,2333,2343,2353,2363,2373,2382},
+    {225,225,226,228,230,234,238,242,247,253,259,266,273,280,288,296,305,313,322,332,341,351,361,371,381,391,402,412,423,433,444,455,466,477,488,499,510,522,533,544,556,567,578,590,601,613,625,636,648,659,671,683,694,706,718,729,741,753,765,777,788,800,812,824,836,847,859,871,883,895,907,918,930,942,954,966,978,990,1002,1013,1025,1037,1049,1061,1073,1085,1097,1109,1120,1132,1144,1156,1168,1180,1192,1204,1215,1227,1239,1251,1263,1275,1286,1298,1310,1322,1334,1346,1357,1369,1381,1393,1405,1416,1428,1440,1452,1464,1475,1487,1499,1511,1522,1534,1546,1557,1569,1581,1593,1604,1616,1628,1639,1651,1662,1674,1685,1697,1708,1720,1731,1743,1754,1766,1777,1789,1800,1811,1823,1834,1845,1857,1868,1879,1891,1902,1913,1924,1936,1947,1958,1969,1980,1992,2003,2014,2025,2036,2047,2058,2069,2080,2091,2102,2113,2124,2135,2146,2157,2168,2178,2188,2198,2208,2218,2228,2238,2248,2257,2267,2277,2287,2297,2307,2317,2326,2336,2346,2356,2366,2376},
+    {237,237,238,240,242,245,249,253,258,263,269,276,282,290,297,305,313,322,330,339,349,358,368,377,387,397,407,418,428,439,449,460,471,482,493,504,515,526,537,548,559,571,582,593,605,616,627,639,650,662,674,685,697,708,720,732,743,755,767,778,790,802,813,825,837,849,860,872,884,896,907,919,931,943,955,966,978,990,1002,1014,1026,1037,1049,1061,1073,1085,1097,1108,1120,1132,1144,1156,1167,1179,1191,1203,1215,1227,1238,1250,1262,1274,1286,1297,1309,1321,1333,1344,1356,1368,1380,1391,1403,1415,1427,1438,1450,1462,1474,1485,1497,1509,1520,1532,1544,1555,1567,1579,1590,1602,1613,1625,1636,1648,1659,1671,1682,1694,1705,1717,1728,1740,1751,1762,1774,1785,1797,1808,1819,1830,1842,1853,1864,1876,1887,1898,1909,1920,1932,1943,1954,1965,1976,1987,1998,2009,2021,2032,2043,2054,2065,2076,2087,2098,2109,2119,2130,2141,2152,2162,2172,2181,2191,2201,2211,2221,2231,2241,2251,2261,2270,2280,2290,2300,2310,2320,2329,2339,2349,2359,2369},
+    {249,249,250,252,254,257,260,264,269,274,280,286,292,299,306,314,322,330,339,347,356,365,375,384,394,404,414,424,434,444,455,465,476,487,497,508,519,530,541,552,563,574,585,597,608,619,631,642,653,665,676,688,699,711,722,734,745,757,768,780,792,803,815,827,838,850,862,873,885,897,909,920,932,944,955,967,979,991,1002,1014,1026,1038,1049,1061,1073,1085,1097,1108,1120,1132,1144,1155,1167,1179,1191,1202,1214,1226,1238,1249,1261,1273,1285,1296,1308,1320,1332,1343,1355,1367,1378,1390,1402,1414,1425,1437,1449,1460,1472,1484,1495,1507,1518,1530,1542,1553,1565,1576,1588,1599,1611,1622,1634,1645,1657,1668,1680,1691,1702,1714,1725,1736,1748,1759,1770,1782,1793,1804,1816,1827,1838,1849,1861,1872,1883,1894,1905,1917,1928,1939,1950,1961,1972,1983,1994,2005,2016,2027,2038,2049,2060,2071,2082,2093,2104,2115,2125,2135,2145,2155,2165,2175,2185,2195,2205,2214,2224,2234,2244,2254,2264,2274,2283,2293,2303,2313,2323,2333,2342,2352,2362},
+    {261,261,262,264,266,269,272,276,280,285,290,296,302,309,316,323,331,339,347,355,364,373,382,391,401,410,420,430,440,450,460,471,481,492,502,513,524,534,545,556,567,578,589,600,611,623,634,645,656,668,679,690,702,713,725,736,748,759,771,782,794,805,817,828,840,852,863,875,886,898,910,921,933,945,956,968,980,991,1003,1015,1026,1038,1050,1062,1073,1085,1097,1108,1120,1132,1143,1155,1167,1179,1190,1202,1214,1225,1237,1249,1260,1272,1284,1296,1307,1319,1331,1342,1354,1366,1377,1389,1401,1412,1424,1435,1447,1459,1470,1482,1493,1505,1516,1528,1539,1551,1562,1574,1585,1597,1608,1620,1631,1642,1654,1665,1677,1688,1699,1711,1722,1733,1745,1756,1767,1778,1790,1801,1812,1823,1835,1846,1857,1868,1879,1890,1902,1913,1924,1935,1946,1957,1968,1979,1990,2001,2012,2023,2034,2045,2056,2067,2078,2089,2099,2109,2119,2129,2139,2149,2158,2168,2178,2188,2198,2208,2218,2228,2237,2247,2257,2267,2277,2287,2296,2306,2316,2326,2336,2345,2355},
+    {273,273,274,276,278,280,283,287,291,296,301,307,313,319,326,333,340,348,356,364,372,381,390,399,408,417,427,437,446,456,466,476,487,497,507,518,529,539,550,561,571,582,593,604,615,626,637,649,660,671,682,693,705,716,727,739,750,761,773,784,796,807,819,830,842,853,865,876,888,899,911,923,934,946,957,969,981,992,1004,1015,1027,1039,1050,1062,1074,1085,1097,1109,1120,1132,1143,1155,1167,1178,1190,1202,1213,1225,1237,1248,1260,1272,1283,1295,1306,1318,1330,1341,1353,1364,1376,1387,1399,1411,1422,1434,1445,1457,1468,1480,1491,1503,1514,1526,1537,1549,1560,1571,1583,1594,1606,1617,1628,1640,1651,1662,1674,1685,1696,1708,1719,1730,1741,1753,1764,1775,1786,1798,1809,1820,1831,1842,1853,1864,1876,1887,1898,1909,1920,1931,1942,1953,1964,1975,1986,1997,2008,2019,2030,2041,2052,2062,2073,2083,2093,2103,2112,2122,2132,2142,2152,2162,2172,2182,2192,2201,2211,2221,2231,2241,2251,2260,2270,2280,2290,2300,2310,2319,2329,2339,2349},
+    {285,285,286,288,289,292,295,298,302,307,312,317,323,329,335,342,349,357,364,372,380,389,398,406,415,424,434,443,453,463,472,482,492,503,513,523,534,544,555,565,576,587,597,608,619,630,641,652,663,674,685,696,708,719,730,741,753,764,775,787,798,809,821,832,844,855,866,878,889,901,912,924,935,947,958,970,981,993,1005,1016,1028,1039,1051,1062,1074,1086,1097,1109,1120,1132,1143,1155,1167,1178,1190,1201,1213,1224,1236,1248,1259,1271,1282,1294,1305,1317,1328,1340,1352,1363,1375,1386,1398,1409,1421,1432,1443,1455,1466,1478,1489,1501,1512,1524,1535,1546,1558,1569,1580,1592,1603,1614,1626,1637,1648,1660,1671,1682,1693,1705,1716,1727,1738,1750,1761,1772,1783,1794,1805,1817,1828,1839,1850,1861,1872,1883,1894,1905,1916,1927,1938,1949,1960,1971,1982,1993,2004,2015,2026,2036,2047,2057,2067,2076,2086,2096,2106,2116,2126,2136,2146,2156,2165,2175,2185,2195,2205,2215,2225,2234,2244,2254,2264,2274,2283,2293,2303,2313,2323,2332,2342},
+    {297,297,298,299,301,304,306,310,314,318,323,328,333,339,345,352,359,366,373,381,389,397,405,414,423,432,441,450,460,469,479,489,498,508,518,529,539,549,560,570,581,591,602,613,623,634,645,656,667,678,689,700,711,722,733,744,755,767,778,789,800,812,823,834,846,857,868,880,891,902,914,925,937,948,960,971,983,994,1005,1017,1028,1040,1051,1063,1074,1086,1097,1109,1120,1132,1143,1155,1167,1178,1190,1201,1213,1224,1236,1247,1258,1270,1281,1293,1304,1316,1327,1339,1350,1362,1373,1385,1396,1408,1419,1430,1442,1453,1465,1476,1487,1499,1510,1521,1533,1544,1555,1567,1578,1589,1601,1612,1623,1635,1646,1657,1668,1679,1691,1702,1713,1724,1735,1747,1758,1769,1780,1791,1802,1813,1824,1835,1846,1857,1868,1879,1890,1901,1912,1923,1934,1945,1956,1967,1978,1989,2000,2011,2021,2031,2041,2050,2060,2070,2080,2090,2100,2110,2120,2130,2139,2149,2159,2169,2179,2189,2199,2208,2218,2228,2238,2248,2258,2267,2277,2287,2297,2306,2316,2326,2336},
+    {309,309,310,311,313,315,318,321,325,329,333,338,344,349,355,362,368,375,382,390,398,405,414,422,431,439,448,457,466,476,485,495,505,514,524,534,544,554,565,575,585,596,606,617,628,638,649,660,671,681,692,703,714,725,736,747,758,769,780,792,803,814,825,836,848,859,870,881,893,904,915,927,938,949,961,972,984,995,1006,1018,1029,1041,1052,1063,1075,1086,1098,1109,1121,1132,1144,1155,1166,1178,1189,1201,1212,1224,1235,1246,1258,1269,1281,1292,1304,1315,1326,1338,1349,1361,1372,1383,1395,1406,1418,1429,1440,1452,1463,1474,1486,1497,1508,1520,1531,1542,1553,1565,1576,1587,1598,1610,1621,1632,1643,1654,1666,1677,1688,1699,1710,1721,1733,1744,1755,1766,1777,1788,1799,1810,1821,1832,1843,1854,1865,1876,1887,1898,1909,1920,1931,1942,1952,1963,1974,1985,1995,2005,2015,2025,2035,2044,2054,2064,2074,2084,2094,2104,2114,2124,2133,2143,2153,2163,2173,2183,2192,2202,2212,2222,2232,2242,2251,2261,2271,2281,2290,2300,2310,2320,2329},
+    {321,321,322,323,325,327,329,333,336,340,344,349,354,360,365,371,378,385,392,399,406,414,422,430,438,447,456,464,473,483,492,501,511,520,530,540,550,560,570,580,590,601,611,622,632,643,653,664,674,685,696,707,718,728,739,750,761,772,783,794,805,817,828,839,850,861,872,883,895,906,917,928,940,951,962,974,985,996,1007,1019,1030,1041,1053,1064,1076,1087,1098,1110,1121,1132,1144,1155,1166,1178,1189,1201,1212,1223,1235,1246,1257,1269,1280,1292,1303,1314,1326,1337,1348,1360,1371,1382,1394,1405,1416,1427,1439,1450,1461,1473,1484,1495,1506,1518,1529,1540,1551,1563,1574,1585,1596,1607,1619,1630,1641,1652,1663,1674,1685,1696,1708,1719,1730,1741,1752,1763,1774,1785,1796,1807,1818,1829,1840,1851,1862,1873,1884,1895,1905,1916,1927,1938,1949,1959,1969,1979,1989,1999,2009,2019,2029,2039,2048,2058,2068,2078,2088,2098,2108,2118,2127,2137,2147,2157,2167,2177,2186,2196,2206,2216,2226,2235,2245,2255,2265,2275,2284,2294,2304,2313,2323},
+    {333,333,334,335,336,338,341,344,347,351,355,360,365,370,375,381,388,394,401,408,415,423,430,438,446,455,463,472,481,490,499,508,517,527,536,546,556,566,576,586,596,606,616,626,637,647,657,668,679,689,700,710,721,732,743,754,764,775,786,797,808,819,830,841,852,863,874,886,897,908,919,930,941,953,964,975,986,997,1009,1020,1031,1042,1054,1065,1076,1088,1099,1110,1121,1133,1144,1155,1167,1178,1189,1201,1212,1223,1234,1246,1257,1268,1280,1291,1302,1314,1325,1336,1347,1359,1370,1381,1392,1404,1415,1426,1437,1449,1460,1471,1482,1494,1505,1516,1527,1538,1549,1561,1572,1583,1594,1605,1616,1627,1639,1650,1661,1672,1683,1694,1705,1716,1727,1738,1749,1760,1771,1782,1793,1804,1815,1826,1837,1848,1859,1869,1880,1891,1902,1913,1924,1934,1944,1954,1963,1973,1983,1993,2003,2013,2023,2033,2043,2053,2062,2072,2082,2092,2102,2112,2122,2131,2141,2151,2161,2171,2180,2190,2200,2210,2220,2229,2239,2249,2259,2268,2278,2288,2298,2307,2317},
+    {344,345,345,346,348,350,352,355,358,362,366,370,375,380,386,391,397,404,410,417,424,431,439,447,455,463,471,479,488,497,506,515,524,533,543,552,562,571,581,591,601,611,621,631,641,652,662,672,683,693,704,714,725,736,746,757,768,779,789,800,811,822,833,844,855,866,877,888,899,910,921,932,943,954,965,976,988,999,1010,1021,1032,1043,1055,1066,1077,1088,1099,1111,1122,1133,1144,1156,1167,1178,1189,1201,1212,1223,1234,1246,1257,1268,1279,1290,1302,1313,1324,1335,1347,1358,1369,1380,1391,1403,1414,1425,1436,1447,1459,1470,1481,1492,1503,1514,1525,1537,1548,1559,1570,1581,1592,1603,1614,1625,1636,1647,1658,1669,1680,1691,1702,1713,1724,1735,1746,1757,1768,1779,1790,1801,1812,1823,1834,1845,1855,1866,1877,1888,1898,1908,1918,1928,1938,1948,1958,1968,1978,1988,1997,2007,2017,2027,2037,2047,2057,2067,2076,2086,2096,2106,2116,2126,2135,2145,2155,2165,2175,2184,2194,2204,2214,2224,2233,2243,2253,2263,2272,2282,2292,2301,2311},
+    {356,356,357,358,360,361,364,366,370,373,377,381,386,391,396,401,407,413,420,426,433,440,448,455,463,471,479,487,496,504,513,522,531,540,549,558,568,577,587,597,606,616,626,636,646,656,667,677,687,698,708,718,729,739,750,761,771,782,793,803,814,825,836,847,857,868,879,890,901,912,923,934,945,956,967,978,989,1000,1011,1022,1033,1045,1056,1067,1078,1089,1100,1111,1123,1134,1145,1156,1167,1178,1190,1201,1212,1223,1234,1245,1257,1268,1279,1290,1301,1312,1324,1335,1346,1357,1368,1379,1390,1402,1413,1424,1435,1446,1457,1468,1479,1491,1502,1513,1524,1535,1546,1557,1568,1579,1590,1601,1612,1623,1634,1645,1656,1667,1678,1689,1700,1711,1722,1733,1744,1755,1766,1776,1787,1798,1809,1820,1831,1842,1852,1863,1873,1883,1893,1903,1913,1923,1933,1942,1952,1962,1972,1982,1992,2002,2012,2022,2031,2041,2051,2061,2071,2081,2091,2100,2110,2120,2130,2140,2149,2159,2169,2179,2189,2198,2208,2218,2228,2237,2247,2257,2266,2276,2286,2296,2305},
+    {368,368,369,370,371,373,375,378,381,384,388,392,396,401,406,411,417,423,429,436,442,449,456,464,471,479,487,495,503,512,520,529,538,547,556,565,574,583,593,602,612,622,632,641,651,661,671,682,692,702,712,723,733,743,754,764,775,785,796,807,817,828,839,849,860,871,882,893,903,914,925,936,947,958,969,980,991,1002,1013,1024,1035,1046,1057,1068,1079,1090,1101,1112,1123,1134,1145,1157,1168,1179,1190,1201,1212,1223,1234,1245,1257,1268,1279,1290,1301,1312,1323,1334,1345,1356,1367,1379,1390,1401,1412,1423,1434,1445,1456,1467,1478,1489,1500,1511,1522,1533,1544,1555,1566,1577,1588,1599,1610,1621,1632,1643,1654,1665,1676,1687,1698,1709,1720,1730,1741,1752,1763,1774,1785,1796,1806,1817,1828,1838,1848,1858,1868,1878,1888,1897,1907,1917,1927,1937,1947,1957,1967,1977,1987,1996,2006,2016,2026,2036,2046,2056,2065,2075,2085,2095,2105,2114,2124,2134,2144,2154,2163,2173,2183,2193,2202,2212,2222,2232,2241,2251,2261,2270,2280,2290,2299},
+    {379,380,380,381,383,384,386,389,392,395,399,403,407,411,416,422,427,433,439,445,452,458,465,472,480,487,495,503,511,519,528,536,545,554,562,571,580,590,599,608,618,627,637,647,657,666,676,686,696,706,717,727,737,747,758,768,779,789,799,810,821,831,842,852,863,874,884,895,906,917,927,938,949,960,971,982,993,1004,1014,1025,1036,1047,1058,1069,1080,1091,1102,1113,1124,1135,1146,1157,1168,1179,1190,1201,1212,1223,1234,1246,1257,1268,1279,1290,1301,1312,1323,1334,1345,1356,1367,1378,1389,1400,1411,1422,1433,1444,1455,1466,1477,1488,1499,1510,1521,1532,1543,1554,1565,1576,1587,1598,1609,1619,1630,1641,1652,1663,1674,1685,1696,1706,1717,1728,1739,1750,1761,1771,1782,1793,1803,1813,1823,1833,1843,1853,1863,1872,1882,1892,1902,1912,1922,1932,1942,1952,1962,1971,1981,1991,2001,2011,2021,2031,2040,2050,2060,2070,2080,2089,2099,2109,2119,2129,2138,2148,2158,2168,2177,2187,2197,2207,2216,2226,2236,2245,2255,2265,2274,2284,2294},
+    {391,391,392,393,394,396,398,400,403,406,410,413,418,422,427,432,437,443,448,455,461,467,474,481,488,496,503,511,519,527,535,543,552,561,569,578,587,596,605,614,624,633,643,652,662,672,681,691,701,711,721,731,741,752,762,772,782,793,803,814,824,834,845,855,866,877,887,898,909,919,930,941,951,962,973,984,995,1005,1016,1027,1038,1049,1060,1071,1081,1092,1103,1114,1125,1136,1147,1158,1169,1180,1191,1202,1213,1224,1235,1246,1257,1268,1279,1290,1301,1312,1323,1334,1345,1355,1366,1377,1388,1399,1410,1421,1432,1443,1454,1465,1476,1487,1498,1509,1520,1531,1541,1552,1563,1574,1585,1596,1607,1618,1629,1639,1650,1661,1672,1683,1693,1704,1715,1726,1737,1747,1758,1768,1778,1788,1798,1808,1818,1828,1838,1848,1858,1867,1877,1887,1897,1907,1917,1927,1937,1947,1956,1966,1976,1986,1996,2006,2015,2025,2035,2045,2055,2065,2074,2084,2094,2104,2113,2123,2133,2143,2153,2162,2172,2182,2191,2201,2211,2221,2230,2240,2250,2259,2269,2279,2288},
+    {402,403,403,404,405,407,409,411,414,417,420,424,428,432,437,442,447,453,458,464,470,477,483,490,497,504,512,519,527,535,543,551,559,568,576,585,594,603,612,621,630,639,649,658,667,677,687,696,706,716,726,736,746,756,766,776,786,797,807,817,828,838,848,859,869,880,890,901,911,922,933,943,954,964,975,986,997,1007,1018,1029,1040,1050,1061,1072,1083,1094,1105,1115,1126,1137,1148,1159,1170,1181,1192,1202,1213,1224,1235,1246,1257,1268,1279,1290,1301,1312,1322,1333,1344,1355,1366,1377,1388,1399,1410,1421,1431,1442,1453,1464,1475,1486,1497,1508,1518,1529,1540,1551,1562,1573,1584,1594,1605,1616,1627,1638,1648,1659,1670,1681,1691,1702,1713,1724,1734,1744,1753,1763,1773,1783,1793,1803,1813,1823,1833,1843,1853,1863,1872,1882,1892,1902,1912,1922,1932,1942,1951,1961,1971,1981,1991,2001,2010,2020,2030,2040,2050,2059,2069,2079,2089,2099,2108,2118,2128,2138,2147,2157,2167,2176,2186,2196,2205,2215,2225,2234,2244,2254,2263,2273,2283},
+    {414,414,415,416,417,418,420,423,425,428,431,435,439,443,447,452,457,462,468,474,480,486,492,499,506,513,520,527,535,543,551,559,567,575,583,592,601,609,618,627,636,645,654,664,673,683,692,702,711,721,731,741,750,760,770,780,791,801,811,821,831,841,852,862,872,883,893,904,914,925,935,946,956,967,978,988,999,1009,1020,1031,1041,1052,1063,1074,1084,1095,1106,1117,1127,1138,1149,1160,1171,1181,1192,1203,1214,1225,1236,1246,1257,1268,1279,1290,1301,1312,1322,1333,1344,1355,1366,1377,1387,1398,1409,1420,1431,1442,1452,1463,1474,1485,1496,1507,1517,1528,1539,1550,1561,1571,1582,1593,1604,1614,1625,1636,1647,1657,1668,1679,1689,1699,1709,1719,1729,1739,1749,1759,1769,1779,1788,1798,1808,1818,1828,1838,1848,1858,1868,1878,1887,1897,1907,1917,1927,1937,1947,1956,1966,1976,1986,1996,2005,2015,2025,2035,2045,2054,2064,2074,2084,2093,2103,2113,2123,2132,2142,2152,2161,2171,2181,2191,2200,2210,2220,2229,2239,2248,2258,2268,2277},
+    {425,426,426,427,428,430,431,434,436,439,442,446,449,453,458,462,467,472,478,483,489,495,502,508,515,522,529,536,543,551,558,566,574,582,591,599,607,616,625,634,642,651,660,670,679,688,698,707,717,726,736,745,755,765,775,785,795,805,815,825,835,845,855,866,876,886,896,907,917,928,938,948,959,969,980,990,1001,1012,1022,1033,1043,1054,1065,1075,1086,1097,1107,1118,1129,1139,1150,1161,1172,1182,1193,1204,1215,1225,1236,1247,1258,1269,1279,1290,1301,1312,1322,1333,1344,1355,1366,1376,1387,1398,1409,1420,1430,1441,1452,1463,1473,1484,1495,1506,1516,1527,1538,1549,1559,1570,1581,1592,1602,1613,1624,1634,1645,1655,1665,1675,1685,1695,1705,1714,1724,1734,1744,1754,1764,1774,1784,1794,1804,1814,1823,1833,1843,1853,1863,1873,1883,1893,1902,1912,1922,1932,1942,1952,1961,1971,1981,1991,2001,2010,2020,2030,2040,2049,2059,2069,2079,2088,2098,2108,2118,2127,2137,2147,2156,2166,2176,2185,2195,2205,2214,2224,2234,2243,2253,2262,2272},
+    {437,437,437,438,439,441,443,445,447,450,453,456,460,464,468,473,477,482,488,493,499,505,511,517,524,530,537,544,551,559,566,574,582,590,598,606,614,623,631,640,649,658,667,676,685,694,703,712,722,731,741,750,760,770,780,789,799,809,819,829,839,849,859,869,879,890,900,910,920,931,941,951,962,972,983,993,1003,1014,1024,1035,1045,1056,1067,1077,1088,1098,1109,1120,1130,1141,1151,1162,1173,1183,1194,1205,1216,1226,1237,1248,1258,1269,1280,1290,1301,1312,1323,1333,1344,1355,1366,1376,1387,1398,1408,1419,1430,1441,1451,1462,1473,1483,1494,1505,1515,1526,1537,1548,1558,1569,1580,1590,1601,1611,1621,1631,1641,1650,1660,1670,1680,1690,1700,1710,1720,1730,1740,1750,1760,1770,1779,1789,1799,1809,1819,1829,1839,1849,1858,1868,1878,1888,1898,1908,1917,1927,1937,1947,1957,1967,1976,1986,1996,2006,2015,2025,2035,2045,2054,2064,2074,2084,2093,2103,2113,2122,2132,2142,2151,2161,2171,2180,2190,2200,2209,2219,2228,2238,2248,2257,2267},
+    {448,448,449,449,451,452,454,456,458,461,464,467,471,474,479,483,487,492,497,503,508,514,520,526,533,539,546,553,560,567,574,582,590,597,605,613,622,630,638,647,655,664,673,682,691,700,709,718,727,737,746,756,765,775,784,794,804,813,823,833,843,853,863,873,883,893,903,913,924,934,944,954,965,975,985,996,1006,1016,1027,1037,1048,1058,1069,1079,1090,1100,1111,1121,1132,1142,1153,1163,1174,1185,1195,1206,1216,1227,1238,1248,1259,1270,1280,1291,1302,1312,1323,1334,1344,1355,1366,1376,1387,1398,1408,1419,1430,1440,1451,1461,1472,1483,1493,1504,1515,1525,1536,1547,1557,1567,1577,1587,1597,1607,1616,1626,1636,1646,1656,1666,1676,1686,1696,1706,1716,1726,1736,1745,1755,1765,1775,1785,1795,1805,1815,1824,1834,1844,1854,1864,1874,1884,1893,1903,1913,1923,1933,1942,1952,1962,1972,1982,1991,2001,2011,2021,2030,2040,2050,2059,2069,2079,2089,2098,2108,2118,2127,2137,2147,2156,2166,2175,2185,2195,2204,2214,2223,2233,2243,2252,2262},
+    {459,459,460,461,462,463,465,467,469,472,475,478,481,485,489,493,498,502,507,512,518,523,529,535,542,548,555,561,568,575,583,590,597,605,613,621,629,637,645,654,662,671,679,688,697,706,715,724,733,742,751,761,770,780,789,799,808,818,828,837,847,857,867,877,887,897,907,917,927,937,947,957,968,978,988,998,1009,1019,1029,1040,1050,1060,1071,1081,1092,1102,1112,1123,1133,1144,1154,1165,1175,1186,1196,1207,1218,1228,1239,1249,1260,1270,1281,1292,1302,1313,1323,1334,1344,1355,1366,1376,1387,1397,1408,1419,1429,1440,1450,1461,1472,1482,1493,1503,1513,1523,1533,1543,1553,1563,1573,1583,1593,1603,1612,1622,1632,1642,1652,1662,1672,1682,1692,1702,1712,1722,1731,1741,1751,1761,1771,1781,1791,1801,1810,1820,1830,1840,1850,1860,1869,1879,1889,1899,1909,1918,1928,1938,1948,1958,1967,1977,1987,1997,2006,2016,2026,2035,2045,2055,2065,2074,2084,2094,2103,2113,2123,2132,2142,2151,2161,2171,2180,2190,2199,2209,2219,2228,2238,2247,2257},
+    {471,471,471,472,473,474,476,478,480,483,485,489,492,495,499,503,508,512,517,522,528,533,539,545,551,557,563,570,577,584,591,598,605,613,620,628,636,644,652,660,669,677,686,694,703,712,721,730,739,748,757,766,775,785,794,804,813,823,832,842,852,861,871,881,891,901,911,920,930,940,951,961,971,981,991,1001,1011,1022,1032,1042,1052,1063,1073,1083,1094,1104,1114,1125,1135,1146,1156,1166,1177,1187,1198,1208,1219,1229,1240,1250,1261,1271,1282,1292,1303,1313,1324,1334,1345,1355,1366,1376,1387,1398,1408,1419,1429,1439,1449,1459,1469,1479,1489,1499,1509,1519,1529,1539,1549,1559,1569,1579,1589,1599,1609,1619,1628,1638,1648,1658,1668,1678,1688,1698,1708,1718,1727,1737,1747,1757,1767,1777,1787,1796,1806,1816,1826,1836,1846,1855,1865,1875,1885,1895,1904,1914,1924,1934,1943,1953,1963,1973,1982,1992,2002,2012,2021,2031,2041,2050,2060,2070,2079,2089,2099,2108,2118,2128,2137,2147,2156,2166,2176,2185,2195,2204,2214,2223,2233,2242,2252},
+    {482,482,482,483,484,485,487,489,491,493,496,499,502,506,510,514,518,522,527,532,537,543,548,554,560,566,572,579,585,592,599,606,613,621,628,636,644,651,659,667,676,684,692,701,709,718,727,736,744,753,762,772,781,790,799,809,818,827,837,846,856,866,875,885,895,904,914,924,934,944,954,964,974,984,994,1004,1014,1024,1034,1045,1055,1065,1075,1086,1096,1106,1116,1127,1137,1147,1158,1168,1178,1189,1199,1210,1220,1230,1241,1251,1262,1272,1283,1293,1303,1314,1324,1335,1345,1356,1366,1376,1386,1396,1406,1416,1426,1436,1446,1456,1466,1476,1486,1496,1506,1516,1525,1535,1545,1555,1565,1575,1585,1595,1605,1615,1625,1635,1645,1654,1664,1674,1684,1694,1704,1714,1724,1733,1743,1753,1763,1773,1783,1792,1802,1812,1822,1832,1842,1851,1861,1871,1881,1890,1900,1910,1920,1930,1939,1949,1959,1968,1978,1988,1998,2007,2017,2027,2036,2046,2056,2065,2075,2085,2094,2104,2113,2123,2133,2142,2152,2161,2171,2180,2190,2200,2209,2219,2228,2238,2247},
+    {493,493,493,494,495,496,498,500,502,504,507,510,513,516,520,524,528,532,537,542,547,552,557,563,569,575,581,587,594,600,607,614,621,629,636,643,651,659,667,675,683,691,699,707,716,724,733,742,750,759,768,777,786,795,804,814,823,832,842,851,860,870,880,889,899,908,918,928,938,948,957,967,977,987,997,1007,1017,1027,1037,1047,1057,1068,1078,1088,1098,1108,1118,1129,1139,1149,1159,1170,1180,1190,1201,1211,1221,1232,1242,1252,1263,1273,1283,1293,1303,1313,1323,1333,1343,1353,1363,1373,1383,1393,1403,1413,1423,1433,1442,1452,1462,1472,1482,1492,1502,1512,1522,1532,1542,1552,1562,1572,1582,1591,1601,1611,1621,1631,1641,1651,1661,1671,1680,1690,1700,1710,1720,1730,1740,1749,1759,1769,1779,1789,1798,1808,1818,1828,1838,1847,1857,1867,1877,1886,1896,1906,1916,1925,1935,1945,1955,1964,1974,1984,1993,2003,2013,2022,2032,2042,2051,2061,2071,2080,2090,2099,2109,2119,2128,2138,2147,2157,2166,2176,2185,2195,2204,2214,2223,2233,2242},
+    {504,504,505,505,506,507,509,511,513,515,518,520,524,527,530,534,538,542,547,552,557,562,567,572,578,584,590,596,603,609,616,622,629,637,644,651,659,666,674,682,690,698,706,714,722,731,739,748,756,765,774,783,792,801,810,819,828,837,846,856,865,875,884,893,903,913,922,932,942,951,961,971,981,991,1000,1010,1020,1030,1040,1050,1060,1070,1080,1090,1100,1111,1121,1131,1140,1150,1160,1170,1180,1190,1200,1210,1220,1230,1240,1250,1260,1270,1280,1290,1300,1310,1320,1330,1340,1350,1360,1370,1380,1390,1399,1409,1419,1429,1439,1449,1459,1469,1479,1489,1499,1509,1519,1529,1539,1548,1558,1568,1578,1588,1598,1608,1618,1628,1637,1647,1657,1667,1677,1687,1697,1706,1716,1726,1736,1746,1756,1765,1775,1785,1795,1805,1814,1824,1834,1844,1853,1863,1873,1883,1892,1902,1912,1922,1931,1941,1951,1960,1970,1980,1989,1999,2009,2018,2028,2038,2047,2057,2066,2076,2086,2095,2105,2114,2124,2133,2143,2152,2162,2171,2181,2190,2200,2209,2219,2228,2238},
+    {515,515,515,516,517,518,519,521,523,525,528,531,534,537,540,544,548,552,556,561,566,571,576,581,587,593,598,604,611,617,624,630,637,644,651,658,666,673,681,688,696,704,712,720,728,737,745,753,762,770,779,788,796,805,814,823,832,841,850,860,869,878,887,897,906,916,925,935,944,954,963,973,983,993,1002,1012,1022,1032,1041,1051,1061,1071,1081,1091,1101,1111,1120,1130,1140,1150,1160,1170,1180,1190,1200,1210,1220,1230,1240,1250,1260,1270,1280,1289,1299,1309,1319,1329,1339,1349,1359,1369,1379,1389,1399,1409,1418,1428,1438,1448,1458,1468,1478,1488,1498,1508,1517,1527,1537,1547,1557,1567,1577,1587,1596,1606,1616,1626,1636,1646,1656,1665,1675,1685,1695,1705,1714,1724,1734,1744,1754,1763,1773,1783,1793,1802,1812,1822,1832,1841,1851,1861,1871,1880,1890,1900,1909,1919,1929,1938,1948,1958,1967,1977,1987,1996,2006,2015,2025,2035,2044,2054,2063,2073,2083,2092,2102,2111,2121,2130,2140,2149,2159,2168,2178,2187,2197,2206,2215,2225,2234},
+    {525,525,526,526,527,529,530,532,534,536,538,541,544,547,550,554,558,562,566,570,575,580,585,590,596,601,607,613,619,625,632,638,645,652,659,666,673,680,688,695,703,710,718,726,734,742,751,759,767,776,784,793,801,810,819,828,837,846,855,864,873,882,891,900,910,919,928,938,947,957,966,976,985,995,1005,1014,1024,1034,1043,1053,1063,1072,1082,1092,1102,1112,1121,1131,1141,1151,1161,1171,1181,1190,1200,1210,1220,1230,1240,1250,1260,1270,1279,1289,1299,1309,1319,1329,1339,1349,1359,1368,1378,1388,1398,1408,1418,1428,1438,1447,1457,1467,1477,1487,1497,1507,1516,1526,1536,1546,1556,1566,1575,1585,1595,1605,1615,1625,1634,1644,1654,1664,1674,1683,1693,1703,1713,1722,1732,1742,1752,1761,1771,1781,1791,1800,1810,1820,1830,1839,1849,1859,1868,1878,1888,1897,1907,1917,1926,1936,1946,1955,1965,1974,1984,1994,2003,2013,2022,2032,2041,2051,2061,2070,2080,2089,2099,2108,2118,2127,2137,2146,2156,2165,2174,2184,2193,2203,2212,2222,2231},
+    {536,536,536,537,538,539,540,542,544,546,548,551,554,557,560,564,567,571,576,580,584,589,594,599,604,610,616,621,627,633,640,646,653,659,666,673,680,687,695,702,709,717,725,733,740,748,757,765,773,781,790,798,807,815,824,833,841,850,859,868,877,886,895,904,913,923,932,941,951,960,969,979,988,998,1007,1017,1026,1036,1045,1055,1065,1074,1084,1094,1103,1113,1123,1133,1142,1152,1162,1172,1181,1191,1201,1211,1221,1230,1240,1250,1260,1270,1280,1289,1299,1309,1319,1329,1339,1349,1358,1368,1378,1388,1398,1408,1417,1427,1437,1447,1457,1466,1476,1486,1496,1506,1516,1525,1535,1545,1555,1565,1574,1584,1594,1604,1614,1623,1633,1643,1653,1662,1672,1682,1692,1701,1711,1721,1731,1740,1750,1760,1769,1779,1789,1799,1808,1818,1828,1837,1847,1857,1866,1876,1885,1895,1905,1914,1924,1934,1943,1953,1962,1972,1981,1991,2001,2010,2020,2029,2039,2048,2058,2067,2077,2086,2096,2105,2115,2124,2134,2143,2152,2162,2171,2181,2190,2200,2209,2218,2228},
+    {546,547,547,548,548,549,551,552,554,556,559,561,564,567,570,574,577,581,585,589,594,598,603,608,613,619,624,630,636,642,648,654,660,667,674,681,687,694,702,709,716,724,731,739,747,755,763,771,779,787,795,804,812,820,829,838,846,855,864,872,881,890,899,908,917,926,936,945,954,963,972,982,991,1000,1010,1019,1029,1038,1048,1057,1067,1076,1086,1096,1105,1115,1124,1134,1144,1153,1163,1173,1183,1192,1202,1212,1222,1231,1241,1251,1261,1270,1280,1290,1300,1309,1319,1329,1339,1349,1358,1368,1378,1388,1398,1407,1417,1427,1437,1446,1456,1466,1476,1486,1495,1505,1515,1525,1534,1544,1554,1564,1573,1583,1593,1603,1612,1622,1632,1642,1651,1661,1671,1680,1690,1700,1710,1719,1729,1739,1748,1758,1768,1777,1787,1797,1806,1816,1826,1835,1845,1855,1864,1874,1883,1893,1903,1912,1922,1931,1941,1950,1960,1970,1979,1989,1998,2008,2017,2027,2036,2046,2055,2065,2074,2083,2093,2102,2112,2121,2131,2140,2149,2159,2168,2178,2187,2196,2206,2215,2224},
+    {557,557,557,558,559,560,561,563,565,567,569,571,574,577,580,583,587,591,595,599,603,608,612,617,622,627,633,638,644,650,656,662,668,675,681,688,695,702,709,716,723,731,738,746,753,761,769,777,785,793,801,809,817,826,834,843,851,860,868,877,886,895,903,912,921,930,939,948,958,967,976,985,994,1004,1013,1022,1032,1041,1050,1060,1069,1079,1088,1098,1107,1117,1126,1136,1145,1155,1165,1174,1184,1194,1203,1213,1223,1232,1242,1252,1261,1271,1281,1290,1300,1310,1320,1329,1339,1349,1359,1368,1378,1388,1398,1407,1417,1427,1436,1446,1456,1466,1475,1485,1495,1505,1514,1524,1534,1543,1553,1563,1573,1582,1592,1602,1611,1621,1631,1641,1650,1660,1670,1679,1689,1699,1708,1718,1728,1737,1747,1756,1766,1776,1785,1795,1805,1814,1824,1833,1843,1853,1862,1872,1881,1891,1900,1910,1920,1929,1939,1948,1958,1967,1977,1986,1996,2005,2015,2024,2034,2043,2053,2062,2071,2081,2090,2100,2109,2118,2128,2137,2147,2156,2165,2175,2184,2193,2203,2212,2221},
+    {567,568,568,568,569,570,572,573,575,577,579,581,584,587,590,593,597,600,604,608,612,617,621,626,631,636,642,647,653,658,664,670,676,683,689,696,702,709,716,723,730,737,745,752,760,767,775,783,791,799,807,815,823,831,839,848,856,865,873,882,890,899,908,917,925,934,943,952,961,970,979,988,998,1007,1016,1025,1034,1044,1053,1062,1072,1081,1091,1100,1109,1119,1128,1138,1147,1157,1166,1176,1186,1195,1205,1214,1224,1233,1243,1253,1262,1272,1282,1291,1301,1311,1320,1330,1340,1349,1359,1369,1378,1388,1398,1407,1417,1427,1436,1446,1456,1465,1475,1485,1495,1504,1514,1524,1533,1543,1553,1562,1572,1582,1591,1601,1611,1620,1630,1640,1649,1659,1668,1678,1688,1697,1707,1717,1726,1736,1745,1755,1765,1774,1784,1793,1803,1813,1822,1832,1841,1851,1860,1870,1879,1889,1898,1908,1918,1927,1937,1946,1956,1965,1974,1984,1993,2003,2012,2022,2031,2041,2050,2059,2069,2078,2088,2097,2106,2116,2125,2134,2144,2153,2162,2172,2181,2190,2200,2209,2217},
+    {578,578,578,579,580,581,582,583,585,587,589,591,594,597,600,603,606,610,614,618,622,626,631,635,640,645,650,656,661,667,672,678,684,691,697,703,710,717,723,730,737,744,752,759,766,774,781,789,797,805,812,820,828,837,845,853,861,870,878,887,895,904,912,921,930,939,947,956,965,974,983,992,1001,1010,1019,1028,1038,1047,1056,1065,1075,1084,1093,1102,1112,1121,1131,1140,1149,1159,1168,1178,1187,1197,1206,1216,1225,1235,1244,1254,1264,1273,1283,1292,1302,1311,1321,1331,1340,1350,1359,1369,1379,1388,1398,1408,1417,1427,1437,1446,1456,1465,1475,1485,1494,1504,1514,1523,1533,1542,1552,1562,1571,1581,1591,1600,1610,1619,1629,1639,1648,1658,1667,1677,1687,1696,1706,1715,1725,1735,1744,1754,1763,1773,1782,1792,1801,1811,1821,1830,1840,1849,1859,1868,1878,1887,1897,1906,1916,1925,1935,1944,1953,1963,1972,1982,1991,2001,2010,2019,2029,2038,2048,2057,2066,2076,2085,2094,2104,2113,2122,2132,2141,2150,2160,2169,2178,2187,2195,2203,2211},
+    {588,588,589,589,590,591,592,594,595,597,599,602,604,607,610,613,616,620,623,627,631,635,640,644,649,654,659,664,670,675,681,687,692,699,705,711,717,724,731,737,744,751,758,766,773,780,788,795,803,811,818,826,834,842,850,858,867,875,883,892,900,908,917,926,934,943,952,960,969,978,987,996,1005,1014,1023,1032,1041,1050,1059,1068,1077,1087,1096,1105,1114,1124,1133,1142,1152,1161,1170,1180,1189,1199,1208,1217,1227,1236,1246,1255,1265,1274,1284,1293,1303,1312,1322,1332,1341,1351,1360,1370,1379,1389,1398,1408,1418,1427,1437,1446,1456,1466,1475,1485,1494,1504,1513,1523,1533,1542,1552,1561,1571,1581,1590,1600,1609,1619,1628,1638,1647,1657,1667,1676,1686,1695,1705,1714,1724,1733,1743,1752,1762,1772,1781,1791,1800,1810,1819,1829,1838,1848,1857,1866,1876,1885,1895,1904,1914,1923,1933,1942,1951,1961,1970,1980,1989,1998,2008,2017,2027,2036,2045,2055,2064,2073,2083,2092,2101,2110,2120,2129,2138,2148,2157,2165,2173,2181,2190,2198,2206},
+    {599,599,599,600,600,601,603,604,606,607,609,612,614,617,620,623,626,629,633,637,641,645,649,653,658,663,668,673,678,684,689,695,701,707,713,719,725,732,738,745,752,758,765,772,780,787,794,802,809,817,824,832,840,848,856,864,872,880,888,897,905,913,922,930,939,947,956,965,973,982,991,1000,1008,1017,1026,1035,1044,1053,1062,1071,1080,1090,1099,1108,1117,1126,1135,1145,1154,1163,1173,1182,1191,1201,1210,1219,1229,1238,1247,1257,1266,1276,1285,1295,1304,1314,1323,1333,1342,1352,1361,1371,1380,1390,1399,1409,1418,1428,1437,1447,1456,1466,1475,1485,1494,1504,1513,1523,1533,1542,1552,1561,1571,1580,1590,1599,1609,1618,1628,1637,1647,1656,1666,1675,1685,1694,1704,1713,1723,1732,1742,1751,1761,1770,1780,1789,1799,1808,1818,1827,1837,1846,1855,1865,1874,1884,1893,1903,1912,1921,1931,1940,1949,1959,1968,1978,1987,1996,2006,2015,2024,2034,2043,2052,2062,2071,2080,2089,2099,2108,2117,2127,2135,2143,2151,2160,2168,2176,2184,2193,2201},
+    {609,609,609,610,611,612,613,614,616,617,619,622,624,627,629,632,635,639,642,646,650,654,658,663,667,672,677,682,687,692,698,703,709,715,721,727,733,739,746,752,759,766,772,779,786,794,801,808,816,823,831,838,846,854,862,869,877,885,894,902,910,918,927,935,943,952,960,969,978,986,995,1004,1012,1021,1030,1039,1048,1057,1066,1075,1084,1093,1102,1111,1120,1129,1138,1147,1156,1166,1175,1184,1193,1203,1212,1221,1231,1240,1249,1259,1268,1277,1287,1296,1305,1315,1324,1334,1343,1353,1362,1371,1381,1390,1400,1409,1419,1428,1438,1447,1457,1466,1476,1485,1495,1504,1513,1523,1532,1542,1551,1561,1570,1580,1589,1599,1608,1618,1627,1637,1646,1656,1665,1675,1684,1694,1703,1713,1722,1731,1741,1750,1760,1769,1779,1788,1797,1807,1816,1826,1835,1845,1854,1863,1873,1882,1891,1901,1910,1920,1929,1938,1948,1957,1966,1976,1985,1994,2004,2013,2022,2032,2041,2050,2059,2069,2078,2087,2096,2105,2113,2122,2130,2138,2146,2155,2163,2171,2179,2187,2196},
+    {619,619,620,620,621,622,623,624,626,628,629,632,634,636,639,642,645,648,652,655,659,663,667,672,676,681,685,690,695,701,706,711,717,723,729,735,741,747,753,760,766,773,780,786,793,800,807,815,822,829,837,844,852,860,867,875,883,891,899,907,915,923,932,940,948,956,965,973,982,990,999,1008,1016,1025,1034,1042,1051,1060,1069,1078,1087,1096,1105,1114,1123,1132,1141,1150,1159,1168,1177,1186,1196,1205,1214,1223,1233,1242,1251,1260,1270,1279,1288,1298,1307,1316,1326,1335,1344,1354,1363,1372,1382,1391,1401,1410,1419,1429,1438,1448,1457,1467,1476,1485,1495,1504,1514,1523,1533,1542,1551,1561,1570,1580,1589,1599,1608,1618,1627,1636,1646,1655,1665,1674,1683,1693,1702,1712,1721,1731,1740,1749,1759,1768,1778,1787,1796,1806,1815,1824,1834,1843,1853,1862,1871,1881,1890,1899,1909,1918,1927,1937,1946,1955,1965,1974,1983,1992,2002,2011,2020,2029,2039,2048,2057,2066,2075,2083,2092,2100,2108,2116,2125,2133,2141,2149,2158,2166,2174,2182,2191},
+    {629,630,630,630,631,632,633,634,636,638,640,642,644,646,649,652,655,658,661,665,669,673,677,681,685,690,694,699,704,709,714,720,725,731,737,742,748,755,761,767,774,780,787,793,800,807,814,821,828,836,843,851,858,866,873,881,889,897,904,912,920,928,937,945,953,961,970,978,986,995,1003,1012,1020,1029,1038,1046,1055,1064,1073,1081,1090,1099,1108,1117,1126,1135,1144,1153,1162,1171,1180,1189,1198,1207,1216,1225,1235,1244,1253,1262,1271,1281,1290,1299,1308,1318,1327,1336,1346,1355,1364,1374,1383,1392,1402,1411,1420,1430,1439,1448,1458,1467,1476,1486,1495,1505,1514,1523,1533,1542,1552,1561,1570,1580,1589,1599,1608,1617,1627,1636,1645,1655,1664,1674,1683,1692,1702,1711,1720,1730,1739,1749,1758,1767,1777,1786,1795,1805,1814,1823,1833,1842,1851,1861,1870,1879,1889,1898,1907,1916,1926,1935,1944,1954,1963,1972,1981,1991,2000,2009,2018,2027,2037,2045,2054,2062,2070,2079,2087,2095,2103,2112,2120,2128,2136,2145,2153,2161,2169,2177,2186},
+    {640,640,640,641,641,642,643,645,646,648,650,652,654,656,659,662,664,668,671,674,678,682,686,690,694,699,703,708,713,718,723,728,733,739,745,750,756,762,768,775,781,787,794,801,807,814,821,828,835,842,849,857,864,872,879,887,894,902,910,918,926,934,942,950,958,966,974,983,991,999,1008,1016,1025,1033,1042,1050,1059,1067,1076,1085,1094,1102,1111,1120,1129,1138,1147,1156,1165,1174,1183,1192,1201,1210,1219,1228,1237,1246,1255,1264,1273,1283,1292,1301,1310,1319,1329,1338,1347,1356,1366,1375,1384,1393,1403,1412,1421,1431,1440,1449,1458,1468,1477,1486,1496,1505,1514,1524,1533,1542,1552,1561,1570,1580,1589,1598,1608,1617,1626,1636,1645,1654,1664,1673,1682,1692,1701,1710,1720,1729,1738,1748,1757,1766,1776,1785,1794,1804,1813,1822,1831,1841,1850,1859,1869,1878,1887,1896,1906,1915,1924,1933,1943,1952,1961,1970,1980,1989,1998,2007,2016,2024,2032,2041,2049,2057,2065,2074,2082,2090,2098,2107,2115,2123,2131,2140,2148,2156,2164,2173,2181},
+    {650,650,650,651,651,652,653,655,656,658,659,661,664,666,669,671,674,677,680,684,687,691,695,699,703,708,712,717,721,726,731,736,742,747,753,758,764,770,776,782,788,795,801,808,814,821,828,835,842,849,856,863,870,878,885,893,900,908,916,923,931,939,947,955,963,971,979,987,996,1004,1012,1020,1029,1037,1046,1054,1063,1071,1080,1089,1097,1106,1115,1123,1132,1141,1150,1159,1168,1176,1185,1194,1203,1212,1221,1230,1239,1248,1257,1266,1275,1285,1294,1303,1312,1321,1330,1339,1349,1358,1367,1376,1385,1395,1404,1413,1422,1432,1441,1450,1459,1469,1478,1487,1496,1506,1515,1524,1533,1543,1552,1561,1571,1580,1589,1598,1608,1617,1626,1636,1645,1654,1664,1673,1682,1691,1701,1710,1719,1729,1738,1747,1756,1766,1775,1784,1793,1803,1812,1821,1830,1840,1849,1858,1867,1877,1886,1895,1904,1914,1923,1932,1941,1950,1960,1969,1978,1986,1995,2003,2011,2019,2028,2036,2044,2052,2061,2069,2077,2085,2094,2102,2110,2118,2127,2135,2143,2151,2160,2168,2176},
+    {660,660,660,661,662,662,663,665,666,668,669,671,674,676,678,681,684,687,690,693,697,700,704,708,712,716,721,725,730,735,740,745,750,755,761,766,772,778,784,790,796,802,809,815,821,828,835,842,848,855,862,870,877,884,891,899,906,914,921,929,937,944,952,960,968,976,984,992,1000,1008,1017,1025,1033,1042,1050,1058,1067,1075,1084,1092,1101,1110,1118,1127,1136,1144,1153,1162,1171,1179,1188,1197,1206,1215,1224,1233,1242,1251,1260,1269,1278,1287,1296,1305,1314,1323,1332,1341,1350,1359,1368,1378,1387,1396,1405,1414,1423,1433,1442,1451,1460,1469,1479,1488,1497,1506,1515,1525,1534,1543,1552,1562,1571,1580,1589,1599,1608,1617,1626,1636,1645,1654,1663,1673,1682,1691,1700,1710,1719,1728,1737,1746,1756,1765,1774,1783,1793,1802,1811,1820,1829,1839,1848,1857,1866,1875,1885,1894,1903,1912,1921,1931,1940,1949,1957,1965,1974,1982,1990,1998,2007,2015,2023,2031,2040,2048,2056,2064,2073,2081,2089,2097,2105,2114,2122,2130,2138,2147,2155,2163,2171},
+    {670,670,671,671,672,672,673,675,676,678,679,681,683,686,688,691,693,696,699,703,706,710,713,717,721,725,730,734,739,744,748,753,758,764,769,775,780,786,792,798,804,810,816,822,829,835,842,848,855,862,869,876,883,890,897,905,912,920,927,935,942,950,958,965,973,981,989,997,1005,1013,1021,1029,1038,1046,1054,1063,1071,1079,1088,1096,1105,1113,1122,1130,1139,1148,1156,1165,1174,1182,1191,1200,1209,1218,1226,1235,1244,1253,1262,1271,1280,1289,1298,1307,1316,1325,1334,1343,1352,1361,1370,1379,1388,1397,1406,1416,1425,1434,1443,1452,1461,1470,1480,1489,1498,1507,1516,1525,1535,1544,1553,1562,1571,1580,1590,1599,1608,1617,1626,1636,1645,1654,1663,1672,1682,1691,1700,1709,1718,1728,1737,1746,1755,1764,1774,1783,1792,1801,1810,1819,1829,1838,1847,1856,1865,1874,1884,1893,1902,1911,1919,1928,1936,1944,1953,1961,1969,1977,1986,1994,2002,2010,2019,2027,2035,2043,2052,2060,2068,2076,2084,2093,2101,2109,2117,2126,2134,2142,2150,2158,2167},
+    {680,680,681,681,682,683,684,685,686,688,689,691,693,695,698,700,703,706,709,712,715,719,723,726,730,734,739,743,747,752,757,762,767,772,777,783,788,794,799,805,811,817,823,830,836,842,849,855,862,869,876,883,889,897,904,911,918,925,933,940,948,955,963,971,979,986,994,1002,1010,1018,1026,1034,1042,1050,1059,1067,1075,1083,1092,1100,1109,1117,1126,1134,1143,1151,1160,1168,1177,1186,1194,1203,1212,1221,1229,1238,1247,1256,1265,1273,1282,1291,1300,1309,1318,1327,1336,1345,1354,1363,1372,1381,1390,1399,1408,1417,1426,1435,1444,1453,1462,1471,1481,1490,1499,1508,1517,1526,1535,1544,1554,1563,1572,1581,1590,1599,1608,1618,1627,1636,1645,1654,1663,1672,1682,1691,1700,1709,1718,1727,1736,1746,1755,1764,1773,1782,1791,1800,1810,1819,1828,1837,1846,1855,1864,1873,1882,1890,1899,1907,1915,1923,1932,1940,1948,1956,1965,1973,1981,1989,1998,2006,2014,2022,2031,2039,2047,2055,2064,2072,2080,2088,2096,2105,2113,2121,2129,2138,2146,2154,2162},
+    {690,690,691,691,692,693,693,695,696,697,699,701,703,705,707,710,713,715,718,721,725,728,732,735,739,743,748,752,756,761,765,770,775,780,785,791,796,802,807,813,819,825,831,837,843,849,856,862,869,876,882,889,896,903,910,917,924,931,939,946,954,961,969,976,984,992,999,1007,1015,1023,1031,1039,1047,1055,1063,1071,1079,1088,1096,1104,1113,1121,1129,1138,1146,1155,1163,1172,1180,1189,1197,1206,1215,1223,1232,1241,1250,1258,1267,1276,1285,1294,1302,1311,1320,1329,1338,1347,1356,1365,1374,1383,1392,1401,1409,1418,1427,1436,1446,1455,1464,1473,1482,1491,1500,1509,1518,1527,1536,1545,1554,1563,1572,1581,1591,1600,1609,1618,1627,1636,1645,1654,1663,1672,1682,1691,1700,1709,1718,1727,1736,1745,1754,1763,1773,1782,1791,1800,1809,1818,1827,1836,1845,1853,1861,1869,1878,1886,1894,1903,1911,1919,1927,1936,1944,1952,1960,1969,1977,1985,1993,2002,2010,2018,2026,2035,2043,2051,2059,2067,2076,2084,2092,2100,2108,2117,2125,2133,2141,2149,2158},
+    {700,700,701,701,702,702,703,705,706,707,709,711,713,715,717,720,722,725,728,731,734,737,741,745,748,752,756,761,765,769,774,779,784,789,794,799,804,810,815,821,826,832,838,844,850,857,863,869,876,882,889,896,903,909,916,923,930,938,945,952,959,967,974,982,989,997,1005,1012,1020,1028,1036,1044,1052,1060,1068,1076,1084,1092,1100,1108,1117,1125,1133,1142,1150,1158,1167,1175,1184,1192,1201,1209,1218,1227,1235,1244,1252,1261,1270,1279,1287,1296,1305,1314,1322,1331,1340,1349,1358,1367,1376,1384,1393,1402,1411,1420,1429,1438,1447,1456,1465,1474,1483,1492,1501,1510,1519,1528,1537,1546,1555,1564,1573,1582,1591,1600,1609,1618,1627,1636,1645,1654,1664,1673,1682,1691,1700,1709,1718,1727,1736,1745,1754,1763,1772,1781,1790,1799,1807,1816,1824,1832,1841,1849,1857,1865,1874,1882,1890,1898,1907,1915,1923,1931,1940,1948,1956,1964,1973,1981,1989,1997,2006,2014,2022,2030,2038,2047,2055,2063,2071,2080,2088,2096,2104,2112,2121,2129,2137,2145,2153},
+    {710,710,711,711,712,712,713,714,716,717,719,720,722,724,727,729,732,734,737,740,743,747,750,754,757,761,765,769,774,778,783,787,792,797,802,807,812,818,823,829,834,840,846,852,858,864,870,876,883,889,896,902,909,916,923,930,937,944,951,958,965,973,980,987,995,1002,1010,1018,1025,1033,1041,1049,1056,1064,1072,1080,1088,1096,1104,1113,1121,1129,1137,1145,1154,1162,1170,1179,1187,1196,1204,1213,1221,1230,1238,1247,1255,1264,1273,1281,1290,1299,1307,1316,1325,1334,1342,1351,1360,1369,1378,1386,1395,1404,1413,1422,1431,1440,1448,1457,1466,1475,1484,1493,1502,1511,1520,1529,1538,1547,1556,1565,1574,1583,1592,1601,1610,1619,1628,1637,1646,1655,1664,1673,1682,1691,1700,1709,1718,1727,1736,1745,1754,1762,1770,1779,1787,1795,1803,1812,1820,1828,1836,1845,1853,1861,1870,1878,1886,1894,1903,1911,1919,1927,1936,1944,1952,1960,1969,1977,1985,1993,2001,2010,2018,2026,2034,2043,2051,2059,2067,2075,2084,2092,2100,2108,2116,2125,2133,2141,2149},
+    {720,720,721,721,722,722,723,724,726,727,729,730,732,734,736,739,741,744,747,750,753,756,759,763,766,770,774,778,782,787,791,796,800,805,810,815,820,826,831,836,842,848,853,859,865,871,877,883,890,896,903,909,916,922,929,936,943,950,957,964,971,978,986,993,1000,1008,1015,1023,1030,1038,1046,1053,1061,1069,1077,1085,1093,1101,1109,1117,1125,1133,1141,1149,1158,1166,1174,1182,1191,1199,1208,1216,1224,1233,1241,1250,1258,1267,1275,1284,1293,1301,1310,1319,1327,1336,1345,1353,1362,1371,1380,1388,1397,1406,1415,1424,1432,1441,1450,1459,1468,1477,1485,1494,1503,1512,1521,1530,1539,1548,1557,1566,1575,1584,1592,1601,1610,1619,1628,1637,1646,1655,1664,1673,1682,1691,1700,1708,1717,1725,1733,1742,1750,1758,1766,1775,1783,1791,1800,1808,1816,1824,1833,1841,1849,1857,1866,1874,1882,1890,1899,1907,1915,1923,1932,1940,1948,1956,1965,1973,1981,1989,1997,2006,2014,2022,2030,2039,2047,2055,2063,2071,2079,2088,2096,2104,2112,2120,2129,2137,2145},
+    {730,730,731,731,731,732,733,734,735,737,738,740,742,744,746,748,751,753,756,759,762,765,768,772,776,779,783,787,791,795,800,804,809,814,818,823,828,834,839,844,850,855,861,867,873,878,885,891,897,903,909,916,922,929,936,942,949,956,963,970,977,984,991,999,1006,1013,1021,1028,1036,1043,1051,1059,1066,1074,1082,1090,1097,1105,1113,1121,1129,1137,1145,1153,1162,1170,1178,1186,1194,1203,1211,1219,1228,1236,1245,1253,1261,1270,1278,1287,1295,1304,1313,1321,1330,1338,1347,1356,1364,1373,1382,1390,1399,1408,1417,1425,1434,1443,1452,1461,1469,1478,1487,1496,1505,1513,1522,1531,1540,1549,1558,1567,1575,1584,1593,1602,1611,1620,1629,1638,1647,1655,1663,1672,1680,1688,1696,1705,1713,1721,1730,1738,1746,1754,1763,1771,1779,1787,1796,1804,1812,1821,1829,1837,1845,1854,1862,1870,1878,1887,1895,1903,1911,1919,1928,1936,1944,1952,1961,1969,1977,1985,1994,2002,2010,2018,2026,2035,2043,2051,2059,2067,2075,2084,2092,2100,2108,2116,2125,2133,2141},
+    {740,740,740,741,741,742,743,744,745,747,748,750,751,753,756,758,760,763,765,768,771,774,778,781,785,788,792,796,800,804,808,813,817,822,827,832,837,842,847,852,857,863,869,874,880,886,892,898,904,910,916,923,929,936,942,949,956,962,969,976,983,990,997,1004,1012,1019,1026,1034,1041,1049,1056,1064,1071,1079,1087,1094,1102,1110,1118,1126,1134,1142,1150,1158,1166,1174,1182,1190,1198,1206,1215,1223,1231,1240,1248,1256,1265,1273,1281,1290,1298,1307,1315,1324,1332,1341,1350,1358,1367,1375,1384,1393,1401,1410,1419,1427,1436,1445,1453,1462,1471,1480,1488,1497,1506,1515,1524,1532,1541,1550,1559,1568,1576,1585,1593,1602,1610,1618,1627,1635,1643,1651,1660,1668,1676,1685,1693,1701,1709,1718,1726,1734,1742,1751,1759,1767,1776,1784,1792,1800,1809,1817,1825,1833,1842,1850,1858,1866,1875,1883,1891,1899,1907,1916,1924,1932,1940,1949,1957,1965,1973,1981,1990,1998,2006,2014,2022,2031,2039,2047,2055,2063,2072,2080,2088,2096,2104,2112,2121,2129,2137},
+    {750,750,750,751,751,752,753,754,755,756,758,759,761,763,765,767,770,772,775,778,781,784,787,790,794,797,801,805,809,813,817,821,826,830,835,840,845,850,855,860,865,871,876,882,887,893,899,905,911,917,923,930,936,942,949,955,962,969,976,982,989,996,1003,1010,1017,1025,1032,1039,1046,1054,1061,1069,1076,1084,1091,1099,1107,1115,1122,1130,1138,1146,1154,1162,1170,1178,1186,1194,1202,1210,1218,1227,1235,1243,1251,1260,1268,1276,1285,1293,1301,1310,1318,1327,1335,1344,1352,1361,1369,1378,1386,1395,1403,1412,1421,1429,1438,1447,1455,1464,1473,1481,1490,1499,1507,1515,1524,1532,1540,1548,1557,1565,1573,1582,1590,1598,1606,1615,1623,1631,1640,1648,1656,1664,1673,1681,1689,1698,1706,1714,1722,1731,1739,1747,1755,1764,1772,1780,1788,1797,1805,1813,1821,1830,1838,1846,1854,1863,1871,1879,1887,1896,1904,1912,1920,1929,1937,1945,1953,1961,1970,1978,1986,1994,2002,2011,2019,2027,2035,2043,2051,2060,2068,2076,2084,2092,2100,2109,2117,2125,2133},
+    {760,760,760,760,761,762,763,763,765,766,767,769,771,773,775,777,779,782,784,787,790,793,796,799,803,806,810,814,817,821,826,830,834,839,843,848,853,858,863,868,873,878,884,889,895,901,906,912,918,924,930,937,943,949,956,962,969,975,982,989,995,1002,1009,1016,1023,1030,1037,1045,1052,1059,1067,1074,1081,1089,1096,1104,1112,1119,1127,1135,1143,1150,1158,1166,1174,1182,1190,1198,1206,1214,1222,1230,1238,1247,1255,1263,1271,1279,1288,1296,1304,1313,1321,1330,1338,1346,1355,1363,1372,1379,1387,1396,1404,1412,1421,1429,1437,1446,1454,1462,1470,1479,1487,1495,1504,1512,1520,1529,1537,1545,1553,1562,1570,1578,1587,1595,1603,1611,1620,1628,1636,1645,1653,1661,1669,1678,1686,1694,1702,1711,1719,1727,1736,1744,1752,1760,1769,1777,1785,1793,1802,1810,1818,1826,1835,1843,1851,1859,1867,1876,1884,1892,1900,1909,1917,1925,1933,1941,1950,1958,1966,1974,1982,1991,1999,2007,2015,2023,2031,2040,2048,2056,2064,2072,2080,2089,2097,2105,2113,2121,2129},
+    {769,769,769,770,770,771,772,773,774,775,776,778,780,782,784,786,788,790,793,796,798,801,804,808,811,814,818,822,826,830,834,838,842,847,851,856,860,865,870,875,880,886,891,896,902,907,913,919,925,931,937,943,949,955,961,968,974,981,987,994,1001,1007,1014,1021,1028,1035,1042,1049,1056,1064,1071,1078,1086,1093,1100,1108,1115,1123,1131,1138,1146,1154,1161,1169,1177,1185,1193,1200,1208,1216,1224,1232,1240,1248,1256,1265,1273,1281,1289,1297,1305,1313,1322,1330,1338,1346,1355,1363,1371,1379,1388,1396,1404,1412,1421,1429,1437,1445,1454,1462,1470,1479,1487,1495,1503,1512,1520,1528,1536,1545,1553,1561,1570,1578,1586,1594,1603,1611,1619,1627,1636,1644,1652,1660,1669,1677,1685,1693,1702,1710,1718,1726,1735,1743,1751,1759,1768,1776,1784,1792,1800,1809,1817,1825,1833,1842,1850,1858,1866,1874,1883,1891,1899,1907,1915,1924,1932,1940,1948,1956,1965,1973,1981,1989,1997,2005,2014,2022,2030,2038,2046,2054,2062,2071,2079,2087,2095,2103,2111,2119,2127},
+    {778,778,779,779,779,780,781,782,783,784,786,787,789,791,793,795,797,799,802,804,807,810,813,816,819,823,826,830,834,838,842,846,850,854,859,863,868,873,878,883,888,893,898,903,909,914,920,925,931,937,943,949,955,961,967,974,980,986,993,999,1006,1013,1020,1026,1033,1040,1047,1054,1061,1068,1075,1083,1090,1097,1104,1112,1119,1127,1134,1142,1149,1157,1165,1172,1180,1188,1195,1203,1211,1219,1227,1235,1243,1251,1259,1267,1275,1283,1291,1299,1307,1315,1323,1331,1339,1347,1356,1364,1372,1380,1388,1397,1405,1413,1421,1429,1438,1446,1454,1462,1471,1479,1487,1495,1503,1512,1520,1528,1536,1545,1553,1561,1569,1578,1586,1594,1602,1611,1619,1627,1635,1643,1652,1660,1668,1676,1685,1693,1701,1709,1717,1726,1734,1742,1750,1759,1767,1775,1783,1791,1800,1808,1816,1824,1832,1841,1849,1857,1865,1873,1881,1890,1898,1906,1914,1922,1931,1939,1947,1955,1963,1971,1979,1988,1996,2004,2012,2020,2028,2036,2045,2053,2061,2069,2077,2085,2093,2101,2109,2118,2126},
+    {787,788,788,788,789,789,790,791,792,793,795,796,798,800,801,804,806,808,810,813,816,819,822,825,828,831,835,838,842,846,850,854,858,862,866,871,876,880,885,890,895,900,905,910,916,921,927,932,938,944,949,955,961,967,973,980,986,992,999,1005,1012,1018,1025,1032,1038,1045,1052,1059,1066,1073,1080,1087,1094,1101,1109,1116,1123,1131,1138,1145,1153,1160,1168,1176,1183,1191,1199,1206,1214,1222,1230,1237,1245,1253,1261,1269,1277,1285,1293,1301,1309,1317,1325,1333,1341,1349,1357,1365,1373,1381,1389,1398,1406,1414,1422,1430,1438,1447,1455,1463,1471,1479,1487,1496,1504,1512,1520,1528,1537,1545,1553,1561,1569,1578,1586,1594,1602,1610,1619,1627,1635,1643,1651,1660,1668,1676,1684,1692,1701,1709,1717,1725,1733,1742,1750,1758,1766,1774,1782,1791,1799,1807,1815,1823,1831,1840,1848,1856,1864,1872,1880,1889,1897,1905,1913,1921,1929,1938,1946,1954,1962,1970,1978,1986,1994,2003,2011,2019,2027,2035,2043,2051,2059,2067,2075,2084,2092,2100,2108,2116,2124},
+    {797,797,797,797,798,798,799,800,801,802,804,805,807,808,810,812,815,817,819,822,824,827,830,833,836,840,843,846,850,854,858,862,866,870,874,879,883,888,892,897,902,907,912,917,923,928,933,939,944,950,956,962,968,974,980,986,992,998,1004,1011,1017,1024,1030,1037,1043,1050,1057,1064,1071,1078,1085,1092,1099,1106,1113,1120,1127,1135,1142,1149,1157,1164,1172,1179,1187,1194,1202,1209,1217,1225,1232,1240,1248,1256,1264,1271,1279,1287,1295,1303,1311,1319,1327,1335,1343,1351,1359,1367,1375,1383,1391,1399,1407,1415,1423,1431,1439,1447,1456,1464,1472,1480,1488,1496,1504,1513,1521,1529,1537,1545,1553,1561,1570,1578,1586,1594,1602,1610,1619,1627,1635,1643,1651,1659,1668,1676,1684,1692,1700,1708,1717,1725,1733,1741,1749,1757,1766,1774,1782,1790,1798,1806,1814,1823,1831,1839,1847,1855,1863,1871,1880,1888,1896,1904,1912,1920,1928,1936,1945,1953,1961,1969,1977,1985,1993,2001,2009,2017,2026,2034,2042,2050,2058,2066,2074,2082,2090,2098,2106,2114,2122},
+};
+
+static const uint16_t TRAVELTIME_S[TRAVELTIME_DEPTH_COUNT][TRAVELTIME_DISTANCE_COUNT] = {
+    {0,29,58,87,116,144,173,202,231,260,289,318,347,376,405,433,462,489,511,533,555,577,600,622,644,666,688,711,733,755,777,799,822,844,866,888,910,933,955,977,999,1021,1043,1066,1088,1110,1132,1154,1177,1199,1221,1243,1265,1288,1310,1332,1354,1376,1398,1421,1443,1465,1487,1509,1531,1554,1576,1598,1620,1642,1664,1687,1709,1731,1753,1775,1797,1820,1842,1864,1886,1908,1930,1952,1975,1997,2019,2041,2063,2085,2107,2129,2152,2174,2196,2218,2240,2262,2284,2306,2328,2351,2373,2395,2417,2439,2461,2483,2505,2527,2549,2571,2594,2616,2638,2660,2682,2704,2726,2748,2770,2792,2814,2836,2858,2880,2902,2924,2946,2968,2990,3012,3035,3057,3079,3101,3123,3145,3167,3189,3211,3233,3255,3277,3299,3321,3342,3364,3386,3408,3430,3452,3474,3496,3518,3540,3562,3584,3606,3628,3650,3672,3694,3716,3738,3759,3781,3803,3825,3847,3869,3891,3913,3935,3956,3978,4000,4022,4044,4066,4088,4110,4131,4153,4175,4197,4219,4241,4262,4284,4306,4328,4350,4371,4393,4415,4437,4459,4480,4502,4524},
+    {29,41,65,91,119,147,176,204,233,262,290,319,348,375,401,426,448,470,492,514,537,559,581,603,625,648,670,692,714,736,759,781,803,825,847,870,892,914,936,958,981,1003,1025,1047,1069,1092,1114,1136,1158,1180,1202,1225,1247,1269,1291,1313,1336,1358,1380,1402,1424,1446,1469,1491,1513,1535,1557,1579,1602,1624,1646,1668,1690,1712,1735,1757,1779,1801,1823,1845,1867,1890,1912,1934,1956,1978,2000,2022,2044,2067,2089,2111,2133,2155,2177,2199,2221,2244,2266,2288,2310,2332,2354,2376,2398,2420,2442,2464,2487,2509,2531,2553,2575,2597,2619,2641,2663,2685,2707,2729,2751,2773,2795,2818,2840,2862,2884,2906,2928,2950,2972,2994,3016,3038,3060,3082,3104,3126,3148,3170,3192,3214,3236,3258,3280,3302,3324,3346,3368,3390,3412,3434,3456,3477,3499,3521,3543,3565,3587,3609,3631,3653,3675,3697,3719,3741,3763,3784,3806,3828,3850,3872,3894,3916,3938,3959,3981,4003,4025,4047,4069,4091,4112,4134,4156,4178,4200,4222,4243,4265,4287,4309,4331,4352,4374,4396,4418,4440,4461,4483,4505},
+    {58,65,82,104,129,155,183,210,238,266,294,318,341,363,385,407,429,452,474,496,518,540,563,585,607,629,651,674,696,718,740,762,785,807,829,851,873,896,918,940,962,984,1007,1029,1051,1073,1095,1117,1140,1162,1184,1206,1228,1251,1273,1295,1317,1339,1361,1384,1406,1428,1450,1472,1494,1517,1539,1561,1583,1605,1627,1650,1672,1694,1716,1738,1760,1782,1805,1827,1849,1871,1893,1915,1937,1960,1982,2004,2026,2048,2070,2092,2114,2137,2159,2181,2203,2225,2247,2269,2291,2313,2335,2358,2380,2402,2424,2446,2468,2490,2512,2534,2556,2578,2600,2622,2645,2667,2689,2711,2733,2755,2777,2799,2821,2843,2865,2887,2909,2931,2953,2975,2997,3019,3041,3063,3085,3107,3129,3151,3173,3195,3217,3239,3261,3283,3305,3327,3349,3371,3393,3415,3437,3459,3481,3503,3525,3547,3568,3590,3612,3634,3656,3678,3700,3722,3744,3766,3788,3809,3831,3853,3875,3897,3919,3941,3963,3984,4006,4028,4050,4072,4094,4115,4137,4159,4181,4203,4225,4246,4268,4290,4312,4334,4355,4377,4399,4421,4442,4464,4486},
+    {84,88,101,118,139,162,186,211,236,261,283,305,327,349,372,394,416,438,460,483,505,527,549,571,594,616,638,660,682,705,727,749,771,793,816,838,860,882,904,927,949,971,993,1015,1038,1060,1082,1104,1126,1148,1171,1193,1215,1237,1259,1282,1304,1326,1348,1370,1392,1415,1437,1459,1481,1503,1525,1548,1570,1592,1614,1636,1658,1680,1703,1725,1747,1769,1791,1813,1835,1858,1880,1902,1924,1946,1968,1990,2012,2035,2057,2079,2101,2123,2145,2167,2189,2211,2234,2256,2278,2300,2322,2344,2366,2388,2410,2432,2454,2477,2499,2521,2543,2565,2587,2609,2631,2653,2675,2697,2719,2741,2763,2785,2807,2829,2851,2873,2895,2917,2939,2961,2983,3006,3028,3050,3072,3093,3115,3137,3159,3181,3203,3225,3247,3269,3291,3313,3335,3357,3379,3401,3423,3445,3467,3489,3511,3533,3555,3577,3598,3620,3642,3664,3686,3708,3730,3752,3774,3796,3817,3839,3861,3883,3905,3927,3949,3970,3992,4014,4036,4058,4080,4101,4123,4145,4167,4189,4211,4232,4254,4276,4298,4319,4341,4363,4385,4407,4428,4450,4472},
+    {108,111,120,134,151,171,191,213,234,256,278,300,322,345,367,389,411,433,455,478,500,522,544,566,588,611,633,655,677,699,721,744,766,788,810,832,855,877,899,921,943,965,987,1010,1032,1054,1076,1098,1120,1143,1165,1187,1209,1231,1253,1276,1298,1320,1342,1364,1386,1408,1431,1453,1475,1497,1519,1541,1564,1586,1608,1630,1652,1674,1696,1718,1741,1763,1785,1807,1829,1851,1873,1895,1918,1940,1962,1984,2006,2028,2050,2072,2094,2116,2139,2161,2183,2205,2227,2249,2271,2293,2315,2337,2359,2381,2404,2426,2448,2470,2492,2514,2536,2558,2580,2602,2624,2646,2668,2690,2712,2734,2756,2778,2800,2822,2844,2866,2888,2910,2932,2954,2976,2998,3020,3042,3064,3086,3108,3130,3152,3174,3196,3218,3240,3262,3284,3306,3328,3350,3372,3394,3416,3437,3459,3481,3503,3525,3547,3569,3591,3613,3635,3657,3678,3700,3722,3744,3766,3788,3810,3831,3853,3875,3897,3919,3941,3963,3984,4006,4028,4050,4072,4093,4115,4137,4159,4181,4202,4224,4246,4268,4290,4311,4333,4355,4377,4398,4420,4442,4464},
+    {130,132,140,151,165,182,201,220,240,261,283,304,326,347,369,391,413,435,457,479,501,523,545,567,589,611,633,655,678,700,722,744,766,788,810,832,855,877,899,921,943,965,987,1009,1032,1054,1076,1098,1120,1142,1164,1186,1209,1231,1253,1275,1297,1319,1341,1363,1386,1408,1430,1452,1474,1496,1518,1540,1562,1585,1607,1629,1651,1673,1695,1717,1739,1761,1783,1806,1828,1850,1872,1894,1916,1938,1960,1982,2004,2026,2049,2071,2093,2115,2137,2159,2181,2203,2225,2247,2269,2291,2313,2335,2357,2379,2401,2423,2445,2468,2490,2512,2534,2556,2578,2600,2622,2644,2666,2688,2710,2732,2754,2776,2798,2820,2842,2864,2886,2908,2930,2952,2974,2995,3017,3039,3061,3083,3105,3127,3149,3171,3193,3215,3237,3259,3281,3303,3325,3347,3368,3390,3412,3434,3456,3478,3500,3522,3544,3566,3587,3609,3631,3653,3675,3697,3719,3740,3762,3784,3806,3828,3850,3871,3893,3915,3937,3959,3981,4002,4024,4046,4068,4089,4111,4133,4155,4177,4198,4220,4242,4264,4285,4307,4329,4351,4372,4394,4416,4437,4459},
+    {152,154,160,170,182,197,213,231,250,270,290,310,331,352,374,395,417,438,460,482,504,525,547,569,591,613,635,657,679,701,723,745,767,789,811,833,855,877,899,921,944,966,988,1010,1032,1054,1076,1098,1120,1142,1164,1186,1208,1231,1253,1275,1297,1319,1341,1363,1385,1407,1429,1451,1473,1496,1518,1540,1562,1584,1606,1628,1650,1672,1694,1716,1738,1760,1782,1804,1827,1849,1871,1893,1915,1937,1959,1981,2003,2025,2047,2069,2091,2113,2135,2157,2179,2201,2223,2245,2267,2289,2311,2333,2355,2377,2400,2422,2444,2466,2488,2510,2532,2554,2576,2598,2619,2641,2663,2685,2707,2729,2751,2773,2795,2817,2839,2861,2883,2905,2927,2949,2971,2993,3015,3037,3059,3081,3103,3124,3146,3168,3190,3212,3234,3256,3278,3300,3322,3344,3365,3387,3409,3431,3453,3475,3497,3519,3540,3562,3584,3606,3628,3650,3671,3693,3715,3737,3759,3781,3802,3824,3846,3868,3890,3911,3933,3955,3977,3999,4020,4042,4064,4086,4107,4129,4151,4173,4194,4216,4238,4260,4281,4303,4325,4346,4368,4390,4412,4433,4455},
+    {174,176,181,189,200,213,228,244,262,280,299,319,339,360,380,401,422,443,465,486,508,529,551,573,594,616,638,660,681,703,725,747,769,791,813,835,857,879,901,923,945,967,989,1011,1033,1055,1077,1099,1121,1143,1165,1187,1209,1231,1253,1275,1297,1319,1341,1363,1385,1407,1429,1451,1473,1495,1517,1539,1561,1583,1605,1627,1650,1672,1694,1716,1738,1760,1782,1804,1826,1848,1870,1892,1914,1936,1958,1980,2002,2024,2046,2068,2090,2112,2134,2156,2178,2200,2222,2244,2266,2288,2310,2332,2354,2376,2398,2420,2442,2464,2486,2508,2530,2552,2574,2596,2618,2639,2661,2683,2705,2727,2749,2771,2793,2815,2837,2859,2881,2903,2925,2947,2969,2990,3012,3034,3056,3078,3100,3122,3144,3166,3188,3209,3231,3253,3275,3297,3319,3341,3363,3384,3406,3428,3450,3472,3494,3515,3537,3559,3581,3603,3625,3646,3668,3690,3712,3734,3755,3777,3799,3821,3843,3864,3886,3908,3930,3951,3973,3995,4017,4038,4060,4082,4104,4125,4147,4169,4191,4212,4234,4256,4277,4299,4321,4342,4364,4386,4407,4429,4451},
+    {197,198,203,210,219,231,244,259,276,293,311,330,349,368,388,409,429,450,471,492,513,534,556,577,598,620,642,663,685,706,728,750,772,793,815,837,859,881,903,925,946,968,990,1012,1034,1056,1078,1100,1122,1144,1166,1188,1210,1232,1254,1276,1298,1320,1341,1363,1385,1407,1429,1451,1473,1495,1517,1539,1561,1583,1605,1627,1649,1671,1693,1715,1737,1759,1781,1803,1825,1847,1869,1891,1913,1935,1957,1979,2001,2023,2045,2067,2089,2111,2133,2155,2177,2199,2221,2243,2265,2287,2309,2331,2352,2374,2396,2418,2440,2462,2484,2506,2528,2550,2572,2594,2616,2638,2660,2682,2703,2725,2747,2769,2791,2813,2835,2857,2879,2901,2923,2944,2966,2988,3010,3032,3054,3076,3098,3119,3141,3163,3185,3207,3229,3251,3272,3294,3316,3338,3360,3382,3403,3425,3447,3469,3491,3513,3534,3556,3578,3600,3622,3643,3665,3687,3709,3730,3752,3774,3796,3817,3839,3861,3883,3904,3926,3948,3970,3991,4013,4035,4057,4078,4100,4122,4143,4165,4187,4209,4230,4252,4274,4295,4317,4339,4360,4382,4404,4425,4447},
+    {219,220,224,231,239,250,262,276,291,307,324,342,360,379,398,418,438,458,478,499,519,540,561,582,604,625,646,668,689,710,732,754,775,797,818,840,862,884,905,927,949,971,992,1014,1036,1058,1080,1102,1123,1145,1167,1189,1211,1233,1255,1277,1299,1320,1342,1364,1386,1408,1430,1452,1474,1496,1518,1540,1562,1584,1606,1627,1649,1671,1693,1715,1737,1759,1781,1803,1825,1847,1869,1891,1913,1935,1957,1979,2000,2022,2044,2066,2088,2110,2132,2154,2176,2198,2220,2242,2264,2286,2307,2329,2351,2373,2395,2417,2439,2461,2483,2505,2527,2549,2570,2592,2614,2636,2658,2680,2702,2724,2746,2767,2789,2811,2833,2855,2877,2899,2921,2942,2964,2986,3008,3030,3052,3073,3095,3117,3139,3161,3183,3204,3226,3248,3270,3292,3314,3335,3357,3379,3401,3423,3444,3466,3488,3510,3532,3553,3575,3597,3619,3640,3662,3684,3706,3727,3749,3771,3793,3814,3836,3858,3880,3901,3923,3945,3966,3988,4010,4031,4053,4075,4097,4118,4140,4162,4183,4205,4227,4248,4270,4292,4313,4335,4356,4378,4400,4421,4443},
+    {241,242,246,252,259,269,280,293,307,322,338,355,372,390,409,428,447,467,487,507,527,547,568,589,610,631,652,673,694,715,737,758,779,801,822,844,865,887,909,930,952,973,995,1017,1039,1060,1082,1104,1126,1147,1169,1191,1213,1235,1256,1278,1300,1322,1344,1366,1387,1409,1431,1453,1475,1497,1519,1540,1562,1584,1606,1628,1650,1672,1694,1716,1737,1759,1781,1803,1825,1847,1869,1891,1913,1935,1956,1978,2000,2022,2044,2066,2088,2110,2132,2153,2175,2197,2219,2241,2263,2285,2307,2328,2350,2372,2394,2416,2438,2460,2482,2504,2525,2547,2569,2591,2613,2635,2657,2678,2700,2722,2744,2766,2788,2810,2831,2853,2875,2897,2919,2941,2962,2984,3006,3028,3050,3071,3093,3115,3137,3159,3180,3202,3224,3246,3268,3289,3311,3333,3355,3377,3398,3420,3442,3464,3485,3507,3529,3551,3572,3594,3616,3638,3659,3681,3703,3724,3746,3768,3790,3811,3833,3855,3876,3898,3920,3941,3963,3985,4007,4028,4050,4072,4093,4115,4136,4158,4180,4201,4223,4245,4266,4288,4310,4331,4353,4374,4396,4418,4437},
+    {263,265,268,273,280,289,299,311,324,338,353,369,386,403,421,439,458,477,496,516,536,556,576,596,617,637,658,679,700,721,742,763,784,806,827,848,870,891,912,934,955,977,998,1020,1042,1063,1085,1107,1128,1150,1172,1193,1215,1237,1258,1280,1302,1324,1345,1367,1389,1411,1433,1454,1476,1498,1520,1542,1563,1585,1607,1629,1651,1673,1694,1716,1738,1760,1782,1804,1825,1847,1869,1891,1913,1935,1956,1978,2000,2022,2044,2066,2088,2109,2131,2153,2175,2197,2219,2241,2262,2284,2306,2328,2350,2372,2393,2415,2437,2459,2481,2503,2524,2546,2568,2590,2612,2634,2655,2677,2699,2721,2743,2764,2786,2808,2830,2852,2873,2895,2917,2939,2961,2982,3004,3026,3048,3070,3091,3113,3135,3157,3178,3200,3222,3244,3265,3287,3309,3331,3352,3374,3396,3418,3439,3461,3483,3505,3526,3548,3570,3592,3613,3635,3657,3678,3700,3722,3743,3765,3787,3808,3830,3852,3873,3895,3917,3938,3960,3982,4003,4025,4047,4068,4090,4112,4133,4155,4176,4198,4220,4241,4263,4284,4306,4328,4349,4370,4388,4406,4424},
+    {286,287,290,294,301,309,318,329,342,355,369,384,400,417,434,451,470,488,507,526,545,565,585,605,625,645,665,686,707,727,748,769,790,811,832,853,874,896,917,938,960,981,1002,1024,1045,1067,1088,1110,1131,1153,1174,1196,1218,1239,1261,1283,1304,1326,1348,1369,1391,1413,1434,1456,1478,1500,1521,1543,1565,1587,1608,1630,1652,1674,1695,1717,1739,1761,1782,1804,1826,1848,1870,1891,1913,1935,1957,1979,2000,2022,2044,2066,2088,2109,2131,2153,2175,2197,2218,2240,2262,2284,2306,2327,2349,2371,2393,2415,2436,2458,2480,2502,2524,2545,2567,2589,2611,2633,2654,2676,2698,2720,2741,2763,2785,2807,2829,2850,2872,2894,2916,2937,2959,2981,3003,3024,3046,3068,3090,3111,3133,3155,3177,3198,3220,3242,3264,3285,3307,3329,3350,3372,3394,3416,3437,3459,3481,3502,3524,3546,3567,3589,3611,3632,3654,3676,3697,3719,3741,3762,3784,3806,3827,3849,3871,3892,3914,3936,3957,3979,4000,4022,4044,4065,4087,4108,4130,4152,4173,4195,4216,4238,4260,4280,4301,4321,4340,4358,4376,4394,4412},
+    {308,309,311,316,322,329,338,348,360,372,386,400,415,431,448,465,482,500,518,537,556,575,594,614,633,653,673,694,714,734,755,776,796,817,838,859,880,901,922,943,964,985,1007,1028,1049,1071,1092,1113,1135,1156,1178,1199,1221,1242,1264,1285,1307,1328,1350,1372,1393,1415,1437,1458,1480,1501,1523,1545,1566,1588,1610,1632,1653,1675,1697,1718,1740,1762,1784,1805,1827,1849,1870,1892,1914,1936,1957,1979,2001,2023,2044,2066,2088,2110,2131,2153,2175,2197,2218,2240,2262,2284,2305,2327,2349,2371,2393,2414,2436,2458,2480,2501,2523,2545,2567,2588,2610,2632,2653,2675,2697,2719,2740,2762,2784,2806,2827,2849,2871,2893,2914,2936,2958,2980,3001,3023,3045,3066,3088,3110,3132,3153,3175,3197,3218,3240,3262,3283,3305,3327,3348,3370,3392,3414,3435,3457,3479,3500,3522,3544,3565,3587,3608,3630,3652,3673,3695,3717,3738,3760,3782,3803,3825,3846,3868,3890,3911,3933,3954,3976,3998,4019,4041,4062,4084,4105,4127,4149,4170,4191,4211,4232,4252,4273,4291,4309,4327,4345,4363,4382,4400},
+    {330,331,333,337,343,350,358,368,379,390,403,417,431,446,462,479,495,513,530,548,567,585,604,624,643,662,682,702,722,742,762,783,803,824,844,865,886,907,928,949,970,991,1012,1033,1054,1075,1096,1118,1139,1160,1182,1203,1224,1246,1267,1289,1310,1332,1353,1375,1396,1418,1439,1461,1482,1504,1525,1547,1569,1590,1612,1633,1655,1677,1698,1720,1742,1763,1785,1807,1828,1850,1872,1893,1915,1937,1958,1980,2002,2023,2045,2067,2088,2110,2132,2154,2175,2197,2219,2240,2262,2284,2306,2327,2349,2371,2392,2414,2436,2458,2479,2501,2523,2544,2566,2588,2610,2631,2653,2675,2696,2718,2740,2761,2783,2805,2827,2848,2870,2892,2913,2935,2957,2978,3000,3022,3043,3065,3087,3108,3130,3152,3173,3195,3217,3238,3260,3282,3303,3325,3347,3368,3390,3412,3433,3455,3477,3498,3520,3541,3563,3585,3606,3628,3650,3671,3693,3714,3736,3758,3779,3801,3822,3844,3865,3887,3909,3930,3952,3973,3995,4016,4038,4060,4080,4101,4122,4142,4163,4183,4204,4224,4242,4261,4279,4297,4315,4333,4351,4369,4387},
+    {352,353,355,359,364,371,379,388,398,409,421,434,448,462,478,493,509,526,543,561,579,597,615,634,653,672,692,711,731,751,771,791,811,831,852,872,893,913,934,955,975,996,1017,1038,1059,1080,1101,1122,1143,1165,1186,1207,1228,1250,1271,1292,1314,1335,1356,1378,1399,1421,1442,1464,1485,1506,1528,1549,1571,1592,1614,1636,1657,1679,1700,1722,1743,1765,1787,1808,1830,1851,1873,1895,1916,1938,1959,1981,2003,2024,2046,2068,2089,2111,2133,2154,2176,2198,2219,2241,2263,2284,2306,2328,2349,2371,2393,2414,2436,2458,2479,2501,2523,2544,2566,2588,2609,2631,2653,2674,2696,2717,2739,2761,2782,2804,2826,2847,2869,2891,2912,2934,2956,2977,2999,3021,3042,3064,3086,3107,3129,3150,3172,3194,3215,3237,3259,3280,3302,3323,3345,3367,3388,3410,3432,3453,3475,3496,3518,3540,3561,3583,3604,3626,3647,3669,3691,3712,3734,3755,3777,3798,3820,3842,3863,3885,3906,3928,3949,3970,3991,4012,4032,4053,4073,4094,4114,4135,4155,4176,4194,4212,4230,4248,4267,4285,4303,4321,4339,4357,4375},
+    {375,375,377,381,386,392,399,408,417,428,439,452,465,479,493,508,524,540,557,574,591,609,627,645,664,683,702,721,740,760,779,799,819,839,859,879,900,920,941,961,982,1002,1023,1044,1065,1086,1107,1128,1148,1170,1191,1212,1233,1254,1275,1296,1318,1339,1360,1381,1403,1424,1445,1467,1488,1509,1531,1552,1574,1595,1617,1638,1660,1681,1703,1724,1746,1767,1789,1810,1832,1853,1875,1896,1918,1939,1961,1982,2004,2026,2047,2069,2090,2112,2134,2155,2177,2198,2220,2242,2263,2285,2306,2328,2350,2371,2393,2414,2436,2458,2479,2501,2523,2544,2566,2587,2609,2631,2652,2674,2696,2717,2739,2760,2782,2804,2825,2847,2868,2890,2912,2933,2955,2977,2998,3020,3041,3063,3085,3106,3128,3149,3171,3193,3214,3236,3257,3279,3300,3322,3344,3365,3387,3408,3430,3451,3473,3495,3516,3538,3559,3581,3602,3624,3646,3667,3689,3710,3732,3753,3775,3796,3818,3839,3860,3881,3902,3923,3943,3964,3984,4005,4025,4046,4066,4087,4107,4127,4146,4164,4182,4200,4218,4236,4254,4272,4291,4309,4327,4345,4363},
+    {397,397,399,403,407,413,420,428,437,447,458,470,482,496,510,524,539,555,571,588,605,622,639,657,675,694,712,731,750,769,789,808,828,848,868,887,908,928,948,968,989,1009,1030,1050,1071,1092,1112,1133,1154,1175,1196,1217,1238,1259,1280,1301,1322,1343,1364,1385,1407,1428,1449,1470,1492,1513,1534,1555,1577,1598,1620,1641,1662,1684,1705,1727,1748,1769,1791,1812,1834,1855,1877,1898,1920,1941,1963,1984,2006,2027,2049,2070,2092,2113,2135,2156,2178,2199,2221,2243,2264,2286,2307,2329,2350,2372,2393,2415,2437,2458,2480,2501,2523,2544,2566,2588,2609,2631,2652,2674,2695,2717,2739,2760,2782,2803,2825,2847,2868,2890,2911,2933,2954,2976,2997,3019,3041,3062,3084,3105,3127,3148,3170,3191,3213,3235,3256,3278,3299,3321,3342,3364,3385,3407,3428,3450,3472,3493,3515,3536,3558,3579,3601,3622,3644,3665,3687,3708,3730,3750,3771,3792,3813,3833,3854,3875,3895,3916,3936,3957,3977,3998,4018,4039,4059,4079,4097,4115,4134,4152,4170,4188,4206,4224,4242,4260,4278,4296,4314,4332,4350},
+    {419,419,421,424,429,434,441,448,457,466,477,488,500,513,527,541,555,570,586,602,618,635,652,670,688,706,724,742,761,780,799,818,837,857,876,896,916,936,956,976,996,1016,1037,1057,1077,1098,1119,1139,1160,1181,1201,1222,1243,1264,1285,1306,1327,1348,1369,1390,1411,1432,1453,1474,1495,1517,1538,1559,1580,1601,1623,1644,1665,1687,1708,1729,1751,1772,1793,1815,1836,1858,1879,1900,1922,1943,1965,1986,2007,2029,2050,2072,2093,2115,2136,2158,2179,2201,2222,2244,2265,2287,2308,2330,2351,2373,2394,2416,2437,2459,2480,2502,2523,2545,2566,2588,2609,2631,2652,2674,2696,2717,2739,2760,2782,2803,2825,2846,2868,2889,2911,2932,2954,2975,2997,3018,3040,3061,3083,3105,3126,3148,3169,3191,3212,3234,3255,3277,3298,3320,3341,3363,3384,3406,3427,3449,3470,3492,3513,3535,3556,3578,3599,3620,3641,3661,3682,3703,3724,3744,3765,3786,3806,3827,3848,3868,3889,3909,3929,3950,3970,3991,4011,4031,4049,4067,4085,4104,4122,4140,4158,4176,4194,4212,4230,4248,4266,4284,4302,4320,4338},
+    {441,442,443,446,450,455,462,469,477,486,496,507,519,531,544,557,571,586,601,617,633,649,666,683,700,718,736,754,772,791,809,828,847,866,886,905,925,944,964,984,1004,1024,1044,1064,1084,1105,1125,1146,1166,1187,1207,1228,1249,1269,1290,1311,1332,1353,1374,1395,1415,1436,1457,1478,1500,1521,1542,1563,1584,1605,1626,1648,1669,1690,1711,1732,1754,1775,1796,1818,1839,1860,1881,1903,1924,1945,1967,1988,2010,2031,2052,2074,2095,2117,2138,2159,2181,2202,2224,2245,2267,2288,2309,2331,2352,2374,2395,2417,2438,2460,2481,2503,2524,2545,2567,2588,2610,2631,2653,2674,2696,2717,2739,2760,2782,2803,2825,2846,2868,2889,2911,2932,2954,2975,2997,3018,3040,3061,3083,3104,3125,3147,3168,3190,3211,3233,3254,3276,3297,3319,3340,3362,3383,3405,3426,3447,3468,3489,3510,3531,3552,3573,3593,3614,3635,3656,3676,3697,3718,3738,3759,3779,3800,3820,3841,3861,3882,3902,3922,3943,3963,3983,4001,4019,4037,4055,4073,4092,4110,4128,4146,4164,4182,4200,4218,4236,4254,4272,4290,4308,4326},
+    {463,464,465,468,472,477,483,490,497,506,516,526,537,549,561,574,588,602,617,632,648,664,680,696,713,731,748,766,784,802,820,839,858,876,895,915,934,953,973,992,1012,1032,1052,1072,1092,1112,1132,1153,1173,1193,1214,1234,1255,1275,1296,1317,1337,1358,1379,1400,1420,1441,1462,1483,1504,1525,1546,1567,1588,1609,1630,1651,1672,1694,1715,1736,1757,1778,1799,1821,1842,1863,1884,1906,1927,1948,1969,1991,2012,2033,2055,2076,2097,2119,2140,2161,2183,2204,2225,2247,2268,2289,2311,2332,2354,2375,2396,2418,2439,2461,2482,2503,2525,2546,2568,2589,2611,2632,2653,2675,2696,2718,2739,2761,2782,2803,2825,2846,2868,2889,2911,2932,2954,2975,2996,3018,3039,3061,3082,3104,3125,3146,3168,3189,3211,3232,3254,3275,3296,3317,3338,3359,3380,3401,3421,3442,3463,3484,3505,3526,3546,3567,3588,3608,3629,3650,3670,3691,3711,3732,3752,3773,3793,3814,3834,3854,3875,3895,3915,3935,3953,3971,3989,4007,4025,4043,4062,4080,4098,4116,4134,4152,4170,4188,4206,4224,4242,4260,4278,4296,4314},
+    {485,486,487,490,494,498,504,510,518,526,535,545,556,567,579,592,605,619,633,648,663,678,694,710,727,744,761,778,796,814,832,850,868,887,906,925,944,963,982,1001,1021,1041,1060,1080,1100,1120,1140,1160,1180,1200,1221,1241,1261,1282,1302,1323,1343,1364,1384,1405,1426,1447,1467,1488,1509,1530,1551,1572,1592,1613,1634,1655,1676,1697,1718,1740,1761,1782,1803,1824,1845,1866,1887,1909,1930,1951,1972,1993,2015,2036,2057,2078,2100,2121,2142,2163,2185,2206,2227,2249,2270,2291,2312,2334,2355,2376,2398,2419,2441,2462,2483,2505,2526,2547,2569,2590,2611,2633,2654,2676,2697,2718,2740,2761,2782,2804,2825,2847,2868,2889,2911,2932,2954,2975,2996,3017,3039,3060,3081,3102,3123,3144,3165,3186,3207,3228,3249,3270,3291,3312,3333,3354,3375,3396,3416,3437,3458,3479,3499,3520,3541,3561,3582,3602,3623,3643,3664,3684,3705,3725,3746,3766,3786,3807,3827,3847,3868,3886,3905,3923,3941,3959,3977,3995,4014,4032,4050,4068,4086,4104,4122,4140,4158,4176,4194,4212,4230,4248,4266,4284,4302},
+    {507,508,509,512,515,520,525,531,539,546,555,565,575,586,598,610,622,636,650,664,678,694,709,725,741,757,774,791,808,826,844,862,880,898,916,935,954,973,992,1011,1030,1049,1069,1088,1108,1128,1148,1168,1188,1208,1228,1248,1268,1288,1309,1329,1349,1370,1390,1411,1431,1452,1473,1493,1514,1535,1555,1576,1597,1618,1639,1660,1680,1701,1722,1743,1764,1785,1806,1827,1848,1869,1890,1912,1933,1954,1975,1996,2017,2038,2059,2081,2102,2123,2144,2165,2187,2208,2229,2250,2271,2293,2314,2335,2356,2378,2399,2420,2442,2463,2484,2505,2527,2548,2569,2590,2612,2633,2654,2675,2697,2718,2739,2760,2782,2803,2824,2845,2867,2888,2909,2930,2951,2972,2993,3014,3035,3057,3078,3099,3119,3140,3161,3182,3203,3224,3245,3266,3287,3307,3328,3349,3370,3390,3411,3432,3452,3473,3494,3514,3535,3555,3576,3596,3617,3637,3658,3678,3698,3719,3739,3759,3780,3800,3820,3839,3857,3875,3893,3911,3929,3948,3966,3984,4002,4020,4038,4056,4074,4092,4110,4128,4146,4164,4182,4200,4218,4236,4254,4272,4289},
+    {529,530,531,534,537,541,546,552,559,567,575,584,594,605,616,628,640,653,666,680,694,709,724,739,755,771,788,804,821,838,856,873,891,909,927,946,964,983,1002,1020,1039,1059,1078,1097,1117,1136,1156,1175,1195,1215,1235,1255,1275,1295,1315,1335,1356,1376,1396,1417,1437,1457,1478,1498,1519,1540,1560,1581,1602,1622,1643,1664,1685,1705,1726,1747,1768,1789,1810,1831,1852,1872,1893,1914,1935,1956,1977,1998,2020,2041,2062,2083,2104,2125,2146,2167,2188,2209,2230,2252,2273,2294,2315,2336,2357,2378,2400,2421,2442,2463,2484,2505,2527,2548,2569,2590,2611,2632,2653,2674,2696,2717,2738,2759,2780,2801,2822,2843,2864,2885,2906,2927,2948,2969,2990,3011,3032,3053,3074,3095,3116,3137,3157,3178,3199,3220,3241,3261,3282,3303,3323,3344,3365,3385,3406,3426,3447,3468,3488,3509,3529,3549,3570,3590,3611,3631,3651,3672,3692,3712,3733,3753,3773,3791,3809,3827,3845,3864,3882,3900,3918,3936,3954,3972,3990,4008,4026,4044,4063,4081,4099,4116,4134,4152,4170,4188,4206,4224,4242,4260,4278},
+    {551,552,553,555,559,563,567,573,580,587,595,604,613,624,634,646,658,670,683,697,710,725,739,754,770,786,802,818,834,851,868,886,903,921,939,957,975,993,1012,1030,1049,1068,1087,1106,1125,1145,1164,1183,1203,1223,1242,1262,1282,1302,1322,1342,1362,1382,1402,1422,1443,1463,1483,1504,1524,1545,1565,1586,1606,1627,1647,1668,1689,1709,1730,1751,1771,1792,1813,1834,1855,1876,1896,1917,1938,1959,1980,2001,2022,2043,2064,2085,2106,2127,2148,2169,2190,2211,2232,2253,2274,2295,2316,2337,2358,2379,2400,2421,2442,2463,2484,2505,2526,2547,2568,2589,2610,2631,2652,2673,2694,2715,2736,2757,2778,2799,2820,2841,2862,2883,2904,2925,2946,2966,2987,3008,3029,3050,3071,3091,3112,3133,3154,3174,3195,3216,3236,3257,3278,3298,3319,3339,3360,3380,3401,3421,3442,3462,3483,3503,3524,3544,3564,3585,3605,3625,3645,3666,3686,3706,3725,3743,3762,3780,3798,3816,3834,3852,3871,3889,3907,3925,3943,3961,3979,3997,4015,4033,4051,4069,4087,4105,4123,4141,4159,4177,4194,4212,4230,4248,4266},
+    {573,574,575,577,580,584,589,594,600,607,615,624,633,643,653,664,676,688,700,713,727,741,755,770,785,800,816,832,848,864,881,898,915,933,950,968,986,1004,1022,1041,1059,1078,1096,1115,1134,1153,1173,1192,1211,1231,1250,1270,1289,1309,1329,1349,1369,1388,1408,1429,1449,1469,1489,1509,1529,1550,1570,1590,1611,1631,1652,1672,1693,1713,1734,1755,1775,1796,1816,1837,1858,1879,1899,1920,1941,1962,1982,2003,2024,2045,2066,2086,2107,2128,2149,2170,2191,2212,2233,2254,2274,2295,2316,2337,2358,2379,2400,2421,2442,2463,2484,2505,2526,2547,2567,2588,2609,2630,2651,2672,2693,2714,2735,2755,2776,2797,2818,2839,2860,2880,2901,2922,2943,2964,2984,3005,3026,3046,3067,3088,3108,3129,3150,3170,3191,3212,3232,3253,3273,3294,3314,3335,3355,3376,3396,3416,3437,3457,3477,3498,3518,3538,3559,3579,3599,3619,3640,3660,3678,3696,3714,3732,3751,3769,3787,3805,3823,3841,3859,3878,3896,3914,3932,3950,3968,3986,4004,4022,4040,4058,4076,4094,4112,4129,4147,4165,4183,4201,4219,4236,4254},
+    {595,595,597,599,601,605,610,615,621,628,635,643,652,662,672,682,694,705,718,730,743,757,771,785,800,815,830,846,862,878,894,911,928,945,962,980,997,1015,1033,1051,1069,1088,1106,1125,1143,1162,1181,1200,1219,1239,1258,1277,1297,1316,1336,1356,1375,1395,1415,1435,1455,1475,1495,1515,1535,1555,1575,1595,1616,1636,1656,1677,1697,1718,1738,1758,1779,1799,1820,1840,1861,1882,1902,1923,1944,1964,1985,2006,2026,2047,2068,2088,2109,2130,2151,2171,2192,2213,2234,2255,2275,2296,2317,2338,2359,2379,2400,2421,2442,2463,2484,2504,2525,2546,2567,2587,2608,2629,2650,2671,2691,2712,2733,2754,2774,2795,2816,2837,2857,2878,2899,2919,2940,2961,2981,3002,3023,3043,3064,3084,3105,3126,3146,3167,3187,3208,3228,3249,3269,3289,3310,3330,3351,3371,3391,3412,3432,3452,3472,3493,3513,3533,3553,3573,3594,3613,3631,3649,3667,3685,3704,3722,3740,3758,3776,3794,3812,3831,3849,3867,3885,3903,3921,3939,3957,3975,3993,4011,4029,4047,4065,4082,4100,4118,4136,4154,4172,4189,4207,4225,4243},
+    {616,617,618,620,623,626,631,636,642,648,655,663,672,681,691,701,712,723,735,747,760,773,787,801,815,830,845,860,876,891,908,924,940,957,974,991,1009,1026,1044,1062,1080,1098,1116,1134,1153,1172,1190,1209,1228,1247,1266,1285,1305,1324,1343,1363,1382,1402,1422,1441,1461,1481,1501,1521,1541,1561,1581,1601,1621,1641,1661,1681,1702,1722,1742,1762,1783,1803,1824,1844,1864,1885,1905,1926,1946,1967,1987,2008,2029,2049,2070,2090,2111,2132,2152,2173,2194,2214,2235,2256,2276,2297,2318,2338,2359,2380,2400,2421,2442,2463,2483,2504,2525,2545,2566,2587,2607,2628,2649,2669,2690,2711,2731,2752,2773,2793,2814,2835,2855,2876,2896,2917,2938,2958,2979,2999,3020,3040,3061,3081,3102,3122,3143,3163,3183,3204,3224,3245,3265,3285,3306,3326,3346,3366,3387,3407,3427,3447,3467,3488,3508,3528,3548,3566,3584,3602,3620,3639,3657,3675,3693,3711,3729,3748,3766,3784,3802,3820,3838,3856,3874,3892,3910,3928,3946,3964,3982,4000,4018,4036,4054,4071,4089,4107,4125,4143,4160,4178,4196,4214,4231},
+    {638,638,640,642,644,648,652,657,662,669,676,683,691,700,710,720,730,741,753,765,777,790,803,817,831,845,860,875,890,905,921,937,953,970,987,1003,1020,1038,1055,1073,1090,1108,1126,1144,1163,1181,1200,1218,1237,1256,1275,1293,1313,1332,1351,1370,1389,1409,1428,1448,1467,1487,1507,1527,1546,1566,1586,1606,1626,1646,1666,1686,1706,1726,1746,1767,1787,1807,1827,1848,1868,1888,1909,1929,1949,1970,1990,2011,2031,2051,2072,2092,2113,2133,2154,2174,2195,2216,2236,2257,2277,2298,2318,2339,2360,2380,2401,2421,2442,2463,2483,2504,2524,2545,2565,2586,2607,2627,2648,2668,2689,2709,2730,2750,2771,2792,2812,2833,2853,2874,2894,2915,2935,2956,2976,2996,3017,3037,3058,3078,3098,3119,3139,3159,3180,3200,3220,3241,3261,3281,3301,3322,3342,3362,3382,3402,3422,3443,3463,3483,3501,3519,3537,3556,3574,3592,3610,3628,3647,3665,3683,3701,3719,3737,3755,3773,3791,3809,3827,3845,3863,3881,3899,3917,3935,3953,3971,3989,4007,4025,4043,4061,4078,4096,4114,4132,4149,4167,4185,4203,4220},
+    {660,660,661,663,665,669,673,678,683,689,696,703,711,720,729,738,749,759,770,782,794,807,820,833,846,860,875,889,904,919,935,951,967,983,999,1016,1032,1049,1067,1084,1101,1119,1137,1155,1173,1191,1209,1227,1246,1264,1283,1302,1321,1340,1359,1378,1397,1416,1435,1455,1474,1494,1513,1533,1552,1572,1592,1611,1631,1651,1671,1691,1711,1731,1751,1771,1791,1811,1831,1851,1871,1892,1912,1932,1952,1973,1993,2013,2034,2054,2074,2095,2115,2135,2156,2176,2197,2217,2237,2258,2278,2299,2319,2340,2360,2381,2401,2422,2442,2463,2483,2504,2524,2545,2565,2585,2606,2626,2647,2667,2688,2708,2729,2749,2769,2790,2810,2831,2851,2872,2892,2912,2933,2953,2973,2994,3014,3034,3055,3075,3095,3116,3136,3156,3176,3197,3217,3237,3257,3277,3297,3318,3338,3358,3378,3398,3418,3436,3455,3473,3491,3509,3527,3546,3564,3582,3600,3618,3636,3655,3673,3691,3709,3727,3745,3763,3781,3799,3817,3835,3853,3871,3889,3907,3925,3943,3961,3979,3996,4014,4032,4050,4068,4085,4103,4121,4139,4156,4174,4192,4209},
+    {681,681,682,684,687,690,694,698,704,709,716,723,731,739,748,757,767,777,788,800,811,824,836,849,862,876,890,904,919,934,949,964,980,996,1012,1028,1045,1061,1078,1095,1113,1130,1147,1165,1183,1201,1219,1237,1255,1274,1292,1311,1329,1348,1367,1386,1404,1424,1443,1462,1481,1500,1520,1539,1558,1578,1598,1617,1637,1656,1676,1696,1716,1736,1755,1775,1795,1815,1835,1855,1875,1895,1915,1935,1956,1976,1996,2016,2036,2056,2077,2097,2117,2137,2158,2178,2198,2219,2239,2259,2280,2300,2320,2341,2361,2381,2402,2422,2442,2463,2483,2504,2524,2544,2565,2585,2605,2626,2646,2666,2687,2707,2727,2748,2768,2788,2809,2829,2849,2870,2890,2910,2930,2951,2971,2991,3011,3032,3052,3072,3092,3113,3133,3153,3173,3193,3213,3233,3253,3273,3294,3314,3334,3354,3372,3390,3408,3427,3445,3463,3481,3500,3518,3536,3554,3572,3590,3608,3627,3645,3663,3681,3699,3717,3735,3753,3771,3789,3807,3825,3843,3861,3879,3897,3915,3932,3950,3968,3986,4004,4021,4039,4057,4075,4092,4110,4128,4146,4163,4181,4198},
+    {702,703,704,705,708,711,715,719,724,730,736,743,750,758,767,776,786,796,806,817,829,841,853,866,879,892,906,920,934,948,963,978,994,1009,1025,1041,1057,1074,1090,1107,1124,1141,1158,1176,1193,1211,1229,1247,1265,1283,1301,1319,1338,1356,1375,1394,1412,1431,1450,1469,1488,1507,1526,1546,1565,1584,1604,1623,1642,1662,1682,1701,1721,1740,1760,1780,1800,1819,1839,1859,1879,1899,1919,1939,1959,1979,1999,2019,2039,2059,2079,2099,2119,2140,2160,2180,2200,2220,2240,2261,2281,2301,2321,2342,2362,2382,2402,2423,2443,2463,2483,2504,2524,2544,2564,2585,2605,2625,2645,2666,2686,2706,2726,2747,2767,2787,2807,2827,2848,2868,2888,2908,2928,2949,2969,2989,3009,3029,3049,3069,3090,3110,3130,3150,3170,3190,3210,3230,3250,3270,3290,3308,3326,3344,3363,3381,3399,3417,3435,3454,3472,3490,3508,3526,3544,3563,3581,3599,3617,3635,3653,3671,3689,3707,3725,3743,3761,3779,3797,3815,3833,3851,3869,3886,3904,3922,3940,3958,3976,3993,4011,4029,4047,4064,4082,4100,4117,4135,4153,4170,4188},
+    {724,724,725,727,729,732,735,740,745,750,756,763,770,778,786,795,804,814,824,835,846,858,870,882,895,908,921,935,949,963,978,992,1008,1023,1038,1054,1070,1086,1102,1119,1136,1153,1170,1187,1204,1221,1239,1257,1274,1292,1310,1328,1347,1365,1383,1402,1420,1439,1458,1477,1495,1514,1533,1552,1571,1591,1610,1629,1648,1668,1687,1707,1726,1746,1765,1785,1804,1824,1844,1863,1883,1903,1923,1943,1962,1982,2002,2022,2042,2062,2082,2102,2122,2142,2162,2182,2202,2222,2242,2262,2282,2302,2323,2343,2363,2383,2403,2423,2443,2464,2484,2504,2524,2544,2564,2584,2605,2625,2645,2665,2685,2705,2725,2746,2766,2786,2806,2826,2846,2866,2886,2906,2927,2947,2967,2987,3007,3027,3047,3067,3087,3107,3127,3147,3167,3187,3207,3226,3244,3262,3281,3299,3317,3335,3353,3372,3390,3408,3426,3444,3462,3481,3499,3517,3535,3553,3571,3589,3607,3625,3643,3661,3679,3697,3715,3733,3751,3769,3787,3805,3823,3841,3859,3877,3894,3912,3930,3948,3965,3983,4001,4019,4036,4054,4072,4089,4107,4124,4142,4160,4177},
+    {745,745,746,748,750,753,756,760,765,770,776,783,790,797,805,814,823,833,843,853,864,875,887,899,911,924,937,950,964,978,992,1007,1022,1037,1052,1067,1083,1099,1115,1131,1148,1164,1181,1198,1215,1232,1249,1267,1284,1302,1320,1338,1356,1374,1392,1410,1429,1447,1466,1484,1503,1522,1540,1559,1578,1597,1616,1635,1654,1674,1693,1712,1732,1751,1770,1790,1809,1829,1848,1868,1887,1907,1927,1946,1966,1986,2006,2025,2045,2065,2085,2105,2125,2144,2164,2184,2204,2224,2244,2264,2284,2304,2324,2344,2364,2384,2404,2424,2444,2464,2484,2504,2524,2544,2564,2584,2604,2625,2645,2665,2685,2705,2725,2745,2765,2785,2805,2825,2845,2865,2885,2905,2925,2945,2965,2985,3005,3025,3044,3064,3084,3104,3124,3144,3162,3180,3199,3217,3235,3253,3272,3290,3308,3326,3344,3363,3381,3399,3417,3435,3453,3471,3490,3508,3526,3544,3562,3580,3598,3616,3634,3652,3670,3688,3706,3724,3742,3760,3778,3795,3813,3831,3849,3867,3885,3902,3920,3938,3955,3973,3991,4009,4026,4044,4061,4079,4097,4114,4132,4149,4167},
+    {766,766,767,769,771,774,777,781,786,791,796,803,809,817,825,833,842,851,861,871,881,892,904,916,928,940,953,966,979,993,1007,1021,1036,1051,1066,1081,1096,1112,1128,1144,1160,1176,1193,1209,1226,1243,1260,1277,1295,1312,1330,1347,1365,1383,1401,1419,1437,1455,1474,1492,1511,1529,1548,1566,1585,1604,1623,1642,1661,1680,1699,1718,1737,1756,1776,1795,1814,1834,1853,1872,1892,1911,1931,1950,1970,1990,2009,2029,2049,2068,2088,2108,2127,2147,2167,2187,2206,2226,2246,2266,2286,2306,2326,2345,2365,2385,2405,2425,2445,2465,2485,2505,2525,2545,2565,2585,2604,2624,2644,2664,2684,2704,2724,2744,2764,2784,2804,2824,2844,2863,2883,2903,2923,2943,2963,2983,3003,3022,3042,3062,3080,3099,3117,3135,3154,3172,3190,3208,3226,3245,3263,3281,3299,3317,3336,3354,3372,3390,3408,3426,3444,3463,3481,3499,3517,3535,3553,3571,3589,3607,3625,3643,3661,3679,3697,3714,3732,3750,3768,3786,3804,3822,3839,3857,3875,3893,3910,3928,3946,3963,3981,3999,4016,4034,4051,4069,4086,4104,4122,4139,4156},
+    {787,787,788,790,792,794,798,802,806,811,816,823,829,836,844,852,861,870,879,889,899,910,921,933,944,957,969,982,995,1008,1022,1036,1050,1065,1079,1094,1109,1125,1140,1156,1172,1188,1204,1221,1237,1254,1271,1288,1305,1322,1340,1357,1375,1392,1410,1428,1446,1464,1482,1500,1519,1537,1555,1574,1592,1611,1630,1648,1667,1686,1705,1724,1743,1762,1781,1800,1819,1839,1858,1877,1896,1916,1935,1955,1974,1993,2013,2032,2052,2072,2091,2111,2130,2150,2170,2189,2209,2229,2248,2268,2288,2308,2327,2347,2367,2387,2406,2426,2446,2466,2486,2505,2525,2545,2565,2585,2605,2624,2644,2664,2684,2704,2724,2743,2763,2783,2803,2823,2842,2862,2882,2902,2922,2941,2961,2981,2999,3017,3036,3054,3072,3090,3109,3127,3145,3163,3182,3200,3218,3236,3254,3273,3291,3309,3327,3345,3363,3381,3400,3418,3436,3454,3472,3490,3508,3526,3544,3562,3580,3598,3616,3634,3652,3669,3687,3705,3723,3741,3759,3777,3794,3812,3830,3848,3865,3883,3901,3918,3936,3954,3971,3989,4006,4024,4041,4059,4077,4094,4111,4129,4146},
+    {808,808,809,810,813,815,818,822,826,831,837,842,849,856,863,871,879,888,897,907,917,928,938,950,961,973,985,998,1011,1024,1037,1051,1065,1079,1093,1108,1123,1138,1153,1169,1184,1200,1216,1232,1249,1265,1282,1299,1316,1333,1350,1367,1384,1402,1419,1437,1455,1473,1491,1509,1527,1545,1563,1581,1600,1618,1637,1655,1674,1693,1711,1730,1749,1768,1787,1806,1825,1844,1863,1882,1901,1920,1940,1959,1978,1998,2017,2036,2056,2075,2095,2114,2133,2153,2172,2192,2212,2231,2251,2270,2290,2310,2329,2349,2369,2388,2408,2428,2447,2467,2487,2506,2526,2546,2565,2585,2605,2625,2644,2664,2684,2704,2723,2743,2763,2782,2802,2822,2842,2861,2881,2900,2918,2936,2954,2973,2991,3009,3028,3046,3064,3082,3101,3119,3137,3155,3173,3192,3210,3228,3246,3264,3282,3301,3319,3337,3355,3373,3391,3409,3427,3445,3463,3481,3499,3517,3535,3553,3571,3589,3607,3625,3643,3660,3678,3696,3714,3732,3750,3767,3785,3803,3821,3838,3856,3874,3891,3909,3926,3944,3962,3979,3997,4014,4032,4049,4067,4084,4102,4119,4136},
+    {829,829,830,831,833,836,839,842,847,851,857,862,869,875,882,890,898,907,916,925,935,945,956,967,978,990,1002,1014,1026,1039,1052,1066,1080,1093,1108,1122,1137,1151,1167,1182,1197,1213,1229,1244,1261,1277,1293,1310,1326,1343,1360,1377,1394,1411,1429,1446,1464,1482,1499,1517,1535,1553,1571,1589,1607,1626,1644,1662,1681,1699,1718,1737,1755,1774,1793,1812,1830,1849,1868,1887,1906,1925,1944,1963,1983,2002,2021,2040,2060,2079,2098,2117,2137,2156,2176,2195,2214,2234,2253,2273,2292,2312,2331,2351,2370,2390,2409,2429,2449,2468,2488,2507,2527,2547,2566,2586,2605,2625,2645,2664,2684,2703,2723,2743,2762,2782,2800,2819,2837,2855,2874,2892,2910,2928,2947,2965,2983,3002,3020,3038,3056,3074,3093,3111,3129,3147,3165,3184,3202,3220,3238,3256,3274,3292,3310,3329,3347,3365,3383,3401,3419,3437,3455,3473,3491,3509,3527,3544,3562,3580,3598,3616,3634,3652,3669,3687,3705,3723,3741,3758,3776,3794,3811,3829,3847,3864,3882,3900,3917,3935,3952,3970,3987,4005,4022,4040,4057,4074,4092,4109,4126},
+    {850,850,851,852,854,856,859,863,867,871,877,882,888,895,902,909,917,925,934,943,953,963,973,984,995,1006,1018,1030,1042,1055,1068,1081,1094,1108,1122,1136,1150,1165,1180,1195,1210,1225,1241,1257,1272,1288,1305,1321,1337,1354,1371,1387,1404,1421,1439,1456,1473,1491,1508,1526,1544,1561,1579,1597,1615,1633,1651,1670,1688,1706,1725,1743,1762,1780,1799,1817,1836,1855,1874,1893,1911,1930,1949,1968,1987,2006,2025,2044,2064,2083,2102,2121,2140,2160,2179,2198,2217,2237,2256,2275,2295,2314,2333,2353,2372,2392,2411,2431,2450,2470,2489,2508,2528,2547,2567,2586,2606,2626,2645,2665,2683,2701,2720,2738,2756,2775,2793,2811,2830,2848,2866,2884,2903,2921,2939,2958,2976,2994,3012,3030,3049,3067,3085,3103,3121,3140,3158,3176,3194,3212,3230,3248,3266,3284,3302,3321,3339,3357,3375,3393,3411,3429,3447,3464,3482,3500,3518,3536,3554,3572,3590,3607,3625,3643,3661,3679,3696,3714,3732,3749,3767,3785,3802,3820,3838,3855,3873,3890,3908,3925,3943,3960,3978,3995,4013,4030,4047,4065,4082,4099,4117},
+    {870,870,871,873,874,877,880,883,887,892,896,902,908,914,921,928,936,944,953,962,971,981,991,1001,1012,1023,1035,1046,1058,1071,1083,1096,1109,1123,1137,1150,1165,1179,1193,1208,1223,1238,1253,1269,1285,1300,1316,1332,1349,1365,1381,1398,1415,1431,1448,1465,1483,1500,1517,1535,1552,1570,1588,1605,1623,1641,1659,1677,1695,1713,1732,1750,1768,1787,1805,1824,1842,1861,1879,1898,1917,1936,1954,1973,1992,2011,2030,2049,2068,2087,2106,2125,2144,2163,2182,2201,2220,2240,2259,2278,2297,2317,2336,2355,2374,2394,2413,2432,2452,2471,2490,2510,2529,2548,2566,2584,2603,2621,2639,2658,2676,2694,2713,2731,2749,2768,2786,2804,2822,2841,2859,2877,2896,2914,2932,2950,2968,2987,3005,3023,3041,3059,3078,3096,3114,3132,3150,3168,3186,3204,3223,3241,3259,3277,3295,3313,3331,3349,3367,3385,3403,3421,3438,3456,3474,3492,3510,3528,3546,3563,3581,3599,3617,3635,3652,3670,3688,3705,3723,3741,3758,3776,3794,3811,3829,3846,3864,3881,3899,3916,3934,3951,3969,3986,4003,4021,4038,4055,4073,4090,4107},
+    {891,891,892,893,895,897,900,903,907,912,916,922,927,934,940,947,955,963,971,980,989,998,1008,1019,1029,1040,1051,1063,1074,1087,1099,1112,1125,1138,1151,1165,1179,1193,1207,1222,1236,1251,1266,1281,1297,1312,1328,1344,1360,1376,1392,1409,1425,1442,1459,1475,1492,1509,1527,1544,1561,1579,1596,1614,1631,1649,1667,1685,1703,1721,1739,1757,1775,1793,1812,1830,1848,1867,1885,1904,1922,1941,1960,1978,1997,2016,2034,2053,2072,2091,2110,2129,2148,2167,2186,2205,2224,2243,2262,2281,2300,2319,2338,2357,2376,2394,2412,2431,2449,2468,2486,2504,2523,2541,2559,2578,2596,2614,2633,2651,2669,2688,2706,2724,2743,2761,2779,2797,2816,2834,2852,2870,2889,2907,2925,2943,2961,2980,2998,3016,3034,3052,3070,3089,3107,3125,3143,3161,3179,3197,3215,3233,3251,3269,3287,3305,3323,3341,3359,3377,3395,3413,3431,3448,3466,3484,3502,3520,3538,3555,3573,3591,3609,3626,3644,3662,3679,3697,3715,3732,3750,3767,3785,3802,3820,3837,3855,3872,3890,3907,3925,3942,3960,3977,3994,4012,4029,4046,4063,4081,4098},
+    {911,912,912,914,915,918,920,924,927,932,936,941,947,953,960,966,974,981,990,998,1007,1016,1026,1036,1046,1057,1068,1079,1091,1103,1115,1127,1140,1153,1166,1179,1193,1207,1221,1235,1250,1264,1279,1294,1309,1325,1340,1356,1371,1387,1403,1420,1436,1452,1469,1485,1502,1519,1536,1553,1570,1587,1605,1622,1640,1657,1675,1693,1710,1728,1746,1764,1782,1800,1818,1836,1855,1873,1891,1910,1928,1946,1965,1983,2002,2021,2039,2058,2077,2094,2112,2131,2149,2167,2186,2204,2223,2241,2259,2278,2296,2314,2333,2351,2370,2388,2406,2425,2443,2461,2480,2498,2516,2535,2553,2571,2590,2608,2626,2645,2663,2681,2700,2718,2736,2754,2773,2791,2809,2827,2845,2864,2882,2900,2918,2936,2955,2973,2991,3009,3027,3045,3063,3081,3100,3118,3136,3154,3172,3190,3208,3226,3244,3262,3280,3298,3316,3333,3351,3369,3387,3405,3423,3441,3458,3476,3494,3512,3530,3547,3565,3583,3600,3618,3636,3653,3671,3689,3706,3724,3741,3759,3776,3794,3811,3829,3846,3864,3881,3898,3916,3933,3951,3968,3985,4002,4020,4037,4054,4071,4088},
+    {931,931,932,933,935,937,940,943,947,951,955,960,966,972,978,985,992,999,1007,1015,1024,1033,1043,1052,1062,1073,1084,1095,1106,1118,1129,1142,1154,1167,1180,1193,1206,1220,1234,1248,1262,1276,1291,1305,1320,1335,1351,1366,1382,1397,1413,1429,1445,1461,1477,1494,1510,1527,1544,1561,1577,1594,1612,1629,1646,1663,1681,1698,1716,1733,1751,1769,1786,1804,1822,1840,1858,1876,1894,1912,1930,1948,1966,1985,2003,2021,2039,2058,2076,2094,2112,2131,2149,2167,2186,2204,2222,2241,2259,2277,2295,2314,2332,2350,2369,2387,2405,2423,2442,2460,2478,2497,2515,2533,2551,2570,2588,2606,2624,2643,2661,2679,2697,2715,2734,2752,2770,2788,2806,2825,2843,2861,2879,2897,2915,2933,2951,2970,2988,3006,3024,3042,3060,3078,3096,3114,3132,3150,3168,3186,3204,3222,3240,3257,3275,3293,3311,3329,3347,3365,3382,3400,3418,3436,3454,3471,3489,3507,3524,3542,3560,3577,3595,3613,3630,3648,3665,3683,3700,3718,3735,3753,3770,3788,3805,3823,3840,3857,3875,3892,3909,3927,3944,3961,3978,3996,4013,4030,4047,4064,4081},
+    {951,951,952,953,954,957,959,962,966,970,974,979,984,990,996,1003,1010,1017,1025,1033,1041,1050,1059,1069,1079,1089,1099,1110,1121,1133,1144,1156,1168,1181,1193,1206,1219,1233,1246,1260,1274,1288,1303,1317,1332,1347,1361,1377,1392,1407,1423,1439,1454,1470,1486,1503,1519,1535,1552,1568,1585,1602,1619,1636,1653,1670,1687,1704,1721,1739,1756,1774,1791,1809,1826,1844,1862,1880,1897,1915,1933,1951,1969,1987,2005,2023,2041,2059,2077,2096,2114,2132,2150,2168,2186,2204,2223,2241,2259,2277,2295,2314,2332,2350,2368,2387,2405,2423,2441,2459,2477,2496,2514,2532,2550,2568,2586,2605,2623,2641,2659,2677,2695,2714,2732,2750,2768,2786,2804,2822,2840,2858,2876,2894,2913,2931,2949,2967,2985,3003,3021,3039,3057,3075,3092,3110,3128,3146,3164,3182,3200,3218,3236,3253,3271,3289,3307,3325,3342,3360,3378,3396,3413,3431,3449,3466,3484,3502,3519,3537,3555,3572,3590,3607,3625,3642,3660,3677,3695,3712,3730,3747,3764,3782,3799,3817,3834,3851,3869,3886,3903,3920,3937,3955,3972,3989,4006,4023,4040,4057,4073},
+    {970,970,971,972,974,976,978,981,985,989,993,998,1003,1008,1014,1021,1028,1035,1042,1050,1059,1067,1076,1085,1095,1105,1115,1126,1137,1148,1159,1171,1183,1195,1207,1220,1233,1246,1259,1273,1287,1300,1315,1329,1343,1358,1373,1387,1403,1418,1433,1448,1464,1480,1496,1512,1528,1544,1560,1576,1593,1609,1626,1643,1660,1676,1693,1710,1728,1745,1762,1779,1797,1814,1831,1849,1866,1884,1902,1919,1937,1955,1972,1990,2008,2026,2044,2062,2080,2098,2116,2134,2152,2170,2188,2206,2224,2242,2260,2278,2296,2314,2332,2350,2368,2387,2405,2423,2441,2459,2477,2495,2513,2531,2549,2567,2585,2604,2622,2640,2658,2676,2694,2712,2730,2748,2766,2784,2802,2820,2838,2856,2874,2892,2910,2928,2946,2964,2982,3000,3018,3036,3053,3071,3089,3107,3125,3143,3161,3178,3196,3214,3232,3250,3267,3285,3303,3321,3338,3356,3374,3391,3409,3427,3444,3462,3479,3497,3515,3532,3550,3567,3585,3602,3620,3637,3655,3672,3689,3707,3724,3741,3759,3776,3793,3811,3828,3845,3862,3880,3897,3914,3931,3948,3965,3983,4000,4017,4032,4047,4062},
+    {990,990,990,992,993,995,998,1001,1004,1008,1012,1016,1021,1027,1033,1039,1046,1053,1060,1068,1076,1084,1093,1102,1111,1121,1131,1142,1152,1163,1174,1186,1197,1209,1222,1234,1247,1259,1272,1286,1299,1313,1327,1341,1355,1369,1384,1398,1413,1428,1443,1459,1474,1489,1505,1521,1537,1553,1569,1585,1601,1617,1634,1650,1667,1684,1700,1717,1734,1751,1768,1785,1802,1819,1837,1854,1871,1889,1906,1924,1941,1959,1976,1994,2012,2029,2047,2065,2082,2100,2118,2136,2154,2172,2190,2207,2225,2243,2261,2279,2297,2315,2333,2351,2369,2387,2405,2423,2441,2459,2477,2495,2513,2531,2549,2567,2585,2603,2621,2639,2657,2675,2693,2711,2729,2747,2764,2782,2800,2818,2836,2854,2872,2890,2908,2926,2944,2961,2979,2997,3015,3033,3051,3068,3086,3104,3122,3140,3157,3175,3193,3211,3228,3246,3264,3281,3299,3317,3334,3352,3370,3387,3405,3422,3440,3457,3475,3492,3510,3527,3545,3562,3580,3597,3615,3632,3649,3667,3684,3701,3719,3736,3753,3771,3788,3805,3822,3839,3857,3874,3891,3908,3925,3942,3959,3976,3992,4006,4021,4036,4051},
+    {1009,1009,1010,1011,1012,1014,1017,1020,1023,1026,1031,1035,1040,1045,1051,1057,1063,1070,1077,1085,1093,1101,1110,1119,1128,1137,1147,1157,1168,1178,1189,1201,1212,1224,1236,1248,1260,1273,1286,1299,1312,1325,1339,1353,1367,1381,1395,1410,1424,1439,1454,1469,1484,1499,1515,1530,1546,1562,1577,1593,1609,1625,1642,1658,1674,1691,1707,1724,1741,1757,1774,1791,1808,1825,1842,1859,1876,1894,1911,1928,1946,1963,1980,1998,2015,2033,2050,2068,2086,2103,2121,2139,2156,2174,2192,2210,2227,2245,2263,2281,2299,2316,2334,2352,2370,2388,2406,2424,2441,2459,2477,2495,2513,2531,2549,2567,2585,2602,2620,2638,2656,2674,2692,2710,2727,2745,2763,2781,2799,2817,2835,2852,2870,2888,2906,2924,2941,2959,2977,2995,3013,3030,3048,3066,3084,3101,3119,3137,3154,3172,3190,3207,3225,3243,3260,3278,3295,3313,3331,3348,3366,3383,3401,3418,3436,3453,3471,3488,3505,3523,3540,3558,3575,3592,3610,3627,3644,3662,3679,3696,3713,3731,3748,3765,3782,3799,3817,3834,3851,3868,3885,3902,3919,3936,3951,3966,3981,3996,4010,4025,4040},
+    {1028,1028,1029,1030,1032,1033,1036,1039,1042,1045,1049,1054,1058,1064,1069,1075,1081,1088,1095,1102,1110,1118,1127,1135,1144,1154,1163,1173,1183,1194,1205,1216,1227,1238,1250,1262,1274,1287,1299,1312,1325,1338,1352,1365,1379,1393,1407,1421,1435,1450,1465,1479,1494,1509,1524,1540,1555,1571,1586,1602,1618,1634,1650,1666,1682,1698,1715,1731,1748,1764,1781,1798,1814,1831,1848,1865,1882,1899,1916,1933,1950,1968,1985,2002,2019,2037,2054,2072,2089,2107,2124,2142,2159,2177,2194,2212,2230,2247,2265,2283,2300,2318,2336,2353,2371,2389,2407,2424,2442,2460,2478,2496,2513,2531,2549,2567,2584,2602,2620,2638,2656,2673,2691,2709,2727,2744,2762,2780,2798,2815,2833,2851,2869,2886,2904,2922,2940,2957,2975,2993,3010,3028,3046,3063,3081,3099,3116,3134,3151,3169,3187,3204,3222,3239,3257,3274,3292,3309,3327,3344,3362,3379,3397,3414,3432,3449,3466,3484,3501,3519,3536,3553,3570,3588,3605,3622,3640,3657,3674,3691,3708,3726,3743,3760,3777,3794,3811,3828,3845,3862,3879,3896,3911,3926,3940,3955,3970,3985,4000,4014,4029},
+    {1047,1047,1048,1049,1051,1052,1055,1057,1061,1064,1068,1072,1077,1082,1087,1093,1099,1106,1113,1120,1127,1135,1143,1152,1161,1170,1179,1189,1199,1209,1220,1231,1242,1253,1264,1276,1288,1300,1313,1325,1338,1351,1364,1377,1391,1405,1418,1432,1447,1461,1475,1490,1505,1520,1534,1550,1565,1580,1595,1611,1627,1642,1658,1674,1690,1706,1722,1739,1755,1771,1788,1804,1821,1837,1854,1871,1888,1905,1921,1938,1955,1972,1990,2007,2024,2041,2058,2076,2093,2110,2128,2145,2162,2180,2197,2215,2232,2250,2267,2285,2302,2320,2337,2355,2373,2390,2408,2426,2443,2461,2479,2496,2514,2532,2549,2567,2585,2602,2620,2638,2655,2673,2691,2708,2726,2744,2761,2779,2797,2814,2832,2850,2867,2885,2903,2920,2938,2955,2973,2991,3008,3026,3043,3061,3079,3096,3114,3131,3149,3166,3184,3201,3219,3236,3254,3271,3289,3306,3324,3341,3358,3376,3393,3410,3428,3445,3462,3480,3497,3514,3532,3549,3566,3583,3601,3618,3635,3652,3669,3686,3703,3721,3738,3755,3772,3789,3806,3823,3840,3856,3871,3885,3900,3915,3930,3945,3959,3974,3989,4004,4019},
+    {1066,1067,1067,1068,1070,1071,1074,1076,1079,1083,1086,1091,1095,1100,1105,1111,1117,1123,1130,1137,1145,1152,1160,1169,1177,1186,1195,1205,1215,1225,1235,1246,1256,1267,1279,1290,1302,1314,1326,1339,1351,1364,1377,1390,1403,1417,1430,1444,1458,1472,1486,1501,1515,1530,1545,1560,1575,1590,1605,1620,1636,1651,1667,1682,1698,1714,1730,1746,1762,1778,1795,1811,1827,1844,1860,1877,1894,1910,1927,1944,1961,1978,1994,2011,2028,2046,2063,2080,2097,2114,2131,2148,2166,2183,2200,2218,2235,2252,2270,2287,2305,2322,2340,2357,2375,2392,2410,2427,2445,2462,2480,2497,2515,2532,2550,2567,2585,2603,2620,2638,2655,2673,2691,2708,2726,2743,2761,2778,2796,2814,2831,2849,2866,2884,2901,2919,2936,2954,2971,2989,3006,3024,3042,3059,3076,3094,3111,3129,3146,3164,3181,3199,3216,3233,3251,3268,3286,3303,3320,3338,3355,3372,3390,3407,3424,3441,3459,3476,3493,3510,3527,3545,3562,3579,3596,3613,3630,3647,3665,3682,3699,3716,3733,3750,3767,3784,3801,3816,3831,3845,3860,3875,3890,3905,3919,3934,3949,3964,3979,3993,4008},
+    {1085,1086,1086,1087,1089,1090,1092,1095,1098,1101,1105,1109,1113,1118,1123,1129,1135,1141,1148,1155,1162,1169,1177,1185,1194,1202,1212,1221,1230,1240,1250,1261,1271,1282,1293,1305,1316,1328,1340,1352,1364,1377,1390,1403,1416,1429,1442,1456,1470,1484,1498,1512,1526,1540,1555,1570,1584,1599,1614,1630,1645,1660,1675,1691,1707,1722,1738,1754,1770,1786,1802,1818,1834,1851,1867,1883,1900,1916,1933,1950,1966,1983,2000,2016,2033,2050,2067,2084,2101,2118,2135,2152,2169,2187,2204,2221,2238,2255,2273,2290,2307,2325,2342,2359,2377,2394,2411,2429,2446,2464,2481,2498,2516,2533,2551,2568,2586,2603,2621,2638,2656,2673,2691,2708,2726,2743,2761,2778,2795,2813,2830,2848,2865,2883,2900,2918,2935,2953,2970,2987,3005,3022,3040,3057,3075,3092,3109,3127,3144,3161,3179,3196,3213,3231,3248,3265,3283,3300,3317,3334,3352,3369,3386,3403,3421,3438,3455,3472,3489,3506,3524,3541,3558,3575,3592,3609,3626,3643,3660,3677,3694,3711,3728,3745,3761,3776,3791,3806,3820,3835,3850,3865,3880,3894,3909,3924,3939,3954,3968,3983,3998},
+    {1104,1104,1105,1106,1107,1109,1111,1114,1117,1120,1123,1127,1132,1136,1142,1147,1153,1159,1165,1172,1179,1186,1194,1202,1210,1219,1228,1237,1246,1256,1266,1276,1286,1297,1308,1319,1330,1342,1354,1366,1378,1390,1403,1415,1428,1441,1454,1468,1481,1495,1509,1523,1537,1551,1565,1580,1595,1609,1624,1639,1654,1669,1684,1700,1715,1731,1746,1762,1778,1794,1809,1825,1841,1858,1874,1890,1906,1923,1939,1955,1972,1989,2005,2022,2038,2055,2072,2089,2106,2122,2139,2156,2173,2190,2207,2224,2241,2259,2276,2293,2310,2327,2344,2362,2379,2396,2413,2431,2448,2465,2483,2500,2517,2535,2552,2569,2587,2604,2621,2639,2656,2673,2691,2708,2726,2743,2760,2778,2795,2813,2830,2847,2865,2882,2899,2917,2934,2951,2969,2986,3003,3021,3038,3055,3073,3090,3107,3125,3142,3159,3176,3194,3211,3228,3245,3263,3280,3297,3314,3332,3349,3366,3383,3400,3417,3434,3451,3469,3486,3503,3520,3537,3554,3571,3588,3605,3622,3639,3656,3673,3690,3706,3721,3736,3751,3766,3781,3796,3810,3825,3840,3855,3870,3884,3899,3914,3929,3943,3958,3973,3988},
+    {1123,1123,1124,1125,1126,1128,1130,1132,1135,1138,1142,1146,1150,1155,1160,1165,1170,1176,1183,1189,1196,1203,1211,1219,1227,1235,1244,1253,1262,1272,1281,1291,1301,1312,1323,1334,1345,1356,1368,1379,1391,1403,1416,1428,1441,1454,1467,1480,1493,1507,1520,1534,1548,1562,1576,1590,1605,1619,1634,1649,1664,1678,1694,1709,1724,1739,1755,1770,1786,1801,1817,1833,1849,1865,1881,1897,1913,1929,1945,1962,1978,1994,2011,2027,2044,2060,2077,2094,2110,2127,2144,2161,2177,2194,2211,2228,2245,2262,2279,2296,2313,2330,2347,2364,2381,2398,2416,2433,2450,2467,2484,2502,2519,2536,2553,2570,2588,2605,2622,2639,2657,2674,2691,2709,2726,2743,2760,2778,2795,2812,2830,2847,2864,2881,2899,2916,2933,2950,2968,2985,3002,3019,3037,3054,3071,3088,3106,3123,3140,3157,3174,3192,3209,3226,3243,3260,3277,3294,3312,3329,3346,3363,3380,3397,3414,3431,3448,3465,3482,3499,3516,3533,3550,3567,3584,3601,3618,3635,3651,3667,3682,3697,3712,3727,3741,3756,3771,3786,3801,3815,3830,3845,3860,3875,3889,3904,3919,3934,3948,3963,3978},
+    {1142,1142,1143,1144,1145,1147,1149,1151,1154,1157,1160,1164,1168,1173,1177,1183,1188,1194,1200,1207,1213,1220,1228,1235,1243,1252,1260,1269,1278,1287,1297,1307,1317,1327,1337,1348,1359,1370,1381,1393,1405,1417,1429,1441,1454,1466,1479,1492,1505,1518,1532,1545,1559,1573,1587,1601,1615,1630,1644,1658,1673,1688,1703,1718,1733,1748,1763,1778,1794,1809,1825,1840,1856,1872,1888,1904,1920,1936,1952,1968,1984,2000,2017,2033,2049,2066,2082,2099,2115,2132,2148,2165,2182,2198,2215,2232,2249,2266,2282,2299,2316,2333,2350,2367,2384,2401,2418,2435,2452,2469,2486,2503,2520,2538,2555,2572,2589,2606,2623,2640,2658,2675,2692,2709,2726,2743,2761,2778,2795,2812,2829,2847,2864,2881,2898,2915,2932,2950,2967,2984,3001,3018,3035,3053,3070,3087,3104,3121,3138,3155,3172,3190,3207,3224,3241,3258,3275,3292,3309,3326,3343,3360,3377,3394,3411,3428,3445,3462,3479,3496,3513,3530,3546,3563,3580,3597,3613,3628,3643,3658,3672,3687,3702,3717,3732,3747,3761,3776,3791,3806,3821,3835,3850,3865,3880,3894,3909,3924,3938,3953,3968},
+    {1161,1161,1161,1162,1164,1165,1167,1169,1172,1175,1179,1182,1186,1191,1195,1200,1206,1212,1218,1224,1230,1237,1245,1252,1260,1268,1276,1285,1294,1303,1312,1322,1332,1342,1352,1363,1373,1384,1395,1407,1418,1430,1442,1454,1466,1479,1492,1504,1517,1530,1544,1557,1570,1584,1598,1612,1626,1640,1654,1668,1683,1697,1712,1727,1742,1757,1772,1787,1802,1817,1833,1848,1864,1879,1895,1911,1927,1942,1958,1974,1990,2006,2023,2039,2055,2071,2088,2104,2120,2137,2153,2170,2186,2203,2219,2236,2253,2269,2286,2303,2320,2336,2353,2370,2387,2404,2421,2438,2455,2472,2488,2505,2522,2539,2556,2573,2590,2608,2625,2642,2659,2676,2693,2710,2727,2744,2761,2778,2795,2812,2829,2847,2864,2881,2898,2915,2932,2949,2966,2983,3000,3017,3034,3051,3068,3086,3103,3120,3137,3154,3171,3188,3205,3222,3239,3256,3273,3290,3307,3324,3340,3357,3374,3391,3408,3425,3442,3459,3476,3492,3509,3526,3543,3559,3574,3589,3604,3619,3633,3648,3663,3678,3693,3708,3722,3737,3752,3767,3782,3796,3811,3826,3841,3855,3870,3885,3899,3914,3929,3943,3958},
+    {1179,1179,1180,1181,1182,1184,1186,1188,1190,1193,1197,1200,1204,1209,1213,1218,1223,1229,1235,1241,1248,1254,1261,1269,1276,1284,1292,1301,1310,1319,1328,1337,1347,1357,1367,1377,1388,1399,1410,1421,1432,1444,1455,1467,1479,1492,1504,1517,1529,1542,1555,1568,1582,1595,1609,1623,1636,1650,1664,1679,1693,1707,1722,1736,1751,1766,1781,1796,1811,1826,1841,1856,1872,1887,1903,1918,1934,1949,1965,1981,1997,2013,2029,2045,2061,2077,2093,2109,2126,2142,2158,2175,2191,2207,2224,2240,2257,2273,2290,2307,2323,2340,2357,2373,2390,2407,2424,2440,2457,2474,2491,2508,2525,2541,2558,2575,2592,2609,2626,2643,2660,2677,2694,2711,2728,2745,2762,2779,2796,2813,2830,2847,2864,2881,2898,2915,2932,2949,2966,2983,3000,3016,3033,3050,3067,3084,3101,3118,3135,3152,3169,3186,3203,3220,3237,3254,3271,3287,3304,3321,3338,3355,3372,3389,3405,3422,3439,3456,3473,3489,3505,3520,3535,3550,3565,3580,3595,3609,3624,3639,3654,3669,3684,3698,3713,3728,3743,3757,3772,3787,3802,3816,3831,3846,3861,3875,3890,3905,3919,3934,3948},
+    {1198,1198,1199,1199,1201,1202,1204,1206,1209,1212,1215,1218,1222,1227,1231,1236,1241,1247,1252,1258,1265,1271,1278,1285,1293,1301,1309,1317,1326,1334,1343,1353,1362,1372,1382,1392,1402,1413,1424,1435,1446,1457,1469,1480,1492,1504,1517,1529,1542,1554,1567,1580,1593,1607,1620,1633,1647,1661,1675,1689,1703,1717,1731,1746,1760,1775,1790,1804,1819,1834,1849,1864,1880,1895,1910,1926,1941,1957,1972,1988,2004,2019,2035,2051,2067,2083,2099,2115,2131,2147,2163,2180,2196,2212,2228,2245,2261,2278,2294,2311,2327,2344,2360,2377,2393,2410,2427,2443,2460,2477,2493,2510,2527,2544,2560,2577,2594,2611,2628,2644,2661,2678,2695,2712,2729,2746,2762,2779,2796,2813,2830,2847,2864,2881,2898,2915,2931,2948,2965,2982,2999,3016,3033,3050,3066,3083,3100,3117,3134,3151,3168,3184,3201,3218,3235,3252,3269,3285,3302,3319,3336,3353,3369,3386,3403,3420,3436,3452,3467,3482,3496,3511,3526,3541,3556,3571,3586,3600,3615,3630,3645,3660,3675,3689,3704,3719,3734,3748,3763,3778,3793,3807,3822,3837,3851,3866,3881,3895,3910,3924,3939},
+    {1216,1217,1217,1218,1219,1221,1222,1225,1227,1230,1233,1237,1240,1244,1249,1254,1259,1264,1270,1276,1282,1288,1295,1302,1309,1317,1325,1333,1341,1350,1359,1368,1377,1387,1397,1407,1417,1427,1438,1449,1460,1471,1482,1494,1505,1517,1529,1542,1554,1567,1579,1592,1605,1618,1631,1645,1658,1672,1685,1699,1713,1727,1741,1755,1770,1784,1799,1813,1828,1843,1858,1873,1888,1903,1918,1933,1948,1964,1979,1995,2010,2026,2042,2057,2073,2089,2105,2121,2137,2153,2169,2185,2201,2217,2233,2249,2266,2282,2298,2315,2331,2347,2364,2380,2397,2413,2430,2446,2463,2480,2496,2513,2529,2546,2563,2579,2596,2613,2629,2646,2663,2680,2696,2713,2730,2747,2763,2780,2797,2814,2831,2847,2864,2881,2898,2915,2931,2948,2965,2982,2999,3015,3032,3049,3066,3082,3099,3116,3133,3150,3166,3183,3200,3217,3233,3250,3267,3284,3300,3317,3334,3350,3367,3384,3398,3413,3428,3443,3458,3473,3488,3503,3517,3532,3547,3562,3577,3592,3606,3621,3636,3651,3666,3680,3695,3710,3725,3739,3754,3769,3783,3798,3813,3828,3842,3857,3871,3886,3901,3915,3930},
+    {1235,1235,1235,1236,1237,1239,1241,1243,1245,1248,1251,1255,1258,1262,1267,1271,1276,1281,1287,1293,1299,1305,1312,1319,1326,1333,1341,1349,1357,1366,1375,1383,1393,1402,1412,1421,1431,1442,1452,1463,1474,1485,1496,1507,1519,1530,1542,1554,1566,1579,1591,1604,1617,1630,1643,1656,1669,1682,1696,1710,1723,1737,1751,1765,1779,1794,1808,1822,1837,1852,1866,1881,1896,1911,1926,1941,1956,1971,1987,2002,2017,2033,2048,2064,2079,2095,2111,2127,2142,2158,2174,2190,2206,2222,2238,2254,2270,2287,2303,2319,2335,2351,2368,2384,2400,2417,2433,2450,2466,2483,2499,2516,2532,2549,2565,2582,2598,2615,2631,2648,2665,2681,2698,2715,2731,2748,2765,2781,2798,2815,2831,2848,2865,2881,2898,2915,2931,2948,2965,2982,2998,3015,3032,3048,3065,3082,3098,3115,3132,3149,3165,3182,3199,3215,3232,3249,3265,3282,3298,3315,3330,3345,3360,3375,3390,3405,3420,3435,3450,3464,3479,3494,3509,3524,3539,3553,3568,3583,3598,3613,3627,3642,3657,3672,3686,3701,3716,3731,3745,3760,3775,3789,3804,3819,3833,3848,3862,3877,3892,3906,3921},
+    {1253,1253,1254,1255,1256,1257,1259,1261,1263,1266,1269,1272,1276,1280,1284,1289,1294,1299,1304,1310,1316,1322,1329,1335,1343,1350,1357,1365,1373,1382,1390,1399,1408,1417,1427,1436,1446,1456,1466,1477,1488,1498,1509,1521,1532,1543,1555,1567,1579,1591,1603,1616,1628,1641,1654,1667,1680,1693,1707,1720,1734,1747,1761,1775,1789,1803,1817,1832,1846,1860,1875,1890,1904,1919,1934,1949,1964,1979,1994,2009,2024,2040,2055,2071,2086,2102,2117,2133,2148,2164,2180,2196,2211,2227,2243,2259,2275,2291,2307,2323,2340,2356,2372,2388,2404,2420,2437,2453,2469,2486,2502,2518,2535,2551,2568,2584,2601,2617,2634,2650,2667,2683,2700,2716,2733,2749,2766,2782,2799,2816,2832,2849,2865,2882,2899,2915,2932,2948,2965,2982,2998,3015,3031,3048,3065,3081,3098,3114,3131,3148,3164,3181,3197,3214,3231,3247,3263,3277,3292,3307,3322,3337,3352,3367,3382,3397,3412,3426,3441,3456,3471,3486,3501,3515,3530,3545,3560,3575,3589,3604,3619,3634,3648,3663,3678,3693,3707,3722,3737,3751,3766,3781,3795,3810,3824,3839,3854,3868,3883,3897,3912},
+    {1271,1272,1272,1273,1274,1275,1277,1279,1281,1284,1287,1290,1294,1298,1302,1306,1311,1316,1321,1327,1333,1339,1345,1352,1359,1366,1374,1381,1389,1397,1406,1414,1423,1432,1442,1451,1461,1471,1481,1491,1502,1512,1523,1534,1545,1557,1568,1580,1592,1604,1616,1628,1640,1653,1666,1678,1691,1704,1718,1731,1744,1758,1771,1785,1799,1813,1827,1841,1855,1870,1884,1898,1913,1927,1942,1957,1972,1987,2002,2017,2032,2047,2062,2077,2093,2108,2123,2139,2154,2170,2186,2201,2217,2233,2249,2264,2280,2296,2312,2328,2344,2360,2376,2392,2408,2424,2440,2457,2473,2489,2505,2522,2538,2554,2570,2587,2603,2619,2636,2652,2669,2685,2701,2718,2734,2751,2767,2784,2800,2817,2833,2850,2866,2883,2899,2916,2932,2949,2965,2982,2998,3015,3031,3048,3064,3081,3097,3114,3130,3147,3163,3180,3195,3210,3225,3240,3255,3270,3284,3299,3314,3329,3344,3359,3374,3389,3403,3418,3433,3448,3463,3478,3492,3507,3522,3537,3552,3566,3581,3596,3611,3625,3640,3655,3669,3684,3699,3713,3728,3743,3757,3772,3787,3801,3816,3830,3845,3859,3874,3888,3903},
+    {1290,1290,1290,1291,1292,1293,1295,1297,1299,1302,1305,1308,1312,1315,1319,1324,1329,1333,1339,1344,1350,1356,1362,1369,1376,1383,1390,1397,1405,1413,1421,1430,1439,1447,1457,1466,1475,1485,1495,1505,1516,1526,1537,1548,1559,1570,1581,1593,1604,1616,1628,1640,1652,1665,1677,1690,1703,1716,1729,1742,1755,1768,1782,1795,1809,1823,1837,1850,1865,1879,1893,1907,1922,1936,1950,1965,1980,1995,2009,2024,2039,2054,2069,2084,2099,2115,2130,2145,2161,2176,2192,2207,2223,2238,2254,2270,2285,2301,2317,2333,2349,2364,2380,2396,2412,2428,2444,2460,2476,2493,2509,2525,2541,2557,2573,2590,2606,2622,2638,2655,2671,2687,2703,2720,2736,2752,2769,2785,2802,2818,2834,2851,2867,2884,2900,2916,2933,2949,2966,2982,2998,3015,3031,3048,3064,3081,3097,3112,3127,3142,3157,3172,3187,3202,3217,3232,3247,3262,3277,3292,3306,3321,3336,3351,3366,3381,3396,3410,3425,3440,3455,3470,3484,3499,3514,3529,3543,3558,3573,3588,3602,3617,3632,3646,3661,3676,3690,3705,3720,3734,3749,3764,3778,3793,3807,3822,3836,3851,3865,3880,3894},
+    {1308,1308,1308,1309,1310,1311,1313,1315,1317,1320,1323,1326,1329,1333,1337,1341,1346,1351,1356,1361,1367,1373,1379,1385,1392,1399,1406,1413,1421,1429,1437,1445,1454,1463,1472,1481,1490,1500,1510,1520,1530,1540,1550,1561,1572,1583,1594,1606,1617,1629,1640,1652,1664,1677,1689,1701,1714,1727,1740,1753,1766,1779,1792,1805,1819,1833,1846,1860,1874,1888,1902,1916,1930,1945,1959,1973,1988,2003,2017,2032,2047,2062,2076,2091,2106,2122,2137,2152,2167,2182,2198,2213,2229,2244,2260,2275,2291,2306,2322,2338,2353,2369,2385,2401,2417,2432,2448,2464,2480,2496,2512,2528,2544,2560,2576,2593,2609,2625,2641,2657,2673,2689,2706,2722,2738,2754,2771,2787,2803,2819,2836,2852,2868,2885,2901,2917,2934,2950,2966,2983,2999,3015,3030,3045,3060,3075,3090,3105,3120,3135,3150,3165,3180,3195,3210,3224,3239,3254,3269,3284,3299,3314,3329,3343,3358,3373,3388,3403,3417,3432,3447,3462,3477,3491,3506,3521,3536,3550,3565,3580,3594,3609,3624,3638,3653,3668,3682,3697,3711,3726,3741,3755,3770,3784,3799,3813,3828,3842,3857,3871,3886},
+    {1326,1326,1326,1327,1328,1329,1331,1333,1335,1338,1341,1344,1347,1351,1355,1359,1363,1368,1373,1378,1384,1390,1396,1402,1408,1415,1422,1430,1437,1445,1453,1461,1469,1478,1487,1496,1505,1514,1524,1534,1544,1554,1564,1575,1585,1596,1607,1619,1630,1641,1653,1665,1677,1689,1701,1713,1726,1738,1751,1764,1776,1789,1803,1816,1829,1843,1856,1870,1883,1897,1911,1925,1939,1953,1968,1982,1996,2011,2025,2040,2054,2069,2084,2099,2114,2128,2143,2159,2174,2189,2204,2219,2235,2250,2265,2281,2296,2312,2327,2343,2358,2374,2390,2405,2421,2437,2452,2468,2484,2500,2516,2532,2548,2564,2580,2596,2612,2628,2644,2660,2676,2692,2708,2724,2740,2756,2772,2789,2805,2821,2837,2853,2870,2886,2902,2918,2933,2948,2963,2978,2993,3008,3023,3038,3053,3068,3083,3098,3113,3128,3143,3158,3172,3187,3202,3217,3232,3247,3262,3277,3291,3306,3321,3336,3351,3365,3380,3395,3410,3425,3439,3454,3469,3484,3498,3513,3528,3542,3557,3572,3587,3601,3616,3630,3645,3660,3674,3689,3703,3718,3733,3747,3762,3776,3791,3805,3820,3834,3849,3863,3877},
+    {1344,1344,1344,1345,1346,1347,1349,1351,1353,1355,1358,1361,1365,1368,1372,1376,1380,1385,1390,1395,1401,1406,1412,1418,1425,1432,1438,1446,1453,1461,1468,1476,1485,1493,1502,1511,1520,1529,1538,1548,1558,1568,1578,1588,1599,1610,1621,1632,1643,1654,1665,1677,1689,1701,1713,1725,1737,1749,1762,1775,1787,1800,1813,1826,1839,1853,1866,1880,1893,1907,1920,1934,1948,1962,1976,1990,2005,2019,2033,2048,2062,2077,2091,2106,2121,2136,2150,2165,2180,2195,2210,2225,2241,2256,2271,2286,2302,2317,2332,2348,2363,2379,2394,2410,2426,2441,2457,2472,2488,2504,2520,2535,2551,2567,2583,2599,2615,2631,2647,2663,2678,2694,2710,2726,2742,2758,2775,2791,2807,2822,2837,2852,2867,2882,2897,2912,2926,2941,2956,2971,2986,3001,3016,3031,3046,3061,3076,3091,3106,3121,3136,3150,3165,3180,3195,3210,3225,3240,3254,3269,3284,3299,3314,3329,3343,3358,3373,3388,3402,3417,3432,3447,3461,3476,3491,3506,3520,3535,3550,3564,3579,3593,3608,3623,3637,3652,3666,3681,3696,3710,3725,3739,3754,3768,3783,3797,3811,3826,3840,3855,3869},
+    {1362,1362,1362,1363,1364,1365,1367,1369,1371,1373,1376,1379,1382,1386,1389,1393,1398,1402,1407,1412,1417,1423,1429,1435,1441,1448,1455,1462,1469,1476,1484,1492,1500,1508,1517,1526,1535,1544,1553,1562,1572,1582,1592,1602,1613,1623,1634,1645,1656,1667,1678,1690,1701,1713,1725,1737,1749,1761,1773,1786,1798,1811,1824,1837,1850,1863,1876,1889,1903,1916,1930,1944,1957,1971,1985,1999,2013,2027,2041,2056,2070,2085,2099,2114,2128,2143,2157,2172,2187,2202,2217,2232,2247,2262,2277,2292,2307,2323,2338,2353,2368,2384,2399,2415,2430,2446,2461,2477,2492,2508,2524,2539,2555,2571,2586,2602,2618,2634,2650,2665,2680,2695,2710,2725,2740,2755,2770,2785,2800,2815,2830,2845,2860,2875,2890,2905,2920,2935,2950,2965,2980,2995,3009,3024,3039,3054,3069,3084,3099,3114,3129,3144,3158,3173,3188,3203,3218,3233,3247,3262,3277,3292,3307,3321,3336,3351,3366,3380,3395,3410,3425,3439,3454,3469,3483,3498,3513,3527,3542,3557,3571,3586,3600,3615,3630,3644,3659,3673,3688,3702,3717,3731,3746,3760,3775,3789,3804,3818,3832,3847,3861},
+    {1380,1380,1380,1381,1382,1383,1385,1386,1388,1391,1393,1396,1400,1403,1407,1411,1415,1419,1424,1429,1434,1440,1445,1451,1458,1464,1471,1478,1485,1492,1500,1507,1515,1524,1532,1541,1549,1558,1567,1577,1586,1596,1606,1616,1626,1637,1647,1658,1669,1680,1691,1702,1713,1725,1737,1749,1760,1773,1785,1797,1809,1822,1835,1847,1860,1873,1886,1899,1913,1926,1939,1953,1967,1980,1994,2008,2022,2036,2050,2064,2078,2092,2107,2121,2136,2150,2165,2179,2194,2209,2223,2238,2253,2268,2283,2298,2313,2328,2343,2359,2374,2389,2404,2420,2435,2449,2464,2479,2494,2509,2524,2539,2554,2569,2584,2599,2614,2629,2644,2659,2674,2689,2704,2719,2734,2749,2764,2779,2794,2809,2824,2839,2854,2869,2884,2898,2913,2928,2943,2958,2973,2988,3003,3018,3033,3048,3063,3077,3092,3107,3122,3137,3152,3167,3181,3196,3211,3226,3241,3255,3270,3285,3300,3315,3329,3344,3359,3373,3388,3403,3418,3432,3447,3462,3476,3491,3506,3520,3535,3549,3564,3578,3593,3608,3622,3637,3651,3666,3680,3695,3709,3724,3738,3752,3767,3781,3796,3810,3824,3839,3853},
+    {1396,1396,1397,1398,1398,1400,1401,1403,1405,1407,1410,1413,1416,1419,1423,1427,1431,1435,1440,1445,1450,1455,1461,1467,1473,1479,1486,1492,1499,1507,1514,1522,1530,1538,1546,1554,1563,1572,1581,1590,1599,1609,1619,1628,1638,1649,1659,1670,1680,1691,1702,1713,1724,1736,1747,1759,1771,1783,1795,1807,1819,1831,1844,1856,1869,1882,1895,1908,1921,1934,1947,1960,1974,1987,2001,2014,2028,2042,2056,2070,2084,2098,2112,2126,2140,2155,2169,2183,2198,2212,2227,2241,2256,2271,2285,2300,2315,2330,2345,2359,2374,2389,2404,2419,2434,2449,2464,2479,2494,2509,2524,2538,2553,2568,2583,2598,2613,2628,2643,2658,2673,2688,2703,2718,2733,2748,2763,2777,2792,2807,2822,2837,2852,2867,2882,2897,2912,2927,2941,2956,2971,2986,3001,3016,3031,3045,3060,3075,3090,3105,3120,3134,3149,3164,3179,3193,3208,3223,3238,3252,3267,3282,3297,3311,3326,3341,3355,3370,3385,3399,3414,3429,3443,3458,3473,3487,3502,3516,3531,3545,3560,3574,3589,3603,3618,3632,3647,3661,3676,3690,3705,3719,3733,3748,3762,3777,3791,3805,3819,3834,3848},
+    {1413,1413,1414,1414,1415,1416,1418,1420,1422,1424,1426,1429,1432,1435,1439,1443,1447,1451,1456,1461,1466,1471,1476,1482,1488,1494,1501,1507,1514,1521,1529,1536,1544,1552,1560,1568,1576,1585,1594,1603,1612,1622,1631,1641,1651,1661,1671,1681,1692,1703,1713,1724,1735,1747,1758,1769,1781,1793,1804,1816,1828,1841,1853,1865,1878,1890,1903,1916,1929,1942,1955,1968,1981,1994,2008,2021,2035,2048,2062,2076,2090,2104,2117,2131,2146,2160,2174,2188,2202,2217,2231,2245,2260,2274,2289,2303,2318,2332,2347,2362,2376,2391,2406,2421,2435,2450,2465,2480,2495,2509,2524,2539,2554,2569,2584,2598,2613,2628,2643,2658,2673,2688,2703,2717,2732,2747,2762,2777,2792,2806,2821,2836,2851,2866,2881,2895,2910,2925,2940,2955,2970,2984,2999,3014,3029,3044,3058,3073,3088,3103,3117,3132,3147,3162,3176,3191,3206,3220,3235,3250,3264,3279,3294,3308,3323,3338,3352,3367,3382,3396,3411,3425,3440,3454,3469,3484,3498,3513,3527,3542,3556,3571,3585,3599,3614,3628,3643,3657,3672,3686,3700,3715,3729,3743,3758,3772,3786,3800,3815,3829,3843},
+    {1430,1430,1430,1431,1432,1433,1434,1436,1438,1440,1443,1445,1448,1452,1455,1459,1463,1467,1471,1476,1481,1486,1492,1497,1503,1509,1516,1522,1529,1536,1543,1550,1558,1566,1574,1582,1590,1599,1607,1616,1625,1634,1644,1653,1663,1673,1683,1693,1704,1714,1725,1735,1746,1757,1769,1780,1791,1803,1814,1826,1838,1850,1862,1874,1887,1899,1912,1924,1937,1950,1963,1976,1989,2002,2015,2028,2042,2055,2069,2082,2096,2110,2123,2137,2151,2165,2179,2193,2207,2221,2235,2250,2264,2278,2292,2307,2321,2336,2350,2365,2379,2394,2408,2423,2438,2452,2467,2481,2496,2511,2526,2540,2555,2570,2584,2599,2614,2629,2643,2658,2673,2688,2703,2717,2732,2747,2762,2776,2791,2806,2821,2836,2850,2865,2880,2895,2909,2924,2939,2954,2968,2983,2998,3012,3027,3042,3057,3071,3086,3101,3115,3130,3145,3159,3174,3189,3203,3218,3233,3247,3262,3277,3291,3306,3320,3335,3349,3364,3379,3393,3408,3422,3437,3451,3466,3480,3495,3509,3523,3538,3552,3567,3581,3596,3610,3624,3639,3653,3667,3682,3696,3710,3725,3739,3753,3767,3782,3796,3810,3824,3838},
+    {1446,1446,1447,1447,1448,1449,1451,1452,1454,1457,1459,1462,1465,1468,1471,1475,1479,1483,1487,1492,1497,1502,1507,1513,1518,1524,1531,1537,1544,1550,1557,1565,1572,1580,1588,1596,1604,1612,1621,1629,1638,1647,1657,1666,1676,1685,1695,1705,1715,1726,1736,1747,1758,1768,1779,1791,1802,1813,1825,1836,1848,1860,1872,1884,1896,1908,1921,1933,1946,1958,1971,1984,1997,2009,2023,2036,2049,2062,2075,2089,2102,2116,2129,2143,2157,2171,2184,2198,2212,2226,2240,2254,2268,2282,2297,2311,2325,2339,2354,2368,2382,2397,2411,2426,2440,2455,2469,2484,2498,2513,2527,2542,2557,2571,2586,2600,2615,2630,2644,2659,2674,2688,2703,2718,2732,2747,2762,2776,2791,2806,2821,2835,2850,2865,2879,2894,2909,2923,2938,2953,2967,2982,2997,3011,3026,3041,3055,3070,3084,3099,3114,3128,3143,3158,3172,3187,3201,3216,3230,3245,3260,3274,3289,3303,3318,3332,3347,3361,3376,3390,3405,3419,3434,3448,3462,3477,3491,3506,3520,3534,3549,3563,3578,3592,3606,3621,3635,3649,3663,3678,3692,3706,3720,3735,3749,3763,3777,3791,3806,3820,3834},
+};
+
+#endif // TRAVELTIME_TABLE_H
@@ -0,0 +1,371 @@
+/**
+ * @file waveform.cpp
+ * @brief 揺れの波形記録の実装
+ * @details ファイル形式（リトルエンディアン）: WaveformHeader（32バイト） + SeismicSample（6バイト: X, Y, Z、int16_t、mg）×サンプル数。
+ *          トリガー前のサンプルは記録開始後の最初の書き込みでリングバッファからコピーし、
+ *          トリガー後のサンプルはサンプリングタスクが2面のブロックに交互に詰める。
+ *          満杯のブロックはloop()側で書き込み、書き込み中のブロックには触れないため排他は状態の受け渡しのみ。
+ *          ヘッダーのサンプル数は記録終了時に書き直す（電源断で途中終了したファイルは0のまま）
+ */
+
+#include "waveform.h"
+#include "config.h"
+#include "scheduler.h"
+#include "timesync.h"
+#include "alertpolicy.h"
+#include <SD.h>
+#include <sys/time.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+static const uint32_t WAVEFORM_MAGIC = 0x46575145;  // "EQWF"
+static const uint8_t WAVEFORM_VERSION = 1;
+static const uint32_t PRE_SAMPLES = (uint32_t)WAVEFORM_PRE_SECONDS * SEISMIC_SAMPLE_RATE_HZ;
+static const uint32_t POST_SAMPLES = (uint32_t)WAVEFORM_POST_SECONDS * SEISMIC_SAMPLE_RATE_HZ;
+static const uint32_t MAX_SAMPLES = (uint32_t)WAVEFORM_MAX_SECONDS * SEISMIC_SAMPLE_RATE_HZ;
+static const uint32_t PRE_COPY_SLACK = SEISMIC_SAMPLE_RATE_HZ;  // トリガー前部分のコピー時に残す上書きまでの余裕（1秒）
+static const uint32_t PRE_CHUNK_SAMPLES = 128;                  // トリガー前部分のコピー単位（768バイト）
+static_assert(PRE_SAMPLES + PRE_COPY_SLACK <= SEISMIC_RING_SAMPLES, "WAVEFORM_PRE_SECONDS exceeds the seismic ring");
+
+/**
+ * @brief 波形ファイルのヘッダー
+ */
+struct WaveformHeader {
+    uint32_t magic;           // WAVEFORM_MAGIC
+    uint8_t version;          // WAVEFORM_VERSION
+    uint8_t trigger;          // WaveformTrigger
+    uint16_t sampleRateHz;    // サンプリング周波数（Hz）
+    uint32_t triggerTime;     // トリガーサンプルの時刻（UTC、Unix時刻・秒、時刻未確定時は0）
+    uint16_t triggerMillis;   // 同ミリ秒部分
+    uint8_t axes;             // 軸数（3）
+    uint8_t reserved;         // 予約（0）
+    uint32_t preSamples;      // トリガー前のサンプル数（先頭からこの件数の次がトリガーサンプル）
+    uint32_t totalSamples;    // 記録したサンプル数（記録終了時に確定）
+    uint32_t droppedSamples;  // 書き込みが間に合わず欠落したサンプル数
+    uint32_t eventTime;       // 地震情報の発生時刻（UTC、Unix時刻・秒、本機の揺れ検知では0）
+};
+static_assert(sizeof(WaveformHeader) == 32, "WaveformHeader layout changed, bump WAVEFORM_VERSION");
+static_assert(sizeof(SeismicSample) == 6, "SeismicSample layout changed, bump WAVEFORM_VERSION");
+
+/**
+ * @brief 記録の進行状態（loop()側）
+ */
+enum class CaptureState : uint8_t {
+    Idle,       // 記録なし
+    Requested,  // 開始済み、サンプリングタスクの受け付け待ち
+    Streaming,  // トリガー前部分を書き込み済み、ブロックの書き込み中
+};
+
+// サンプリングタスクとloop()で共有する状態（captureMuxで保護）
+static SeismicSample blocks[2][WAVEFORM_BLOCK_SAMPLES];
+static uint16_t blockCount[2];      // 書き込み待ちブロックのサンプル数
+static bool blockReady[2];          // 書き込み待ち（サンプリングタスクは書き込み完了まで触れない）
+static bool captureArmed = false;   // サンプリングタスクが記録を受け付けた
+static uint32_t armSample = 0;      // ブロックに詰めた最初のサンプルの通し番号
+static uint32_t endSample = 0;      // 記録終了位置（このサンプルの手前まで）
+static bool captureFinished = false;
+static uint32_t capturedDropped = 0;
+static volatile bool captureActive = false;  // サンプリングタスクの早期リターン判定用
+static portMUX_TYPE captureMux = portMUX_INITIALIZER_UNLOCKED;
+
+// サンプリングタスク専用の状態
+static uint8_t fillBlock = 0;
+static uint16_t fillPos = 0;
+
+// loop()側の状態
+static bool waveformReady = false;
+static int writeTimerId = SCHEDULER_INVALID_TIMER;
+static CaptureState captureState = CaptureState::Idle;
+static File captureFile;
+static String capturePath;
+static WaveformHeader header;
+static uint32_t captureStart = 0;   // トリガー前部分の先頭サンプルの通し番号
+static uint32_t captureTrigger = 0; // トリガーサンプルの通し番号
+static uint8_t writeBlock = 0;      // 次に書き込むブロック
+static uint32_t samplesWritten = 0;
+static SeismicSample preChunk[PRE_CHUNK_SAMPLES];
+
+static WaveformStats stats;
+
+// 前方宣言
+static void onWriteTimer(void *arg);
+
+bool initWaveform() {
+#if WAVEFORM_ENABLED
+    if (!isSDCardMounted()) {
+        return false;
+    }
+    if (!SD.exists(WAVEFORM_DIR) && !SD.mkdir(WAVEFORM_DIR)) {
+        consoleLog("[Waveform] ディレクトリ作成失敗: " WAVEFORM_DIR);
+        return false;
+    }
+    writeTimerId = schedulerCreateTimer("waveform", onWriteTimer);
+    if (writeTimerId == SCHEDULER_INVALID_TIMER) {
+        return false;
+    }
+    waveformReady = true;
+    consoleLog("[Waveform] 波形記録有効: トリガー前" + String(WAVEFORM_PRE_SECONDS) + "秒 + 後" +
+               String(WAVEFORM_POST_SECONDS) + "秒, " + String(SEISMIC_SAMPLE_RATE_HZ) + "Hz×3軸 (" +
+               String(SEISMIC_SAMPLE_RATE_HZ * sizeof(SeismicSample)) + "バイト/秒)");
+    return true;
+#else
+    return false;
+#endif
+}
+
+void captureWaveformSample(uint32_t sequence, const SeismicSample &sample) {
+    if (!captureActive) {
+        return;
+    }
+
+    portENTER_CRITICAL(&captureMux);
+    if (!captureArmed) {
+        captureArmed = true;
+        armSample = sequence;
+        fillBlock = 0;
+        fillPos = 0;
+    }
+    if (blockReady[fillBlock]) {
+        // 両方のブロックが書き込み待ち（loop()の書き込みが間に合っていない）
+        capturedDropped++;
+    } else {
+        blocks[fillBlock][fillPos++] = sample;
+    }
+    bool last = (int32_t)(endSample - (sequence + 1)) <= 0;
+    if ((fillPos == WAVEFORM_BLOCK_SAMPLES || last) && fillPos > 0) {
+        blockCount[fillBlock] = fillPos;
+        blockReady[fillBlock] = true;
+        fillBlock ^= 1;
+        fillPos = 0;
+    }
+    if (last) {
+        captureFinished = true;
+        captureActive = false;
+    }
+    portEXIT_CRITICAL(&captureMux);
+}
+
+/**
+ * @brief 記録を開始（記録中の場合は終了位置を延長）
+ * @param start トリガー前部分の先頭サンプルの通し番号
+ * @param trigger トリガーサンプルの通し番号
+ * @param end 記録終了位置の通し番号
+ * @param reason 記録開始のきっかけ
+ * @param eventTime 地震情報の発生時刻（本機の揺れ検知では0）
+ */
+static void beginCapture(uint32_t start, uint32_t trigger, uint32_t end, WaveformTrigger reason, uint32_t eventTime) {
+    if (!waveformReady) {
+        return;
+    }
+
+    if (captureState != CaptureState::Idle) {
+        bool extended = false;
+        portENTER_CRITICAL(&captureMux);
+        if (!captureFinished) {
+            if ((int32_t)(end - (captureStart + MAX_SAMPLES)) > 0) {
+                end = captureStart + MAX_SAMPLES;
+            }
+            if ((int32_t)(end - endSample) > 0) {
+                endSample = end;
+                extended = true;
+            }
+        }
+        portEXIT_CRITICAL(&captureMux);
+        if (extended) {
+            consoleLog("[Waveform] 記録を延長: 残り約" +
+                       String((end - getSampleCount()) / SEISMIC_SAMPLE_RATE_HZ) + "秒");
+        }
+        return;
+    }
+
+    // トリガーサンプルの時刻（現在時刻からサンプル数分さかのぼる）
+    uint32_t triggerTime = 0;
+    uint16_t triggerMillis = 0;
+    if (isClockValid()) {
+        struct timeval now;
+        gettimeofday(&now, nullptr);
+        int64_t nowMs = (int64_t)now.tv_sec * 1000 + now.tv_usec / 1000;
+        int64_t triggerMs = nowMs - (int64_t)(getSampleCount() - trigger) * 1000 / SEISMIC_SAMPLE_RATE_HZ;
+        triggerTime = (uint32_t)(triggerMs / 1000);
+        triggerMillis = (uint16_t)(triggerMs % 1000);
+    }
+
+    capturePath = String(WAVEFORM_DIR "/") + (triggerTime != 0 ? String(triggerTime) : "boot" + String(millis())) + ".bin";
+    captureFile = SD.open(capturePath, FILE_WRITE);
+    if (!captureFile) {
+        consoleLog("[Waveform] ファイル作成失敗: " + capturePath);
+        return;
+    }
+
+    header = WaveformHeader();
+    header.magic = WAVEFORM_MAGIC;
+    header.version = WAVEFORM_VERSION;
+    header.trigger = (uint8_t)reason;
+    header.sampleRateHz = SEISMIC_SAMPLE_RATE_HZ;
+    header.triggerTime = triggerTime;
+    header.triggerMillis = triggerMillis;
+    header.axes = 3;
+    header.eventTime = eventTime;
+    captureFile.write((const uint8_t *)&header, sizeof(header));
+
+    captureStart = start;
+    captureTrigger = trigger;
+    writeBlock = 0;
+    samplesWritten = 0;
+    portENTER_CRITICAL(&captureMux);
+    captureArmed = false;
+    captureFinished = false;
+    capturedDropped = 0;
+    blockReady[0] = false;
+    blockReady[1] = false;
+    endSample = end;
+    captureActive = true;
+    portEXIT_CRITICAL(&captureMux);
+
+    captureState = CaptureState::Requested;
+    schedulerStart(writeTimerId, WAVEFORM_WRITE_INTERVAL_MS, WAVEFORM_WRITE_INTERVAL_MS);
+    consoleLog("[Waveform] 記録開始 (" + String(reason == WaveformTrigger::Local ? "揺れ検知" : "地震情報") + "): " + capturePath);
+}
+
+void captureLocalWaveform(uint32_t onsetSample) {
+    uint32_t start = (onsetSample > PRE_SAMPLES) ? onsetSample - PRE_SAMPLES : 0;
+    beginCapture(start, onsetSample, onsetSample + POST_SAMPLES, WaveformTrigger::Local, 0);
+}
+
+void captureNetworkWaveform(const EarthquakeData &data) {
+    if (!waveformReady || intensityRank(alertIntensity(data)) < intensityRank(WAVEFORM_NETWORK_MIN_INTENSITY)) {
+        return;
+    }
+    // 揺れが過ぎた地震（REST APIでの再取得、遅れて届いた続報など）は記録しない
+    time_t now = time(nullptr);
+    if (!isClockValid() || data.originTime == 0 || now - data.originTime > WAVEFORM_NETWORK_MAX_AGE_S) {
+        return;
+    }
+    uint32_t current = getSampleCount();
+    uint32_t start = (current > PRE_SAMPLES) ? current - PRE_SAMPLES : 0;
+    beginCapture(start, current, current + POST_SAMPLES, WaveformTrigger::Network, (uint32_t)data.originTime);
+}
+
+/**
+ * @brief トリガー前部分（リングバッファ内）を書き込み
+ * @param armed ブロックに詰めた最初のサンプルの通し番号（トリガー前部分の終端）
+ * @details 記録開始の遅れでリングバッファの上書きが近いサンプルは、コピー中の上書きを避けるため記録しない
+ */
+static void writePreTrigger(uint32_t armed) {
+    uint32_t current = getSampleCount();
+    uint32_t first = captureStart;
+    if (current - first > SEISMIC_RING_SAMPLES - PRE_COPY_SLACK) {
+        uint32_t oldestSafe = current - (SEISMIC_RING_SAMPLES - PRE_COPY_SLACK);
+        if ((int32_t)(oldestSafe - armed) > 0) {
+            oldestSafe = armed;
+        }
+        stats.preMissed += oldestSafe - first;
+        first = oldestSafe;
+    }
+
+    while ((int32_t)(armed - first) > 0) {
+        uint32_t count = armed - first;
+        if (count > PRE_CHUNK_SAMPLES) {
+            count = PRE_CHUNK_SAMPLES;
+        }
+        if (samplesWritten == 0) {
+            header.preSamples = ((int32_t)(captureTrigger - first) > 0) ? captureTrigger - first : 0;
+        }
+        if (copySamples(first, preChunk, count)) {
+            captureFile.write((const uint8_t *)preChunk, count * sizeof(SeismicSample));
+            samplesWritten += count;
+        } else {
+            stats.preMissed += count;
+        }
+        first += count;
+    }
+}
+
+/**
+ * @brief 記録を終了（ヘッダーのサンプル数を確定してファイルを閉じる）
+ */
+static void finishCapture() {
+    schedulerStop(writeTimerId);
+
+    portENTER_CRITICAL(&captureMux);
+    uint32_t dropped = capturedDropped;
+    portEXIT_CRITICAL(&captureMux);
+
+    header.totalSamples = samplesWritten;
+    header.droppedSamples = dropped;
+    captureFile.seek(0);
+    captureFile.write((const uint8_t *)&header, sizeof(header));
+    captureFile.close();
+    captureState = CaptureState::Idle;
+
+    stats.captures++;
+    stats.droppedSamples += dropped;
+    consoleLog("[Waveform] 記録終了: " + capturePath + " " + String(samplesWritten) + "サンプル (トリガー前" +
+               String(header.preSamples) + ", 欠落" + String(dropped) + ")");
+}
+
+/**
+ * @brief 書き込みタイマーのコールバック（記録中のみ動作）
+ * @param arg 未使用
+ */
+static void onWriteTimer(void *arg) {
+    (void)arg;
+
+    if (captureState == CaptureState::Idle) {
+        return;
+    }
+    if (captureState == CaptureState::Requested) {
+        portENTER_CRITICAL(&captureMux);
+        bool armed = captureArmed;
+        uint32_t firstBlockSample = armSample;
+        portEXIT_CRITICAL(&captureMux);
+        if (!armed) {
+            return;
+        }
+        writePreTrigger(firstBlockSample);
+        captureState = CaptureState::Streaming;
+    }
+
+    // 満杯のブロックを順に書き込み（書き込み中のブロックはサンプリングタスクが触れない）
+    bool finished = false;
+    for (;;) {
+        portENTER_CRITICAL(&captureMux);
+        bool ready = blockReady[writeBlock];
+        uint16_t count = blockCount[writeBlock];
+        finished = captureFinished;
+        portEXIT_CRITICAL(&captureMux);
+        if (!ready) {
+            break;
+        }
+
+        unsigned long startMicros = micros();
+        captureFile.write((const uint8_t *)blocks[writeBlock], count * sizeof(SeismicSample));
+        uint32_t elapsed = micros() - startMicros;
+        samplesWritten += count;
+        stats.blocks++;
+        if (elapsed > stats.writeMicrosMax) {
+            stats.writeMicrosMax = elapsed;
+        }
+
+        portENTER_CRITICAL(&captureMux);
+        blockReady[writeBlock] = false;
+        portEXIT_CRITICAL(&captureMux);
+        writeBlock ^= 1;
+    }
+
+    if (finished) {
+        finishCapture();
+    }
+}
+
+void logWaveformStats() {
+    if (!waveformReady || (stats.captures == 0 && stats.blocks == 0)) {
+        return;
+    }
+    consoleLog("[Waveform] 記録" + String(stats.captures) + "件, ブロック" + String(stats.blocks) + "件, 書き込み最大" +
+               String(stats.writeMicrosMax) + "us (1ブロック" +
+               String(WAVEFORM_BLOCK_SAMPLES * 1000 / SEISMIC_SAMPLE_RATE_HZ) + "ms分), 欠落" +
+               String(stats.droppedSamples) + "件, トリガー前の上書き" + String(stats.preMissed) + "件");
+    stats = WaveformStats();
+}
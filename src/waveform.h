@@ -0,0 +1,86 @@
+/**
+ * @file waveform.h
+ * @brief 揺れの波形をSDカードに記録（トリガー前のサンプルを含む）
+ * @details 本機の揺れ検知、または揺れが予想される地震情報の受信をきっかけに、
+ *          トリガー前WAVEFORM_PRE_SECONDS秒（揺れ検知のリングバッファから取得）と
+ *          トリガー後WAVEFORM_POST_SECONDS秒の加速度を1イベント1ファイルで記録する。
+ *          トリガー後のサンプルはサンプリングタスクが2つのブロックに交互に詰め、
+ *          SDカードへの書き込みはloop()側のタイマーで行うため、サンプリングが書き込みで止まることはない
+ */
+
+#ifndef WAVEFORM_H
+#define WAVEFORM_H
+
+#include <Arduino.h>
+#include "earthquake.h"
+#include "seismic.h"
+
+// 波形記録の有効/無効（揺れ検知が無効の場合も記録しない）
+#define WAVEFORM_ENABLED true
+
+// 記録設定
+#define WAVEFORM_DIR "/waveform"                // 記録先ディレクトリ（ファイル名はトリガー時刻のUnix時刻）
+#define WAVEFORM_PRE_SECONDS 4                  // トリガー前の記録秒数（リングバッファ長から1秒以上の余裕を残す）
+#define WAVEFORM_POST_SECONDS 60                // トリガー後の記録秒数（記録中の再トリガーで延長）
+#define WAVEFORM_MAX_SECONDS 300                // 延長を含む1ファイルの最大記録秒数
+#define WAVEFORM_BLOCK_SAMPLES 256              // 書き込みブロックのサンプル数（1536バイト、2面で3KB）
+#define WAVEFORM_WRITE_INTERVAL_MS 100          // 記録中の書き込み確認間隔（ミリ秒）
+
+// 地震情報による記録開始の条件
+#define WAVEFORM_NETWORK_MIN_INTENSITY Intensity::Int3  // 記録する震度の下限（設置場所の推定震度、なければ最大震度）
+#define WAVEFORM_NETWORK_MAX_AGE_S 120                  // 発生時刻からの経過秒数の上限（揺れが過ぎた地震は記録しない）
+
+/**
+ * @brief 記録開始のきっかけ（ファイルヘッダーに記録）
+ */
+enum class WaveformTrigger : uint8_t {
+    Local = 0,    // 本機の揺れ検知（STA/LTAトリガー）
+    Network = 1,  // 地震情報の受信
+};
+
+/**
+ * @brief 波形記録の統計
+ */
+struct WaveformStats {
+    uint32_t captures;          // 記録したファイル数
+    uint32_t blocks;            // 書き込んだブロック数
+    uint32_t writeMicrosMax;    // ブロック書き込みの最大時間（マイクロ秒）
+    uint32_t droppedSamples;    // ブロックの書き込みが間に合わず欠落したサンプル数
+    uint32_t preMissed;         // 上書き済みで記録できなかったトリガー前のサンプル数
+};
+
+/**
+ * @brief 波形記録を初期化（initSeismic()とloadAppConfig()の後に1回呼び出し）
+ * @return 記録が利用可能な場合true（SDカードなし、揺れ検知が無効の場合はfalse）
+ */
+bool initWaveform();
+
+/**
+ * @brief 本機の揺れ検知による波形記録を開始（updateSeismic()からトリガー開始時に呼び出し）
+ * @param onsetSample トリガー開始サンプルの通し番号
+ * @details 記録中の場合は終了位置を延長する
+ */
+void captureLocalWaveform(uint32_t onsetSample);
+
+/**
+ * @brief 地震情報の受信による波形記録を開始
+ * @param data 地震情報
+ * @details 設置場所の推定震度（推定していない場合は最大震度）がWAVEFORM_NETWORK_MIN_INTENSITY以上で、
+ *          発生直後の地震のみ記録する
+ */
+void captureNetworkWaveform(const EarthquakeData &data);
+
+/**
+ * @brief 記録中のブロックに1サンプルを追加（サンプリングタスクから毎サンプル呼び出し）
+ * @param sequence サンプルの通し番号
+ * @param sample サンプル
+ * @details 記録中でなければ何もしない。ブロックが満杯になったら書き込み待ちにして次のブロックに切り替える
+ */
+void captureWaveformSample(uint32_t sequence, const SeismicSample &sample);
+
+/**
+ * @brief 記録統計をログ出力してリセット
+ */
+void logWaveformStats();
+
+#endif // WAVEFORM_H
@@ -6,20 +6,42 @@
 #include "websocket.h"
 #include "earthquake.h"
 #include "notification.h"
-#include <ArduinoWebsockets.h>
+#include "wsclient.h"
+#include "scheduler.h"
+#include "timesync.h"
 #include <ArduinoJson.h>
 
-using namespace websockets;
-
 // 外部依存関数（main.cppで定義）
 extern void consoleLog(String message);
 extern bool isWiFiConnected;
 
-// WebSocketクライアントオブジェクト
-static WebsocketsClient webSocketClient;
+// 同時購読ノード数（主ノード + 追加ノード）
+#define WS_MAX_NODES (1 + SYMBOL_MAX_HEDGE_NODES)
 
-// WebSocket接続URL（initWebSocket()で設定）
-static String websocketUrl = "";
+/**
+ * @brief ノードごとのWebSocket接続状態
+ * @details 複数ノードを並行購読し、先着したトランザクションのみを処理する（ヘッジ購読）
+ */
+struct WsNodeConnection {
+    WsClient client;                       // WebSocketクライアントオブジェクト（固定長受信バッファ）
+    String url;                            // WebSocket接続URL
+    bool connected = false;                // WebSocket接続状態フラグ
+    String serverUid = "";                 // サーバーから受信したUID
+    bool uidReceived = false;              // UID受信フラグ
+    int consecutiveFailures = 0;           // 連続失敗カウンター
+    int reconnectTimerId = SCHEDULER_INVALID_TIMER;   // 再接続タイマー
+    int pingTimerId = SCHEDULER_INVALID_TIMER;        // Ping送信タイマー（周期）
+    int pongTimeoutTimerId = SCHEDULER_INVALID_TIMER; // Pong応答タイムアウト（ワンショット）
+
+    // 到着統計（ヘッジ購読の効果測定用）
+    uint32_t firstArrivals = 0;            // 先着したトランザクション数
+    uint32_t lateArrivals = 0;             // 他ノードより遅れて到着した数
+    uint32_t lateDeltaSumMs = 0;           // 遅延の合計（ミリ秒）
+    uint32_t lateDeltaMaxMs = 0;           // 遅延の最大値（ミリ秒）
+};
+
+static WsNodeConnection wsNodes[WS_MAX_NODES];
+static int wsNodeCount = 0;
 
 // サブスクリプション対象アドレス（initWebSocket()で設定）
 static String subscriptionAddress = "";
@@ -27,208 +49,294 @@ static String subscriptionAddress = "";
 // 署名者公開鍵（initWebSocket()で設定）
 static String signerPubKey = "";
 
-// WebSocket接続状態フラグ
-static bool wsConnected = false;
-
-// サーバーから受信したUID
-static String serverUid = "";
-
-// UID受信フラグ
-static bool uidReceived = false;
-
-// 再接続タイマー
-static unsigned long reconnectTimer = 0;
-
-// 連続失敗カウンター
-static int consecutiveFailures = 0;
-
 // 再接続間隔定数
 static const unsigned long RECONNECT_INTERVAL = 5000;         // 5秒
 static const unsigned long BACKOFF_INTERVAL = 60000;          // 1分
 static const int MAX_CONSECUTIVE_FAILURES = 5;
+static const unsigned long CONNECT_STAGGER_INTERVAL = 500;   // ノードごとの接続開始のずらし幅（ミリ秒）
 
 // 重複検出用トランザクションハッシュバッファ（循環バッファ）
+// 到着時刻と先着ノードを併せて保持し、後着分の到着差を統計に記録する
 #define TX_HASH_BUFFER_SIZE 10
-static String txHashBuffer[TX_HASH_BUFFER_SIZE];
+struct TxArrival {
+    String hash;                 // トランザクションハッシュ
+    unsigned long arrivalTime;   // 先着時刻（millis）
+    int firstNode;               // 先着ノードのインデックス
+    uint8_t seenMask;            // 到着済みノードのビットマスク
+};
+static TxArrival txHashBuffer[TX_HASH_BUFFER_SIZE];
 static int txHashIndex = 0;
 
 // メモリ監視用定数とタイマー
-static unsigned long memoryCheckTimer = 0;
+static int memoryTimerId = SCHEDULER_INVALID_TIMER;
 static const unsigned long MEMORY_CHECK_INTERVAL = 10000;     // 10秒
 static const unsigned long LOW_MEMORY_THRESHOLD = 20000;      // 20KB
 static const unsigned long CRITICAL_MEMORY_THRESHOLD = 15000; // 15KB
 
-// Ping/Pong監視用タイマー
-static unsigned long lastPingSentTime = 0;      // 最後にPingを送信した時刻（0は未送信）
-static unsigned long lastPongReceivedTime = 0;  // 最後にPongを受信した時刻
+// 到着統計・受信統計のログ出力間隔
+static int statsTimerId = SCHEDULER_INVALID_TIMER;
+static const unsigned long STATS_INTERVAL = 300000;           // 5分
 
 // Ping/Pong監視用定数
 static const unsigned long PING_INTERVAL = 60000;   // Ping送信間隔（60秒）
 static const unsigned long PONG_TIMEOUT = 30000;    // Pong応答タイムアウト（30秒）
 
 // 前方宣言
-static bool connectWebSocket();
-static void disconnectWebSocket();
-static void subscribeToTransactions(const String &uid);
-static void handleWebSocketMessage(const String &message);
-static bool isDuplicateTransaction(const String &txHash);
-static void addTransactionHash(const String &txHash);
-static void monitorMemory();
-static void onWebSocketConnect();
-static void onWebSocketDisconnect();
-static void onWebSocketError(String error);
-static void sendPing();
-static bool checkPongTimeout();
+static String buildWebSocketUrl(const String &nodeUrl);
+static bool connectWebSocket(int node);
+static void disconnectWebSocket(int node);
+static void subscribeToTransactions(int node, const String &uid);
+static void handleWebSocketMessage(int node, const char *message, size_t length);
+static int findTransaction(const String &txHash);
+static void addTransactionHash(int node, const String &txHash);
+static void recordLateArrival(int node, int slot);
+static void monitorMemory(void *arg);
+static void logConnectionStats(void *arg);
+static void onWebSocketConnect(int node);
+static void onWebSocketDisconnect(int node);
+static void scheduleReconnect(int node);
+static void onReconnectTimer(void *arg);
+static void onPingTimer(void *arg);
+static void onPongTimeout(void *arg);
+
+/**
+ * @brief ログ用のノード識別プレフィックスを生成
+ * @param node ノードインデックス
+ * @return 単一ノード時は"[WebSocket]"、複数ノード時は"[WebSocket#n]"
+ */
+static String wsTag(int node) {
+    if (wsNodeCount <= 1) {
+        return "[WebSocket]";
+    }
+    return "[WebSocket#" + String(node) + "]";
+}
 
 /**
- * @brief トランザクションハッシュの重複チェック
+ * @brief トランザクションハッシュを重複検出バッファから検索
  * @param txHash トランザクションハッシュ（64文字16進数文字列）
- * @return 重複している場合true、新規の場合false
+ * @return 見つかった場合はバッファ内のインデックス、新規の場合-1
  */
-static bool isDuplicateTransaction(const String &txHash) {
+static int findTransaction(const String &txHash) {
     for (int i = 0; i < TX_HASH_BUFFER_SIZE; i++) {
-        if (txHashBuffer[i] == txHash) {
-            return true;  // 重複検出
+        if (txHashBuffer[i].hash == txHash) {
+            return i;  // 重複検出
         }
     }
-    return false;  // 新規トランザクション
+    return -1;  // 新規トランザクション
 }
 
 /**
  * @brief 重複検出バッファにトランザクションハッシュを追加
+ * @param node 先着したノードのインデックス
  * @param txHash トランザクションハッシュ（64文字16進数文字列）
  */
-static void addTransactionHash(const String &txHash) {
-    txHashBuffer[txHashIndex] = txHash;
+static void addTransactionHash(int node, const String &txHash) {
+    TxArrival &entry = txHashBuffer[txHashIndex];
+    entry.hash = txHash;
+    entry.arrivalTime = millis();
+    entry.firstNode = node;
+    entry.seenMask = (uint8_t)(1 << node);
     txHashIndex = (txHashIndex + 1) % TX_HASH_BUFFER_SIZE;  // 循環バッファ
+
+    wsNodes[node].firstArrivals++;
 }
 
 /**
- * @brief Ping送信処理
- * @details WebSocket接続中にPingフレームを送信し、送信時刻を記録
+ * @brief 後着したトランザクションの到着差を統計に記録
+ * @param node 後着したノードのインデックス
+ * @param slot 重複検出バッファ内のインデックス
+ * @details 同一ノードからの再送は統計に含めない
  */
-static void sendPing() {
-    if (wsConnected) {
-        bool success = webSocketClient.ping();
-        if (success) {
-            lastPingSentTime = millis();
-            consoleLog("[WebSocket] Ping送信");
-        } else {
-            consoleLog("[WebSocket] Ping送信失敗");
-            // Ping送信失敗時はlastPingSentTimeを更新しない（次回再試行）
-        }
+static void recordLateArrival(int node, int slot) {
+    TxArrival &entry = txHashBuffer[slot];
+    uint8_t bit = (uint8_t)(1 << node);
+    if (entry.firstNode == node || (entry.seenMask & bit)) {
+        return;
     }
+    entry.seenMask |= bit;
+
+    uint32_t delta = millis() - entry.arrivalTime;
+    WsNodeConnection &conn = wsNodes[node];
+    conn.lateArrivals++;
+    conn.lateDeltaSumMs += delta;
+    if (delta > conn.lateDeltaMaxMs) {
+        conn.lateDeltaMaxMs = delta;
+    }
+
+    consoleLog(wsTag(node) + " 後着 +" + String(delta) + "ms（先着: #" + String(entry.firstNode) + "）");
 }
 
 /**
- * @brief Pong応答タイムアウトチェック
- * @return タイムアウト検出時true、正常時false
- * @details Ping送信後30秒以内にPong応答がない場合、接続断と判断
- * @note millis()オーバーフロー対策: unsigned long型の減算により、
- *       オーバーフロー時も正しく動作（49.7日ごとのオーバーフロー）
+ * @brief ノードごとの受信統計と到着統計をログ出力（5分周期のタイマー）
+ * @param arg 未使用
+ * @details poll()処理コスト（平均/最大）、受信メッセージ数、最大メッセージ長を出力。
+ *          到着統計はヘッジ購読時（複数ノード）のみ出力する
  */
-static bool checkPongTimeout() {
-    // Ping未送信時はチェックしない
-    if (lastPingSentTime == 0) {
-        return false;
+static void logConnectionStats(void *arg) {
+    for (int i = 0; i < wsNodeCount; i++) {
+        WsNodeConnection &conn = wsNodes[i];
+        const WsClientStats &stats = conn.client.getStats();
+        uint32_t avgPoll = stats.pollCount > 0 ? stats.pollMicrosTotal / stats.pollCount : 0;
+        consoleLog(wsTag(i) + " 受信統計: poll平均=" + String(avgPoll) + "us, poll最大=" + String(stats.pollMicrosMax) +
+                   "us, メッセージ=" + String(stats.messages) + "件, 最大長=" + String(stats.maxMessageLength) +
+                   " bytes, 破棄=" + String(stats.droppedMessages) + "件, Free heap=" + String(ESP.getFreeHeap()) + " bytes");
+
+        if (wsNodeCount > 1) {
+            uint32_t avgDelta = conn.lateArrivals > 0 ? conn.lateDeltaSumMs / conn.lateArrivals : 0;
+            consoleLog(wsTag(i) + " 到着統計: 先着=" + String(conn.firstArrivals) +
+                       "件, 後着=" + String(conn.lateArrivals) +
+                       "件, 平均遅延=" + String(avgDelta) + "ms, 最大遅延=" + String(conn.lateDeltaMaxMs) + "ms");
+        }
     }
+}
 
-    // Pong受信済みの場合はタイムアウトしない
-    if (lastPongReceivedTime >= lastPingSentTime) {
-        return false;
+/**
+ * @brief Ping送信タイマーのコールバック
+ * @param arg ノードインデックス
+ * @details WebSocket接続中にPingフレームを送信し、Pong応答タイムアウトを開始
+ */
+static void onPingTimer(void *arg) {
+    int node = (int)(intptr_t)arg;
+    WsNodeConnection &conn = wsNodes[node];
+    if (!conn.connected) {
+        return;
     }
 
-    unsigned long currentTime = millis();
-    unsigned long elapsedSincePing = currentTime - lastPingSentTime;
-
-    // Pongタイムアウトチェック（30秒超過）
-    if (elapsedSincePing > PONG_TIMEOUT) {
-        consoleLog("[WebSocket] Pong応答タイムアウト、接続断と判断");
-        disconnectWebSocket();
-
-        // 再接続タイマー開始（consecutiveFailuresは増加させない）
-        reconnectTimer = currentTime;
-
-        return true;
+    bool success = conn.client.ping();
+    if (success) {
+        consoleLog(wsTag(node) + " Ping送信");
+        // 応答待ち中に再送した場合は最初のPingからのタイムアウトを維持
+        if (!schedulerIsActive(conn.pongTimeoutTimerId)) {
+            schedulerStart(conn.pongTimeoutTimerId, PONG_TIMEOUT);
+        }
+    } else {
+        consoleLog(wsTag(node) + " Ping送信失敗");
+        // Ping送信失敗時は次の周期で再試行
     }
+}
 
-    return false;
+/**
+ * @brief Pong応答タイムアウトのコールバック
+ * @param arg ノードインデックス
+ * @details Ping送信後30秒以内にPong応答がない場合、接続断と判断。
+ *          切断イベントで再接続タイマーが開始される（consecutiveFailuresは増加させない）
+ */
+static void onPongTimeout(void *arg) {
+    int node = (int)(intptr_t)arg;
+    consoleLog(wsTag(node) + " Pong応答タイムアウト、接続断と判断");
+    disconnectWebSocket(node);
 }
 
 /**
- * @brief メモリ使用量を監視し、必要に応じて警告または切断
+ * @brief メモリ使用量を監視し、必要に応じて警告または切断（10秒周期のタイマー）
+ * @param arg 未使用
+ * @details メモリ不足時は全ノードを切断する
  */
-static void monitorMemory() {
-    unsigned long currentTime = millis();
-
-    if (currentTime - memoryCheckTimer >= MEMORY_CHECK_INTERVAL) {
-        memoryCheckTimer = currentTime;
-
-        uint32_t freeHeap = ESP.getFreeHeap();
-
-        if (freeHeap < CRITICAL_MEMORY_THRESHOLD) {
-            consoleLog("[WebSocket] メモリ不足、切断: Free heap = " + String(freeHeap) + " bytes");
-            disconnectWebSocket();
-            // 1分待機してから再接続試行
-            reconnectTimer = currentTime;
-            consecutiveFailures = MAX_CONSECUTIVE_FAILURES;  // バックオフ間隔を使用
-        } else if (freeHeap < LOW_MEMORY_THRESHOLD) {
-            consoleLog("[WebSocket] メモリ警告: Free heap = " + String(freeHeap) + " bytes");
+static void monitorMemory(void *arg) {
+    uint32_t freeHeap = ESP.getFreeHeap();
+
+    if (freeHeap < CRITICAL_MEMORY_THRESHOLD) {
+        consoleLog("[WebSocket] メモリ不足、切断: Free heap = " + String(freeHeap) + " bytes");
+        for (int i = 0; i < wsNodeCount; i++) {
+            // 1分待機してから再接続試行（バックオフ間隔を使用）
+            wsNodes[i].consecutiveFailures = MAX_CONSECUTIVE_FAILURES;
+            disconnectWebSocket(i);
+            scheduleReconnect(i);
         }
+    } else if (freeHeap < LOW_MEMORY_THRESHOLD) {
+        consoleLog("[WebSocket] メモリ警告: Free heap = " + String(freeHeap) + " bytes");
     }
 }
 
 /**
  * @brief Symbol blockchain WebSocketにサブスクリプションを送信
  * @details 該当アドレス宛てのconfirmed transactionを監視
+ * @param node ノードインデックス
  * @param uid サーバーから受信したUID
  */
-static void subscribeToTransactions(const String &uid) {
+static void subscribeToTransactions(int node, const String &uid) {
     String subscription = "{\"uid\":\"" + uid + "\",\"subscribe\":\"confirmedAdded/" + subscriptionAddress + "\"}";
 
-    consoleLog("[WebSocket] サブスクリプション送信: " + subscription);
-    webSocketClient.send(subscription);
+    consoleLog(wsTag(node) + " サブスクリプション送信: " + subscription);
+    wsNodes[node].client.send(subscription);
+
+    // 時計未設定の場合は新規ブロック（約30秒ごと）も購読し、最初のブロックのタイムスタンプで時計を設定
+    if (!isClockValid()) {
+        wsNodes[node].client.send("{\"uid\":\"" + uid + "\",\"subscribe\":\"block\"}");
+    }
+
+    // 起動から最初の購読までの時間（起動処理の計測用）
+    static bool firstSubscriptionLogged = false;
+    if (!firstSubscriptionLogged) {
+        firstSubscriptionLogged = true;
+        consoleLog("[Boot] 購読開始: " + String(millis()) + "ms");
+    }
 }
 
 /**
  * @brief WebSocketメッセージ受信時のコールバック
- * @param message 受信したメッセージ（JSON文字列）
+ * @param node 受信したノードのインデックス
+ * @param message 受信したメッセージ（JSON文字列、WsClientの受信バッファへの参照）
+ * @param length メッセージ長（バイト）
+ * @details 受信バッファを直接JSON解析し、メッセージ全体のString複製は行わない
  */
-static void handleWebSocketMessage(const String &message) {
-    consoleLog("[WebSocket] メッセージ受信 (長さ: " + String(message.length()) + ")");
-    consoleLog("[WebSocket] 内容: " + message);
+static void handleWebSocketMessage(int node, const char *message, size_t length) {
+    uint32_t heapBefore = ESP.getFreeHeap();
+    consoleLog(wsTag(node) + " メッセージ受信 (長さ: " + String((unsigned long)length) + ")");
+
+    // 内容プレビュー（先頭200文字まで）
+    char preview[201];
+    size_t previewLength = min(length, sizeof(preview) - 1);
+    memcpy(preview, message, previewLength);
+    preview[previewLength] = '\0';
+    consoleLog(wsTag(node) + " 内容: " + String(preview));
 
     // JSON解析
     JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, message);
+    DeserializationError error = deserializeJson(doc, message, length);
 
     if (error) {
-        consoleLog("[WebSocket] JSON解析エラー: " + String(error.c_str()));
+        consoleLog(wsTag(node) + " JSON解析エラー: " + String(error.c_str()));
         return;
     }
 
+    WsNodeConnection &conn = wsNodes[node];
+
     // UID受信チェック（接続直後にサーバーから送られる）
     if (doc["uid"].is<const char*>() && !doc["data"].is<JsonObject>() && !doc["topic"].is<const char*>()) {
-        serverUid = doc["uid"].as<String>();
-        uidReceived = true;
-        consoleLog("[WebSocket] サーバーからUIDを受信: " + serverUid);
+        conn.serverUid = doc["uid"].as<String>();
+        conn.uidReceived = true;
+        consoleLog(wsTag(node) + " サーバーからUIDを受信: " + conn.serverUid);
 
         // UIDを受信したのでサブスクリプションを送信
-        subscribeToTransactions(serverUid);
+        subscribeToTransactions(node, conn.serverUid);
         return;
     }
 
     // トランザクション情報の取得
     if (!doc["data"].is<JsonObject>()) {
         // dataフィールドがない場合はスキップ（サブスクリプション応答など）
-        consoleLog("[WebSocket] サブスクリプション確認応答を受信、接続維持");
+        consoleLog(wsTag(node) + " サブスクリプション確認応答を受信、接続維持");
         return;
     }
 
     JsonObject data = doc["data"];
 
+    // 新規ブロック（時計設定用、1回受信したら購読解除）
+    if (strcmp(doc["topic"] | "", "block") == 0) {
+        uint64_t blockTimestamp = strtoull(data["block"]["timestamp"] | "0", nullptr, 10);
+        seedClockFromSymbolTimestamp(blockTimestamp);
+        conn.client.send("{\"uid\":\"" + conn.serverUid + "\",\"unsubscribe\":\"block\"}");
+        return;
+    }
+
+    // 承認直後のトランザクションのタイムスタンプ（ノードが付与する場合）でも時計を設定
+    if (data["meta"]["timestamp"].is<const char*>()) {
+        seedClockFromSymbolTimestamp(strtoull(data["meta"]["timestamp"].as<const char*>(), nullptr, 10));
+    }
+
     if (!data["transaction"].is<JsonObject>()) {
-        consoleLog("[WebSocket] transactionキーなし");
+        consoleLog(wsTag(node) + " transactionキーなし");
         return;
     }
 
@@ -246,21 +354,23 @@ static void handleWebSocketMessage(const String &message) {
     String hexMessage = transaction["message"] | "";
 
     if (hexMessage.length() == 0) {
-        consoleLog("[WebSocket] messageフィールドが空");
+        consoleLog(wsTag(node) + " messageフィールドが空");
         return;
     }
 
     // メタ情報からトランザクションハッシュを取得
     String txHash = data["meta"]["hash"] | "";
 
-    // 重複検出
-    if (isDuplicateTransaction(txHash)) {
-        consoleLog("[WebSocket] 重複トランザクションをスキップ: " + txHash.substring(0, 16) + "...");
+    // 重複検出（他ノードから先着済みの場合は到着差のみ記録）
+    int slot = findTransaction(txHash);
+    if (slot >= 0) {
+        recordLateArrival(node, slot);
+        consoleLog(wsTag(node) + " 重複トランザクションをスキップ: " + txHash.substring(0, 16) + "...");
         return;
     }
 
     // 新規トランザクションとしてハッシュを記録
-    addTransactionHash(txHash);
+    addTransactionHash(node, txHash);
 
     // 地震情報をパース
     EarthquakeData earthquakeData;
@@ -270,67 +380,148 @@ static void handleWebSocketMessage(const String &message) {
     }
 
     // 地震情報をログ出力
-    consoleLog("[WebSocket] 新しい地震情報を検出");
+    consoleLog(wsTag(node) + " 新しい地震情報を検出");
     consoleLog("発生時刻: " + earthquakeData.datetime);
     consoleLog("震源地: " + earthquakeData.hypocenterName);
     consoleLog("マグニチュード: M" + String(earthquakeData.magnitude, 1));
-    consoleLog("最大震度: " + earthquakeData.maxIntensity);
+    consoleLog("最大震度: " + String(intensityLabel(earthquakeData.maxIntensity)));
+    if (earthquakeData.hasSiteEstimate) {
+        consoleLog("推定震度（設置場所）: " + String(intensityLabel(earthquakeData.siteIntensity)));
+    }
     consoleLog("深さ: " + String(earthquakeData.depth) + "km");
     consoleLog("津波: " + earthquakeData.tsunami);
 
     // 通知機能を呼び出す（重複検出済みと想定）
     notifyEarthquake(earthquakeData);
+
+    // 1メッセージ処理中のヒープ変動（JSON解析・デコードの一時確保を含む）
+    consoleLog(wsTag(node) + " メッセージ処理後 Free heap: " + String(ESP.getFreeHeap()) +
+               " bytes (処理前比 " + String((long)ESP.getFreeHeap() - (long)heapBefore) + ")");
 }
 
 /**
  * @brief WebSocket接続確立時のコールバック
+ * @param node ノードインデックス
  */
-static void onWebSocketConnect() {
-    consoleLog("[WebSocket] 接続成功、サーバーからのUID待機中...");
-    wsConnected = true;
-    consecutiveFailures = 0;  // 連続失敗カウンターリセット
-    uidReceived = false;      // UID受信フラグリセット
-    serverUid = "";           // UIDクリア
-
-    // Ping/Pong監視の初期化
-    lastPingSentTime = 0;            // Ping未送信状態
-    lastPongReceivedTime = millis(); // 接続確立時刻を記録
+static void onWebSocketConnect(int node) {
+    WsNodeConnection &conn = wsNodes[node];
+    consoleLog(wsTag(node) + " 接続成功、サーバーからのUID待機中...");
+    conn.connected = true;
+    conn.consecutiveFailures = 0;  // 連続失敗カウンターリセット
+    conn.uidReceived = false;      // UID受信フラグリセット
+    conn.serverUid = "";           // UIDクリア
+
+    // Ping/Pong監視の開始
+    schedulerStop(conn.reconnectTimerId);
+    schedulerStop(conn.pongTimeoutTimerId);
+    schedulerStart(conn.pingTimerId, PING_INTERVAL, PING_INTERVAL);
 
     // サブスクリプションはUID受信後に送信（handleWebSocketMessageで処理）
 }
 
 /**
  * @brief WebSocket切断時のコールバック
+ * @param node ノードインデックス
  */
-static void onWebSocketDisconnect() {
-    consoleLog("[WebSocket] 切断（サーバーまたはネットワークにより切断されました）");
-    wsConnected = false;
-    uidReceived = false;  // UID受信フラグリセット
-    serverUid = "";       // UIDクリア
+static void onWebSocketDisconnect(int node) {
+    WsNodeConnection &conn = wsNodes[node];
+    consoleLog(wsTag(node) + " 切断（サーバーまたはネットワークにより切断されました）");
+    conn.connected = false;
+    conn.uidReceived = false;  // UID受信フラグリセット
+    conn.serverUid = "";       // UIDクリア
+
+    // Ping/Pong監視を停止し、再接続タイマーを開始
+    schedulerStop(conn.pingTimerId);
+    schedulerStop(conn.pongTimeoutTimerId);
+    scheduleReconnect(node);
 }
 
 /**
- * @brief WebSocketエラー時のコールバック
- * @param error エラーメッセージ
+ * @brief 再接続タイマーを開始
+ * @param node ノードインデックス
+ * @details 5回連続失敗後は1分間隔（バックオフ）、それ以外は5秒間隔
  */
-static void onWebSocketError(String error) {
-    consoleLog("[WebSocket] エラー: " + error);
+static void scheduleReconnect(int node) {
+    WsNodeConnection &conn = wsNodes[node];
+    unsigned long interval = (conn.consecutiveFailures >= MAX_CONSECUTIVE_FAILURES) ? BACKOFF_INTERVAL : RECONNECT_INTERVAL;
+    schedulerStart(conn.reconnectTimerId, interval);
 }
 
 /**
- * @brief WebSocketサーバーに接続
- * @return 接続成功時true、失敗時false
+ * @brief 再接続タイマーのコールバック
+ * @param arg ノードインデックス
  */
-static bool connectWebSocket() {
-    consoleLog("[WebSocket] 接続試行: " + websocketUrl);
+static void onReconnectTimer(void *arg) {
+    int node = (int)(intptr_t)arg;
+    WsNodeConnection &conn = wsNodes[node];
+    if (conn.connected || conn.client.isConnecting()) {
+        return;
+    }
+
+    // WiFi切断中は接続を試みない（WiFi復帰時にwebSocketOnWiFiConnected()が再開する）
+    if (!isWiFiConnected) {
+        return;
+    }
+
+    // 5回連続失敗後の1分待機をログ出力
+    if (conn.consecutiveFailures >= MAX_CONSECUTIVE_FAILURES) {
+        consoleLog(wsTag(node) + " 5回連続失敗、1分間待機後に再接続試行");
+    }
+
+    // 再接続試行（接続処理はpoll()で進み、結果はOpened/Failedイベントで通知される）
+    if (!connectWebSocket(node)) {
+        scheduleReconnect(node);
+    }
+}
+
+/**
+ * @brief WsClientからのメッセージ受信コールバック
+ * @param arg ノードインデックス（initWebSocket()で登録）
+ * @param data メッセージ本文
+ * @param length メッセージ長
+ */
+static void onClientMessage(void *arg, const char *data, size_t length) {
+    handleWebSocketMessage((int)(intptr_t)arg, data, length);
+}
+
+/**
+ * @brief WsClientからのイベントコールバック
+ * @param arg ノードインデックス（initWebSocket()で登録）
+ * @param event イベント種別
+ */
+static void onClientEvent(void *arg, WsClientEvent event) {
+    int node = (int)(intptr_t)arg;
+    if (event == WsClientEvent::Opened) {
+        onWebSocketConnect(node);
+    } else if (event == WsClientEvent::Failed) {
+        consoleLog(wsTag(node) + " 接続失敗");
+        wsNodes[node].consecutiveFailures++;
+        scheduleReconnect(node);
+    } else if (event == WsClientEvent::Closed) {
+        onWebSocketDisconnect(node);
+    } else if (event == WsClientEvent::GotPing) {
+        consoleLog(wsTag(node) + " Ping受信");
+    } else if (event == WsClientEvent::GotPong) {
+        consoleLog(wsTag(node) + " Pong受信、接続正常");
+        schedulerStop(wsNodes[node].pongTimeoutTimerId);
+    }
+}
+
+/**
+ * @brief WebSocketサーバーへの接続を開始
+ * @param node ノードインデックス
+ * @return 接続を開始した場合true、開始できない場合false
+ * @details 接続処理はwebSocketLoop()のpoll()で進むため、他ノードの受信を止めない
+ */
+static bool connectWebSocket(int node) {
+    WsNodeConnection &conn = wsNodes[node];
+    consoleLog(wsTag(node) + " 接続試行: " + conn.url);
 
     // WebSocket接続（非暗号化、開発環境用）
     // イベントハンドラーはinitWebSocket()で既に登録済み
-    bool connected = webSocketClient.connect(websocketUrl);
-
-    if (!connected) {
-        consoleLog("[WebSocket] 接続失敗");
-        consecutiveFailures++;
+    if (!conn.client.connect(conn.url)) {
+        consoleLog(wsTag(node) + " 接続失敗");
+        conn.consecutiveFailures++;
         return false;
     }
 
@@ -339,42 +530,70 @@ static bool connectWebSocket() {
 
 /**
  * @brief WebSocket切断処理
+ * @param node ノードインデックス
  */
-static void disconnectWebSocket() {
-    if (wsConnected) {
-        consoleLog("[WebSocket] 切断処理");
-        webSocketClient.close();
-        wsConnected = false;
+static void disconnectWebSocket(int node) {
+    WsNodeConnection &conn = wsNodes[node];
+    if (conn.connected) {
+        consoleLog(wsTag(node) + " 切断処理");
+        conn.client.close();
+        conn.connected = false;
+    } else if (conn.client.isConnecting()) {
+        consoleLog(wsTag(node) + " 接続処理を中止");
+        conn.client.close();
     }
 }
 
 /**
- * @brief WebSocket機能を初期化
- * @param config Symbol設定（network, node, address, pubKey）
- * @details WebSocketクライアントのセットアップ、イベントハンドラー登録、重複検出バッファ初期化
+ * @brief ノードURLからWebSocket URLを生成
+ * @param nodeUrl RESTノードURL
+ * @return WebSocket URL
+ * @details 例: "https://sym-test-03.opening-line.jp:3001" -> "ws://sym-test-03.opening-line.jp:3000/ws"
  */
-void initWebSocket(const SymbolConfig &config) {
-    // 状態変数の初期化
-    wsConnected = false;
-    uidReceived = false;
-    serverUid = "";
-    reconnectTimer = 0;
-    consecutiveFailures = 0;
-
-    // WebSocket URL生成（node URLから変換）
-    // 例: "https://sym-test-03.opening-line.jp:3001" -> "ws://sym-test-03.opening-line.jp:3000/ws"
-    websocketUrl = config.node;
-    websocketUrl.replace("https://", "ws://");
-    websocketUrl.replace(":3001", ":3000");  // REST APIポート -> WebSocketポート
-    if (!websocketUrl.endsWith("/ws")) {
+static String buildWebSocketUrl(const String &nodeUrl) {
+    String url = nodeUrl;
+    url.replace("https://", "ws://");
+    url.replace(":3001", ":3000");  // REST APIポート -> WebSocketポート
+    if (!url.endsWith("/ws")) {
         // パスが含まれている場合は除去
-        int pathStart = websocketUrl.indexOf('/', 5);  // "ws://"の後の最初の'/'
+        int pathStart = url.indexOf('/', 5);  // "ws://"の後の最初の'/'
         if (pathStart > 0) {
-            websocketUrl = websocketUrl.substring(0, pathStart);
+            url = url.substring(0, pathStart);
         }
-        websocketUrl += "/ws";
+        url += "/ws";
+    }
+    return url;
+}
+
+/**
+ * @brief WebSocket機能を初期化
+ * @param config Symbol設定（network, node, address, pubKey, hedgeNodes）
+ * @details WebSocketクライアントのセットアップ、イベントハンドラー登録、重複検出バッファ初期化。
+ *          hedgeNodesが設定されている場合は全ノードを並行購読し、先着した通知のみを処理する
+ */
+void initWebSocket(const SymbolConfig &config) {
+    // 接続対象ノードの設定（主ノード + 追加ノード）
+    wsNodeCount = 1 + min(config.hedgeNodeCount, SYMBOL_MAX_HEDGE_NODES);
+    for (int i = 0; i < wsNodeCount; i++) {
+        WsNodeConnection &conn = wsNodes[i];
+
+        // 状態変数の初期化
+        conn.connected = false;
+        conn.uidReceived = false;
+        conn.serverUid = "";
+        conn.consecutiveFailures = 0;
+        conn.firstArrivals = 0;
+        conn.lateArrivals = 0;
+        conn.lateDeltaSumMs = 0;
+        conn.lateDeltaMaxMs = 0;
+
+        // WebSocket URL生成（node URLから変換）
+        conn.url = buildWebSocketUrl(i == 0 ? config.node : config.hedgeNodes[i - 1]);
+        consoleLog(wsTag(i) + " URL設定: " + conn.url);
+    }
+    if (wsNodeCount > 1) {
+        consoleLog("[WebSocket] ヘッジ購読有効: " + String(wsNodeCount) + "ノード");
     }
-    consoleLog("[WebSocket] URL設定: " + websocketUrl);
 
     // サブスクリプション対象アドレス設定
     subscriptionAddress = config.address;
@@ -390,87 +609,92 @@ void initWebSocket(const SymbolConfig &config) {
 
     // 重複検出バッファの初期化（空文字列で初期化）
     for (int i = 0; i < TX_HASH_BUFFER_SIZE; i++) {
-        txHashBuffer[i] = "";
+        txHashBuffer[i].hash = "";
+        txHashBuffer[i].arrivalTime = 0;
+        txHashBuffer[i].firstNode = -1;
+        txHashBuffer[i].seenMask = 0;
     }
     txHashIndex = 0;
 
-    // イベントハンドラー登録（1回のみ、ここで登録）
-    webSocketClient.onMessage([](WebsocketsMessage message) {
-        handleWebSocketMessage(message.data());
-    });
-    webSocketClient.onEvent([](WebsocketsEvent event, String data) {
-        if (event == WebsocketsEvent::ConnectionOpened) {
-            onWebSocketConnect();
-        } else if (event == WebsocketsEvent::ConnectionClosed) {
-            onWebSocketDisconnect();
-        } else if (event == WebsocketsEvent::GotPing) {
-            consoleLog("[WebSocket] Ping受信");
-        } else if (event == WebsocketsEvent::GotPong) {
-            consoleLog("[WebSocket] Pong受信、接続正常");
-            lastPongReceivedTime = millis();
-        }
-    });
+    // イベントハンドラーとタイマー登録（1回のみ、ここで登録）
+    for (int i = 0; i < wsNodeCount; i++) {
+        WsNodeConnection &conn = wsNodes[i];
+        void *nodeArg = (void *)(intptr_t)i;
+        conn.client.setHandlers(onClientMessage, onClientEvent, nodeArg);
+        conn.reconnectTimerId = schedulerCreateTimer("ws-reconnect", onReconnectTimer, nodeArg);
+        conn.pingTimerId = schedulerCreateTimer("ws-ping", onPingTimer, nodeArg);
+        conn.pongTimeoutTimerId = schedulerCreateTimer("ws-pong-timeout", onPongTimeout, nodeArg);
+
+        // 初回接続は次のloop()から、ノードごとに少しずつずらして開始
+        schedulerStart(conn.reconnectTimerId, i * CONNECT_STAGGER_INTERVAL);
+    }
+
+    memoryTimerId = schedulerCreateTimer("ws-memory", monitorMemory);
+    schedulerStart(memoryTimerId, MEMORY_CHECK_INTERVAL, MEMORY_CHECK_INTERVAL);
+    statsTimerId = schedulerCreateTimer("ws-stats", logConnectionStats);
+    schedulerStart(statsTimerId, STATS_INTERVAL, STATS_INTERVAL);
 
     consoleLog("[WebSocket] 初期化完了");
 }
 
 /**
  * @brief WebSocketループ処理（loop()から呼び出し）
- * @details 接続状態確認、メッセージ受信、再接続処理、メモリ監視
+ * @details 接続中ノードのメッセージ受信と、接続処理中ノードの接続処理を行う（いずれもブロックしない）。
+ *          再接続、Ping/Pong監視、メモリ監視、統計出力はスケジューラのタイマーで実行される
  */
 void webSocketLoop() {
-    // WiFi接続チェック
+    // WiFi切断中は受信しない（切断処理はwebSocketOnWiFiDisconnected()で実施済み）
     if (!isWiFiConnected) {
-        // WiFi切断時はWebSocketも切断し、連続失敗カウンターをリセット
-        if (wsConnected) {
-            disconnectWebSocket();
-            consecutiveFailures = 0;
-        }
         return;
     }
 
-    // WebSocket接続状態確認
-    if (!wsConnected) {
-        // 再接続タイマーチェック
-        unsigned long currentTime = millis();
-        unsigned long interval = (consecutiveFailures >= MAX_CONSECUTIVE_FAILURES) ? BACKOFF_INTERVAL : RECONNECT_INTERVAL;
-
-        if (currentTime - reconnectTimer >= interval) {
-            // 5回連続失敗後の1分待機をログ出力
-            if (consecutiveFailures >= MAX_CONSECUTIVE_FAILURES && currentTime - reconnectTimer >= BACKOFF_INTERVAL) {
-                consoleLog("[WebSocket] 5回連続失敗、1分間待機後に再接続試行");
-            }
-
-            // 再接続試行
-            if (connectWebSocket()) {
-                // 接続成功時はonWebSocketConnect()でconsecutiveFailuresがリセットされる
-            } else {
-                // 接続失敗時は再接続タイマーを更新
-                reconnectTimer = currentTime;
-            }
+    // 全ノードをポーリング（先着したメッセージのみhandleWebSocketMessageで処理される）
+    for (int i = 0; i < wsNodeCount; i++) {
+        if (wsNodes[i].connected || wsNodes[i].client.isConnecting()) {
+            wsNodes[i].client.poll();
         }
-    } else {
-        // WebSocket接続中の場合、メッセージをポーリング（常に呼び出す）
-        webSocketClient.poll();
+    }
+}
 
-        // Ping/Pong監視
-        // Ping送信タイミングチェック（60秒経過）
-        if (millis() - lastPingSentTime >= PING_INTERVAL) {
-            sendPing();
+/**
+ * @brief WiFi接続完了を通知
+ * @details 切断中のノードの再接続待ちを打ち切り、次のloop()からノードごとにずらして接続を試行する
+ */
+void webSocketOnWiFiConnected() {
+    for (int i = 0; i < wsNodeCount; i++) {
+        if (!wsNodes[i].connected) {
+            wsNodes[i].consecutiveFailures = 0;
+            schedulerStart(wsNodes[i].reconnectTimerId, i * CONNECT_STAGGER_INTERVAL);
         }
-
-        // Pongタイムアウトチェック
-        checkPongTimeout();
     }
+}
 
-    // メモリ監視（毎回実行）
-    monitorMemory();
+/**
+ * @brief WiFi切断を通知
+ * @details 切断したリンク上での接続試行を避けるため、全ノードを切断して再接続・Ping監視を停止する
+ */
+void webSocketOnWiFiDisconnected() {
+    for (int i = 0; i < wsNodeCount; i++) {
+        WsNodeConnection &conn = wsNodes[i];
+        disconnectWebSocket(i);
+        conn.uidReceived = false;
+        conn.serverUid = "";
+        conn.consecutiveFailures = 0;
+        schedulerStop(conn.reconnectTimerId);
+        schedulerStop(conn.pingTimerId);
+        schedulerStop(conn.pongTimeoutTimerId);
+    }
 }
 
 /**
  * @brief WebSocket接続状態を取得
- * @return 接続中ならtrue、切断中ならfalse
+ * @return いずれかのノードに接続中ならtrue、全ノード切断中ならfalse
  */
 bool getWebSocketConnected() {
-    return wsConnected;
+    for (int i = 0; i < wsNodeCount; i++) {
+        if (wsNodes[i].connected) {
+            return true;
+        }
+    }
+    return false;
 }
@@ -11,20 +11,33 @@
 
 /**
  * @brief WebSocket機能を初期化
- * @param config Symbol設定（network, node, address, pubKey）
- * @details WebSocketクライアントのセットアップ、イベントハンドラー登録、重複検出バッファ初期化
+ * @param config Symbol設定（network, node, address, pubKey, hedgeNodes）
+ * @details WebSocketクライアントのセットアップ、イベントハンドラー登録、重複検出バッファ初期化。
+ *          hedgeNodesが設定されている場合は全ノードを並行購読し、先着した通知のみを処理する
  */
 void initWebSocket(const SymbolConfig &config);
 
 /**
  * @brief WebSocketループ処理（loop()から呼び出し）
- * @details 接続状態確認、メッセージ受信、再接続処理、メモリ監視
+ * @details 接続中ノードのメッセージ受信。再接続、Ping/Pong監視、メモリ監視はスケジューラで実行
  */
 void webSocketLoop();
 
+/**
+ * @brief WiFi接続完了を通知
+ * @details 切断中のノードの再接続待ちを打ち切り、次のloop()で即座に接続を試行する
+ */
+void webSocketOnWiFiConnected();
+
+/**
+ * @brief WiFi切断を通知
+ * @details 全ノードを切断し、再接続・Ping監視を停止する（WiFi復帰時にwebSocketOnWiFiConnected()で再開）
+ */
+void webSocketOnWiFiDisconnected();
+
 /**
  * @brief WebSocket接続状態を取得
- * @return 接続中ならtrue、切断中ならfalse
+ * @return いずれかのノードに接続中ならtrue、全ノード切断中ならfalse
  */
 bool getWebSocketConnected();
 
@@ -0,0 +1,691 @@
+/**
+ * @file wsclient.cpp
+ * @brief 固定長受信バッファを用いた軽量WebSocketクライアントの実装
+ */
+
+#include "wsclient.h"
+#include <esp_system.h>
+#include <mbedtls/version.h>
+#include <mbedtls/sha1.h>
+#include <mbedtls/base64.h>
+#include <lwip/sockets.h>
+
+// 外部依存関数（main.cppで定義）
+extern void consoleLog(String message);
+
+// WebSocket opcode（RFC 6455 5.2）
+static const uint8_t WS_OPCODE_CONTINUATION = 0x0;
+static const uint8_t WS_OPCODE_TEXT = 0x1;
+static const uint8_t WS_OPCODE_BINARY = 0x2;
+static const uint8_t WS_OPCODE_CLOSE = 0x8;
+static const uint8_t WS_OPCODE_PING = 0x9;
+static const uint8_t WS_OPCODE_PONG = 0xA;
+
+// Sec-WebSocket-Accept計算用GUID（RFC 6455 1.3）
+static const char WS_HANDSHAKE_GUID[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+// 送信時のマスク処理用チャンクサイズ（スタック上で処理）
+static const size_t WS_TX_CHUNK_SIZE = 64;
+
+WsClient::WsClient()
+    : connected(false),
+      connectState(CONN_IDLE),
+      connectPhaseStart(0),
+      connectPort(0),
+      dnsStatus(DNS_PENDING),
+      dnsAddress(0),
+      connectFd(-1),
+      handshakeLineLength(0),
+      handshakeStatusChecked(false),
+      handshakeAcceptVerified(false),
+      messageHandler(nullptr),
+      eventHandler(nullptr),
+      handlerArg(nullptr),
+      messageLength(0),
+      messageOpcode(0),
+      messageInProgress(false),
+      messageOverflow(false) {
+    memset(&stats, 0, sizeof(stats));
+    resetRxState();
+}
+
+void WsClient::setHandlers(WsMessageHandler onMessage, WsEventHandler onEvent, void *arg) {
+    messageHandler = onMessage;
+    eventHandler = onEvent;
+    handlerArg = arg;
+}
+
+/**
+ * @brief フレームヘッダー受信状態を初期化
+ */
+void WsClient::resetRxState() {
+    rxState = RX_HEADER;
+    headerLength = 0;
+    headerNeeded = 2;
+    opcode = 0;
+    finalFragment = false;
+    masked = false;
+    payloadLength = 0;
+    payloadReceived = 0;
+}
+
+/**
+ * @brief TCP接続を閉じ、必要であれば切断イベントを通知
+ */
+void WsClient::dropConnection() {
+    bool wasConnected = connected;
+    tcp.stop();
+    connected = false;
+    messageInProgress = false;
+    messageLength = 0;
+    resetRxState();
+
+    if (wasConnected && eventHandler != nullptr) {
+        eventHandler(handlerArg, WsClientEvent::Closed);
+    }
+}
+
+/**
+ * @brief 接続処理を中止（イベントは通知しない）
+ */
+void WsClient::abortConnect() {
+    if (connectFd >= 0) {
+        lwip_close(connectFd);
+        connectFd = -1;
+    }
+    if (connectState != CONN_IDLE) {
+        tcp.stop();
+    }
+    connectState = CONN_IDLE;
+}
+
+/**
+ * @brief 接続処理を失敗として終了し、失敗イベントを通知
+ * @param reason 失敗理由（ログ用）
+ */
+void WsClient::failConnect(const char *reason) {
+    abortConnect();
+    consoleLog("[WsClient] 接続失敗 (" + connectHost + "): " + String(reason));
+    if (eventHandler != nullptr) {
+        eventHandler(handlerArg, WsClientEvent::Failed);
+    }
+}
+
+/**
+ * @brief 名前解決の完了通知（lwIPのタスクから呼ばれる）
+ * @details 中止済み・別ホストの接続処理への遅れた通知は無視する
+ */
+void WsClient::onDnsFound(const char *name, const ip_addr_t *address, void *arg) {
+    WsClient *self = (WsClient *)arg;
+    if (self->connectState != CONN_RESOLVING || self->dnsStatus != DNS_PENDING ||
+        strcmp(name, self->connectHost.c_str()) != 0) {
+        return;
+    }
+    if (address == nullptr || !IP_IS_V4(address)) {
+        self->dnsStatus = DNS_FAILED;
+        return;
+    }
+    self->dnsAddress = ip_2_ip4(address)->addr;
+    self->dnsStatus = DNS_DONE;
+}
+
+/**
+ * @brief ノンブロッキングソケットでTCP接続を開始
+ * @return 接続を開始した場合true
+ */
+bool WsClient::startTcpConnect() {
+    int fd = lwip_socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    lwip_fcntl(fd, F_SETFL, lwip_fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = dnsAddress;
+    address.sin_port = htons(connectPort);
+    if (lwip_connect(fd, (struct sockaddr *)&address, sizeof(address)) < 0 && errno != EINPROGRESS) {
+        lwip_close(fd);
+        return false;
+    }
+
+    connectFd = fd;
+    connectState = CONN_CONNECTING;
+    return true;
+}
+
+/**
+ * @brief ハンドシェイク要求を送信し、期待するSec-WebSocket-Acceptを計算
+ * @return 送信成功時true
+ */
+bool WsClient::sendHandshakeRequest() {
+    // Sec-WebSocket-Key生成（16バイト乱数のBase64）
+    uint8_t nonce[16];
+    for (int i = 0; i < 16; i += 4) {
+        uint32_t r = esp_random();
+        memcpy(nonce + i, &r, 4);
+    }
+    unsigned char key[32];
+    size_t keyLength = 0;
+    mbedtls_base64_encode(key, sizeof(key), &keyLength, nonce, sizeof(nonce));
+    key[keyLength] = '\0';
+
+    // 期待するSec-WebSocket-Accept = Base64(SHA1(key + GUID))
+    unsigned char digest[20];
+    mbedtls_sha1_context sha;
+    mbedtls_sha1_init(&sha);
+#if MBEDTLS_VERSION_MAJOR >= 3
+    mbedtls_sha1_starts(&sha);
+    mbedtls_sha1_update(&sha, key, keyLength);
+    mbedtls_sha1_update(&sha, (const unsigned char *)WS_HANDSHAKE_GUID, sizeof(WS_HANDSHAKE_GUID) - 1);
+    mbedtls_sha1_finish(&sha, digest);
+#else
+    mbedtls_sha1_starts_ret(&sha);
+    mbedtls_sha1_update_ret(&sha, key, keyLength);
+    mbedtls_sha1_update_ret(&sha, (const unsigned char *)WS_HANDSHAKE_GUID, sizeof(WS_HANDSHAKE_GUID) - 1);
+    mbedtls_sha1_finish_ret(&sha, digest);
+#endif
+    mbedtls_sha1_free(&sha);
+    size_t acceptLength = 0;
+    mbedtls_base64_encode((unsigned char *)expectedAccept, sizeof(expectedAccept), &acceptLength, digest, sizeof(digest));
+    expectedAccept[acceptLength] = '\0';
+
+    // ハンドシェイク要求送信（受信バッファを作業領域として使用、接続直後の送信バッファに収まる大きさ）
+    int requestLength = snprintf(rxBuffer, sizeof(rxBuffer),
+                                 "GET %s HTTP/1.1\r\n"
+                                 "Host: %s\r\n"
+                                 "Upgrade: websocket\r\n"
+                                 "Connection: Upgrade\r\n"
+                                 "Sec-WebSocket-Key: %s\r\n"
+                                 "Sec-WebSocket-Version: 13\r\n"
+                                 "\r\n",
+                                 connectPath.c_str(), connectHostPort.c_str(), (const char *)key);
+    if (requestLength <= 0 || (size_t)requestLength >= sizeof(rxBuffer)) {
+        return false;
+    }
+    if (tcp.write((const uint8_t *)rxBuffer, requestLength) != (size_t)requestLength) {
+        return false;
+    }
+
+    handshakeLineLength = 0;
+    handshakeStatusChecked = false;
+    handshakeAcceptVerified = false;
+    return true;
+}
+
+/**
+ * @brief 届いているハンドシェイク応答を読み取り、ステータスとSec-WebSocket-Acceptを検証
+ * @return 検証成功時1、失敗時-1、ヘッダー終端が未着の場合0
+ * @details ヘッダー終端（空行）まで1バイトずつ読み取り、直後に届くフレームを読み過ぎないようにする。
+ *          受信途中の行は次回の呼び出しに持ち越す
+ */
+int WsClient::readHandshakeResponse() {
+    while (tcp.available() > 0) {
+        int c = tcp.read();
+        if (c < 0) {
+            break;
+        }
+        if (c == '\r') {
+            continue;
+        }
+        if (c != '\n') {
+            if (handshakeLineLength < WS_RX_BUFFER_SIZE) {
+                rxBuffer[handshakeLineLength++] = (char)c;
+            }
+            continue;
+        }
+
+        // 1行分を受信
+        rxBuffer[handshakeLineLength] = '\0';
+
+        if (handshakeLineLength == 0) {
+            // 空行: ヘッダー終端
+            return (handshakeStatusChecked && handshakeAcceptVerified) ? 1 : -1;
+        }
+
+        if (!handshakeStatusChecked) {
+            // ステータス行: "HTTP/1.1 101 Switching Protocols"
+            if (strncmp(rxBuffer, "HTTP/1.1 101", 12) != 0) {
+                consoleLog("[WsClient] ハンドシェイク拒否: " + String(rxBuffer));
+                return -1;
+            }
+            handshakeStatusChecked = true;
+        } else if (strncasecmp(rxBuffer, "Sec-WebSocket-Accept:", 21) == 0) {
+            const char *value = rxBuffer + 21;
+            while (*value == ' ') {
+                value++;
+            }
+            handshakeAcceptVerified = (strcmp(value, expectedAccept) == 0);
+            if (!handshakeAcceptVerified) {
+                consoleLog("[WsClient] Sec-WebSocket-Acceptが不一致");
+            }
+        }
+
+        handshakeLineLength = 0;
+    }
+
+    return tcp.connected() ? 0 : -1;
+}
+
+/**
+ * @brief 接続処理を1段階進める（poll()から呼び出し、ブロックしない）
+ * @details 名前解決とTCP接続はWS_CONNECT_TIMEOUT、ハンドシェイク応答はTCP接続完了から
+ *          WS_HANDSHAKE_TIMEOUTで打ち切る
+ */
+void WsClient::stepConnect() {
+    unsigned long elapsed = millis() - connectPhaseStart;
+
+    if (connectState == CONN_RESOLVING) {
+        if (dnsStatus == DNS_FAILED) {
+            failConnect("名前解決に失敗");
+        } else if (dnsStatus == DNS_DONE) {
+            if (!startTcpConnect()) {
+                failConnect("TCP接続を開始できない");
+            }
+        } else if (elapsed >= WS_CONNECT_TIMEOUT) {
+            failConnect("名前解決タイムアウト");
+        }
+        return;
+    }
+
+    if (connectState == CONN_CONNECTING) {
+        // 書き込み可能になれば接続処理が完了（成否はSO_ERRORで判定）
+        fd_set writeSet;
+        FD_ZERO(&writeSet);
+        FD_SET(connectFd, &writeSet);
+        struct timeval noWait = {0, 0};
+        int ready = lwip_select(connectFd + 1, nullptr, &writeSet, nullptr, &noWait);
+        if (ready == 0) {
+            if (elapsed >= WS_CONNECT_TIMEOUT) {
+                failConnect("TCP接続タイムアウト");
+            }
+            return;
+        }
+        int error = 0;
+        socklen_t errorLength = sizeof(error);
+        if (ready < 0 || lwip_getsockopt(connectFd, SOL_SOCKET, SO_ERROR, &error, &errorLength) < 0 || error != 0) {
+            failConnect(("TCP接続に失敗 (errno " + String(error) + ")").c_str());
+            return;
+        }
+
+        // 以降の送受信はWiFiClientに任せる（WiFiClient::connect()と同じくブロッキングに戻す）
+        lwip_fcntl(connectFd, F_SETFL, lwip_fcntl(connectFd, F_GETFL, 0) & ~O_NONBLOCK);
+        tcp = WiFiClient(connectFd);
+        connectFd = -1;
+        tcp.setNoDelay(true);
+        connectState = CONN_HANDSHAKE;
+        connectPhaseStart = millis();
+        if (!sendHandshakeRequest()) {
+            failConnect("ハンドシェイク要求の送信に失敗");
+        }
+        return;
+    }
+
+    // CONN_HANDSHAKE
+    int result = readHandshakeResponse();
+    if (result < 0) {
+        failConnect("ハンドシェイク失敗");
+        return;
+    }
+    if (result == 0) {
+        if (elapsed >= WS_HANDSHAKE_TIMEOUT) {
+            failConnect("ハンドシェイク応答タイムアウト");
+        }
+        return;
+    }
+
+    connectState = CONN_IDLE;
+    connected = true;
+    messageInProgress = false;
+    messageLength = 0;
+    resetRxState();
+
+    if (eventHandler != nullptr) {
+        eventHandler(handlerArg, WsClientEvent::Opened);
+    }
+}
+
+bool WsClient::connect(const String &url) {
+    close();
+
+    // URL解析（"ws://host[:port][/path]"）
+    if (!url.startsWith("ws://")) {
+        consoleLog("[WsClient] 未対応のURL: " + url);
+        return false;
+    }
+    int hostStart = 5;
+    int pathStart = url.indexOf('/', hostStart);
+    connectHostPort = pathStart > 0 ? url.substring(hostStart, pathStart) : url.substring(hostStart);
+    connectPath = pathStart > 0 ? url.substring(pathStart) : String("/");
+
+    connectHost = connectHostPort;
+    connectPort = 80;
+    int colon = connectHostPort.indexOf(':');
+    if (colon > 0) {
+        connectHost = connectHostPort.substring(0, colon);
+        connectPort = (uint16_t)connectHostPort.substring(colon + 1).toInt();
+    }
+
+    // 名前解決（IPアドレス表記またはキャッシュ済みなら即時、それ以外はonDnsFound()で完了）
+    connectState = CONN_RESOLVING;
+    connectPhaseStart = millis();
+    dnsStatus = DNS_PENDING;
+    IPAddress literal;
+    if (literal.fromString(connectHost)) {
+        dnsAddress = (uint32_t)literal;
+        dnsStatus = DNS_DONE;
+    } else {
+        ip_addr_t address;
+        err_t err = dns_gethostbyname(connectHost.c_str(), &address, &WsClient::onDnsFound, this);
+        if (err == ERR_OK) {
+            onDnsFound(connectHost.c_str(), &address, this);
+        } else if (err != ERR_INPROGRESS) {
+            connectState = CONN_IDLE;
+            consoleLog("[WsClient] 名前解決を開始できない: " + connectHost);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief フレームヘッダーの受信完了時の処理
+ * @details 拡張長・マスクキーが必要な場合は追加のヘッダーバイトを要求し、
+ *          揃った時点でペイロード受信状態へ遷移する
+ */
+void WsClient::handleFrameHeader() {
+    if (rxState == RX_HEADER) {
+        finalFragment = (header[0] & 0x80) != 0;
+        opcode = header[0] & 0x0F;
+        masked = (header[1] & 0x80) != 0;
+        uint8_t length7 = header[1] & 0x7F;
+
+        if (length7 == 126) {
+            rxState = RX_EXT_LENGTH;
+            headerNeeded = 4;
+            return;
+        }
+        if (length7 == 127) {
+            rxState = RX_EXT_LENGTH;
+            headerNeeded = 10;
+            return;
+        }
+        payloadLength = length7;
+    } else if (rxState == RX_EXT_LENGTH) {
+        payloadLength = 0;
+        for (uint8_t i = 2; i < headerNeeded; i++) {
+            payloadLength = (payloadLength << 8) | header[i];
+        }
+    }
+
+    if (masked && rxState != RX_MASK) {
+        rxState = RX_MASK;
+        headerNeeded += 4;
+        return;
+    }
+    if (masked) {
+        memcpy(maskKey, header + headerNeeded - 4, 4);
+    }
+
+    // フレーム種別ごとの検証
+    if (opcode >= WS_OPCODE_CLOSE) {
+        if (payloadLength > WS_CONTROL_PAYLOAD_MAX || !finalFragment) {
+            consoleLog("[WsClient] 不正な制御フレーム、切断");
+            dropConnection();
+            return;
+        }
+    } else if (opcode == WS_OPCODE_TEXT || opcode == WS_OPCODE_BINARY) {
+        if (messageInProgress) {
+            consoleLog("[WsClient] 継続フレーム待ちに新規メッセージ、切断");
+            dropConnection();
+            return;
+        }
+        messageInProgress = true;
+        messageOverflow = false;
+        messageLength = 0;
+        messageOpcode = opcode;
+    } else if (opcode == WS_OPCODE_CONTINUATION) {
+        if (!messageInProgress) {
+            consoleLog("[WsClient] 予期しない継続フレーム、切断");
+            dropConnection();
+            return;
+        }
+    } else {
+        consoleLog("[WsClient] 未知のopcode: " + String(opcode) + "、切断");
+        dropConnection();
+        return;
+    }
+
+    // 最大フレーム長の制限（受信バッファに収まらないメッセージは読み捨て）
+    if (opcode < WS_OPCODE_CLOSE && messageLength + payloadLength > WS_RX_BUFFER_SIZE) {
+        messageOverflow = true;
+    }
+
+    rxState = RX_PAYLOAD;
+    payloadReceived = 0;
+    if (payloadLength == 0) {
+        finishFrame();
+    }
+}
+
+/**
+ * @brief 受信したペイロードのマスク解除（サーバーフレームは通常マスクなし）
+ * @param data ペイロード断片
+ * @param length 断片長
+ */
+void WsClient::unmaskPayload(uint8_t *data, size_t length) {
+    if (!masked) {
+        return;
+    }
+    for (size_t i = 0; i < length; i++) {
+        data[i] ^= maskKey[(payloadReceived + i) & 3];
+    }
+}
+
+/**
+ * @brief 1フレーム分のペイロード受信完了時の処理
+ */
+void WsClient::finishFrame() {
+    if (opcode >= WS_OPCODE_CLOSE) {
+        handleControlFrame();
+        if (connected) {
+            resetRxState();
+        }
+        return;
+    }
+
+    if (!messageOverflow) {
+        messageLength += (size_t)payloadLength;
+    }
+
+    if (finalFragment) {
+        messageInProgress = false;
+        if (messageOverflow) {
+            stats.droppedMessages++;
+            consoleLog("[WsClient] メッセージが受信バッファ(" + String(WS_RX_BUFFER_SIZE) + " bytes)を超過、破棄");
+        } else {
+            rxBuffer[messageLength] = '\0';
+            stats.messages++;
+            if (messageLength > stats.maxMessageLength) {
+                stats.maxMessageLength = messageLength;
+            }
+            if (messageOpcode == WS_OPCODE_TEXT && messageHandler != nullptr) {
+                messageHandler(handlerArg, rxBuffer, messageLength);
+            }
+        }
+        messageLength = 0;
+    }
+
+    if (connected) {
+        resetRxState();
+    }
+}
+
+/**
+ * @brief 制御フレーム（Ping/Pong/Close）を即時処理
+ */
+void WsClient::handleControlFrame() {
+    size_t length = (size_t)payloadLength;
+
+    if (opcode == WS_OPCODE_PING) {
+        // 同一ペイロードでPongを返す
+        sendFrame(WS_OPCODE_PONG, controlBuffer, length);
+        if (eventHandler != nullptr) {
+            eventHandler(handlerArg, WsClientEvent::GotPing);
+        }
+    } else if (opcode == WS_OPCODE_PONG) {
+        if (eventHandler != nullptr) {
+            eventHandler(handlerArg, WsClientEvent::GotPong);
+        }
+    } else if (opcode == WS_OPCODE_CLOSE) {
+        // ステータスコードをそのまま返して切断
+        sendFrame(WS_OPCODE_CLOSE, controlBuffer, length >= 2 ? 2 : 0);
+        dropConnection();
+    }
+}
+
+void WsClient::poll() {
+    if (connectState != CONN_IDLE) {
+        stepConnect();
+        return;
+    }
+    if (!connected) {
+        return;
+    }
+
+    unsigned long startMicros = micros();
+
+    while (connected) {
+        int available = tcp.available();
+        if (available <= 0) {
+            if (!tcp.connected()) {
+                dropConnection();
+            }
+            break;
+        }
+
+        if (rxState != RX_PAYLOAD) {
+            // ヘッダー受信
+            size_t want = headerNeeded - headerLength;
+            int n = tcp.read(header + headerLength, min(want, (size_t)available));
+            if (n <= 0) {
+                break;
+            }
+            headerLength += n;
+            if (headerLength == headerNeeded) {
+                handleFrameHeader();
+            }
+            continue;
+        }
+
+        // ペイロード受信（データフレームは受信バッファへ直接書き込み）
+        size_t remaining = (size_t)(payloadLength - payloadReceived);
+        size_t chunk = min(remaining, (size_t)available);
+        uint8_t *dest;
+        if (opcode >= WS_OPCODE_CLOSE) {
+            dest = controlBuffer + payloadReceived;
+        } else if (!messageOverflow) {
+            dest = (uint8_t *)rxBuffer + messageLength + payloadReceived;
+        } else {
+            // 超過メッセージは制御フレーム領域を使って読み捨て
+            dest = controlBuffer;
+            chunk = min(chunk, sizeof(controlBuffer));
+        }
+
+        int n = tcp.read(dest, chunk);
+        if (n <= 0) {
+            break;
+        }
+        unmaskPayload(dest, n);
+        payloadReceived += n;
+
+        if (payloadReceived == payloadLength) {
+            finishFrame();
+        }
+    }
+
+    uint32_t elapsed = micros() - startMicros;
+    stats.pollCount++;
+    stats.pollMicrosTotal += elapsed;
+    if (elapsed > stats.pollMicrosMax) {
+        stats.pollMicrosMax = elapsed;
+    }
+}
+
+/**
+ * @brief フレームを送信（クライアントフレームは必ずマスクする）
+ * @param frameOpcode opcode
+ * @param payload ペイロード
+ * @param length ペイロード長
+ * @return 送信成功時true
+ */
+bool WsClient::sendFrame(uint8_t frameOpcode, const uint8_t *payload, size_t length) {
+    if (!connected) {
+        return false;
+    }
+
+    uint8_t frameHeader[14];
+    size_t headerSize = 0;
+    frameHeader[headerSize++] = 0x80 | frameOpcode;  // FIN + opcode
+
+    if (length < 126) {
+        frameHeader[headerSize++] = 0x80 | (uint8_t)length;
+    } else if (length <= 0xFFFF) {
+        frameHeader[headerSize++] = 0x80 | 126;
+        frameHeader[headerSize++] = (uint8_t)(length >> 8);
+        frameHeader[headerSize++] = (uint8_t)length;
+    } else {
+        frameHeader[headerSize++] = 0x80 | 127;
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            frameHeader[headerSize++] = (uint8_t)((uint64_t)length >> shift);
+        }
+    }
+
+    uint32_t maskValue = esp_random();
+    uint8_t mask[4];
+    memcpy(mask, &maskValue, 4);
+    memcpy(frameHeader + headerSize, mask, 4);
+    headerSize += 4;
+
+    if (tcp.write(frameHeader, headerSize) != headerSize) {
+        return false;
+    }
+
+    // マスク済みペイロードをチャンク単位で送信（ヒープ確保なし）
+    uint8_t chunk[WS_TX_CHUNK_SIZE];
+    size_t sent = 0;
+    while (sent < length) {
+        size_t n = min(length - sent, WS_TX_CHUNK_SIZE);
+        for (size_t i = 0; i < n; i++) {
+            chunk[i] = payload[sent + i] ^ mask[(sent + i) & 3];
+        }
+        if (tcp.write(chunk, n) != n) {
+            return false;
+        }
+        sent += n;
+    }
+    return true;
+}
+
+bool WsClient::send(const String &text) {
+    return sendFrame(WS_OPCODE_TEXT, (const uint8_t *)text.c_str(), text.length());
+}
+
+bool WsClient::ping() {
+    return sendFrame(WS_OPCODE_PING, nullptr, 0);
+}
+
+void WsClient::close() {
+    if (connectState != CONN_IDLE) {
+        abortConnect();
+        return;
+    }
+    if (!connected) {
+        return;
+    }
+    // ステータスコード1000（正常終了）
+    const uint8_t closeCode[2] = {0x03, 0xE8};
+    sendFrame(WS_OPCODE_CLOSE, closeCode, sizeof(closeCode));
+    dropConnection();
+}
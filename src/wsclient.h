@@ -0,0 +1,215 @@
+/**
+ * @file wsclient.h
+ * @brief 固定長受信バッファを用いた軽量WebSocketクライアント（RFC 6455）
+ * @details Symbol blockchainノードの購読専用。メッセージ毎のヒープ確保を行わず、
+ *          フラグメント化されたフレームは受信バッファ上でそのまま再構築する。
+ *          Ping/Pong/Closeの制御フレームはpoll()内で即時処理する。
+ *          接続（名前解決・TCP接続・ハンドシェイク）もpoll()で1段階ずつ進め、loop()をブロックしない
+ */
+
+#ifndef WSCLIENT_H
+#define WSCLIENT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <lwip/dns.h>
+
+// 受信バッファ設定
+#define WS_RX_BUFFER_SIZE 4096        // 1メッセージの最大長（超過メッセージは破棄）
+#define WS_CONTROL_PAYLOAD_MAX 125    // 制御フレームの最大ペイロード長（RFC 6455）
+
+// タイムアウト設定
+#define WS_CONNECT_TIMEOUT 5000       // 名前解決とTCP接続のタイムアウト（ミリ秒）
+#define WS_HANDSHAKE_TIMEOUT 5000     // ハンドシェイク応答タイムアウト（ミリ秒）
+
+/**
+ * @brief WebSocketクライアントのイベント種別
+ */
+enum class WsClientEvent {
+    Opened,   // ハンドシェイク完了
+    Failed,   // 接続失敗（名前解決・TCP接続・ハンドシェイクの失敗またはタイムアウト）
+    Closed,   // 切断（サーバー、ネットワーク、またはclose()）
+    GotPing,  // Ping受信（Pongは自動応答済み）
+    GotPong   // Pong受信
+};
+
+/**
+ * @brief テキストメッセージ受信コールバック
+ * @param arg 登録時に指定したユーザー引数
+ * @param data メッセージ本文（受信バッファへの参照、コールバック内でのみ有効、NUL終端済み）
+ * @param length メッセージ長（バイト）
+ */
+typedef void (*WsMessageHandler)(void *arg, const char *data, size_t length);
+
+/**
+ * @brief イベント通知コールバック
+ * @param arg 登録時に指定したユーザー引数
+ * @param event イベント種別
+ */
+typedef void (*WsEventHandler)(void *arg, WsClientEvent event);
+
+/**
+ * @brief poll()処理コストとメッセージ統計
+ */
+struct WsClientStats {
+    uint32_t pollCount;        // poll()呼び出し回数
+    uint32_t pollMicrosTotal;  // poll()累積処理時間（マイクロ秒）
+    uint32_t pollMicrosMax;    // poll()最大処理時間（マイクロ秒）
+    uint32_t messages;         // 受信メッセージ数
+    uint32_t maxMessageLength; // 最大メッセージ長（バイト）
+    uint32_t droppedMessages;  // バッファ超過により破棄したメッセージ数
+};
+
+/**
+ * @brief 軽量WebSocketクライアント（ws://のみ、テキストメッセージ受信専用）
+ */
+class WsClient {
+public:
+    WsClient();
+
+    /**
+     * @brief コールバックを登録
+     * @param onMessage テキストメッセージ受信コールバック
+     * @param onEvent イベント通知コールバック
+     * @param arg コールバックに渡すユーザー引数
+     */
+    void setHandlers(WsMessageHandler onMessage, WsEventHandler onEvent, void *arg);
+
+    /**
+     * @brief WebSocketサーバーへの接続を開始（ブロックしない）
+     * @param url 接続URL（例: "ws://example.com:3000/ws"）
+     * @return 接続を開始した場合true（URLが不正、または名前解決を開始できない場合false）
+     * @details 以降はpoll()で接続処理を進め、結果をOpened（成功）またはFailed（失敗）イベントで通知する
+     */
+    bool connect(const String &url);
+
+    /**
+     * @brief 接続処理・受信データを処理（loop()から繰り返し呼び出し）
+     * @details 接続中は名前解決・TCP接続・ハンドシェイク応答の完了を確認し、
+     *          接続後は届いているバイトのみを読み取る。いずれもブロックしない
+     */
+    void poll();
+
+    /**
+     * @brief テキストメッセージを送信
+     * @param text 送信する文字列
+     * @return 送信成功時true
+     */
+    bool send(const String &text);
+
+    /**
+     * @brief Pingフレームを送信
+     * @return 送信成功時true
+     */
+    bool ping();
+
+    /**
+     * @brief Closeフレームを送信して切断
+     * @details 接続処理中の場合はイベントを通知せずに中止する
+     */
+    void close();
+
+    /**
+     * @brief 接続状態を取得
+     * @return ハンドシェイク済みで接続中ならtrue
+     */
+    bool isConnected() const { return connected; }
+
+    /**
+     * @brief 接続処理中かを取得
+     * @return connect()の後、OpenedまたはFailedイベントの通知前ならtrue
+     */
+    bool isConnecting() const { return connectState != CONN_IDLE; }
+
+    /**
+     * @brief poll()処理コストとメッセージ統計を取得
+     */
+    const WsClientStats &getStats() const { return stats; }
+
+private:
+    // 接続処理の状態
+    enum ConnectState : uint8_t {
+        CONN_IDLE,        // 接続処理なし（未接続または接続済み）
+        CONN_RESOLVING,   // 名前解決中
+        CONN_CONNECTING,  // TCP接続中（ノンブロッキングソケット）
+        CONN_HANDSHAKE    // ハンドシェイク応答待ち
+    };
+
+    // 名前解決の結果（lwIPのDNSコールバックから設定）
+    enum DnsStatus : uint8_t {
+        DNS_PENDING,
+        DNS_DONE,
+        DNS_FAILED
+    };
+
+    // フレーム受信状態
+    enum RxState : uint8_t {
+        RX_HEADER,     // 基本ヘッダー（2バイト）待ち
+        RX_EXT_LENGTH, // 拡張ペイロード長待ち
+        RX_MASK,       // マスクキー待ち（サーバーフレームでは通常なし）
+        RX_PAYLOAD     // ペイロード受信中
+    };
+
+    static void onDnsFound(const char *name, const ip_addr_t *address, void *arg);
+    void stepConnect();
+    bool startTcpConnect();
+    bool sendHandshakeRequest();
+    int readHandshakeResponse();
+    void failConnect(const char *reason);
+    void abortConnect();
+    bool sendFrame(uint8_t opcode, const uint8_t *payload, size_t length);
+    void handleFrameHeader();
+    void unmaskPayload(uint8_t *data, size_t length);
+    void finishFrame();
+    void handleControlFrame();
+    void resetRxState();
+    void dropConnection();
+
+    WiFiClient tcp;
+    bool connected;
+
+    // 接続処理
+    ConnectState connectState;
+    unsigned long connectPhaseStart;   // 現在の段階の開始時刻（millis、タイムアウト判定用）
+    String connectHost;                // 接続先ホスト名
+    String connectHostPort;            // Hostヘッダーの値（"host[:port]"）
+    String connectPath;                // 要求パス
+    uint16_t connectPort;              // 接続先ポート
+    volatile DnsStatus dnsStatus;      // 名前解決の結果
+    volatile uint32_t dnsAddress;      // 解決したIPv4アドレス（ネットワークバイトオーダー）
+    int connectFd;                     // TCP接続中のソケット（-1はなし、接続後はtcpが保持）
+    char expectedAccept[32];           // 期待するSec-WebSocket-Accept値
+    size_t handshakeLineLength;        // 受信中の応答行の長さ
+    bool handshakeStatusChecked;       // ステータス行（101）を確認済みか
+    bool handshakeAcceptVerified;      // Sec-WebSocket-Acceptを検証済みか
+
+    WsMessageHandler messageHandler;
+    WsEventHandler eventHandler;
+    void *handlerArg;
+
+    // 受信状態
+    RxState rxState;
+    uint8_t header[14];          // フレームヘッダー作業領域
+    uint8_t headerLength;        // 受信済みヘッダーバイト数
+    uint8_t headerNeeded;        // 現在の状態で必要なヘッダーバイト数
+    uint8_t opcode;              // 現在のフレームのopcode
+    bool finalFragment;          // FINビット
+    bool masked;                 // MASKビット
+    uint8_t maskKey[4];          // マスクキー
+    uint64_t payloadLength;      // 現在のフレームのペイロード長
+    uint64_t payloadReceived;    // 受信済みペイロード長
+
+    // データメッセージ再構築（受信バッファ上で連結、+1はNUL終端用）
+    char rxBuffer[WS_RX_BUFFER_SIZE + 1];
+    size_t messageLength;        // 再構築中のメッセージ長
+    uint8_t messageOpcode;       // 再構築中のメッセージのopcode（テキスト/バイナリ）
+    bool messageInProgress;      // 継続フレーム待ち
+    bool messageOverflow;        // バッファ超過（メッセージ完了時に破棄）
+
+    // 制御フレーム（データメッセージの途中にも挿入され得るため別領域）
+    uint8_t controlBuffer[WS_CONTROL_PAYLOAD_MAX];
+
+    WsClientStats stats;
+};
+
+#endif // WSCLIENT_H
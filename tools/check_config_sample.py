@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+"""config.ini.sampleが実機の設定読み込みの制限内に収まるかを確認する。
+
+ファイルサイズ（src/network.hのCONFIG_FILE_MAX_SIZE）を超えると読み込み全体が失敗して
+すべての設定がデフォルト値になり、1行の長さ（src/config.hのCONFIG_LINE_MAX）を超えると行末が切り捨てられる。
+config.ini.sampleを編集したときに手動で実行する（ビルドには組み込まない）。
+
+使い方: python3 tools/check_config_sample.py
+"""
+
+import os
+import re
+import sys
+
+
+def read_define(path, name):
+    with open(path, encoding="utf-8") as f:
+        match = re.search(r"^#define\s+" + name + r"\s+(\d+)", f.read(), re.MULTILINE)
+    if match is None:
+        raise SystemExit(f"{path}: {name}が見つからない")
+    return int(match.group(1))
+
+
+def check(root):
+    sample = os.path.join(root, "config.ini.sample")
+    max_size = read_define(os.path.join(root, "src", "network.h"), "CONFIG_FILE_MAX_SIZE")
+    line_max = read_define(os.path.join(root, "src", "config.h"), "CONFIG_LINE_MAX")
+
+    with open(sample, "rb") as f:
+        data = f.read()
+    errors = []
+    if len(data) > max_size:
+        errors.append(f"サイズ{len(data)}バイトがCONFIG_FILE_MAX_SIZE({max_size})を超過")
+    for number, line in enumerate(data.split(b"\n"), 1):
+        # 行バッファは終端の'\0'を含むため、格納できるのはCONFIG_LINE_MAX - 1バイトまで
+        if len(line.rstrip(b"\r")) > line_max - 1:
+            errors.append(f"{number}行目が{len(line)}バイト（CONFIG_LINE_MAX - 1 = {line_max - 1}を超過）")
+
+    for error in errors:
+        print(f"config.ini.sample: {error}", file=sys.stderr)
+    if not errors:
+        print(f"config.ini.sample: {len(data)}/{max_size}バイト、OK")
+    return not errors
+
+
+if __name__ == "__main__":
+    sys.exit(0 if check(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")) else 1)
@@ -0,0 +1,336 @@
+#!/usr/bin/env python3
+"""日本の海岸線データ（src/coastline_data.h）を生成する。
+
+海岸線の折れ線（緯度・経度）をDouglas-Peucker法で簡略化し、0.01度単位に量子化して
+始点の絶対座標と、以降の点の差分（int8の緯度・経度の組）で出力する。
+差分がint8に収まらない区間は中間点を補って分割する。
+
+既定では本スクリプトに内蔵した主要な島の概形（約1km精度の手作業の簡略化、地図表示用）を使う。
+Natural Earthなどの海岸線GeoJSON（LineString/Polygon、経度・緯度の順）を指定すると、
+表示範囲内の線をそこから生成する。
+
+使い方:
+    python3 tools/gen_coastline.py > src/coastline_data.h
+    python3 tools/gen_coastline.py --geojson ne_10m_coastline.geojson > src/coastline_data.h
+    python3 tools/gen_coastline.py --preview /tmp/coastline.pgm > /dev/null  # 投影結果の確認用画像
+"""
+
+import argparse
+import json
+import math
+import sys
+
+UNITS_PER_DEGREE = 100      # 座標の量子化単位（0.01度）
+TOLERANCE_DEG = 0.04        # 簡略化の許容誤差（度、地図表示で0.5ピクセル未満）
+MIN_EXTENT_DEG = 0.15       # これより小さい島は出力しない（地図上で1ピクセル程度）
+BOUNDS = (24.0, 46.0, 122.0, 149.0)  # 出力範囲（緯度下限, 緯度上限, 経度下限, 経度上限）
+
+# 地図の投影（src/epicentermap.cppと同じ値、--previewでのみ使用）
+MAP_WIDTH = 320
+MAP_HEIGHT = 210
+MAP_LAT_TOP = 46.0
+MAP_LON_LEFT = 110.0
+MAP_PIXELS_PER_DEGREE = 9.5
+MAP_REFERENCE_LAT = 36.0
+
+# 内蔵の海岸線（緯度, 経度）、各島は閉じた折れ線（始点を繰り返さない）
+BUILTIN_ISLANDS = {
+    "北海道": [
+        (45.52, 141.94), (44.94, 142.58), (44.36, 143.35), (44.02, 144.27), (43.91, 144.67),
+        (44.34, 145.33), (44.02, 145.19), (43.66, 145.13), (43.33, 145.58), (43.38, 145.82),
+        (43.08, 145.12), (42.98, 144.38), (42.28, 143.32), (41.92, 143.25), (42.16, 142.77),
+        (42.33, 142.37), (42.63, 141.60), (42.32, 140.97), (42.47, 140.86), (42.25, 140.27),
+        (42.11, 140.58), (42.03, 140.82), (41.81, 141.18), (41.77, 140.73), (41.40, 140.20),
+        (41.43, 140.10), (41.87, 140.13), (42.45, 139.85), (42.70, 140.06), (42.79, 140.23),
+        (42.98, 140.51), (43.33, 140.35), (43.20, 140.78), (43.19, 141.00), (43.24, 141.35),
+        (43.85, 141.52), (43.94, 141.64), (44.36, 141.70), (44.88, 141.74), (45.41, 141.67),
+    ],
+    "本州": [
+        # 津軽半島から太平洋側を南下
+        (41.26, 140.35), (41.04, 140.64), (40.83, 140.74), (40.90, 140.86), (40.87, 141.13),
+        (41.25, 141.15), (41.15, 140.80), (41.54, 140.91), (41.43, 141.46), (40.97, 141.38),
+        (40.52, 141.53), (40.19, 141.80), (39.64, 141.98), (39.55, 142.07), (39.27, 141.89),
+        (39.06, 141.73), (38.90, 141.58), (38.29, 141.51), (38.42, 141.30), (38.26, 141.02),
+        (37.80, 140.96), (36.95, 140.90), (36.59, 140.66), (36.31, 140.58), (35.70, 140.87),
+        (35.25, 140.40), (34.90, 139.89), (35.00, 139.84), (35.31, 139.79), (35.58, 140.07),
+        (35.63, 139.80), (35.45, 139.65), (35.14, 139.63), (35.30, 139.48), (35.25, 139.16),
+        (35.10, 139.08), (34.96, 139.10), (34.60, 138.85), (34.75, 138.77), (34.97, 138.77),
+        (35.10, 138.86), (34.97, 138.40), (34.60, 138.22), (34.66, 137.73), (34.58, 137.02),
+        (34.69, 136.93), (35.05, 136.85), (34.96, 136.63), (34.72, 136.52), (34.48, 136.85),
+        (34.27, 136.90), (34.07, 136.20), (33.72, 135.99), (33.43, 135.76), (33.68, 135.34),
+        (33.88, 135.15), (34.23, 135.15), (34.57, 135.45), (34.68, 135.43), (34.68, 135.18),
+        (34.64, 134.99), (34.77, 134.68), (34.62, 134.15), (34.48, 133.95), (34.45, 133.38),
+        (34.40, 133.20), (34.39, 133.08), (34.23, 132.56), (34.35, 132.45), (34.17, 132.23),
+        (33.96, 132.11), (34.03, 131.80), (34.03, 131.57), (33.93, 131.25), (33.96, 130.93),
+        # 関門海峡から日本海側を北上
+        (34.08, 130.90), (34.38, 131.18), (34.42, 131.40), (34.68, 131.84), (34.90, 132.07),
+        (35.43, 132.63), (35.57, 133.05), (35.54, 133.23), (35.45, 133.33), (35.54, 134.22),
+        (35.64, 134.62), (35.78, 135.22), (35.50, 135.38), (35.66, 136.06), (35.95, 135.97),
+        (36.22, 136.15), (36.60, 136.60), (36.90, 136.77), (37.30, 136.72), (37.40, 136.90),
+        (37.53, 137.35), (37.05, 136.98), (36.85, 136.99), (36.76, 137.22), (37.04, 137.86),
+        (37.18, 138.25), (37.37, 138.55), (37.93, 139.05), (38.22, 139.47), (38.56, 139.55),
+        (38.92, 139.82), (39.21, 139.90), (39.72, 140.05), (39.98, 139.70), (40.10, 139.98),
+        (40.20, 140.03), (40.60, 139.85), (40.78, 140.20), (41.00, 140.28), (41.13, 140.29),
+    ],
+    "四国": [
+        (34.18, 134.62), (34.07, 134.58), (33.83, 134.75), (33.25, 134.18), (33.50, 133.57),
+        (33.38, 133.28), (32.72, 133.02), (32.92, 132.70), (33.22, 132.56), (33.46, 132.42),
+        (33.34, 132.02), (33.50, 132.38), (33.85, 132.70), (34.07, 133.00), (33.97, 133.28),
+        (34.12, 133.65), (34.30, 133.80), (34.35, 134.05), (34.23, 134.40),
+    ],
+    "九州": [
+        (33.95, 130.96), (33.72, 131.00), (33.60, 131.20), (33.60, 131.70), (33.28, 131.50),
+        (33.25, 131.65), (33.25, 131.88), (32.95, 131.95), (32.58, 131.70), (32.42, 131.65),
+        (31.90, 131.47), (31.37, 131.35), (31.47, 131.10), (31.00, 130.66), (31.40, 130.80),
+        (31.58, 130.57), (31.23, 130.65), (31.27, 130.30), (31.72, 130.27), (32.02, 130.19),
+        (32.20, 130.38), (32.50, 130.58), (32.62, 130.47), (32.78, 130.60), (32.98, 130.43),
+        (33.15, 130.38), (33.18, 130.20), (33.10, 130.12), (32.85, 130.10), (32.78, 130.37),
+        (32.60, 130.19), (32.72, 130.20), (32.73, 129.87), (32.58, 129.75), (32.95, 129.70),
+        (33.18, 129.70), (33.35, 129.55), (33.30, 129.85), (33.48, 129.98), (33.60, 130.15),
+        (33.60, 130.40), (33.85, 130.50), (33.92, 130.75),
+    ],
+    "佐渡島": [
+        (38.33, 138.50), (38.20, 138.55), (37.82, 138.28), (37.85, 138.22), (38.08, 138.22),
+        (38.30, 138.37),
+    ],
+    "淡路島": [
+        (34.60, 134.98), (34.35, 134.87), (34.22, 134.70), (34.40, 134.78),
+    ],
+    "種子島": [
+        (30.83, 131.05), (30.45, 130.98), (30.37, 130.88), (30.72, 130.95),
+    ],
+    "屋久島": [
+        (30.45, 130.50), (30.28, 130.65), (30.23, 130.45), (30.35, 130.38),
+    ],
+    "奄美大島": [
+        (28.52, 129.70), (28.35, 129.55), (28.12, 129.25), (28.30, 129.35), (28.45, 129.50),
+    ],
+    "沖縄本島": [
+        (26.87, 128.26), (26.59, 127.97), (26.70, 127.88), (26.44, 127.71), (26.21, 127.67),
+        (26.12, 127.66), (26.17, 127.82), (26.30, 127.90), (26.48, 127.98), (26.70, 128.20),
+    ],
+    "宮古島": [
+        (24.93, 125.28), (24.72, 125.45), (24.73, 125.25),
+    ],
+    "石垣島": [
+        (24.60, 124.30), (24.33, 124.25), (24.40, 124.10),
+    ],
+}
+
+
+def perpendicular_distance(point, start, end):
+    """点から線分までの距離（度、経度方向は基準緯度のcosで補正）"""
+    scale = math.cos(math.radians(MAP_REFERENCE_LAT))
+    px, py = point[1] * scale, point[0]
+    ax, ay = start[1] * scale, start[0]
+    bx, by = end[1] * scale, end[0]
+    dx, dy = bx - ax, by - ay
+    length2 = dx * dx + dy * dy
+    if length2 == 0:
+        return math.hypot(px - ax, py - ay)
+    t = max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / length2))
+    return math.hypot(px - (ax + t * dx), py - (ay + t * dy))
+
+
+def simplify(points, tolerance):
+    """Douglas-Peucker法で折れ線を簡略化（始点・終点は残す）"""
+    if len(points) < 3:
+        return list(points)
+    keep = [False] * len(points)
+    keep[0] = keep[-1] = True
+    stack = [(0, len(points) - 1)]
+    while stack:
+        first, last = stack.pop()
+        best, index = 0.0, None
+        for i in range(first + 1, last):
+            d = perpendicular_distance(points[i], points[first], points[last])
+            if d > best:
+                best, index = d, i
+        if index is not None and best > tolerance:
+            keep[index] = True
+            stack.append((first, index))
+            stack.append((index, last))
+    return [p for p, k in zip(points, keep) if k]
+
+
+def extent(points):
+    lats = [p[0] for p in points]
+    lons = [p[1] for p in points]
+    return max(max(lats) - min(lats), max(lons) - min(lons))
+
+
+def in_bounds(point):
+    return BOUNDS[0] <= point[0] <= BOUNDS[1] and BOUNDS[2] <= point[1] <= BOUNDS[3]
+
+
+def load_builtin():
+    lines = []
+    for name, points in BUILTIN_ISLANDS.items():
+        lines.append((name, points + [points[0]]))
+    return lines
+
+
+def load_geojson(path):
+    """GeoJSONの線を読み込み、出力範囲外で分割した折れ線のリストを返す"""
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    features = data["features"] if data.get("type") == "FeatureCollection" else [data]
+    rings = []
+    for feature in features:
+        geometry = feature.get("geometry") or feature
+        kind = geometry["type"]
+        coords = geometry["coordinates"]
+        if kind == "LineString":
+            rings.append(coords)
+        elif kind in ("MultiLineString", "Polygon"):
+            rings.extend(coords)
+        elif kind == "MultiPolygon":
+            for polygon in coords:
+                rings.extend(polygon)
+    lines = []
+    for ring in rings:
+        current = []
+        for lon, lat in ((c[0], c[1]) for c in ring):
+            if in_bounds((lat, lon)):
+                current.append((lat, lon))
+            elif current:
+                lines.append(("", current))
+                current = []
+        if current:
+            lines.append(("", current))
+    return lines
+
+
+def quantize(points):
+    """0.01度単位に量子化し、連続する重複点を除く"""
+    result = []
+    for lat, lon in points:
+        q = (int(round(lat * UNITS_PER_DEGREE)), int(round(lon * UNITS_PER_DEGREE)))
+        if not result or result[-1] != q:
+            result.append(q)
+    return result
+
+
+def encode(points):
+    """始点と、int8に収まるよう分割した差分の列に符号化"""
+    deltas = []
+    for (lat0, lon0), (lat1, lon1) in zip(points, points[1:]):
+        steps = max(1, math.ceil(max(abs(lat1 - lat0), abs(lon1 - lon0)) / 127))
+        prev_lat, prev_lon = lat0, lon0
+        for s in range(1, steps + 1):
+            lat = lat0 + round((lat1 - lat0) * s / steps)
+            lon = lon0 + round((lon1 - lon0) * s / steps)
+            deltas.append((lat - prev_lat, lon - prev_lon))
+            prev_lat, prev_lon = lat, lon
+    return points[0], deltas
+
+
+def build(lines):
+    polylines = []
+    for name, points in lines:
+        if len(points) < 2 or extent(points) < MIN_EXTENT_DEG:
+            continue
+        quantized = quantize(simplify(points, TOLERANCE_DEG))
+        if len(quantized) < 2:
+            continue
+        start, deltas = encode(quantized)
+        polylines.append((name, start, deltas))
+    return polylines
+
+
+def project(lat100, lon100):
+    """src/epicentermap.cppの固定小数点投影と同じ計算"""
+    scale_x = int(round(MAP_PIXELS_PER_DEGREE * math.cos(math.radians(MAP_REFERENCE_LAT)) / UNITS_PER_DEGREE * 65536))
+    scale_y = int(round(MAP_PIXELS_PER_DEGREE / UNITS_PER_DEGREE * 65536))
+    x = ((lon100 - int(MAP_LON_LEFT * UNITS_PER_DEGREE)) * scale_x) >> 16
+    y = ((int(MAP_LAT_TOP * UNITS_PER_DEGREE) - lat100) * scale_y) >> 16
+    return x, y
+
+
+def write_preview(path, polylines):
+    """投影した海岸線をPGM画像に描画（生成結果の目視確認用）"""
+    pixels = bytearray(MAP_WIDTH * MAP_HEIGHT)
+    for _, (lat, lon), deltas in polylines:
+        x0, y0 = project(lat, lon)
+        for dlat, dlon in deltas:
+            lat += dlat
+            lon += dlon
+            x1, y1 = project(lat, lon)
+            steps = max(abs(x1 - x0), abs(y1 - y0), 1)
+            for s in range(steps + 1):
+                x = x0 + round((x1 - x0) * s / steps)
+                y = y0 + round((y1 - y0) * s / steps)
+                if 0 <= x < MAP_WIDTH and 0 <= y < MAP_HEIGHT:
+                    pixels[y * MAP_WIDTH + x] = 255
+            x0, y0 = x1, y1
+    with open(path, "wb") as f:
+        f.write(f"P5\n{MAP_WIDTH} {MAP_HEIGHT}\n255\n".encode())
+        f.write(pixels)
+
+
+def emit(polylines, source):
+    points = sum(len(deltas) + 1 for _, _, deltas in polylines)
+    out = []
+    out.append("/**")
+    out.append(" * @file coastline_data.h")
+    out.append(" * @brief 日本の海岸線データ（tools/gen_coastline.pyで生成、手動で編集しないこと）")
+    out.append(f" * @details 出典: {source}。緯度・経度は0.01度単位。")
+    out.append(" *          各折れ線は始点の絶対座標と、COASTLINE_DELTASの差分（緯度, 経度の順のint8の組）で表す")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef COASTLINE_DATA_H")
+    out.append("#define COASTLINE_DATA_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append(f"#define COASTLINE_POLYLINE_COUNT {len(polylines)}  // 折れ線の数")
+    out.append(f"#define COASTLINE_POINT_COUNT {points}   // 点の総数（始点を含む）")
+    out.append("")
+    out.append("/**")
+    out.append(" * @brief 海岸線の折れ線（始点と差分列の位置）")
+    out.append(" */")
+    out.append("struct CoastlinePolyline {")
+    out.append("    int16_t lat;         // 始点の緯度（0.01度）")
+    out.append("    int16_t lon;         // 始点の経度（0.01度）")
+    out.append("    uint16_t offset;     // COASTLINE_DELTASでの差分の開始位置（組の番号）")
+    out.append("    uint16_t count;      // 差分の組の数（線分の数）")
+    out.append("};")
+    out.append("")
+    out.append("static const CoastlinePolyline COASTLINE_POLYLINES[COASTLINE_POLYLINE_COUNT] = {")
+    offset = 0
+    for name, (lat, lon), deltas in polylines:
+        comment = f"  // {name}" if name else ""
+        out.append(f"    {{{lat}, {lon}, {offset}, {len(deltas)}}},{comment}")
+        offset += len(deltas)
+    out.append("};")
+    out.append("")
+    out.append(f"static const int8_t COASTLINE_DELTAS[{offset} * 2] = {{")
+    flat = [v for _, _, deltas in polylines for d in deltas for v in d]
+    for i in range(0, len(flat), 24):
+        out.append("    " + ",".join(str(v) for v in flat[i:i + 24]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("#endif // COASTLINE_DATA_H")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--geojson", help="海岸線のGeoJSON（省略時は内蔵の概形）")
+    parser.add_argument("--preview", help="投影した海岸線を書き出すPGM画像のパス")
+    args = parser.parse_args()
+
+    if args.geojson:
+        lines = load_geojson(args.geojson)
+        source = args.geojson.rsplit("/", 1)[-1]
+    else:
+        lines = load_builtin()
+        source = "tools/gen_coastline.pyに内蔵した主要な島の概形"
+    polylines = build(lines)
+    if args.preview:
+        write_preview(args.preview, polylines)
+    sys.stdout.write(emit(polylines, source))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""揺れ検知のホストテスト用の合成加速度波形（host/traces/*.bin）を生成する。
+
+本機の波形記録（waveform.cpp）と同じ形式（"EQWF"ヘッダー + 3軸int16のmg、100Hz）で、
+トリガー前4秒の静穏部分に続けて、P波（高周波・小振幅）とS波（低周波・大振幅、指数減衰）を重ねる。
+ヘッダーのpreSamples（トリガーサンプルの位置）にはP波の到達サンプルを書く。
+合成波形であり観測記録ではない。本機で記録したファイル（SDカードの/waveform/*.bin）も同じディレクトリに置けば入力できる。
+
+使い方: python3 tools/gen_traces.py [出力ディレクトリ（既定: host/traces）]
+"""
+
+import math
+import os
+import random
+import struct
+import sys
+
+SAMPLE_RATE_HZ = 100
+PRE_SECONDS = 4
+GRAVITY_MG = 1000
+MAGIC = 0x46575145  # "EQWF"
+VERSION = 1
+
+# 名前: (静穏時のノイズmg, P波振幅mg, P波周波数Hz, S波の遅れ秒, S波振幅mg, S波周波数Hz, 減衰の時定数秒, 記録秒数)
+TRACES = {
+    "quiet": (1.5, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 30),
+    "moderate": (1.5, 6.0, 6.0, 4.0, 30.0, 3.0, 4.0, 30),
+    "strong": (1.5, 40.0, 5.0, 3.0, 380.0, 2.0, 8.0, 40),
+}
+
+
+def synthesize(name, params):
+    noise, p_amp, p_freq, s_delay, s_amp, s_freq, decay, seconds = params
+    rng = random.Random(name)
+    pre = PRE_SECONDS * SAMPLE_RATE_HZ
+    total = seconds * SAMPLE_RATE_HZ
+    samples = []
+    for n in range(total):
+        t = (n - pre) / SAMPLE_RATE_HZ  # P波の到達からの秒数
+        axes = [rng.gauss(0.0, noise) for _ in range(3)]
+        axes[2] += GRAVITY_MG
+        if t >= 0 and p_amp > 0:
+            # P波は上下動が大きく、S波は水平動が大きい
+            envelope = math.exp(-t / decay) * min(1.0, t / 0.2)
+            phase = 2 * math.pi * p_freq * t
+            axes[0] += 0.4 * p_amp * envelope * math.sin(phase)
+            axes[1] += 0.3 * p_amp * envelope * math.cos(phase * 1.1)
+            axes[2] += p_amp * envelope * math.sin(phase * 0.9)
+        if t >= s_delay and s_amp > 0:
+            ts = t - s_delay
+            envelope = math.exp(-ts / decay) * min(1.0, ts / 0.5)
+            phase = 2 * math.pi * s_freq * ts
+            axes[0] += s_amp * envelope * math.sin(phase)
+            axes[1] += 0.7 * s_amp * envelope * math.sin(phase * 1.3 + 1.0)
+            axes[2] += 0.3 * s_amp * envelope * math.sin(phase * 0.8)
+        samples.append([max(-8000, min(8000, int(round(a)))) for a in axes])
+    return pre, samples
+
+
+def write_trace(path, pre, samples):
+    # waveform.cppのWaveformHeaderと同じ配置（32バイト、リトルエンディアン）
+    header = struct.pack("<IBBHIHBBIIII", MAGIC, VERSION, 0, SAMPLE_RATE_HZ, 0, 0, 3, 0, pre, len(samples), 0, 0)
+    with open(path, "wb") as out:
+        out.write(header)
+        for x, y, z in samples:
+            out.write(struct.pack("<hhh", x, y, z))
+
+
+def main():
+    directory = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), "..", "host", "traces")
+    os.makedirs(directory, exist_ok=True)
+    for name, params in TRACES.items():
+        pre, samples = synthesize(name, params)
+        write_trace(os.path.join(directory, name + ".bin"), pre, samples)
+
+
+if __name__ == "__main__":
+    main()
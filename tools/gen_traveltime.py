@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""P波・S波の走時表（src/traveltime_table.h）を生成する。
+
+1次元速度構造（ak135の上部マントルまでを折れ線で近似）を地球平坦化変換し、
+2km厚の水平成層として射線パラメータを走査して初動走時を求める。
+震央距離0〜2000km（10km間隔）×震源深さ0〜700km（10km間隔）の走時を0.1秒単位で出力する。
+
+使い方: python3 tools/gen_traveltime.py > src/traveltime_table.h
+"""
+
+import math
+import sys
+
+EARTH_RADIUS_KM = 6371.0
+LAYER_KM = 2.0
+MODEL_BOTTOM_KM = 1400.0
+DISTANCE_STEP_KM = 10
+DISTANCE_COUNT = 201
+DEPTH_STEP_KM = 10
+DEPTH_COUNT = 71
+RAY_SAMPLES = 6000
+
+# (深さkm, Vp km/s, Vs km/s)、同じ深さを2回書くと不連続面
+MODEL = [
+    (0.0, 5.80, 3.46),
+    (20.0, 5.80, 3.46),
+    (20.0, 6.50, 3.85),
+    (35.0, 6.50, 3.85),
+    (35.0, 8.04, 4.48),
+    (120.0, 8.05, 4.50),
+    (210.0, 8.30, 4.52),
+    (410.0, 9.03, 4.87),
+    (410.0, 9.36, 5.08),
+    (660.0, 10.20, 5.61),
+    (660.0, 10.79, 5.96),
+    (760.0, 11.06, 6.21),
+    (1400.0, 11.80, 6.50),
+]
+
+
+def velocity(depth, phase):
+    """折れ線モデルから深さの速度を求める（不連続面では下側の値）"""
+    column = 1 if phase == "P" else 2
+    for upper, lower in zip(MODEL, MODEL[1:]):
+        if upper[0] <= depth < lower[0]:
+            if lower[0] == upper[0]:
+                continue
+            ratio = (depth - upper[0]) / (lower[0] - upper[0])
+            return upper[column] + (lower[column] - upper[column]) * ratio
+    return MODEL[-1][column]
+
+
+def flattened_layers(phase):
+    """平坦化した水平成層（厚さ、速度）のリスト（上から順）"""
+    layers = []
+    depth = 0.0
+    while depth < MODEL_BOTTOM_KM:
+        top = depth
+        bottom = depth + LAYER_KM
+        mid = (top + bottom) / 2
+        top_f = -EARTH_RADIUS_KM * math.log((EARTH_RADIUS_KM - top) / EARTH_RADIUS_KM)
+        bottom_f = -EARTH_RADIUS_KM * math.log((EARTH_RADIUS_KM - bottom) / EARTH_RADIUS_KM)
+        v_f = velocity(mid, phase) * EARTH_RADIUS_KM / (EARTH_RADIUS_KM - mid)
+        layers.append((bottom_f - top_f, v_f))
+        depth = bottom
+    return layers
+
+
+def ray_sums(layers, p):
+    """射線パラメータpの累積距離・走時（各層の下面まで）と、射線が反転する層の番号"""
+    xs = [0.0]
+    ts = [0.0]
+    for index, (thickness, v) in enumerate(layers):
+        pv = p * v
+        if pv >= 1.0:
+            return xs, ts, index
+        cosine = math.sqrt(1.0 - pv * pv)
+        xs.append(xs[-1] + thickness * pv / cosine)
+        ts.append(ts[-1] + thickness / (v * cosine))
+    return xs, ts, None
+
+
+def first_arrivals(phase):
+    layers = flattened_layers(phase)
+    layers_per_depth = int(DEPTH_STEP_KM / LAYER_KM)
+    p_max = 1.0 / layers[0][1]
+    # 等間隔の走査に加え、各層でちょうど反転する射線も含める（速度勾配の小さい上部マントルでは
+    # pのわずかな差で反転深さが大きく変わり、等間隔だけでは震央距離に抜けが生じるため）
+    rays = {p_max * i / RAY_SAMPLES for i in range(RAY_SAMPLES)}
+    rays.update((1.0 - 1e-9) / v for _, v in layers)
+    sums = [ray_sums(layers, p) for p in sorted(rays)]
+
+    table = []
+    for depth_index in range(DEPTH_COUNT):
+        source = depth_index * layers_per_depth
+        best = [math.inf] * DISTANCE_COUNT
+        # 上向き（直達）と下向き（反転して戻る）の2つの枝
+        for branch in ("up", "down"):
+            points = []
+            for xs, ts, turn in sums:
+                reach = len(xs) - 1 if turn is None else turn
+                if reach < source:
+                    continue
+                if branch == "up":
+                    points.append((xs[source], ts[source]))
+                elif turn is not None and turn > source:
+                    points.append((2 * xs[turn] - xs[source], 2 * ts[turn] - ts[source]))
+            for (x0, t0), (x1, t1) in zip(points, points[1:]):
+                low, high = min(x0, x1), max(x0, x1)
+                first = math.ceil(low / DISTANCE_STEP_KM)
+                last = min(int(high // DISTANCE_STEP_KM), DISTANCE_COUNT - 1)
+                for k in range(first, last + 1):
+                    x = k * DISTANCE_STEP_KM
+                    t = t0 if x1 == x0 else t0 + (t1 - t0) * (x - x0) / (x1 - x0)
+                    if t < best[k]:
+                        best[k] = t
+        # 震源と観測点を結ぶ直線経路（平坦化座標）の走時も候補とする（フェルマーの原理により初動走時の上限、
+        # 震源近傍と、水平に近い射線が走査で得られない浅い震源で有効）
+        depth_f = sum(thickness for thickness, _ in layers[:source])
+        slowness = sum(thickness / v for thickness, v in layers[:source]) / depth_f if source > 0 else 1.0 / layers[0][1]
+        for k in range(DISTANCE_COUNT):
+            line = math.hypot(k * DISTANCE_STEP_KM, depth_f) * slowness
+            if line < best[k]:
+                best[k] = line
+        table.append([int(round(t * 10)) for t in best])
+    return table
+
+
+def emit(name, table):
+    lines = [f"static const uint16_t {name}[TRAVELTIME_DEPTH_COUNT][TRAVELTIME_DISTANCE_COUNT] = {{"]
+    for row in table:
+        values = ",".join(str(v) for v in row)
+        lines.append(f"    {{{values}}},")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    p_table = first_arrivals("P")
+    s_table = first_arrivals("S")
+    out = sys.stdout
+    out.write("/**\n")
+    out.write(" * @file traveltime_table.h\n")
+    out.write(" * @brief P波・S波の走時表（tools/gen_traveltime.pyで生成、手動で編集しないこと）\n")
+    out.write(" * @details 1次元速度構造（ak135の上部マントルまでを折れ線で近似）の初動走時。\n")
+    out.write(" *          [震源深さ][震央距離]の0.1秒単位\n")
+    out.write(" */\n\n")
+    out.write("#ifndef TRAVELTIME_TABLE_H\n#define TRAVELTIME_TABLE_H\n\n#include <stdint.h>\n\n")
+    out.write(f"#define TRAVELTIME_DISTANCE_STEP_KM {DISTANCE_STEP_KM}  // 震央距離の間隔（km）\n")
+    out.write(f"#define TRAVELTIME_DISTANCE_COUNT {DISTANCE_COUNT}   // 震央距離の点数（0〜{DISTANCE_STEP_KM * (DISTANCE_COUNT - 1)}km）\n")
+    out.write(f"#define TRAVELTIME_DEPTH_STEP_KM {DEPTH_STEP_KM}     // 震源深さの間隔（km）\n")
+    out.write(f"#define TRAVELTIME_DEPTH_COUNT {DEPTH_COUNT}       // 震源深さの点数（0〜{DEPTH_STEP_KM * (DEPTH_COUNT - 1)}km）\n\n")
+    out.write(emit("TRAVELTIME_P", p_table) + "\n\n")
+    out.write(emit("TRAVELTIME_S", s_table) + "\n\n")
+    out.write("#endif // TRAVELTIME_TABLE_H\n")
+
+
+if __name__ == "__main__":
+    main()